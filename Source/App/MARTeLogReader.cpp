@@ -0,0 +1,139 @@
+/**
+ * @file MARTeLogReader.cpp
+ * @brief Source file for class MARTeLogReader
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MARTeLogReader (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/**
+ * @brief Decodes a ring log file written by the RingFileLogger and prints its records, from the oldest to the newest, to the standard output.
+ * @details Usage: MARTeLogReader.ex FILENAME [FORMAT [PRINTKEYS]], where FORMAT and PRINTKEYS are as described in LoggerConsumerI::LoadPrintPreferences
+ * (default FORMAT is EtOCFfm and default PRINTKEYS is 1).
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "LoggerConsumerI.h"
+#include "RingFileLogReader.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief LoggerConsumerI which prints the log pages to the standard output.
+ */
+class LogReaderPrinter: public LoggerConsumerI {
+public:
+    /**
+     * @brief Loads the print preferences from \a data (see LoggerConsumerI::LoadPrintPreferences).
+     * @param[in] data the print preferences.
+     * @return true if the preferences are valid.
+     */
+    bool Configure(StructuredDataI &data) {
+        return LoadPrintPreferences(data);
+    }
+
+    /**
+     * @brief Prints \a logPage to the standard output.
+     * @param[in] logPage the log page to print.
+     */
+    virtual void ConsumeLogMessage(LoggerPage *logPage) {
+        StreamString line;
+        PrintToStream(logPage, line);
+        (void) printf("%s\n", line.Buffer());
+    }
+};
+}
+
+/**
+ * @brief The error processing function for the main program.
+ * @param[in] errorInfo information about the error.
+ * @param[in] errorDescription error textual description.
+ */
+void MainErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo, const char * const errorDescription) {
+    MARTe::StreamString errorCodeStr;
+    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+    (void) fprintf(stderr, "[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Main function.
+ * @param[in] argc the number of arguments.
+ * @param[in] argv FILENAME [FORMAT [PRINTKEYS]].
+ * @return 0 if the file was successfully decoded.
+ */
+int main(int argc, char **argv) {
+    using namespace MARTe;
+    SetErrorProcessFunction(&MainErrorProcessFunction);
+
+    bool ok = ((argc > 1) && (argc < 5));
+    if (!ok) {
+        (void) fprintf(stderr, "Usage: %s FILENAME [FORMAT [PRINTKEYS]]\n", argv[0]);
+    }
+    LogReaderPrinter printer;
+    if (ok) {
+        ConfigurationDatabase printPreferences;
+        ok = printPreferences.Write("Format", (argc > 2) ? argv[2] : "EtOCFfm");
+        if ((ok) && (argc > 3)) {
+            ok = printPreferences.Write("PrintKeys", argv[3]);
+        }
+        if (ok) {
+            ok = printer.Configure(printPreferences);
+        }
+    }
+    RingFileLogReader reader;
+    if (ok) {
+        ok = reader.Open(argv[1]);
+    }
+    if (ok) {
+        LoggerPage page;
+        bool firstRecord = true;
+        uint64 nOfRead = 0u;
+        while (reader.Read(page)) {
+            if ((firstRecord) && (reader.GetSequence() > 0u)) {
+                (void) printf("[%llu older records were overwritten]\n", static_cast<unsigned long long>(reader.GetSequence()));
+            }
+            firstRecord = false;
+            printer.ConsumeLogMessage(&page);
+            nOfRead++;
+        }
+        //The last record read must be the last record written.
+        uint64 nOfRecords = reader.GetNumberOfRecords();
+        if (nOfRecords > 0u) {
+            ok = ((nOfRead > 0u) && ((reader.GetSequence() + 1u) == nOfRecords));
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Stopped at an invalid record after reading %u records", static_cast<uint32>(nOfRead));
+            }
+        }
+    }
+    return ok ? 0 : -1;
+}
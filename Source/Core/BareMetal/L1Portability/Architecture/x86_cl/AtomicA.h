@@ -101,6 +101,22 @@ inline bool TestAndSet(volatile int8 *p) {
     return _InterlockedCompareExchange8(pp, 1, 0) == 0;
 }
 
+inline bool CompareAndSwap(volatile int32 *p,
+                           int32 expected,
+                           int32 desired) {
+    volatile long* pp = (volatile long *) p;
+    //returns the initial value of *pp
+    return _InterlockedCompareExchange(pp, desired, expected) == expected;
+}
+
+inline bool CompareAndSwap(volatile int64 *p,
+                           int64 expected,
+                           int64 desired) {
+    volatile __int64* pp = (volatile __int64 *) p;
+    //returns the initial value of *pp
+    return _InterlockedCompareExchange64(pp, desired, expected) == expected;
+}
+
 inline void Add(volatile int32 *p,
                 int32 value) {
 
@@ -114,6 +130,10 @@ inline void Sub(volatile int32 *p,
     _InterlockedExchangeAdd(pp, -value);
 }
 
+inline void Pause() {
+    _mm_pause();
+}
+
 }
 }
 #endif /* ATOMICA_H_ */
@@ -151,6 +151,26 @@ inline bool TestAndSet(volatile int8 *p) {
 #endif
 }
 
+inline bool CompareAndSwap(volatile int32 *p,
+                           int32 expected,
+                           int32 desired) {
+#if GCC_VERSION > 40700
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return __sync_bool_compare_and_swap(p, expected, desired);
+#endif
+}
+
+inline bool CompareAndSwap(volatile int64 *p,
+                           int64 expected,
+                           int64 desired) {
+#if GCC_VERSION > 40700
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return __sync_bool_compare_and_swap(p, expected, desired);
+#endif
+}
+
 inline void Add(volatile int32 *p, int32 value) {
 #if GCC_VERSION > 40700
     __atomic_add_fetch(p, value, __ATOMIC_SEQ_CST);
@@ -176,6 +196,10 @@ inline void Sub(volatile int32 *p, int32 value) {
 #endif
 }
 
+inline void Pause() {
+    asm volatile ("pause" ::: "memory");
+}
+
 }
 
 }
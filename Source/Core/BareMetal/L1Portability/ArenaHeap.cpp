@@ -0,0 +1,222 @@
+/**
+ * @file ArenaHeap.cpp
+ * @brief Source file for class ArenaHeap
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeap (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeap.h"
+#include "Atomic.h"
+#include "GlobalObjectsDatabase.h"
+#include "HeapManager.h"
+#include "MemoryLock.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ArenaHeap::ArenaHeap() :
+        HeapI() {
+    memory = NULL_PTR(void *);
+    arena = NULL_PTR(uint8 *);
+    memorySize = 0u;
+    arenaSize = 0u;
+    usedSize = 0;
+    memoryLocked = false;
+    heapName[0] = '\0';
+}
+
+ArenaHeap::~ArenaHeap() {
+    if (memory != NULL_PTR(void *)) {
+        (void) HeapManager::RemoveHeap(this);
+        if (memoryLocked) {
+            (void) MemoryLock::Unlock(memory, memorySize);
+        }
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(memory);
+    }
+    arena = NULL_PTR(uint8 *);
+}
+
+bool ArenaHeap::Create(const char8 * const heapName,
+                       const uint32 size,
+                       const bool lockMemory) {
+    bool ok = (memory == NULL_PTR(void *));
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "ArenaHeap: Create can only be called once");
+    }
+    if (ok) {
+        //The offset is a signed 32 bit integer
+        ok = ((heapName != NULL_PTR(const char8 *)) && (size > 0u) && (size < 0x7FFFFFF0u));
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "ArenaHeap: the name shall be set and the size shall be > 0 and < 2 GB");
+        }
+    }
+    if (ok) {
+        //Room to align the start of the arena
+        memorySize = size + ArenaHeapAlignment;
+        memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize);
+        ok = (memory != NULL_PTR(void *));
+    }
+    if (ok) {
+        MemoryLock::PreFault(memory, memorySize);
+        /*lint -e{9091} -e{923} the casting from pointer type to integer type is required to align the arena*/
+        uintp misalignment = reinterpret_cast<uintp>(memory) % ArenaHeapAlignment;
+        uint32 alignmentOffset = (misalignment == 0u) ? (0u) : (ArenaHeapAlignment - static_cast<uint32>(misalignment));
+        arena = &(reinterpret_cast<uint8 *>(memory)[alignmentOffset]);
+        arenaSize = memorySize - alignmentOffset;
+        usedSize = 0;
+        if (lockMemory) {
+            memoryLocked = MemoryLock::Lock(memory, memorySize);
+            if (!memoryLocked) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ArenaHeap: could not lock the memory");
+            }
+        }
+        (void) StringHelper::CopyN(&this->heapName[0], heapName, static_cast<uint32>(sizeof(this->heapName) - 1u));
+        this->heapName[sizeof(this->heapName) - 1u] = '\0';
+        ok = HeapManager::AddHeap(this);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ArenaHeap: could not register the heap in the HeapManager");
+        }
+    }
+    return ok;
+}
+
+void *ArenaHeap::Malloc(const uint32 size) {
+    void *allocated = NULL_PTR(void *);
+    if ((size > 0u) && (size < arenaSize)) {
+        //Header with the size followed by the data, rounded up to keep the next allocation aligned
+        uint32 totalSize = ArenaHeapAlignment + (((size + ArenaHeapAlignment) - 1u) & ~(ArenaHeapAlignment - 1u));
+        bool done = false;
+        while (!done) {
+            int32 offset = usedSize;
+            uint32 newOffset = static_cast<uint32>(offset) + totalSize;
+            if (newOffset > arenaSize) {
+                done = true;
+            }
+            else {
+                done = Atomic::CompareAndSwap(&usedSize, offset, static_cast<int32>(newOffset));
+                if (done) {
+                    uint8 *header = &arena[offset];
+                    *reinterpret_cast<uint32 *>(header) = size;
+                    allocated = reinterpret_cast<void *>(&header[ArenaHeapAlignment]);
+                }
+            }
+        }
+    }
+    if ((allocated == NULL_PTR(void *)) && (size > 0u)) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "ArenaHeap: Failed Malloc(). The arena is exhausted");
+    }
+    return allocated;
+}
+
+void ArenaHeap::Free(void *&data) {
+    data = NULL_PTR(void *);
+}
+
+void *ArenaHeap::Realloc(void *&data,
+                         const uint32 newSize) {
+    if (data == NULL) {
+        data = ArenaHeap::Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        ArenaHeap::Free(data);
+    }
+    else {
+        uint8 *header = &(reinterpret_cast<uint8 *>(data)[-static_cast<int32>(ArenaHeapAlignment)]);
+        uint32 oldSize = *reinterpret_cast<uint32 *>(header);
+        if (oldSize < newSize) {
+            void *newData = ArenaHeap::Malloc(newSize);
+            if (newData != NULL) {
+                (void) MemoryOperationsHelper::Copy(newData, data, oldSize);
+            }
+            data = newData;
+        }
+    }
+    return data;
+}
+
+void *ArenaHeap::Duplicate(const void * const data,
+                           uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = ArenaHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp ArenaHeap::FirstAddress() const {
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required
+     * in order to be able to return the range of addresses provided by this heap*/
+    return reinterpret_cast<uintp>(arena);
+}
+
+uintp ArenaHeap::LastAddress() const {
+    uintp lastAddress = 0u;
+    if (arena != NULL_PTR(uint8 *)) {
+        /*lint -e{9091} -e{923} see FirstAddress*/
+        lastAddress = (reinterpret_cast<uintp>(arena) + arenaSize) - 1u;
+    }
+    return lastAddress;
+}
+
+const char8 *ArenaHeap::Name() const {
+    return &heapName[0];
+}
+
+void ArenaHeap::Reset() {
+    (void) Atomic::Exchange(&usedSize, 0);
+}
+
+uint32 ArenaHeap::GetSize() const {
+    return arenaSize;
+}
+
+uint32 ArenaHeap::GetUsedSize() const {
+    return static_cast<uint32>(usedSize);
+}
+
+bool ArenaHeap::IsMemoryLocked() const {
+    return memoryLocked;
+}
+
+}
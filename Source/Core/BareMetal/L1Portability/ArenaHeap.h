@@ -0,0 +1,205 @@
+/**
+ * @file ArenaHeap.h
+ * @brief Header file for class ArenaHeap
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENAHEAP_H_
+#define ARENAHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The alignment of the memory returned by an ArenaHeap. Each allocation is preceded by a header of this size.
+ */
+static const uint32 ArenaHeapAlignment = 16u;
+
+/**
+ * @brief A HeapI which serves allocations by incrementing an offset in a preallocated memory area (bump allocator).
+ * @details Malloc is lock-free (the offset is updated with Atomic::CompareAndSwap) and never calls the operating
+ * system. Free does not reclaim the memory: all the memory is reclaimed at once by Reset. This fits data whose lifetime
+ * is bounded by a well defined phase (e.g. objects created while configuring a state and destroyed with it).
+ *
+ * The memory can be pre-faulted and locked (see MemoryLock) so that accessing it never causes a page fault.
+ *
+ * Create registers the heap in the HeapManager, so that it can be found by name and selected for the construction
+ * of objects (e.g. ObjectBuilder::Build or ReferenceT(className, heap)).
+ */
+class DLL_API ArenaHeap: public HeapI {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    ArenaHeap();
+
+    /**
+     * @brief Destructor. Removes the heap from the HeapManager and frees the memory.
+     * @pre No memory allocated from this heap is still in use.
+     */
+    virtual ~ArenaHeap();
+
+    /**
+     * @brief Allocates the arena memory and registers the heap in the HeapManager.
+     * @param[in] heapName the name of the heap (truncated to 31 characters).
+     * @param[in] size the size of the arena in bytes.
+     * @param[in] lockMemory if true the memory is locked in physical memory. A failure to lock is reported as a warning.
+     * @return true if the memory could be allocated and the heap registered in the HeapManager.
+     * @pre Create was not yet called.
+     */
+    bool Create(const char8 * const heapName,
+                const uint32 size,
+                const bool lockMemory);
+
+    /**
+     * @brief Allocates \a size bytes (aligned to ArenaHeapAlignment) from the arena.
+     * @param[in] size The size in byte of the memory to allocate.
+     * @return The pointer to the allocated memory. NULL if size is zero or if the arena is exhausted.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief Sets \a data to NULL. The memory is only reclaimed by Reset.
+     * @param[in,out] data The memory area to be freed.
+     * @post data = NULL
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Reallocates a memory area.
+     * @details The same memory is returned if it is large enough for \a newSize, otherwise the content is copied to a new area.
+     * @param[in,out] data The pointer to the new memory block.
+     * @param[in] newSize The size of the new memory block.
+     * @return The pointer to the new data block. NULL if reallocation failed.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @brief Duplicates a memory section into a new area of this heap.
+     * @param[in] data The pointer to the memory which must be copied.
+     * @param[in] size size of memory to allocate. if size = 0 then memory is copied until a zero is found (included)
+     * @return The pointer to the new allocated memory which contains a copy of data.
+     */
+    /*lint -e(1735) the derived classes shall use this default parameter or no default parameter at all*/
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @brief Returns the start of the arena memory.
+     * @return The start of the arena memory.
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @brief Returns the end (inclusive) of the arena memory.
+     * @return The end (inclusive) of the arena memory.
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Returns the name of the heap
+     * @return The name of the heap
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Reclaims all the memory of the arena.
+     * @pre No memory allocated from this heap is still in use.
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the size of the arena.
+     * @return the size of the arena in bytes.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Gets the number of bytes already allocated (including headers and alignment).
+     * @return the number of bytes already allocated.
+     */
+    uint32 GetUsedSize() const;
+
+    /**
+     * @brief Returns true if the memory is locked in physical memory.
+     * @return true if the memory is locked in physical memory.
+     */
+    bool IsMemoryLocked() const;
+
+private:
+
+    /**
+     * The arena memory.
+     */
+    void *memory;
+
+    /**
+     * The first aligned address of the arena memory.
+     */
+    uint8 *arena;
+
+    /**
+     * The size of the memory.
+     */
+    uint32 memorySize;
+
+    /**
+     * The usable size of the arena (from arena).
+     */
+    uint32 arenaSize;
+
+    /**
+     * The offset of the next allocation.
+     */
+    volatile int32 usedSize;
+
+    /**
+     * True if the memory is locked.
+     */
+    bool memoryLocked;
+
+    /**
+     * The heap name.
+     */
+    char8 heapName[32];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENAHEAP_H_ */
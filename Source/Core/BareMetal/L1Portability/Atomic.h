@@ -119,6 +119,27 @@ namespace MARTe {
          */
         inline bool TestAndSet(volatile int8 *p);
 
+        /**
+         * @brief Atomically compares a 32 bit memory location with an expected value and, if equal, replaces it.
+         * @param[in,out] p the pointer to the 32 bit variable which must be compared and swapped.
+         * @param[in] expected the value that *p must hold for the swap to happen.
+         * @param[in] desired the value to store in *p if *p == expected.
+         * @return true if *p was equal to \a expected and was set to \a desired.
+         * @pre p != NULL.
+         */
+        inline bool CompareAndSwap(volatile int32 *p, int32 expected, int32 desired);
+
+        /**
+         * @brief Atomically compares a 64 bit memory location with an expected value and, if equal, replaces it.
+         * @details Allows to update an index and a version tag in a single operation (e.g. to avoid the ABA problem in lock-free lists).
+         * @param[in,out] p the pointer to the 64 bit variable which must be compared and swapped. It must be 8 byte aligned.
+         * @param[in] expected the value that *p must hold for the swap to happen.
+         * @param[in] desired the value to store in *p if *p == expected.
+         * @return true if *p was equal to \a expected and was set to \a desired.
+         * @pre p != NULL.
+         */
+        inline bool CompareAndSwap(volatile int64 *p, int64 expected, int64 desired);
+
         /**
          * @brief Atomically adds two 32 bit integers.
          * @param[in,out] p the pointer to the variable which must be incremented.
@@ -135,6 +156,13 @@ namespace MARTe {
          */
         inline void Sub (volatile int32 *p, int32 value);
 
+        /**
+         * @brief Hints the processor that the caller is inside a spin-wait loop.
+         * @details Reduces the power consumption and the pipeline flush penalty paid
+         * when the spin-wait loop exits (e.g. the x86 pause instruction).
+         */
+        inline void Pause();
+
     }
 
 }
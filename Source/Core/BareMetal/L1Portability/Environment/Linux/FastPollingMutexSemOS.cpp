@@ -0,0 +1,75 @@
+/**
+ * @file FastPollingMutexSemOS.cpp
+ * @brief Source file for class FastPollingMutexSem
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the operating system
+ * specific methods of the class FastPollingMutexSem (thread parking).
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/*lint -e{9130} -e{9117} -e{970} -e{923} the futex system call requires the native types.*/
+void FastPollingMutexSem::OsPark(volatile int32 * const address,
+                                 const int32 value,
+                                 const uint64 timeoutTicks) {
+    struct timespec tspec;
+    struct timespec *tspecPtr = static_cast<struct timespec *>(NULL);
+    if (timeoutTicks > 0u) {
+        float64 nanoSeconds = static_cast<float64>(timeoutTicks) * HighResolutionTimer::Period() * 1e9;
+        uint64 nanoSecondsU = static_cast<uint64>(nanoSeconds);
+        tspec.tv_sec = static_cast<time_t>(nanoSecondsU / 1000000000u);
+        tspec.tv_nsec = static_cast<long>(nanoSecondsU % 1000000000u);
+        tspecPtr = &tspec;
+    }
+    //The kernel only parks if *address is still equal to value (otherwise EAGAIN). EINTR and ETIMEDOUT are handled by the caller re-checking the lock.
+    (void) syscall(SYS_futex, const_cast<int32 *>(address), FUTEX_WAIT_PRIVATE, value, tspecPtr, NULL, 0);
+}
+
+/*lint -e{9130} -e{970} -e{923} the futex system call requires the native types.*/
+void FastPollingMutexSem::OsUnPark(volatile int32 * const address) {
+    (void) syscall(SYS_futex, const_cast<int32 *>(address), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+}
@@ -30,6 +30,7 @@
 #include <math.h>
 #include <errno.h>
 #include <unistd.h>
+#include <time.h>
 #else
 #include "lint-linux.h"
 #endif
@@ -71,6 +72,25 @@ void Sleep::OsUsleep(const uint32 usecTime) {
 
 }
 
+void Sleep::UntilCounter(const uint64 counterTicks) {
+    int64 deltaTicks = static_cast<int64>(counterTicks - HighResolutionTimer::Counter());
+    if (deltaTicks > 0) {
+        struct timespec wakeTime;
+        if (clock_gettime(CLOCK_MONOTONIC, &wakeTime) == 0) {
+            /*lint -e{9122} conversion from float to integer allowed*/
+            uint64 deltaNSec = static_cast<uint64>(static_cast<float64>(deltaTicks) * HighResolutionTimer::Period() * 1e9);
+            uint64 nSec = static_cast<uint64>(wakeTime.tv_nsec) + deltaNSec;
+            wakeTime.tv_sec += static_cast<time_t>(nSec / 1000000000u);
+            wakeTime.tv_nsec = static_cast<long>(nSec % 1000000000u);
+            //The wake-up time is absolute, so that it can be safely reissued if interrupted.
+            int32 err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, static_cast<struct timespec *>(NULL));
+            while (err == EINTR) {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, static_cast<struct timespec *>(NULL));
+            }
+        }
+    }
+}
+
 int32 Sleep::GetDateSeconds() {
     return static_cast<int32>(time(static_cast<time_t *>(NULL)));
 }
@@ -0,0 +1,65 @@
+/**
+ * @file FastPollingMutexSemOS.cpp
+ * @brief Source file for class FastPollingMutexSem
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the operating system
+ * specific methods of the class FastPollingMutexSem (thread parking).
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void FastPollingMutexSem::OsPark(volatile int32 * const address,
+                                 const int32 value,
+                                 const uint64 timeoutTicks) {
+    //No address based wait available in the supported Windows versions. Yield the CPU and let the caller re-check the lock.
+    if (*address == value) {
+        float64 maxSleep = 1e-3;
+        if (timeoutTicks > 0u) {
+            float64 timeoutSec = static_cast<float64>(timeoutTicks) * HighResolutionTimer::Period();
+            if (timeoutSec < maxSleep) {
+                maxSleep = timeoutSec;
+            }
+        }
+        Sleep::Sec(maxSleep);
+    }
+}
+
+/*lint -e{715} the parked threads re-check the lock autonomously.*/
+void FastPollingMutexSem::OsUnPark(volatile int32 * const address) {
+}
+
+}
@@ -0,0 +1,106 @@
+/**
+ * @file MemoryLock.cpp
+ * @brief Source file for module MemoryLock
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module MemoryLock (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <windows.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryLock.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace MemoryLock {
+
+bool Lock(const void * const address,
+          const uint32 size) {
+    bool ok = (address != NULL);
+    if (ok) {
+        ok = (VirtualLock(const_cast<void *>(address), static_cast<SIZE_T>(size)) != 0);
+    }
+    return ok;
+}
+
+bool Unlock(const void * const address,
+            const uint32 size) {
+    bool ok = (address != NULL);
+    if (ok) {
+        ok = (VirtualUnlock(const_cast<void *>(address), static_cast<SIZE_T>(size)) != 0);
+    }
+    return ok;
+}
+
+void PreFault(void * const address,
+              const uint32 size) {
+    if (address != NULL) {
+        (void) MemoryOperationsHelper::Set(address, '\0', size);
+    }
+}
+
+void Touch(const void * const address,
+           const uint32 size) {
+    if ((address != NULL) && (size > 0u)) {
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        uint32 pageSize = static_cast<uint32>(systemInfo.dwPageSize);
+        if (pageSize == 0u) {
+            pageSize = 4096u;
+        }
+        const volatile char8 *bytes = reinterpret_cast<const volatile char8 *>(address);
+        char8 value = '\0';
+        for (uint64 i = 0u; i < size; i += pageSize) {
+            value = bytes[i];
+        }
+        value = bytes[size - 1u];
+        (void) value;
+    }
+}
+
+bool LockAll() {
+    //There is no process wide equivalent of mlockall in Windows.
+    return false;
+}
+
+bool UnlockAll() {
+    return false;
+}
+
+}
+
+}
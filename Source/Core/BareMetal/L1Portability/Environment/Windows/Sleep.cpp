@@ -63,6 +63,14 @@ void Sleep::OsUsleep(const uint32 usecTime) {
     //(void)usleep(usecTime);
 }
 
+void Sleep::UntilCounter(const uint64 counterTicks) {
+    int64 deltaTicks = static_cast<int64>(counterTicks - HighResolutionTimer::Counter());
+    if (deltaTicks > 0) {
+        //No absolute sleep available. Sleep the remaining time, truncated to the Sleep resolution so that the deadline is not overshot.
+        OsUsleep(static_cast<uint32>(static_cast<float64>(deltaTicks) * HighResolutionTimer::Period() * 1e6));
+    }
+}
+
 
 
 }
@@ -46,14 +46,18 @@ namespace MARTe {
 FastPollingMutexSem::FastPollingMutexSem() {
     internalFlag = 0;
     flag = &internalFlag;
+    adaptive = false;
 }
 
 FastPollingMutexSem::FastPollingMutexSem(volatile int32 &externalFlag) {
     internalFlag = 0;
     flag = &externalFlag;
+    adaptive = false;
 }
 
-void FastPollingMutexSem::Create(const bool locked) {
+void FastPollingMutexSem::Create(const bool locked,
+                                 const bool adaptive) {
+    this->adaptive = adaptive;
     if (locked) {
         *flag = 1;
     }
@@ -62,45 +66,96 @@ void FastPollingMutexSem::Create(const bool locked) {
     }
 }
 
+bool FastPollingMutexSem::IsAdaptive() const {
+    return adaptive;
+}
+
 bool FastPollingMutexSem::Locked() const {
-    return *flag == 1;
+    return *flag != 0;
 }
 
 ErrorManagement::ErrorType FastPollingMutexSem::FastLock(const TimeoutType &timeout,
                                                          float32 sleepTime ) {
-    uint64 ticksStop = timeout.HighResolutionTimerTicks();
-    ticksStop += HighResolutionTimer::Counter();
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
-
-    // sets the default if it is negative
-    if (sleepTime < 0.0F) {
-        sleepTime = 1e-3F;
+    if (adaptive) {
+        err = FastLockAdaptive(timeout);
     }
-    bool noSleep = IsEqual(sleepTime, 0.0);
-
-    while (!Atomic::TestAndSet(flag)) {
-        if (timeout != TTInfiniteWait) {
-            uint64 ticks = HighResolutionTimer::Counter();
-            if (ticks > ticksStop) {
-                err = ErrorManagement::Timeout;
-                REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
-                break;
-            }
+    else {
+        uint64 ticksStop = timeout.HighResolutionTimerTicks();
+        ticksStop += HighResolutionTimer::Counter();
+
+        // sets the default if it is negative
+        if (sleepTime < 0.0F) {
+            sleepTime = 1e-3F;
         }
+        bool noSleep = IsEqual(sleepTime, 0.0);
+
+        while (!Atomic::TestAndSet(flag)) {
+            if (timeout != TTInfiniteWait) {
+                uint64 ticks = HighResolutionTimer::Counter();
+                if (ticks > ticksStop) {
+                    err = ErrorManagement::Timeout;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
+                    break;
+                }
+            }
 
-        if (!noSleep) {
-            Sleep::Sec(sleepTime);
+            if (!noSleep) {
+                Sleep::Sec(sleepTime);
+            }
         }
     }
     return err;
 }
 
 bool FastPollingMutexSem::FastTryLock() {
-    return (Atomic::TestAndSet(flag));
+    //Never overwrite the contended state (2), otherwise the parked threads would not be woken.
+    return (Atomic::CompareAndSwap(flag, 0, 1));
+}
+
+ErrorManagement::ErrorType FastPollingMutexSem::FastLockAdaptive(const TimeoutType &timeout) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    //Only acquire with a compare and swap (0 -> 1): writing 1 over the contended state (2) would lose the wake-up of the parked threads.
+    bool locked = Atomic::CompareAndSwap(flag, 0, 1);
+    uint32 spin = 0u;
+    //Bounded spin. Only try to acquire when the lock looks free, so that the cache line is not hammered.
+    while ((!locked) && (spin < FAST_POLLING_MUTEX_SEM_ADAPTIVE_SPIN_COUNT)) {
+        Atomic::Pause();
+        if (*flag == 0) {
+            locked = Atomic::CompareAndSwap(flag, 0, 1);
+        }
+        spin++;
+    }
+    if (!locked) {
+        uint64 ticksStop = timeout.HighResolutionTimerTicks();
+        ticksStop += HighResolutionTimer::Counter();
+        //Mark the lock as contended. If the previous value was 0 the lock was taken (and FastUnLock will issue a spurious wake).
+        while (Atomic::Exchange(flag, 2) != 0) {
+            uint64 timeoutTicks = 0u;
+            if (timeout != TTInfiniteWait) {
+                uint64 ticks = HighResolutionTimer::Counter();
+                if (ticks >= ticksStop) {
+                    err = ErrorManagement::Timeout;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
+                    break;
+                }
+                timeoutTicks = (ticksStop - ticks);
+            }
+            OsPark(flag, 2, timeoutTicks);
+        }
+    }
+    return err;
 }
 
 void FastPollingMutexSem::FastUnLock() {
-    *flag = 0;
+    if (adaptive) {
+        if (Atomic::Exchange(flag, 0) == 2) {
+            OsUnPark(flag);
+        }
+    }
+    else {
+        *flag = 0;
+    }
 }
 
 }
@@ -39,10 +39,17 @@
 #include "HighResolutionTimer.h"
 #include "TimeoutType.h"
 #include "Sleep.h"
+
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * Number of times that an adaptive FastPollingMutexSem polls the lock (with a processor pause hint in-between)
+ * before parking the calling thread in the operating system.
+ */
+#define FAST_POLLING_MUTEX_SEM_ADAPTIVE_SPIN_COUNT 1000u
+
 namespace MARTe {
 
 /**
@@ -51,6 +58,12 @@ namespace MARTe {
  *
  * @details This semaphore is not recursive i.e is the same thread locks two times sequentially causes a deadlock.
  * Moreover a thread can unlock the semaphore locked by another thread.
+ *
+ * @details When created in adaptive mode (see Create) a contended FastLock polls the lock for
+ * FAST_POLLING_MUTEX_SEM_ADAPTIVE_SPIN_COUNT times, issuing a processor pause hint in-between, and then parks the
+ * calling thread in the operating system (a futex in Linux) until the lock is released. In this mode the spin-lock
+ * holds 0 (unlocked), 1 (locked) or 2 (locked with potential waiters) and FastUnLock only calls the operating system
+ * when there are waiters to be woken.
  */
 class DLL_API FastPollingMutexSem {
 
@@ -72,8 +85,17 @@ public:
     /**
      * @brief Initializes the semaphore as locked or unlocked.
      * @param[in] locked defines if the semaphore is to be initialized in a locked in an unlocked state (default locked=false)
+     * @param[in] adaptive if true a contended FastLock spins for a bounded number of cycles and then parks the thread
+     * until the semaphore is unlocked (default adaptive=false, i.e. poll the spin-lock with the FastLock sleepTime).
      */
-    void Create(const bool locked = false);
+    void Create(const bool locked = false,
+                const bool adaptive = false);
+
+    /**
+     * @brief Returns true if the semaphore was created in adaptive mode.
+     * @return true if the semaphore was created in adaptive mode.
+     */
+    bool IsAdaptive() const;
 
     /**
      * @brief Returns the status of the semaphore.
@@ -87,7 +109,7 @@ public:
      * by the same thread causes a deadlock.
      * @param[in] timeout is the desired timeout.
      * @param[in] sleepTime is the amount of time the CPU is to be released in-between each polling loop cycle.
-     * If sleepTime = 0 the CPU is never released and the spin-lock is continuously polled.
+     * If sleepTime = 0 the CPU is never released and the spin-lock is continuously polled. Ignored in adaptive mode.
      * @return ErrorManagement::Timeout if the semaphore is locked for a period which is greater than the
      * specified timeout. Otherwise ErrorManagement::NoError is returned.
      */
@@ -105,11 +127,39 @@ public:
      * @brief Unlocks the semaphore.
      * @details A thread could unlock the semaphore locked by another thread.
      * @details If a thread locks this type of semaphore, another threads can unlock it.
+     * @details In adaptive mode the parked threads (if any) are woken.
      */
     void FastUnLock();
 
 private:
 
+    /**
+     * @brief Adaptive mode implementation of FastLock.
+     * @param[in] timeout is the desired timeout.
+     * @return ErrorManagement::Timeout if the timeout expired. Otherwise ErrorManagement::NoError is returned.
+     */
+    ErrorManagement::ErrorType FastLockAdaptive(const TimeoutType &timeout);
+
+    /**
+     * @brief Parks the calling thread while *address == value.
+     * @details Operating system specific. The function may return spuriously, so that the caller must re-check the
+     * condition.
+     * @param[in] address the address of the spin-lock.
+     * @param[in] value the value the spin-lock is expected to hold.
+     * @param[in] timeoutTicks the maximum time to park the thread (in HighResolutionTimer ticks). If 0 the thread is
+     * parked without a timeout.
+     */
+    static void OsPark(volatile int32 * const address,
+                       const int32 value,
+                       const uint64 timeoutTicks);
+
+    /**
+     * @brief Wakes one of the threads parked in \a address.
+     * @details Operating system specific.
+     * @param[in] address the address of the spin-lock.
+     */
+    static void OsUnPark(volatile int32 * const address);
+
     /**
      * The internal spin-lock
      */
@@ -120,6 +170,11 @@ private:
      */
     volatile int32 *flag;
 
+    /**
+     * True if the semaphore was created in adaptive mode.
+     */
+    bool adaptive;
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,105 @@
+/**
+ * @file MemoryLock.h
+ * @brief Header file for module MemoryLock
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module MemoryLock
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYLOCK_H_
+#define MEMORYLOCK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace MemoryLock {
+
+/**
+ * @brief Locks a memory area in physical memory, so that accessing it never causes a page fault.
+ * @details Typically requires specific privileges (e.g. CAP_IPC_LOCK or a large enough RLIMIT_MEMLOCK in Linux).
+ * @param[in] address the start of the memory area.
+ * @param[in] size the size of the memory area in bytes.
+ * @return true if the memory area was locked.
+ */
+DLL_API bool Lock(const void * const address,
+                  const uint32 size);
+
+/**
+ * @brief Unlocks a memory area previously locked with Lock.
+ * @param[in] address the start of the memory area.
+ * @param[in] size the size of the memory area in bytes.
+ * @return true if the memory area was unlocked.
+ */
+DLL_API bool Unlock(const void * const address,
+                    const uint32 size);
+
+/**
+ * @brief Touches every page of a memory area, so that the operating system maps it before it is used.
+ * @details The memory content is set to zero.
+ * @param[in] address the start of the memory area.
+ * @param[in] size the size of the memory area in bytes.
+ */
+DLL_API void PreFault(void * const address,
+                      const uint32 size);
+
+/**
+ * @brief Touches every page of a memory area which is already in use, so that it is mapped before the real-time execution.
+ * @details Contrary to PreFault the memory is only read (one byte of each page), so that its content is preserved even if
+ * other threads are writing into it. Pages which were never written may still fault on their first write.
+ * @param[in] address the start of the memory area.
+ * @param[in] size the size of the memory area in bytes.
+ */
+DLL_API void Touch(const void * const address,
+                   const uint32 size);
+
+/**
+ * @brief Locks all the memory currently mapped by the process and all the memory that will be mapped in the future
+ * (e.g. heap allocations and thread stacks) in physical memory.
+ * @details Typically requires specific privileges (see Lock). Not supported in all the environments.
+ * @return true if the process memory was locked.
+ */
+DLL_API bool LockAll();
+
+/**
+ * @brief Unlocks all the memory of the process, previously locked with LockAll.
+ * @return true if the process memory was unlocked.
+ */
+DLL_API bool UnlockAll();
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYLOCK_H_ */
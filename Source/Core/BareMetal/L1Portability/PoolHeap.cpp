@@ -0,0 +1,353 @@
+/**
+ * @file PoolHeap.cpp
+ * @brief Source file for class PoolHeap
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PoolHeap (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "GlobalObjectsDatabase.h"
+#include "HeapManager.h"
+#include "MemoryLock.h"
+#include "MemoryOperationsHelper.h"
+#include "PoolHeap.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Mask of the block index in PoolHeapSizeClass::freeListHead.
+ */
+static const uint64 PoolHeapIndexMask = 0xFFFFFFFFu;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+PoolHeap::PoolHeap() :
+        HeapI() {
+    numberOfSizeClasses = 0u;
+    memory = NULL_PTR(void *);
+    memorySize = 0u;
+    nextFreeTable = NULL_PTR(uint32 *);
+    nextFreeTableSize = 0u;
+    memoryLocked = false;
+    heapName[0] = '\0';
+}
+
+PoolHeap::~PoolHeap() {
+    if (memory != NULL_PTR(void *)) {
+        (void) HeapManager::RemoveHeap(this);
+    }
+    if (memoryLocked) {
+        (void) MemoryLock::Unlock(memory, memorySize);
+        (void) MemoryLock::Unlock(nextFreeTable, static_cast<uint32>(nextFreeTableSize * sizeof(uint32)));
+    }
+    HeapI *standardHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    if (memory != NULL_PTR(void *)) {
+        standardHeap->Free(memory);
+    }
+    if (nextFreeTable != NULL_PTR(uint32 *)) {
+        void *table = reinterpret_cast<void *>(nextFreeTable);
+        standardHeap->Free(table);
+        nextFreeTable = NULL_PTR(uint32 *);
+    }
+}
+
+bool PoolHeap::Create(const char8 * const heapName,
+                      const uint32 maximumBlockSize,
+                      const uint32 numberOfBlocks,
+                      const bool lockMemory) {
+    bool ok = (memory == NULL_PTR(void *));
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::IllegalOperation, "PoolHeap: Create can only be called once");
+    }
+    if (ok) {
+        ok = ((heapName != NULL_PTR(const char8 *)) && (maximumBlockSize > 0u) && (numberOfBlocks > 0u));
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "PoolHeap: the name, the maximum block size and the number of blocks shall be set");
+        }
+    }
+    uint32 blockSize = PoolHeapMinimumBlockSize;
+    if (ok) {
+        numberOfSizeClasses = 1u;
+        while ((blockSize < maximumBlockSize) && (numberOfSizeClasses < PoolHeapMaximumNumberOfSizeClasses)) {
+            blockSize *= 2u;
+            numberOfSizeClasses++;
+        }
+        ok = (blockSize >= maximumBlockSize);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "PoolHeap: the maximum block size is too large");
+        }
+    }
+    uint64 totalSize = 0u;
+    if (ok) {
+        //Sum of the size classes is (2 * largest - smallest) bytes for each block
+        totalSize = ((2u * static_cast<uint64>(blockSize)) - PoolHeapMinimumBlockSize) * numberOfBlocks;
+        uint64 totalBlocks = static_cast<uint64>(numberOfSizeClasses) * numberOfBlocks;
+        ok = ((totalSize <= 0xFFFFFFFFu) && ((totalBlocks * sizeof(uint32)) <= 0xFFFFFFFFu));
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "PoolHeap: the pool shall be smaller than 4 GB");
+        }
+    }
+    HeapI *standardHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+    if (ok) {
+        memorySize = static_cast<uint32>(totalSize);
+        nextFreeTableSize = numberOfSizeClasses * numberOfBlocks;
+        memory = standardHeap->Malloc(memorySize);
+        nextFreeTable = reinterpret_cast<uint32 *>(standardHeap->Malloc(static_cast<uint32>(nextFreeTableSize * sizeof(uint32))));
+        ok = ((memory != NULL_PTR(void *)) && (nextFreeTable != NULL_PTR(uint32 *)));
+    }
+    if (ok) {
+        //Map all the pages now and not when the blocks are first used.
+        MemoryLock::PreFault(memory, memorySize);
+        uint8 *firstBlock = reinterpret_cast<uint8 *>(memory);
+        uint32 c;
+        blockSize = PoolHeapMinimumBlockSize;
+        for (c = 0u; c < numberOfSizeClasses; c++) {
+            PoolHeapSizeClass &sizeClass = sizeClasses[c];
+            sizeClass.blockSize = blockSize;
+            sizeClass.numberOfBlocks = numberOfBlocks;
+            sizeClass.firstBlock = firstBlock;
+            sizeClass.nextFree = &nextFreeTable[c * numberOfBlocks];
+            uint32 b;
+            for (b = 0u; b < numberOfBlocks; b++) {
+                sizeClass.nextFree[b] = ((b + 1u) < numberOfBlocks) ? (b + 2u) : (0u);
+            }
+            sizeClass.freeListHead = 1;
+            sizeClass.numberOfFreeBlocks = static_cast<int32>(numberOfBlocks);
+            firstBlock = &firstBlock[blockSize * numberOfBlocks];
+            blockSize *= 2u;
+        }
+        if (lockMemory) {
+            memoryLocked = MemoryLock::Lock(memory, memorySize);
+            if (memoryLocked) {
+                memoryLocked = MemoryLock::Lock(nextFreeTable, static_cast<uint32>(nextFreeTableSize * sizeof(uint32)));
+                if (!memoryLocked) {
+                    (void) MemoryLock::Unlock(memory, memorySize);
+                }
+            }
+            if (!memoryLocked) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "PoolHeap: could not lock the memory");
+            }
+        }
+        (void) StringHelper::CopyN(&this->heapName[0], heapName, static_cast<uint32>(sizeof(this->heapName) - 1u));
+        this->heapName[sizeof(this->heapName) - 1u] = '\0';
+        ok = HeapManager::AddHeap(this);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "PoolHeap: could not register the heap in the HeapManager");
+        }
+    }
+    return ok;
+}
+
+void *PoolHeap::PopBlock(PoolHeapSizeClass &sizeClass) {
+    void *block = NULL_PTR(void *);
+    bool done = false;
+    while (!done) {
+        uint64 head = static_cast<uint64>(sizeClass.freeListHead);
+        uint32 index = static_cast<uint32>(head & PoolHeapIndexMask);
+        //index > numberOfBlocks can only be read if the head was changed while being read (non-atomic 64 bit read). Retry.
+        if (index == 0u) {
+            done = true;
+        }
+        else if (index <= sizeClass.numberOfBlocks) {
+            uint64 next = static_cast<uint64>(sizeClass.nextFree[index - 1u]);
+            uint64 newHead = (((head >> 32u) + 1u) << 32u) | next;
+            if (Atomic::CompareAndSwap(&sizeClass.freeListHead, static_cast<int64>(head), static_cast<int64>(newHead))) {
+                Atomic::Decrement(&sizeClass.numberOfFreeBlocks);
+                block = reinterpret_cast<void *>(&sizeClass.firstBlock[(index - 1u) * sizeClass.blockSize]);
+                done = true;
+            }
+        }
+        else {
+            Atomic::Pause();
+        }
+    }
+    return block;
+}
+
+void *PoolHeap::Malloc(const uint32 size) {
+    void *block = NULL_PTR(void *);
+    if (size > 0u) {
+        uint32 c;
+        for (c = 0u; (c < numberOfSizeClasses) && (block == NULL_PTR(void *)); c++) {
+            if (sizeClasses[c].blockSize >= size) {
+                block = PopBlock(sizeClasses[c]);
+            }
+        }
+        if (block == NULL_PTR(void *)) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PoolHeap: Failed Malloc(). No free block large enough");
+        }
+    }
+    return block;
+}
+
+uint32 PoolHeap::FindSizeClass(const void * const data,
+                               uint32 &blockIndex) const {
+    uint32 found = numberOfSizeClasses;
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required
+     * in order to be able to find the size class from the address*/
+    uintp address = reinterpret_cast<uintp>(data);
+    bool searching = true;
+    uint32 c;
+    for (c = 0u; (c < numberOfSizeClasses) && (searching); c++) {
+        /*lint -e{9091} -e{923} see above*/
+        uintp start = reinterpret_cast<uintp>(sizeClasses[c].firstBlock);
+        uintp offset = address - start;
+        if ((address >= start) && (offset < (static_cast<uintp>(sizeClasses[c].blockSize) * sizeClasses[c].numberOfBlocks))) {
+            searching = false;
+            //Block sizes are powers of two
+            if ((offset & (static_cast<uintp>(sizeClasses[c].blockSize) - 1u)) == 0u) {
+                found = c;
+                blockIndex = static_cast<uint32>(offset / sizeClasses[c].blockSize);
+            }
+        }
+    }
+    return found;
+}
+
+void PoolHeap::Free(void *&data) {
+    if (data != NULL) {
+        uint32 blockIndex = 0u;
+        uint32 c = FindSizeClass(data, blockIndex);
+        if (c < numberOfSizeClasses) {
+            PoolHeapSizeClass &sizeClass = sizeClasses[c];
+            bool done = false;
+            while (!done) {
+                uint64 head = static_cast<uint64>(sizeClass.freeListHead);
+                sizeClass.nextFree[blockIndex] = static_cast<uint32>(head & PoolHeapIndexMask);
+                uint64 newHead = (((head >> 32u) + 1u) << 32u) | (static_cast<uint64>(blockIndex) + 1u);
+                done = Atomic::CompareAndSwap(&sizeClass.freeListHead, static_cast<int64>(head), static_cast<int64>(newHead));
+            }
+            Atomic::Increment(&sizeClass.numberOfFreeBlocks);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PoolHeap: Failed Free(). The address is not a block of this heap");
+        }
+    }
+    data = NULL_PTR(void *);
+}
+
+void *PoolHeap::Realloc(void *&data,
+                        const uint32 newSize) {
+    if (data == NULL) {
+        data = PoolHeap::Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        PoolHeap::Free(data);
+    }
+    else {
+        uint32 blockIndex = 0u;
+        uint32 c = FindSizeClass(data, blockIndex);
+        if (c < numberOfSizeClasses) {
+            if (sizeClasses[c].blockSize < newSize) {
+                void *newBlock = PoolHeap::Malloc(newSize);
+                if (newBlock != NULL) {
+                    (void) MemoryOperationsHelper::Copy(newBlock, data, sizeClasses[c].blockSize);
+                    PoolHeap::Free(data);
+                }
+                data = newBlock;
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "PoolHeap: Failed Realloc(). The address is not a block of this heap");
+            data = NULL_PTR(void *);
+        }
+    }
+    return data;
+}
+
+void *PoolHeap::Duplicate(const void * const data,
+                          uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = PoolHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp PoolHeap::FirstAddress() const {
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required
+     * in order to be able to return the range of addresses provided by this heap*/
+    return reinterpret_cast<uintp>(memory);
+}
+
+uintp PoolHeap::LastAddress() const {
+    uintp lastAddress = 0u;
+    if (memory != NULL_PTR(void *)) {
+        /*lint -e{9091} -e{923} see FirstAddress*/
+        lastAddress = (reinterpret_cast<uintp>(memory) + memorySize) - 1u;
+    }
+    return lastAddress;
+}
+
+const char8 *PoolHeap::Name() const {
+    return &heapName[0];
+}
+
+uint32 PoolHeap::GetNumberOfSizeClasses() const {
+    return numberOfSizeClasses;
+}
+
+uint32 PoolHeap::GetBlockSize(const uint32 sizeClass) const {
+    uint32 blockSize = 0u;
+    if (sizeClass < numberOfSizeClasses) {
+        blockSize = sizeClasses[sizeClass].blockSize;
+    }
+    return blockSize;
+}
+
+uint32 PoolHeap::GetNumberOfFreeBlocks(const uint32 sizeClass) const {
+    uint32 freeBlocks = 0u;
+    if (sizeClass < numberOfSizeClasses) {
+        freeBlocks = static_cast<uint32>(sizeClasses[sizeClass].numberOfFreeBlocks);
+    }
+    return freeBlocks;
+}
+
+bool PoolHeap::IsMemoryLocked() const {
+    return memoryLocked;
+}
+
+}
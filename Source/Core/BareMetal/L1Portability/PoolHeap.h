@@ -0,0 +1,275 @@
+/**
+ * @file PoolHeap.h
+ * @brief Header file for class PoolHeap
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PoolHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POOLHEAP_H_
+#define POOLHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * The size of the smallest block served by a PoolHeap.
+ */
+static const uint32 PoolHeapMinimumBlockSize = 16u;
+
+/**
+ * The maximum number of size classes of a PoolHeap (i.e. blocks up to PoolHeapMinimumBlockSize * 2^(N-1) bytes).
+ */
+static const uint32 PoolHeapMaximumNumberOfSizeClasses = 24u;
+
+/**
+ * @brief The blocks of a given size of a PoolHeap.
+ */
+struct PoolHeapSizeClass {
+    /**
+     * The size of each block.
+     */
+    uint32 blockSize;
+
+    /**
+     * The number of blocks.
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * The address of the first block.
+     */
+    uint8 *firstBlock;
+
+    /**
+     * For each block, the index (+1) of the next free block (0 terminates the list).
+     */
+    uint32 *nextFree;
+
+    /**
+     * The index (+1) of the first free block (lower 32 bits) and a version tag which is incremented on every update (upper 32 bits).
+     */
+    volatile int64 freeListHead;
+
+    /**
+     * The number of free blocks.
+     */
+    volatile int32 numberOfFreeBlocks;
+};
+
+/**
+ * @brief A HeapI which serves allocations from preallocated pools of fixed size blocks.
+ * @details The memory is allocated once by Create and divided in size classes with blocks of
+ * PoolHeapMinimumBlockSize, 2 * PoolHeapMinimumBlockSize, ... up to the requested maximum block size.
+ * Malloc returns a block of the smallest size class that fits the request (or of a larger one if that
+ * size class is exhausted) and Free returns the block to its size class. Both operations are lock-free
+ * (each size class is a stack updated with Atomic::CompareAndSwap and protected from the ABA problem by a version tag)
+ * and never call the operating system, so that they can be used from real-time threads.
+ *
+ * The memory can be pre-faulted and locked (see MemoryLock) so that accessing the blocks never causes a page fault.
+ *
+ * Create registers the heap in the HeapManager, so that it can be found by name and selected for the construction
+ * of objects (e.g. ObjectBuilder::Build or ReferenceT(className, heap)). The objects are returned to the
+ * heap by HeapManager::Free, which finds the heap from the address.
+ */
+class DLL_API PoolHeap: public HeapI {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    PoolHeap();
+
+    /**
+     * @brief Destructor. Removes the heap from the HeapManager and frees the memory.
+     * @pre No memory allocated from this heap is still in use.
+     */
+    virtual ~PoolHeap();
+
+    /**
+     * @brief Allocates the memory of all the size classes and registers the heap in the HeapManager.
+     * @param[in] heapName the name of the heap (truncated to 31 characters).
+     * @param[in] maximumBlockSize the size of the largest block. It is rounded up to PoolHeapMinimumBlockSize * 2^N.
+     * @param[in] numberOfBlocks the number of blocks of each size class.
+     * @param[in] lockMemory if true the memory is locked in physical memory. A failure to lock is reported as a warning.
+     * @return true if the memory could be allocated and the heap registered in the HeapManager.
+     * @pre Create was not yet called.
+     */
+    bool Create(const char8 * const heapName,
+                const uint32 maximumBlockSize,
+                const uint32 numberOfBlocks,
+                const bool lockMemory);
+
+    /**
+     * @brief Gets a free block from the smallest size class with blocks of at least \a size bytes.
+     * @param[in] size The size in byte of the memory to allocate.
+     * @return The pointer to the allocated memory. NULL if size is zero, larger than the maximum block size or if
+     * all the size classes that could serve it are exhausted.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief Returns a block to its size class.
+     * @param[in,out] data The memory area to be freed.
+     * @post data = NULL
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @brief Reallocates a block.
+     * @details The same block is returned if it is large enough for \a newSize, otherwise the content is copied to a new block.
+     * @param[in,out] data The pointer to the new memory block.
+     * @param[in] newSize The size of the new memory block.
+     * @return The pointer to the new data block. NULL if reallocation failed.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @brief Duplicates a memory section into a new block of this heap.
+     * @param[in] data The pointer to the memory which must be copied.
+     * @param[in] size size of memory to allocate. if size = 0 then memory is copied until a zero is found (included)
+     * @return The pointer to the new allocated memory which contains a copy of data.
+     */
+    /*lint -e(1735) the derived classes shall use this default parameter or no default parameter at all*/
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @brief Returns the start of the pool memory.
+     * @return The start of the pool memory.
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @brief Returns the end (inclusive) of the pool memory.
+     * @return The end (inclusive) of the pool memory.
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Returns the name of the heap
+     * @return The name of the heap
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the number of size classes.
+     * @return the number of size classes.
+     */
+    uint32 GetNumberOfSizeClasses() const;
+
+    /**
+     * @brief Gets the size of the blocks of a size class.
+     * @param[in] sizeClass the index of the size class.
+     * @return the size of the blocks or 0 if \a sizeClass does not exist.
+     */
+    uint32 GetBlockSize(const uint32 sizeClass) const;
+
+    /**
+     * @brief Gets the number of free blocks of a size class.
+     * @param[in] sizeClass the index of the size class.
+     * @return the number of free blocks or 0 if \a sizeClass does not exist.
+     */
+    uint32 GetNumberOfFreeBlocks(const uint32 sizeClass) const;
+
+    /**
+     * @brief Returns true if the memory is locked in physical memory.
+     * @return true if the memory is locked in physical memory.
+     */
+    bool IsMemoryLocked() const;
+
+private:
+
+    /**
+     * @brief Pops a block from the free list of a size class.
+     * @param[in] sizeClass the size class.
+     * @return the block or NULL if the size class is exhausted.
+     */
+    void *PopBlock(PoolHeapSizeClass &sizeClass);
+
+    /**
+     * @brief Gets the size class that owns a block.
+     * @param[in] data the block address.
+     * @param[out] blockIndex the index of the block in the size class.
+     * @return the index of the size class or numberOfSizeClasses if \a data is not the address of a block.
+     */
+    uint32 FindSizeClass(const void * const data,
+                         uint32 &blockIndex) const;
+
+    /**
+     * The size classes.
+     */
+    PoolHeapSizeClass sizeClasses[PoolHeapMaximumNumberOfSizeClasses];
+
+    /**
+     * The number of size classes.
+     */
+    uint32 numberOfSizeClasses;
+
+    /**
+     * The memory of all the blocks.
+     */
+    void *memory;
+
+    /**
+     * The size of the memory of all the blocks.
+     */
+    uint32 memorySize;
+
+    /**
+     * The next free tables of all the size classes.
+     */
+    uint32 *nextFreeTable;
+
+    /**
+     * The number of elements in nextFreeTable.
+     */
+    uint32 nextFreeTableSize;
+
+    /**
+     * True if the memory is locked.
+     */
+    bool memoryLocked;
+
+    /**
+     * The heap name.
+     */
+    char8 heapName[32];
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POOLHEAP_H_ */
@@ -87,6 +87,18 @@ public:
     static inline void SemiBusy(const float32 totalSleepSec,
             const float32 nonBusySleepSec);
 
+    /**
+     * @brief Sleeps, without using the cpu, until HighResolutionTimer::Counter() reaches an absolute value.
+     * @details The deadline is converted into an absolute time of the operating system monotonic clock, so that
+     * the sleep is not stretched by interruptions or by the time spent computing the request. The function may return
+     * later than \a counterTicks (by the operating system wake-up latency) but never earlier, unless the
+     * operating system does not support absolute sleeps, in which case a relative sleep of the remaining time is used.
+     * It returns immediately if \a counterTicks is already in the past. Callers that require sub-latency precision are
+     * expected to request an earlier wake-up and busy wait the remaining ticks.
+     * @param[in] counterTicks the value of HighResolutionTimer::Counter() until when to sleep.
+     */
+    static void UntilCounter(const uint64 counterTicks);
+
     /**
      * @brief Gets the scheduler granularity (i.e. any requests to sleep no more than this value, will busy sleep).
      * @return the scheduler granularity in micro-seconds.
@@ -62,6 +62,8 @@ ClassRegistryDatabase *ClassRegistryDatabase::Instance() {
 
 ClassRegistryDatabase::ClassRegistryDatabase() {
     classUniqueIdentifier = 0u;
+    classNameIndexComplete = true;
+    typeIdNameIndexComplete = true;
 }
 
 ClassRegistryDatabase::~ClassRegistryDatabase() {
@@ -80,6 +82,13 @@ void ClassRegistryDatabase::Add(ClassRegistryItem * const p) {
         classDatabase.ListInsert(p, classUniqueIdentifier);
         classUniqueIdentifier = classUniqueIdentifier + 1u;
 
+        if (!AddToIndex(classNameIndex, p, false)) {
+            classNameIndexComplete = false;
+        }
+        if (!AddToIndex(typeIdNameIndex, p, true)) {
+            typeIdNameIndexComplete = false;
+        }
+
         UnLock();
     }
 }
@@ -115,20 +124,8 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
         if (!Lock()) {
             REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
         }
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = Search(className, false);
+        found = (registryItem != NULL_PTR(ClassRegistryItem *));
         //Must unlock as the loader->Open below might trigger the registration of new classes which will call on the
         //Add method and thus Lock the database.
         UnLock();
@@ -167,19 +164,10 @@ ClassRegistryItem *ClassRegistryDatabase::Find(const char8 *className) {
             if (!Lock()) {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
             }
-            uint32 databaseSize = classDatabase.ListSize();
-            for (i = 0u; (i < databaseSize) && (!found); i++) {
-                ClassRegistryItem *p = classDatabase.ListPeek(i);
-                if (p != NULL) {
-                    const ClassProperties *classProperties = p->GetClassProperties();
-                    if (classProperties != NULL_PTR(ClassProperties *)) {
-                        if (StringHelper::Compare(classProperties->GetName(), className) == 0) {
-                            registryItem = p;
-                            registryItem->SetLoadableLibrary(loader);
-                            found = true;
-                        }
-                    }
-                }
+            registryItem = Search(className, false);
+            found = (registryItem != NULL_PTR(ClassRegistryItem *));
+            if (found) {
+                registryItem->SetLoadableLibrary(loader);
             }
             UnLock();
         }
@@ -200,22 +188,8 @@ ClassRegistryItem *ClassRegistryDatabase::FindTypeIdName(const char8 * const typ
     if (!Lock()) {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: Failed FastLock()");
     }
-    bool found = false;
     if (typeidName != NULL) {
-        uint32 i;
-        uint32 databaseSize = classDatabase.ListSize();
-        for (i = 0u; (i < databaseSize) && (!found); i++) {
-            ClassRegistryItem *p = classDatabase.ListPeek(i);
-            if (p != NULL) {
-                const ClassProperties *classProperties = p->GetClassProperties();
-                if (classProperties != NULL_PTR(ClassProperties *)) {
-                    if (StringHelper::Compare(classProperties->GetTypeIdName(), typeidName) == 0) {
-                        registryItem = p;
-                        found = true;
-                    }
-                }
-            }
-        }
+        registryItem = Search(typeidName, true);
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ClassRegistryDatabase: NULL pointer in input");
@@ -255,6 +229,76 @@ const char8 * const ClassRegistryDatabase::GetClassName() const {
 
 void ClassRegistryDatabase::CleanUp() {
     classDatabase.CleanUp();
+    classNameIndex.Reset();
+    typeIdNameIndex.Reset();
+    classNameIndexComplete = true;
+    typeIdNameIndexComplete = true;
+}
+
+const char8 *ClassRegistryDatabase::GetIndexName(const ClassRegistryItem * const p,
+                                                 const bool typeIdName) {
+    const char8 *name = NULL_PTR(const char8 *);
+    const ClassProperties *classProperties = p->GetClassProperties();
+    if (classProperties != NULL_PTR(ClassProperties *)) {
+        name = (typeIdName) ? (classProperties->GetTypeIdName()) : (classProperties->GetName());
+    }
+    return name;
+}
+
+bool ClassRegistryDatabase::AddToIndex(BinaryTree<ClassRegistryItem *, Fnv1aHashFunction> &index,
+                                       ClassRegistryItem * const p,
+                                       const bool typeIdName) {
+    const char8 *name = GetIndexName(p, typeIdName);
+    bool ok = (name != NULL_PTR(const char8 *));
+    if (ok) {
+        if (index.Insert(name, p) == 0xFFFFFFFFu) {
+            //Either the same name is already indexed (the first registered class is kept, as in a linear search)
+            //or a different name has the same hash.
+            uint32 position = 0u;
+            ok = index.Search(name, position);
+            if (ok) {
+                const char8 *indexedName = GetIndexName(index[position], typeIdName);
+                ok = (indexedName != NULL_PTR(const char8 *));
+                if (ok) {
+                    ok = (StringHelper::Compare(indexedName, name) == 0);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+ClassRegistryItem *ClassRegistryDatabase::Search(const char8 * const name,
+                                                 const bool typeIdName) {
+    ClassRegistryItem *registryItem = NULL_PTR(ClassRegistryItem *);
+    BinaryTree<ClassRegistryItem *, Fnv1aHashFunction> &index = (typeIdName) ? (typeIdNameIndex) : (classNameIndex);
+    bool indexComplete = (typeIdName) ? (typeIdNameIndexComplete) : (classNameIndexComplete);
+    uint32 position = 0u;
+    if (index.Search(name, position)) {
+        ClassRegistryItem *p = index[position];
+        const char8 *itemName = GetIndexName(p, typeIdName);
+        if (itemName != NULL_PTR(const char8 *)) {
+            //Must match the full name as different names might have the same hash
+            if (StringHelper::Compare(itemName, name) == 0) {
+                registryItem = p;
+            }
+        }
+    }
+    if ((registryItem == NULL_PTR(ClassRegistryItem *)) && (!indexComplete)) {
+        uint32 databaseSize = classDatabase.ListSize();
+        for (uint32 i = 0u; (i < databaseSize) && (registryItem == NULL_PTR(ClassRegistryItem *)); i++) {
+            ClassRegistryItem *p = classDatabase.ListPeek(i);
+            if (p != NULL) {
+                const char8 *itemName = GetIndexName(p, typeIdName);
+                if (itemName != NULL_PTR(const char8 *)) {
+                    if (StringHelper::Compare(itemName, name) == 0) {
+                        registryItem = p;
+                    }
+                }
+            }
+        }
+    }
+    return registryItem;
 }
 
 bool ClassRegistryDatabase::Lock() {
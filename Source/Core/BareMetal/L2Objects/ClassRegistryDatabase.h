@@ -32,8 +32,10 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "BinaryTree.h"
 #include "GlobalObjectsDatabase.h"
 #include "FastPollingMutexSem.h"
+#include "Fnv1aHashFunction.h"
 #include "ClassRegistryItem.h"
 #include "StaticList.h"
 #include "FractionalInteger.h"
@@ -72,7 +74,8 @@ public:
      * @brief Adds an element to the database.
      * @details This method should only be called by the ClassRegistryItem constructor.
      * After adding the element to the database the ClassRegistryItem unique identifier value is set
-     * to the position at which it was added to the database.
+     * to the position at which it was added to the database. The element is also added to the class name and
+     * typeid name indexes used by Find and FindTypeIdName.
      * @param[in] p the element to be added.
      */
     void Add(ClassRegistryItem * const p);
@@ -80,6 +83,8 @@ public:
     /**
      * @brief Returns the ClassRegistryItem associated to the class with name \a className.
      * @details The returned pointer will be valid as long as it exists in the database.
+     * The class is searched in a index keyed by the hash of the class name. If more than one class was registered with the same name,
+     * the first registered class is returned.
      * @param[in] className the name of the class to be searched.
      * @return a pointer to the ClassRegisteredItem or NULL if the \a className could not be found.
      */
@@ -88,6 +93,7 @@ public:
     /**
      * @brief Returns the ClassRegistryItem associated to the class with typeid(class).name() equal to \a typeidName.
      * @details The returned pointer will be valid as long as it exists in the database.
+     * The class is searched in a index keyed by the hash of the typeid name.
      * @param[in] typeidName the typeid().name() of the class to be searched.
      * @return a pointer to the ClassRegisteredItem or NULL if the \a className could not be found.
      */
@@ -139,6 +145,57 @@ protected:
 
 private:
 
+    /**
+     * @brief Gets the name used to index an element.
+     * @param[in] p the element.
+     * @param[in] typeIdName true to get the typeid name, false to get the class name.
+     * @return the class name (or typeid name) of \a p or NULL if \a p has no ClassProperties.
+     */
+    static const char8 *GetIndexName(const ClassRegistryItem * const p,
+                                     const bool typeIdName);
+
+    /**
+     * @brief Adds an element to one of the indexes.
+     * @details If the name hash collides with the hash of a different name the element is not indexed.
+     * @param[in,out] index the index to be updated.
+     * @param[in] p the element to be added.
+     * @param[in] typeIdName true if \a index is keyed by typeid name.
+     * @return false if the element could not be indexed and the index can no longer be used alone to search for elements.
+     */
+    static bool AddToIndex(BinaryTree<ClassRegistryItem *, Fnv1aHashFunction> &index,
+                           ClassRegistryItem * const p,
+                           const bool typeIdName);
+
+    /**
+     * @brief Searches for an element by class name (or typeid name) using the indexes.
+     * @details Falls back to a linear search of the database when the index is not complete. Shall be called with the database locked.
+     * @param[in] name the class name (or typeid name) to search.
+     * @param[in] typeIdName true if \a name is a typeid name.
+     * @return a pointer to the ClassRegistryItem or NULL if \a name could not be found.
+     */
+    ClassRegistryItem *Search(const char8 * const name,
+                              const bool typeIdName);
+
+    /**
+     * Index of the database elements keyed by the hash of the class name.
+     */
+    BinaryTree<ClassRegistryItem *, Fnv1aHashFunction> classNameIndex;
+
+    /**
+     * Index of the database elements keyed by the hash of the typeid name.
+     */
+    BinaryTree<ClassRegistryItem *, Fnv1aHashFunction> typeIdNameIndex;
+
+    /**
+     * False if at least one element could not be added to the classNameIndex.
+     */
+    bool classNameIndexComplete;
+
+    /**
+     * False if at least one element could not be added to the typeIdNameIndex.
+     */
+    bool typeIdNameIndexComplete;
+
     /**
      * The database is implemented as a StaticList.
      * The destructor of the list will clean its elements.
@@ -32,9 +32,11 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ErrorType.h"
+#include "HeapManager.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainerFilterReferences.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -58,6 +60,8 @@ ObjectRegistryDatabase *ObjectRegistryDatabase::Instance() {
 
 ObjectRegistryDatabase::ObjectRegistryDatabase() :
         ReferenceContainer() {
+    pathIndexEnabled = false;
+    pathIndexMux.Create();
 }
 
 /*lint -e{1551} Guarantees that all the nodes are cleared before destroying the application.*/
@@ -65,6 +69,15 @@ ObjectRegistryDatabase::~ObjectRegistryDatabase() {
     Purge();
 }
 
+void ObjectRegistryDatabase::Purge() {
+    ReferenceContainer::Purge();
+}
+
+void ObjectRegistryDatabase::Purge(ReferenceContainer &purgeList) {
+    ResetPathIndex();
+    ReferenceContainer::Purge(purgeList);
+}
+
 Reference ObjectRegistryDatabase::Find(const char8 * const path,
                                        const Reference current) {
     ReferenceT<ReferenceContainer> domain = current;
@@ -109,6 +122,11 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
     }
     // now search from the domain forward
     Reference ret;
+    bool useIndex = (ok && pathIndexEnabled && (!isSearchDomain));
+    if (useIndex) {
+        ret = FindInPathIndex(&path[backSteps]);
+        ok = !ret.IsValid();
+    }
     if (ok) {
         ReferenceContainerFilterObjectName filterName(1, ReferenceContainerFilterMode::SHALLOW, &path[backSteps]);
         ReferenceContainer resultSingle;
@@ -131,11 +149,244 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
         if (ok) {
             //Invalidate move to leafs
             ret = resultSingle.Get(resultSingle.Size() - 1u);
+            if (useIndex) {
+                AddToPathIndex(&path[backSteps], resultSingle);
+            }
         }
     }
     return ret;
 }
 
+void ObjectRegistryDatabase::SetPathIndexEnabled(const bool enable) {
+    pathIndexEnabled = enable;
+    if (!enable) {
+        ResetPathIndex();
+    }
+}
+
+bool ObjectRegistryDatabase::IsPathIndexEnabled() const {
+    return pathIndexEnabled;
+}
+
+uint32 ObjectRegistryDatabase::GetPathIndexSize() {
+    uint32 size = 0u;
+    if (pathIndexMux.FastLock() == ErrorManagement::NoError) {
+        uint32 numberOfHashes = pathIndex.GetSize();
+        for (uint32 i = 0u; i < numberOfHashes; i++) {
+            for (ObjectRegistryDatabasePathIndexEntry *entry = pathIndex[i]; entry != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *); entry = entry->next) {
+                size++;
+            }
+        }
+    }
+    pathIndexMux.FastUnLock();
+    return size;
+}
+
+Reference ObjectRegistryDatabase::FindInPathIndex(const char8 * const path) {
+    Reference ret;
+    //Keep the nodes alive while they are validated. Declared before the lock so that, if one of these is the last Reference
+    //to an Object that was meanwhile removed, the Object is only destroyed after the pathIndexMux is released.
+    Reference nodes[OBJECT_REGISTRY_DATABASE_PATH_INDEX_MAX_DEPTH];
+    if (pathIndexMux.FastLock() == ErrorManagement::NoError) {
+        uint32 index = 0u;
+        if (pathIndex.Search(path, index)) {
+            //Different paths with the same hash are chained.
+            ObjectRegistryDatabasePathIndexEntry *entry = pathIndex[index];
+            while ((entry != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) && (StringHelper::Compare(entry->path, path) != 0)) {
+                entry = entry->next;
+            }
+            if (entry != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) {
+                //Validate from the root. The first container is the database and each of the others is alive given that
+                //it is referenced by the previous node. The node can only be referenced if its container still holds it,
+                //i.e. if the container was not modified, and this must be verified while holding the container lock.
+                bool valid = true;
+                for (uint32 i = 0u; (i < entry->depth) && (valid); i++) {
+                    valid = entry->containers[i]->Lock();
+                    if (valid) {
+                        valid = (entry->containers[i]->GetModificationCounter() == entry->counters[i]);
+                    }
+                    if (valid) {
+                        nodes[i] = Reference(entry->objects[i]);
+                    }
+                    entry->containers[i]->UnLock();
+                }
+                if (valid) {
+                    valid = PathIndexEntryNamesMatch(entry);
+                }
+                if (valid) {
+                    ret = nodes[entry->depth - 1u];
+                }
+                else {
+                    RemoveFromPathIndex(entry);
+                    DeletePathIndexEntry(entry);
+                }
+            }
+        }
+    }
+    pathIndexMux.FastUnLock();
+    return ret;
+}
+
+/*lint -e{429} the entry is freed by ResetPathIndex or when it is found to be no longer valid.*/
+void ObjectRegistryDatabase::AddToPathIndex(const char8 * const path,
+                                            ReferenceContainer &nodes) {
+    uint32 depth = nodes.Size();
+    uint32 length = StringHelper::Length(path);
+    //Only paths without empty nodes (e.g. leading, trailing or consecutive dots) are indexed
+    bool ok = ((depth > 0u) && (length > 0u));
+    if (ok) {
+        ok = ((path[0] != '.') && (path[length - 1u] != '.'));
+    }
+    uint32 numberOfNodes = 1u;
+    for (uint32 i = 1u; (i < length) && (ok); i++) {
+        if (path[i] == '.') {
+            ok = (path[i - 1u] != '.');
+            numberOfNodes++;
+        }
+    }
+    if (ok) {
+        ok = ((numberOfNodes == depth) && (depth <= OBJECT_REGISTRY_DATABASE_PATH_INDEX_MAX_DEPTH));
+    }
+    ObjectRegistryDatabasePathIndexEntry *entry = NULL_PTR(ObjectRegistryDatabasePathIndexEntry *);
+    if (ok) {
+        entry = new ObjectRegistryDatabasePathIndexEntry;
+        entry->path = StringHelper::StringDup(path);
+        entry->depth = depth;
+        entry->containers = new ReferenceContainer*[depth];
+        entry->counters = new uint32[depth];
+        entry->objects = new Object*[depth];
+        entry->next = NULL_PTR(ObjectRegistryDatabasePathIndexEntry *);
+        entry->containers[0] = this;
+        for (uint32 i = 0u; (i < depth) && (ok); i++) {
+            Reference node = nodes.Get(i);
+            ok = node.IsValid();
+            if (ok) {
+                entry->objects[i] = node.operator->();
+                if ((i + 1u) < depth) {
+                    ReferenceT<ReferenceContainer> nodeContainer = node;
+                    ok = nodeContainer.IsValid();
+                    if (ok) {
+                        entry->containers[i + 1u] = nodeContainer.operator->();
+                    }
+                }
+            }
+            if (ok) {
+                //The node might have been removed while the database was being walked. Only accept the node if the
+                //container still holds it and was not modified while this was being checked.
+                entry->counters[i] = entry->containers[i]->GetModificationCounter();
+                ReferenceContainerFilterReferences filterRef(1, ReferenceContainerFilterMode::SHALLOW, node);
+                ReferenceContainer result;
+                entry->containers[i]->Find(result, filterRef);
+                ok = (result.Size() > 0u);
+                if (ok) {
+                    ok = (entry->containers[i]->GetModificationCounter() == entry->counters[i]);
+                }
+            }
+        }
+    }
+    if (ok) {
+        if (pathIndexMux.FastLock() == ErrorManagement::NoError) {
+            uint32 index = 0u;
+            if (pathIndex.Search(path, index)) {
+                //Chain it after the paths with the same hash, unless the path is already indexed.
+                ObjectRegistryDatabasePathIndexEntry *last = pathIndex[index];
+                ok = (StringHelper::Compare(last->path, path) != 0);
+                while ((ok) && (last->next != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *))) {
+                    last = last->next;
+                    ok = (StringHelper::Compare(last->path, path) != 0);
+                }
+                if (ok) {
+                    last->next = entry;
+                }
+            }
+            else {
+                ok = (pathIndex.Insert(path, entry) != 0xFFFFFFFFu);
+            }
+        }
+        else {
+            ok = false;
+        }
+        pathIndexMux.FastUnLock();
+    }
+    if (!ok) {
+        DeletePathIndexEntry(entry);
+    }
+}
+
+void ObjectRegistryDatabase::ResetPathIndex() {
+    if (pathIndexMux.FastLock() == ErrorManagement::NoError) {
+        uint32 size = pathIndex.GetSize();
+        for (uint32 i = 0u; i < size; i++) {
+            ObjectRegistryDatabasePathIndexEntry *entry = pathIndex[i];
+            while (entry != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) {
+                ObjectRegistryDatabasePathIndexEntry *next = entry->next;
+                DeletePathIndexEntry(entry);
+                entry = next;
+            }
+        }
+        pathIndex.Reset();
+    }
+    pathIndexMux.FastUnLock();
+}
+
+void ObjectRegistryDatabase::RemoveFromPathIndex(const ObjectRegistryDatabasePathIndexEntry * const entry) {
+    uint32 index = 0u;
+    if (pathIndex.Search(entry->path, index)) {
+        ObjectRegistryDatabasePathIndexEntry *first = pathIndex[index];
+        if (first == entry) {
+            //The BinaryTree values cannot be replaced: reinsert the rest of the chain (same hash, i.e. same key).
+            if (pathIndex.Remove(entry->path)) {
+                if (entry->next != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) {
+                    (void) pathIndex.Insert(entry->next->path, entry->next);
+                }
+            }
+        }
+        else {
+            ObjectRegistryDatabasePathIndexEntry *previous = first;
+            while ((previous->next != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) && (previous->next != entry)) {
+                previous = previous->next;
+            }
+            if (previous->next == entry) {
+                previous->next = entry->next;
+            }
+        }
+    }
+}
+
+void ObjectRegistryDatabase::DeletePathIndexEntry(ObjectRegistryDatabasePathIndexEntry * const entry) {
+    if (entry != NULL_PTR(ObjectRegistryDatabasePathIndexEntry *)) {
+        if (entry->path != NULL_PTR(char8 *)) {
+            if (!HeapManager::Free(reinterpret_cast<void *&>(entry->path))) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ObjectRegistryDatabase: Failed HeapManager::Free()");
+            }
+        }
+        delete[] entry->containers;
+        delete[] entry->counters;
+        delete[] entry->objects;
+        delete entry;
+    }
+}
+
+bool ObjectRegistryDatabase::PathIndexEntryNamesMatch(const ObjectRegistryDatabasePathIndexEntry * const entry) {
+    bool ok = true;
+    const char8 *node = entry->path;
+    for (uint32 i = 0u; (i < entry->depth) && (ok); i++) {
+        const char8 *name = entry->objects[i]->GetName();
+        ok = (name != NULL_PTR(const char8 *));
+        if (ok) {
+            uint32 nameLength = StringHelper::Length(name);
+            ok = (StringHelper::CompareN(name, node, nameLength) == 0);
+            if (ok) {
+                //The node must end exactly where the name ends
+                char8 end = ((i + 1u) < entry->depth) ? ('.') : ('\0');
+                ok = (node[nameLength] == end);
+                node = &node[nameLength + 1u];
+            }
+        }
+    }
+    return ok;
+}
+
 const char8 * const ObjectRegistryDatabase::GetClassName() const {
     return "ObjectRegistryDatabase";
 }
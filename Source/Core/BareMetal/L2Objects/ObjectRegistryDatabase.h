@@ -32,6 +32,9 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "BinaryTree.h"
+#include "FastPollingMutexSem.h"
+#include "Fnv1aHashFunction.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 
@@ -39,8 +42,53 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * Maximum number of nodes of a path stored in the ObjectRegistryDatabase path index. Deeper paths are always resolved by walking the database.
+ */
+#define OBJECT_REGISTRY_DATABASE_PATH_INDEX_MAX_DEPTH 32u
+
 namespace MARTe {
 
+/**
+ * @brief Entry of the ObjectRegistryDatabase path index.
+ * @details Stores, for each node of an absolute path, the container that holds the node, the value of the container
+ * modification counter when the path was resolved and the Object that was found.
+ * @details The Objects are not referenced by the entry (so that the index does not keep alive Objects that were removed from the
+ * database). An Object is only accessed after having verified, while holding the lock of its container, that the container was not
+ * modified since the path was resolved.
+ */
+struct ObjectRegistryDatabasePathIndexEntry {
+    /**
+     * The absolute path (as given to ObjectRegistryDatabase::Find).
+     */
+    char8 *path;
+
+    /**
+     * The number of nodes in the path.
+     */
+    uint32 depth;
+
+    /**
+     * The container that holds each node (the first one is the ObjectRegistryDatabase).
+     */
+    ReferenceContainer **containers;
+
+    /**
+     * The modification counter of each container when the path was resolved.
+     */
+    uint32 *counters;
+
+    /**
+     * The Object found at each node.
+     */
+    Object **objects;
+
+    /**
+     * The next entry whose path has the same hash (NULL if none).
+     */
+    ObjectRegistryDatabasePathIndexEntry *next;
+};
+
 /**
  * @brief Singleton database of References to MARTe Objects.
  */
@@ -66,6 +114,10 @@ public:
      * @param[in] current is the research start point. In this case we admit the syntax "::A.B.C"
      * where the ':' symbol set the search start point to the previous domain with respect to \a current.
      * If no ':' is found at the beginning of the path, the start point is the root.
+     * @details If the path index is enabled (see SetPathIndexEnabled) absolute paths are first looked up in the index.
+     * An indexed path is only returned if none of the containers in the path was modified (see ReferenceContainer::GetModificationCounter)
+     * and if none of the nodes was renamed since the path was resolved; otherwise the path is resolved again by walking the database.
+     * Only paths with at most OBJECT_REGISTRY_DATABASE_PATH_INDEX_MAX_DEPTH nodes are indexed.
      * @return the reference found at the provided \a path or an invalid reference in case of failure.
      */
     /*lint -e{1511} [MISRA C++ Rule 2-10-2].*/
@@ -78,8 +130,104 @@ public:
      */
     virtual const char8 * const GetClassName() const;
 
+    /**
+     * @brief Enables or disables the path index used by Find to resolve absolute paths.
+     * @details The index is filled incrementally with the absolute paths successfully resolved by Find and gives
+     * O(log(n)) lookups (on the 32-bit hash of the path) followed by an O(depth) validation of the stored path.
+     * The index is the BinaryTree also used by the ConfigurationDatabaseNode (a sorted array of hashes searched by bisection),
+     * and not an O(1) hash table. Paths with the same hash are chained in the same BinaryTree element.
+     * It is disabled by default. Disabling the index releases all its entries.
+     * @param[in] enable true to enable the path index.
+     * @warning Siblings with the same name make a path ambiguous. After such a path has been indexed, renaming
+     * one of the siblings of a node in the path (or inserting children in a same-named sibling of a node) is not detected
+     * and Find keeps returning the previously resolved Reference.
+     */
+    void SetPathIndexEnabled(const bool enable);
+
+    /**
+     * @brief Checks if the path index is enabled.
+     * @return true if the path index is enabled.
+     */
+    bool IsPathIndexEnabled() const;
+
+    /**
+     * @brief Gets the number of paths currently stored in the path index.
+     * @return the number of paths currently stored in the path index.
+     */
+    uint32 GetPathIndexSize();
+
+    /**
+     * @brief Removes all the elements from the database and clears the path index.
+     * @see ReferenceContainer::Purge()
+     */
+    void Purge();
+
+    /**
+     * @brief Clears the path index and recursively adds to the purgeList all the reference containers held by the database.
+     * @see ReferenceContainer::Purge(ReferenceContainer &)
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
 private:
 
+    /**
+     * @brief Looks up an absolute path in the path index.
+     * @details Entries that are no longer valid are removed from the index. The entry is validated from the root: the counter of each
+     * container is checked, and a Reference to its node taken, while holding the container lock, so that the node (and thus the
+     * next container of the path) cannot be destroyed while it is being validated.
+     * @param[in] path the absolute path to look up.
+     * @return the indexed Reference or an invalid Reference if the path is not indexed or no longer valid.
+     */
+    Reference FindInPathIndex(const char8 * const path);
+
+    /**
+     * @brief Adds an absolute path to the path index.
+     * @param[in] path the absolute path.
+     * @param[in] nodes the nodes found by walking the database for \a path (as returned by a ReferenceContainerFilterMode::PATH search).
+     */
+    void AddToPathIndex(const char8 * const path,
+                        ReferenceContainer &nodes);
+
+    /**
+     * @brief Removes all the entries from the path index.
+     */
+    void ResetPathIndex();
+
+    /**
+     * @brief Unlinks an entry from the path index (and from the chain of paths with the same hash).
+     * @details The pathIndexMux shall be locked.
+     * @param[in] entry the entry to unlink. It is not freed.
+     */
+    void RemoveFromPathIndex(const ObjectRegistryDatabasePathIndexEntry * const entry);
+
+    /**
+     * @brief Frees the memory of a path index entry.
+     * @param[in] entry the entry to free.
+     */
+    static void DeletePathIndexEntry(ObjectRegistryDatabasePathIndexEntry * const entry);
+
+    /**
+     * @brief Checks that the names of the Objects stored in a path index entry still match its path.
+     * @param[in] entry the entry to verify.
+     * @return true if every node name is equal to the corresponding (dot separated) element of the path.
+     */
+    static bool PathIndexEntryNamesMatch(const ObjectRegistryDatabasePathIndexEntry * const entry);
+
+    /**
+     * True if the path index is enabled.
+     */
+    bool pathIndexEnabled;
+
+    /**
+     * The path index, keyed by the hash of the path. Each element is the first entry of the chain of paths with that hash.
+     */
+    BinaryTree<ObjectRegistryDatabasePathIndexEntry *, Fnv1aHashFunction> pathIndex;
+
+    /**
+     * Protects the access to the path index.
+     */
+    FastPollingMutexSem pathIndexMux;
+
 
     /**
      * @brief Disallow the usage of new.
@@ -59,10 +59,14 @@ ReferenceContainer::ReferenceContainer() :
         Object() {
     mux.Create();
     muxTimeout = TTInfiniteWait;
+    modificationCounter = 0u;
+    arrayStorage = false;
 }
 
 ReferenceContainer::ReferenceContainer(ReferenceContainer &copy) :
         Object(copy) {
+    modificationCounter = 0u;
+    arrayStorage = false;
     SetTimeout(copy.GetTimeout());
     uint32 nChildren = copy.Size();
     for (uint32 i = 0u; i < nChildren; i++) {
@@ -91,8 +95,8 @@ ReferenceContainer& ReferenceContainer::operator =(ReferenceContainer &copy) {
 Reference ReferenceContainer::Get(const uint32 idx) {
     Reference ref;
     if (Lock()) {
-        if (idx < list.ListSize()) {
-            ReferenceContainerNode *node = (list.ListPeek(idx));
+        if (idx < GetNumberOfNodes()) {
+            ReferenceContainerNode *node = PeekNode(idx);
             if (node != NULL) {
                 ref = node->GetReference();
             }
@@ -123,6 +127,11 @@ ReferenceContainer::~ReferenceContainer() {
         p = p->Next();
         delete q;
     }
+    uint32 nOfNodes = arrayList.GetSize();
+    for (uint32 i = 0u; i < nOfNodes; i++) {
+        delete arrayList[i];
+    }
+    arrayList.Clean();
 }
 
 /*lint -e{593} .Justification: The node (newItem) will be deleted by the destructor. */
@@ -131,11 +140,12 @@ bool ReferenceContainer::Insert(Reference ref, const int32 &position) {
     if (ok) {
         ReferenceContainerNode *newItem = new ReferenceContainerNode();
         if (newItem->SetReference(ref)) {
-            if (position == -1) {
-                list.ListAdd(newItem);
+            ok = InsertNode(newItem, position);
+            if (ok) {
+                modificationCounter++;
             }
             else {
-                list.ListInsert(newItem, static_cast<uint32>(position));
+                delete newItem;
             }
         }
         else {
@@ -252,16 +262,16 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
     int32 index = 0;
     bool ok = Lock();
     if (ok) {
-        if (list.ListSize() > 0u) {
+        if (GetNumberOfNodes() > 0u) {
             if (filter.IsReverse()) {
-                index = static_cast<int32>(list.ListSize()) - 1;
+                index = static_cast<int32>(GetNumberOfNodes()) - 1;
             }
 
             //The filter will be finished when the correct occurrence has been found (otherwise it will walk all the list)
             //lint -e{9007} no side-effects on the right of the && operator
-            while ((!filter.IsFinished()) && ((filter.IsReverse() && (index > -1)) || ((!filter.IsReverse()) && (index < static_cast<int32>(list.ListSize()))))) {
+            while ((!filter.IsFinished()) && ((filter.IsReverse() && (index > -1)) || ((!filter.IsReverse()) && (index < static_cast<int32>(GetNumberOfNodes()))))) {
 
-                ReferenceContainerNode *currentNode = (list.ListPeek(static_cast<uint32>(index)));
+                ReferenceContainerNode *currentNode = PeekNode(static_cast<uint32>(index));
                 Reference const & currentNodeReference = currentNode->GetReference();
                 //Check if the current node meets the filter criteria
                 bool found = filter.Test(result, currentNodeReference);
@@ -273,7 +283,11 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                         if (result.Insert(currentNodeReference)) {
                             if (filter.IsRemove()) {
                                 //Only delete the exact node index
-                                if (list.ListDelete(currentNode)) {
+                                ReferenceContainerNode *deletedNode = ExtractNode(static_cast<uint32>(index));
+                                if (deletedNode != NULL_PTR(ReferenceContainerNode *)) {
+                                    //Before the Reference is released (see ObjectRegistryDatabase::FindInPathIndex)
+                                    modificationCounter++;
+                                    delete deletedNode;
                                     //Given that the index will be incremented, but we have removed an element, the index should stay in the same position
                                     if (!filter.IsReverse()) {
                                         index--;
@@ -304,22 +318,22 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
                     if (ok) {
                         ReferenceT<ReferenceContainer> currentNodeContainer = currentNodeReference;
-                        uint32 sizeBeforeBranching = result.list.ListSize();
+                        uint32 sizeBeforeBranching = result.GetNumberOfNodes();
                         UnLock();
                         currentNodeContainer->Find(result, filter);
                         if (Lock()) {
                             //Recursion was aborted. Remove all the elements from the test results
                             if (!filter.IsRecursive()) {
-                                while (result.list.ListSize() > 0u) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                while (result.GetNumberOfNodes() > 0u) {
+                                    ReferenceContainerNode *node = result.ExtractNode(result.GetNumberOfNodes() - 1u);
                                     delete node;
                                 }
                             }
                             //Something was found if the result size has changed
-                            else if (sizeBeforeBranching == result.list.ListSize()) {
+                            else if (sizeBeforeBranching == result.GetNumberOfNodes()) {
                                 //Nothing found. Remove the stored path (which led to nowhere).
                                 if (filter.IsStorePath()) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    ReferenceContainerNode *node = result.ExtractNode(result.GetNumberOfNodes() - 1u);
                                     delete node;
                                 }
                             }
@@ -368,7 +382,7 @@ Reference ReferenceContainer::Find(const char8 * const path, const bool recursiv
 uint32 ReferenceContainer::Size() {
     uint32 size = 0u;
     if (Lock()) {
-        size = list.ListSize();
+        size = GetNumberOfNodes();
     }
     else {
         REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
@@ -380,9 +394,16 @@ uint32 ReferenceContainer::Size() {
 bool ReferenceContainer::Initialise(StructuredDataI &data) {
 
     // only one thread has to initialise.
+    uint32 arrayStorageValue = 0u;
+    if (!data.Read("ArrayStorage", arrayStorageValue)) {
+        arrayStorageValue = 0u;
+    }
+    bool ok = true;
+    if (arrayStorageValue == 1u) {
+        ok = SetArrayStorage(true);
+    }
 
     // Recursive initialization
-    bool ok = true;
     uint32 numberOfChildren = data.GetNumberOfChildren();
     for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
         const char8* childName = data.GetChildName(i);
@@ -471,6 +492,107 @@ void ReferenceContainer::Purge(ReferenceContainer &purgeList) {
     }
 }
 
+bool ReferenceContainer::SetArrayStorage(const bool enable) {
+    bool ok = Lock();
+    if (ok) {
+        if (enable != arrayStorage) {
+            if (enable) {
+                uint32 nOfNodes = list.ListSize();
+                for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
+                    ok = arrayList.Add(list.ListPeek(i));
+                }
+                if (ok) {
+                    list.Reset();
+                }
+                else {
+                    //Keep the linked list (which still holds all the nodes)
+                    arrayList.Clean();
+                }
+            }
+            else {
+                uint32 nOfNodes = arrayList.GetSize();
+                for (uint32 i = 0u; i < nOfNodes; i++) {
+                    list.ListAdd(arrayList[i]);
+                }
+                arrayList.Clean();
+            }
+            if (ok) {
+                arrayStorage = enable;
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
+    }
+    UnLock();
+    return ok;
+}
+
+bool ReferenceContainer::IsArrayStorage() const {
+    return arrayStorage;
+}
+
+uint32 ReferenceContainer::GetNumberOfNodes() const {
+    return arrayStorage ? arrayList.GetSize() : list.ListSize();
+}
+
+ReferenceContainerNode *ReferenceContainer::PeekNode(const uint32 idx) {
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (arrayStorage) {
+        if (!arrayList.Peek(idx, node)) {
+            node = NULL_PTR(ReferenceContainerNode *);
+        }
+    }
+    else {
+        node = list.ListPeek(idx);
+    }
+    return node;
+}
+
+bool ReferenceContainer::InsertNode(ReferenceContainerNode * const node,
+                                    const int32 position) {
+    bool ok = true;
+    if (arrayStorage) {
+        if (position == -1) {
+            ok = arrayList.Add(node);
+        }
+        else {
+            uint32 insertPosition = static_cast<uint32>(position);
+            //Same behaviour as the linked list: positions after the end add to the end
+            if (insertPosition > arrayList.GetSize()) {
+                insertPosition = arrayList.GetSize();
+            }
+            ok = arrayList.Insert(insertPosition, node);
+        }
+    }
+    else {
+        if (position == -1) {
+            list.ListAdd(node);
+        }
+        else {
+            list.ListInsert(node, static_cast<uint32>(position));
+        }
+    }
+    return ok;
+}
+
+ReferenceContainerNode *ReferenceContainer::ExtractNode(const uint32 idx) {
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (arrayStorage) {
+        if (!arrayList.Extract(idx, node)) {
+            node = NULL_PTR(ReferenceContainerNode *);
+        }
+    }
+    else {
+        node = list.ListExtract(idx);
+    }
+    return node;
+}
+
+uint32 ReferenceContainer::GetModificationCounter() const {
+    return modificationCounter;
+}
+
 bool ReferenceContainer::IsReferenceContainer() const {
     return true;
 }
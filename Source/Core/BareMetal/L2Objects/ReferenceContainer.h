@@ -38,6 +38,7 @@
 #include "Reference.h"
 #include "ReferenceContainerFilter.h"
 #include "ReferenceContainerNode.h"
+#include "StaticList.h"
 #include "TimeoutType.h"
 
 /*---------------------------------------------------------------------------*/
@@ -55,6 +56,9 @@ const uint32 REFERENCE_CONTAINER_NUMBER_OF_TOKENS = 5u;
  * @details One of the basilar classes of the framework. Linear container of references which may also
  * include other containers of references (generating a tree). The access to the container is protected
  * by an internal FastPollingMutexSem whose timeout can be specified.
+ *
+ * By default the references are stored in a linked list. Containers that are often accessed by index (Get) or walked (Find)
+ * can be switched to an array storage (see SetArrayStorage) which gives O(1) indexed access.
  */
 /*lint -e{9109} forward declaration in ReferenceContainerFilter.h is required to define the class*/
 /*lint -e{763} forward declaration in ReferenceContainerFilter.h is required to define the class*/
@@ -185,9 +189,29 @@ ReferenceContainer    ();
      * has the special symbol '+' or '$' at the beginning. The symbol '$' marks the
      * node as a domain and will be used for relative researches by path in ObjectRegistryDatabase::Find(*)
      * @param[in] data is the StructuredData in input.
+     * @details The following optional parameter is also read:
+     * <pre>
+     * ArrayStorage = 1 //If 1 the references are stored in an array (see SetArrayStorage). Default = 0.
+     * </pre>
      */
     virtual bool Initialise(StructuredDataI &data);
 
+    /**
+     * @brief Selects how the references are stored in the container.
+     * @details In the array storage the nodes are held in a contiguous array, so that Get(i) is O(1) and Find
+     * walks the container without list traversals. Inserting or removing a reference in the middle of the container
+     * moves the following elements. The references already in the container are moved to the new storage.
+     * @param[in] enable true to store the references in an array, false to store them in a linked list.
+     * @return true if the storage was successfully changed.
+     */
+    bool SetArrayStorage(const bool enable);
+
+    /**
+     * @brief Checks if the references are stored in an array.
+     * @return true if the references are stored in an array.
+     */
+    bool IsArrayStorage() const;
+
     /**
      * @see Object::ExportData(*)
      */
@@ -235,6 +259,17 @@ ReferenceContainer    ();
      */
     virtual bool IsReferenceContainer() const;
 
+    /**
+     * @brief Gets the number of structural modifications performed on this container.
+     * @details The counter is incremented every time that a Reference is inserted in or removed from this container
+     * (Insert, Delete, Purge and Find with ReferenceContainerFilterMode::REMOVE). It allows to detect, without walking the
+     * container, that a previously resolved child is no longer guaranteed to be held at the same position.
+     * The counter is incremented while holding the container lock (see Lock) and before the removed Reference is released, so that
+     * a child is still alive if the counter is found unchanged while holding the lock.
+     * @return the number of modifications since construction.
+     */
+    uint32 GetModificationCounter() const;
+
     /**
      * @brief Checks if the input token is one of the tokens that force the creation of a new Object.
      * @param[in] token the token to verify.
@@ -309,11 +344,50 @@ private:
      */
     static void RemoveToken(char8 * const tokenList, char8 token);
 
+    /**
+     * @brief Gets the number of nodes in the storage. Does not lock the container.
+     * @return the number of nodes in the storage.
+     */
+    uint32 GetNumberOfNodes() const;
+
+    /**
+     * @brief Gets the node at a given position of the storage. Does not lock the container.
+     * @param[in] idx the position of the node.
+     * @return the node at position \a idx or NULL if \a idx is out of range.
+     */
+    ReferenceContainerNode *PeekNode(const uint32 idx);
+
+    /**
+     * @brief Inserts a node in the storage. Does not lock the container.
+     * @param[in] node the node to insert.
+     * @param[in] position the position where to insert the node (-1 to add at the end).
+     * @return true if the node was inserted.
+     */
+    bool InsertNode(ReferenceContainerNode * const node,
+                    const int32 position);
+
+    /**
+     * @brief Extracts the node at a given position of the storage. Does not lock the container.
+     * @param[in] idx the position of the node.
+     * @return the extracted node (to be deleted by the caller) or NULL if \a idx is out of range.
+     */
+    ReferenceContainerNode *ExtractNode(const uint32 idx);
+
     /**
      * The list of references
      */
     LinkedListHolderT<ReferenceContainerNode> list;
 
+    /**
+     * The list of references when arrayStorage is true.
+     */
+    StaticList<ReferenceContainerNode *> arrayList;
+
+    /**
+     * True if the references are stored in arrayList.
+     */
+    bool arrayStorage;
+
     
     /**
      * Protects multiple access to the internal resources
@@ -325,6 +399,11 @@ private:
      */
     TimeoutType muxTimeout;
 
+    /**
+     * Number of Insert/Delete operations performed on the list.
+     */
+    volatile uint32 modificationCounter;
+
 };
 
 }
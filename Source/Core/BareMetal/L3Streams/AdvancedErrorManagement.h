@@ -46,6 +46,71 @@ namespace MARTe {
  */
 static const uint32 MAX_ERROR_MESSAGE_SIZE = 200u;
 
+/**
+ * Maximum number of parameters of a logging message (see REPORT_ERROR_MACRO_CHOOSER).
+ */
+static const uint32 MAX_ERROR_MESSAGE_PARAMETERS = 10u;
+
+namespace ErrorManagement {
+
+/**
+ * @brief The type of a user provided function that processes the errors without formatting the message.
+ * @details The function receives the printf-like format of the message and the list of parameters (terminated by
+ * a void AnyType) that would be used to format it. The parameters point at the memory of the caller and are
+ * only valid while the function is executing.
+ */
+typedef void (*DeferredErrorProcessFunctionType)(const ErrorInformation &errorInfo,
+                                                 const char8 * const format,
+                                                 const AnyType * const parameters);
+
+/**
+ * @brief A pointer to the function that will process the errors with parameters without formatting them.
+ * @details NULL (the default) if the messages are to be formatted by ReportErrorParameters.
+ */
+extern DLL_API DeferredErrorProcessFunctionType deferredErrorProcessFunction;
+
+/**
+ * @brief Sets the routine that processes the errors with parameters without formatting them.
+ * @param[in] userFun is a pointer to the function called by ReportErrorParameters. If NULL the messages
+ * are formatted by ReportErrorParameters and sent to the function set with SetErrorProcessFunction.
+ */
+DLL_API void SetDeferredErrorProcessFunction(const DeferredErrorProcessFunctionType userFun);
+
+/**
+ * @brief Reports an error message with parameters.
+ * @details If a DeferredErrorProcessFunctionType is set, the format and the parameters are given to this function
+ * without being formatted. Otherwise the message is formatted (see BufferedStreamI::Printf) into a buffer with
+ * MAX_ERROR_MESSAGE_SIZE characters and reported with ReportError.
+ * @param[in] code is the error code.
+ * @param[in] format is the printf-like format of the message.
+ * @param[in] clsName is the name of the class where the error was triggered (or NULL).
+ * @param[in] objName is the name of the object where the error was triggered (or NULL).
+ * @param[in] objPtr is the pointer to the object where the error was triggered (or NULL).
+ * @param[in] fileName is the name of the file where the error was triggered.
+ * @param[in] lineNumber is the line number where the error was triggered.
+ * @param[in] functionName is the name of the function where the error is triggered.
+ * @param[in] par1 ... par10 the parameters of the message.
+ */
+DLL_API void ReportErrorParameters(const ErrorType &code,
+                                   const char8 * const format,
+                                   const char8 * const clsName,
+                                   const char8 * const objName,
+                                   const void * const objPtr,
+                                   const char8 * const fileName,
+                                   const int16 lineNumber,
+                                   const char8 * const functionName,
+                                   const AnyType &par1,
+                                   const AnyType &par2 = voidAnyType,
+                                   const AnyType &par3 = voidAnyType,
+                                   const AnyType &par4 = voidAnyType,
+                                   const AnyType &par5 = voidAnyType,
+                                   const AnyType &par6 = voidAnyType,
+                                   const AnyType &par7 = voidAnyType,
+                                   const AnyType &par8 = voidAnyType,
+                                   const AnyType &par9 = voidAnyType,
+                                   const AnyType &par10 = voidAnyType);
+}
+
 /**
  * @brief The REPORT_ERROR_STATIC_U is not to be used. It serves as the one parameter choice for the REPORT_ERROR_STATIC_MACRO_CHOOSER macro.
  */
@@ -64,11 +129,7 @@ do {                                                                        \
 #define REPORT_ERROR_STATIC_PARAMETERS(code, message,...)                              \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
-    MARTe::ErrorManagement::ReportError(code,&buffer[0], NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::ErrorManagement::ReportErrorParameters(code, reinterpret_cast<const MARTe::char8 *>(message), NULL_PTR(const MARTe::char8* ), NULL_PTR(const MARTe::char8* ), NULL_PTR(const void* ), __FILE__,__LINE__,__ERROR_FUNCTION_NAME__,__VA_ARGS__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
@@ -118,16 +179,12 @@ do {                                                                        \
 #define REPORT_ERROR_PARAMETERS(code, message,...)                                     \
 /*lint -save -e717 Let lint know that we know that we are doing while(0)*/             \
 do {                                                                                   \
-    MARTe::char8 buffer[MARTe::MAX_ERROR_MESSAGE_SIZE+1u];                             \
-    MARTe::StreamMemoryReference smr(&buffer[0],MARTe::MAX_ERROR_MESSAGE_SIZE);        \
-    (void) (smr.Printf(reinterpret_cast<const MARTe::char8 *>(message),__VA_ARGS__));  \
-    buffer[smr.Size()]='\0';                                                           \
     const MARTe::char8 *pClassName = "Unknown";                                        \
     const MARTe::ClassProperties *cProperties = GetClassProperties();                  \
     if (cProperties != NULL_PTR(const MARTe::ClassProperties *)) {                     \
         pClassName = cProperties->GetName();                                           \
     }                                                                                  \
-    MARTe::ErrorManagement::ReportError(code, &buffer[0], pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__); \
+    MARTe::ErrorManagement::ReportErrorParameters(code, reinterpret_cast<const MARTe::char8 *>(message), pClassName, GetName(), this, __FILE__,__LINE__,__ERROR_FUNCTION_NAME__,__VA_ARGS__); \
 } while(false) /*lint -restore */ //Protect scope with the {} and force to end with ;
 
 /**
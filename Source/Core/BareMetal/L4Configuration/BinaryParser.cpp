@@ -0,0 +1,326 @@
+/**
+ * @file BinaryParser.cpp
+ * @brief Source file for class BinaryParser
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryParser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "BinaryParser.h"
+#include "HeapManager.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamMemoryReference.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BinaryParser::BinaryParser(StreamI &stream,
+                           StructuredDataI &databaseIn,
+                           BufferedStreamI * const err) {
+    inputStream = &stream;
+    database = &databaseIn;
+    errorStream = err;
+    records = static_cast<const char8 *>(NULL);
+    numberOfRecords = 0u;
+    stringTable = static_cast<const char8 *>(NULL);
+    stringTableSize = 0u;
+    data = static_cast<const char8 *>(NULL);
+    dataSize = 0u;
+}
+
+BinaryParser::~BinaryParser() {
+    inputStream = static_cast<StreamI *>(NULL);
+    database = static_cast<StructuredDataI *>(NULL);
+    errorStream = static_cast<BufferedStreamI *>(NULL);
+    records = static_cast<const char8 *>(NULL);
+    stringTable = static_cast<const char8 *>(NULL);
+    data = static_cast<const char8 *>(NULL);
+}
+
+void BinaryParser::PrintError(const char8 * const message) {
+    if (errorStream != NULL) {
+        if (!errorStream->Printf("%s", message)) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "PrintError: Failed Printf() on parseError stream");
+        }
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s", message);
+}
+
+bool BinaryParser::Parse() {
+    const char8 *memory = static_cast<const char8 *>(NULL);
+    char8 *memoryCopy = static_cast<char8 *>(NULL);
+    uint64 position = inputStream->Position();
+    uint64 size = inputStream->Size();
+    bool ok = (size >= position);
+    if (ok) {
+        size -= position;
+        ok = (size >= static_cast<uint64>(sizeof(BinaryConfigurationHeader)));
+        if (!ok) {
+            PrintError("The binary configuration is too small");
+        }
+    }
+    if (ok) {
+        //If the binary configuration is already in memory (e.g. a memory mapped file), read it in-place.
+        StreamMemoryReference *memoryReference = dynamic_cast<StreamMemoryReference *>(inputStream);
+        if (memoryReference != NULL_PTR(StreamMemoryReference *)) {
+            memory = &(memoryReference->Buffer()[position]);
+            /*lint -e{923} -e{9091} Justification: the pointer is converted to an integer only to check its alignment.*/
+            if ((reinterpret_cast<uintp>(memory) % BinaryConfiguration::ALIGNMENT) != 0u) {
+                memory = static_cast<const char8 *>(NULL);
+            }
+            else {
+                ok = memoryReference->Seek(position + size);
+            }
+        }
+    }
+    if ((ok) && (memory == NULL)) {
+        ok = (size < 0xFFFFFFFFull);
+        uint32 readSize = static_cast<uint32>(size);
+        if (ok) {
+            memoryCopy = static_cast<char8 *>(HeapManager::Malloc(readSize));
+            ok = (memoryCopy != NULL);
+        }
+        if (ok) {
+            ok = inputStream->Read(memoryCopy, readSize);
+        }
+        if (ok) {
+            ok = (readSize == static_cast<uint32>(size));
+        }
+        if (!ok) {
+            PrintError("Failed to read the binary configuration");
+        }
+        memory = memoryCopy;
+    }
+    BinaryConfigurationHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, memory, static_cast<uint32>(sizeof(BinaryConfigurationHeader)));
+    }
+    if (ok) {
+        ok = (header.magic == BinaryConfiguration::MAGIC);
+        if (!ok) {
+            PrintError("Not a binary configuration (or incompatible byte order)");
+        }
+    }
+    if (ok) {
+        ok = (header.version == BinaryConfiguration::VERSION);
+        if (!ok) {
+            PrintError("Unsupported binary configuration version");
+        }
+    }
+    if (ok) {
+        uint64 recordsSize = static_cast<uint64>(header.numberOfRecords) * sizeof(BinaryConfigurationRecord);
+        uint64 expectedSize = static_cast<uint64>(sizeof(BinaryConfigurationHeader)) + recordsSize;
+        expectedSize += static_cast<uint64>(header.stringTableSize);
+        expectedSize += static_cast<uint64>(header.dataSize);
+        ok = (expectedSize <= size);
+        if (ok) {
+            numberOfRecords = header.numberOfRecords;
+            records = &memory[sizeof(BinaryConfigurationHeader)];
+            stringTableSize = header.stringTableSize;
+            stringTable = &records[recordsSize];
+            dataSize = header.dataSize;
+            data = &stringTable[stringTableSize];
+        }
+        else {
+            PrintError("The binary configuration is truncated");
+        }
+    }
+    if ((ok) && (numberOfRecords > 0u)) {
+        //All the names are zero terminated inside the string table.
+        ok = (stringTableSize > 0u);
+        if (ok) {
+            ok = (stringTable[stringTableSize - 1u] == '\0');
+        }
+        if (!ok) {
+            PrintError("Invalid string table");
+        }
+    }
+    if (ok) {
+        ok = ParseRecords(0u, numberOfRecords);
+    }
+    if (ok) {
+        ok = database->MoveToRoot();
+    }
+    if (memoryCopy != NULL) {
+        void *toFree = reinterpret_cast<void *>(memoryCopy);
+        if (!HeapManager::Free(toFree)) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed HeapManager::Free()");
+        }
+    }
+    records = static_cast<const char8 *>(NULL);
+    stringTable = static_cast<const char8 *>(NULL);
+    data = static_cast<const char8 *>(NULL);
+    return ok;
+}
+
+bool BinaryParser::ParseRecords(const uint32 firstRecord,
+                                const uint32 lastRecord) {
+    bool ok = true;
+    uint32 i = firstRecord;
+    while ((i < lastRecord) && (ok)) {
+        BinaryConfigurationRecord record;
+        ok = MemoryOperationsHelper::Copy(&record, &records[i * static_cast<uint32>(sizeof(BinaryConfigurationRecord))],
+                                          static_cast<uint32>(sizeof(BinaryConfigurationRecord)));
+        if (ok) {
+            ok = ((record.nextSibling > i) && (record.nextSibling <= lastRecord) && (record.nameOffset < stringTableSize));
+            if (!ok) {
+                PrintError("Invalid record");
+            }
+        }
+        if (ok) {
+            const char8 * const name = &stringTable[record.nameOffset];
+            if (record.kind == BinaryConfiguration::NODE) {
+                ok = database->CreateRelative(name);
+                if (ok) {
+                    ok = ParseRecords(i + 1u, record.nextSibling);
+                }
+                if (ok) {
+                    ok = database->MoveToAncestor(1u);
+                }
+                if (!ok) {
+                    PrintError("Failed to create a node");
+                }
+            }
+            else {
+                ok = (record.nextSibling == (i + 1u));
+                if (ok) {
+                    ok = ParseLeaf(record, name);
+                }
+                if (!ok) {
+                    PrintError("Failed to add a leaf");
+                }
+            }
+        }
+        i = record.nextSibling;
+    }
+    return ok;
+}
+
+bool BinaryParser::ParseLeaf(const BinaryConfigurationRecord &record,
+                             const char8 * const name) {
+    bool ok = (record.numberOfDimensions < 3u);
+    uint32 numberOfColumns = 1u;
+    uint32 numberOfRows = 1u;
+    if (record.numberOfDimensions > 0u) {
+        numberOfColumns = record.numberOfColumns;
+    }
+    if (record.numberOfDimensions > 1u) {
+        numberOfRows = record.numberOfRows;
+    }
+    uint64 numberOfElements = static_cast<uint64>(numberOfColumns) * numberOfRows;
+    if (ok) {
+        ok = ((numberOfElements > 0u) && (record.dataOffset <= dataSize));
+    }
+    if (ok) {
+        ok = (record.dataSize <= (dataSize - record.dataOffset));
+    }
+    const char8 * const leafData = &data[record.dataOffset];
+    AnyType leaf;
+    char8 **strings = NULL_PTR(char8 **);
+    if (ok) {
+        if (record.kind == BinaryConfiguration::STRING) {
+            //Each element is zero terminated inside the leaf data.
+            ok = (record.dataSize > 0u);
+            if (ok) {
+                ok = (leafData[record.dataSize - 1u] == '\0');
+            }
+            if ((ok) && (record.numberOfDimensions == 0u)) {
+                ok = ((StringHelper::Length(leafData) + 1u) == record.dataSize);
+                /*lint -e{9005} Justification: the data is only read (and copied) by StructuredDataI::Write.*/
+                leaf = AnyType(CharString, 0u, const_cast<char8 *>(leafData));
+            }
+            else if (ok) {
+                ok = (numberOfElements <= record.dataSize);
+                if (ok) {
+                    strings = new char8*[static_cast<uint32>(numberOfElements)];
+                }
+                uint32 offset = 0u;
+                for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                    ok = (offset < record.dataSize);
+                    if (ok) {
+                        /*lint -e{9005} Justification: the data is only read (and copied) by StructuredDataI::Write.*/
+                        strings[e] = const_cast<char8 *>(&leafData[offset]);
+                        offset += (StringHelper::Length(strings[e]) + 1u);
+                    }
+                }
+                if (ok) {
+                    ok = (offset == record.dataSize);
+                }
+                leaf = AnyType(CharString, 0u, reinterpret_cast<void *>(strings));
+            }
+            else {
+                //NOOP
+            }
+        }
+        else {
+            uint16 type = 0u;
+            if (record.kind == BinaryConfiguration::SIGNED_INTEGER) {
+                type = SignedInteger;
+            }
+            else if (record.kind == BinaryConfiguration::UNSIGNED_INTEGER) {
+                type = UnsignedInteger;
+            }
+            else if (record.kind == BinaryConfiguration::FLOAT) {
+                type = Float;
+            }
+            else {
+                ok = false;
+            }
+            if (ok) {
+                ok = ((record.numberOfBits == 8u) || (record.numberOfBits == 16u) || (record.numberOfBits == 32u) || (record.numberOfBits == 64u));
+            }
+            if (ok) {
+                ok = ((numberOfElements * (record.numberOfBits / 8u)) == record.dataSize);
+            }
+            if (ok) {
+                /*lint -e{9005} Justification: the data is only read (and copied) by StructuredDataI::Write.*/
+                leaf = AnyType(TypeDescriptor(false, type, static_cast<uint16>(record.numberOfBits)), 0u, const_cast<char8 *>(leafData));
+            }
+        }
+    }
+    if (ok) {
+        leaf.SetNumberOfDimensions(static_cast<uint8>(record.numberOfDimensions));
+        leaf.SetNumberOfElements(0u, numberOfColumns);
+        leaf.SetNumberOfElements(1u, numberOfRows);
+        leaf.SetNumberOfElements(2u, 1u);
+        ok = database->Write(name, leaf);
+    }
+    if (strings != NULL) {
+        delete[] strings;
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,301 @@
+/**
+ * @file BinaryParser.h
+ * @brief Header file for class BinaryParser
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BinaryParser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BINARYPARSER_H_
+#define BINARYPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BufferedStreamI.h"
+#include "StreamI.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Constants of the binary configuration format (see BinaryParser and BinaryWriter).
+ */
+namespace BinaryConfiguration {
+
+/**
+ * The first four bytes of a binary configuration ("MCDB").
+ */
+static const uint32 MAGIC = 0x4244434Du;
+
+/**
+ * The version of the binary configuration format.
+ */
+static const uint32 VERSION = 1u;
+
+/**
+ * The alignment (in bytes) of the sections and of the leaves data.
+ */
+static const uint32 ALIGNMENT = 8u;
+
+/**
+ * Record kind of a node.
+ */
+static const uint32 NODE = 0u;
+
+/**
+ * Record kind of a signed integer leaf.
+ */
+static const uint32 SIGNED_INTEGER = 1u;
+
+/**
+ * Record kind of an unsigned integer leaf.
+ */
+static const uint32 UNSIGNED_INTEGER = 2u;
+
+/**
+ * Record kind of a floating point leaf.
+ */
+static const uint32 FLOAT = 3u;
+
+/**
+ * Record kind of a string leaf.
+ */
+static const uint32 STRING = 4u;
+
+}
+
+/**
+ * @brief Header of a binary configuration.
+ */
+struct BinaryConfigurationHeader {
+    /**
+     * BinaryConfiguration::MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * BinaryConfiguration::VERSION.
+     */
+    uint32 version;
+
+    /**
+     * Number of BinaryConfigurationRecord that follow the header.
+     */
+    uint32 numberOfRecords;
+
+    /**
+     * Size in bytes of the string table (which follows the records).
+     */
+    uint32 stringTableSize;
+
+    /**
+     * Size in bytes of the data section (which follows the string table).
+     */
+    uint32 dataSize;
+
+    /**
+     * Reserved (keeps the records aligned).
+     */
+    uint32 reserved;
+};
+
+/**
+ * @brief A node or a leaf of a binary configuration.
+ * @details The records are stored in pre-order (i.e. a node is followed by all the records of its subtree).
+ */
+struct BinaryConfigurationRecord {
+    /**
+     * Offset of the (zero terminated) name in the string table.
+     */
+    uint32 nameOffset;
+
+    /**
+     * One of the BinaryConfiguration record kinds.
+     */
+    uint32 kind;
+
+    /**
+     * Number of bits of each element (leaves only).
+     */
+    uint32 numberOfBits;
+
+    /**
+     * Number of dimensions (0, 1 or 2) of the leaf.
+     */
+    uint32 numberOfDimensions;
+
+    /**
+     * Number of columns of the leaf.
+     */
+    uint32 numberOfColumns;
+
+    /**
+     * Number of rows of the leaf.
+     */
+    uint32 numberOfRows;
+
+    /**
+     * Index of the record that follows the subtree of this record.
+     */
+    uint32 nextSibling;
+
+    /**
+     * Offset of the leaf data in the data section. Numeric leaves are stored as packed arrays (row-major) and
+     * string leaves as a sequence of zero terminated strings.
+     */
+    uint32 dataOffset;
+
+    /**
+     * Size in bytes of the leaf data.
+     */
+    uint32 dataSize;
+
+    /**
+     * Reserved (keeps the records aligned).
+     */
+    uint32 reserved;
+};
+
+/**
+ * @brief Builds a StructuredDataI from a binary configuration (see BinaryWriter).
+ *
+ * @details A binary configuration is a compact, already typed, serialisation of a StructuredDataI:
+ * a BinaryConfigurationHeader followed by the BinaryConfigurationRecord array (one for each node and leaf, in pre-order),
+ * by a string table with all the node and leaf names and by the leaves data.
+ *
+ * Parsing does not require any lexical analysis nor type conversion. If the input stream is a StreamMemoryReference
+ * (e.g. a memory mapped file) the data is read in-place, otherwise the stream is first read to memory.
+ *
+ * The binary configuration uses the native byte order and is rejected if the header does not match.
+ *
+ * This class has the same interface of the text parsers (e.g. StandardParser) and can be selected in the Loader with Parser = "bin".
+ */
+class DLL_API BinaryParser {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] stream is the stream to be parsed.
+     * @param[out] databaseIn is the built StructuredData in output.
+     * @param[out] err is the stream where error messages are printed to.
+     */
+    BinaryParser(StreamI &stream,
+                 StructuredDataI &databaseIn,
+                 BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BinaryParser();
+
+    /**
+     * @brief Parses the stream in input (from its current position) and builds the configuration database accordingly.
+     * @return true if the stream in input is a valid binary configuration and all the nodes and leaves could be written into the database.
+     * In case of failure, the error causing the failure is printed on the \a err stream in input (if it is not NULL).
+     */
+    bool Parse();
+
+private:
+
+    /**
+     * @brief Writes the records in the range [firstRecord, lastRecord[ in the current node of the database.
+     * @param[in] firstRecord the index of the first record.
+     * @param[in] lastRecord the index of the record after the last record.
+     * @return true if all the records are valid and could be written.
+     */
+    bool ParseRecords(const uint32 firstRecord,
+                      const uint32 lastRecord);
+
+    /**
+     * @brief Writes a leaf record in the current node of the database.
+     * @param[in] record the leaf record.
+     * @param[in] name the leaf name.
+     * @return true if the record is valid and could be written.
+     */
+    bool ParseLeaf(const BinaryConfigurationRecord &record,
+                   const char8 * const name);
+
+    /**
+     * @brief Prints an error in the error stream.
+     * @param[in] message the error message.
+     */
+    void PrintError(const char8 * const message);
+
+    /**
+     * The stream to be parsed.
+     */
+    StreamI *inputStream;
+
+    /**
+     * The StructuredData to be built.
+     */
+    StructuredDataI *database;
+
+    /**
+     * The stream to print the error messages.
+     */
+    BufferedStreamI *errorStream;
+
+    /**
+     * The records (pointing into the binary configuration memory).
+     */
+    const char8 *records;
+
+    /**
+     * The number of records.
+     */
+    uint32 numberOfRecords;
+
+    /**
+     * The string table (pointing into the binary configuration memory).
+     */
+    const char8 *stringTable;
+
+    /**
+     * The size of the string table.
+     */
+    uint32 stringTableSize;
+
+    /**
+     * The data section (pointing into the binary configuration memory).
+     */
+    const char8 *data;
+
+    /**
+     * The size of the data section.
+     */
+    uint32 dataSize;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BINARYPARSER_H_ */
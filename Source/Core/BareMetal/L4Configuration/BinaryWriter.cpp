@@ -0,0 +1,307 @@
+/**
+ * @file BinaryWriter.cpp
+ * @brief Source file for class BinaryWriter
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryWriter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "BinaryWriter.h"
+#include "Matrix.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BinaryWriter::BinaryWriter(StreamI &stream,
+                           StructuredDataI &databaseIn,
+                           BufferedStreamI * const err) :
+        stringTableIndex() {
+    outputStream = &stream;
+    database = &databaseIn;
+    errorStream = err;
+    numberOfRecords = 0u;
+}
+
+BinaryWriter::~BinaryWriter() {
+    outputStream = static_cast<StreamI *>(NULL);
+    database = static_cast<StructuredDataI *>(NULL);
+    errorStream = static_cast<BufferedStreamI *>(NULL);
+}
+
+void BinaryWriter::PrintError(const char8 * const message,
+                              const char8 * const name) {
+    if (errorStream != NULL) {
+        if (!errorStream->Printf("%s [%s]", message, name)) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "PrintError: Failed Printf() on error stream");
+        }
+    }
+    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s [%s]", message, name);
+}
+
+bool BinaryWriter::Align(StreamString &stream) {
+    bool ok = true;
+    while (((stream.Size() % BinaryConfiguration::ALIGNMENT) != 0u) && (ok)) {
+        uint32 paddingSize = 1u;
+        ok = stream.Write("\0", paddingSize);
+    }
+    return ok;
+}
+
+uint32 BinaryWriter::AddName(const char8 * const name) {
+    uint32 offset = 0u;
+    uint32 index = 0u;
+    bool found = stringTableIndex.Search(name, index);
+    if (found) {
+        offset = stringTableIndex[index];
+        found = (StringHelper::Compare(&(stringTable.Buffer()[offset]), name) == 0);
+    }
+    if (!found) {
+        offset = static_cast<uint32>(stringTable.Size());
+        uint32 nameSize = StringHelper::Length(name) + 1u;
+        if (stringTable.Write(name, nameSize)) {
+            //On a hash collision the name is simply not indexed.
+            (void) stringTableIndex.Insert(name, offset);
+        }
+    }
+    return offset;
+}
+
+bool BinaryWriter::Write() {
+    numberOfRecords = 0u;
+    bool ok = records.SetSize(0ull);
+    if (ok) {
+        ok = stringTable.SetSize(0ull);
+    }
+    if (ok) {
+        ok = data.SetSize(0ull);
+    }
+    stringTableIndex.Reset();
+    if (ok) {
+        ok = WriteNode();
+    }
+    if (ok) {
+        ok = Align(stringTable);
+    }
+    if (ok) {
+        ok = Align(data);
+    }
+    BinaryConfigurationHeader header;
+    header.magic = BinaryConfiguration::MAGIC;
+    header.version = BinaryConfiguration::VERSION;
+    header.numberOfRecords = numberOfRecords;
+    header.stringTableSize = static_cast<uint32>(stringTable.Size());
+    header.dataSize = static_cast<uint32>(data.Size());
+    header.reserved = 0u;
+    if (ok) {
+        uint32 size = static_cast<uint32>(sizeof(BinaryConfigurationHeader));
+        ok = outputStream->Write(reinterpret_cast<const char8 *>(&header), size);
+    }
+    if (ok) {
+        uint32 size = static_cast<uint32>(records.Size());
+        ok = outputStream->Write(records.Buffer(), size);
+    }
+    if (ok) {
+        uint32 size = static_cast<uint32>(stringTable.Size());
+        ok = outputStream->Write(stringTable.Buffer(), size);
+    }
+    if (ok) {
+        uint32 size = static_cast<uint32>(data.Size());
+        ok = outputStream->Write(data.Buffer(), size);
+    }
+    if (!ok) {
+        PrintError("Failed to write the binary configuration", "");
+    }
+    return ok;
+}
+
+bool BinaryWriter::WriteNode() {
+    bool ok = true;
+    uint32 numberOfChildren = database->GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        StreamString name = database->GetChildName(i);
+        BinaryConfigurationRecord record;
+        record.nameOffset = AddName(name.Buffer());
+        record.kind = BinaryConfiguration::NODE;
+        record.numberOfBits = 0u;
+        record.numberOfDimensions = 0u;
+        record.numberOfColumns = 0u;
+        record.numberOfRows = 0u;
+        record.nextSibling = 0u;
+        record.dataOffset = 0u;
+        record.dataSize = 0u;
+        record.reserved = 0u;
+        uint32 recordSize = static_cast<uint32>(sizeof(BinaryConfigurationRecord));
+        uint64 recordPosition = records.Size();
+        if (database->MoveToChild(i)) {
+            //Reserve the record and patch the nextSibling once the subtree is written.
+            ok = records.Write(reinterpret_cast<const char8 *>(&record), recordSize);
+            numberOfRecords++;
+            if (ok) {
+                ok = WriteNode();
+            }
+            if (ok) {
+                ok = database->MoveToAncestor(1u);
+            }
+            if (ok) {
+                record.nextSibling = numberOfRecords;
+                ok = records.Seek(recordPosition);
+            }
+            if (ok) {
+                ok = records.Write(reinterpret_cast<const char8 *>(&record), recordSize);
+            }
+            if (ok) {
+                ok = records.Seek(records.Size());
+            }
+        }
+        else {
+            ok = WriteLeaf(name.Buffer(), record);
+            if (ok) {
+                record.nextSibling = numberOfRecords + 1u;
+                ok = records.Write(reinterpret_cast<const char8 *>(&record), recordSize);
+                numberOfRecords++;
+            }
+        }
+    }
+    return ok;
+}
+
+bool BinaryWriter::WriteLeaf(const char8 * const name,
+                             BinaryConfigurationRecord &record) {
+    AnyType leaf = database->GetType(name);
+    TypeDescriptor descriptor = leaf.GetTypeDescriptor();
+    uint32 numberOfDimensions = leaf.GetNumberOfDimensions();
+    bool ok = ((!descriptor.isStructuredData) && (numberOfDimensions < 3u) && (!leaf.IsVoid()));
+    uint32 numberOfColumns = 1u;
+    uint32 numberOfRows = 1u;
+    if (numberOfDimensions > 0u) {
+        numberOfColumns = leaf.GetNumberOfElements(0u);
+    }
+    if (numberOfDimensions > 1u) {
+        numberOfRows = leaf.GetNumberOfElements(1u);
+    }
+    uint32 numberOfElements = numberOfColumns * numberOfRows;
+    if (ok) {
+        ok = (numberOfElements > 0u);
+    }
+    if (!ok) {
+        PrintError("Unsupported leaf", name);
+    }
+    record.numberOfDimensions = numberOfDimensions;
+    record.numberOfColumns = numberOfColumns;
+    record.numberOfRows = numberOfRows;
+
+    uint32 numberOfBits = descriptor.numberOfBits;
+    bool isNumeric = ((numberOfBits == 8u) || (numberOfBits == 16u) || (numberOfBits == 32u) || (numberOfBits == 64u));
+    if (descriptor.type == SignedInteger) {
+        record.kind = BinaryConfiguration::SIGNED_INTEGER;
+    }
+    else if (descriptor.type == UnsignedInteger) {
+        record.kind = BinaryConfiguration::UNSIGNED_INTEGER;
+    }
+    else if (descriptor.type == Float) {
+        record.kind = BinaryConfiguration::FLOAT;
+        isNumeric = ((numberOfBits == 32u) || (numberOfBits == 64u));
+    }
+    else {
+        isNumeric = false;
+    }
+    if ((ok) && (isNumeric)) {
+        //Read the leaf as a packed array and append it to the data section.
+        record.numberOfBits = numberOfBits;
+        record.dataSize = numberOfElements * (numberOfBits / 8u);
+        ok = Align(data);
+        record.dataOffset = static_cast<uint32>(data.Size());
+        char8 *packedData = new char8[record.dataSize];
+        if (ok) {
+            AnyType packed(TypeDescriptor(false, descriptor.type, static_cast<uint16>(numberOfBits)), 0u, packedData);
+            packed.SetNumberOfDimensions(static_cast<uint8>(numberOfDimensions));
+            packed.SetNumberOfElements(0u, numberOfColumns);
+            packed.SetNumberOfElements(1u, numberOfRows);
+            packed.SetNumberOfElements(2u, 1u);
+            ok = database->Read(name, packed);
+        }
+        if (ok) {
+            uint32 packedSize = record.dataSize;
+            ok = data.Write(packedData, packedSize);
+        }
+        delete[] packedData;
+        if (!ok) {
+            PrintError("Failed to serialise numeric leaf", name);
+        }
+    }
+    else if (ok) {
+        //A character array (e.g. char8 str[N] or char8 str[M][N]) holds one string per row.
+        if (descriptor.type == CArray) {
+            numberOfDimensions--;
+            numberOfColumns = numberOfRows;
+            numberOfRows = 1u;
+            numberOfElements = numberOfColumns;
+            record.numberOfDimensions = numberOfDimensions;
+            record.numberOfColumns = numberOfColumns;
+            record.numberOfRows = numberOfRows;
+        }
+        record.kind = BinaryConfiguration::STRING;
+        record.numberOfBits = 8u;
+        record.dataOffset = static_cast<uint32>(data.Size());
+        StreamString *strings = new StreamString[numberOfElements];
+        if (numberOfDimensions == 0u) {
+            ok = database->Read(name, strings[0]);
+        }
+        else if (numberOfDimensions == 1u) {
+            Vector<StreamString> stringsVector(strings, numberOfElements);
+            ok = database->Read(name, stringsVector);
+        }
+        else {
+            Matrix<StreamString> stringsMatrix(strings, numberOfRows, numberOfColumns);
+            ok = database->Read(name, stringsMatrix);
+        }
+        for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+            uint32 stringSize = static_cast<uint32>(strings[e].Size()) + 1u;
+            ok = data.Write(strings[e].Buffer(), stringSize);
+        }
+        record.dataSize = static_cast<uint32>(data.Size()) - record.dataOffset;
+        delete[] strings;
+        if (!ok) {
+            PrintError("Failed to serialise string leaf", name);
+        }
+    }
+    else {
+        //NOOP
+    }
+    return ok;
+}
+
+}
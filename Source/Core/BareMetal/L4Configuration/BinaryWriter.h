@@ -0,0 +1,177 @@
+/**
+ * @file BinaryWriter.h
+ * @brief Header file for class BinaryWriter
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BinaryWriter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BINARYWRITER_H_
+#define BINARYWRITER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BinaryParser.h"
+#include "BinaryTree.h"
+#include "Fnv1aHashFunction.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Serialises a StructuredDataI into a binary configuration (see BinaryParser for the format description).
+ *
+ * @details The subtree of the current node of the StructuredDataI is written. Numeric leaves (signed and unsigned integers
+ * of 8, 16, 32 and 64 bits and floats of 32 and 64 bits) keep their type. Any other leaf is converted to string.
+ * Leaves with more than two dimensions are not supported.
+ *
+ * Node and leaf names are written only once in the string table.
+ *
+ * @details Usage example (converting a text configuration into a binary configuration):
+ * <pre>
+ * ConfigurationDatabase cdb;
+ * StandardParser parser(textStream, cdb);
+ * ok = parser.Parse();
+ * ...
+ * BinaryWriter writer(binaryStream, cdb);
+ * ok = writer.Write();
+ * </pre>
+ */
+class DLL_API BinaryWriter {
+
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[out] stream is the stream where the binary configuration is written.
+     * @param[in] databaseIn is the StructuredData to be serialised.
+     * @param[out] err is the stream where error messages are printed to.
+     */
+    BinaryWriter(StreamI &stream,
+                 StructuredDataI &databaseIn,
+                 BufferedStreamI * const err = static_cast<BufferedStreamI*>(NULL));
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~BinaryWriter();
+
+    /**
+     * @brief Writes the subtree of the current node of the StructuredDataI into the stream (from its current position).
+     * @return true if all the nodes and leaves could be serialised and the binary configuration was written in the stream.
+     * @post
+     *   The StructuredDataI is at the same node.
+     */
+    bool Write();
+
+private:
+
+    /**
+     * @brief Adds the records of all the children of the current node.
+     * @return true if all the children could be serialised.
+     */
+    bool WriteNode();
+
+    /**
+     * @brief Adds the record of the leaf \a name of the current node.
+     * @param[in] name the name of the leaf.
+     * @param[in, out] record the leaf record to be completed.
+     * @return true if the leaf could be serialised.
+     */
+    bool WriteLeaf(const char8 * const name,
+                   BinaryConfigurationRecord &record);
+
+    /**
+     * @brief Gets the offset of \a name in the string table (adding it if needed).
+     * @param[in] name the name to add.
+     * @return the offset of \a name in the string table.
+     */
+    uint32 AddName(const char8 * const name);
+
+    /**
+     * @brief Pads \a stream with zeros to a multiple of BinaryConfiguration::ALIGNMENT.
+     * @param[in, out] stream the stream to be padded.
+     * @return true if the padding could be written.
+     */
+    static bool Align(StreamString &stream);
+
+    /**
+     * @brief Prints an error in the error stream.
+     * @param[in] message the error message.
+     * @param[in] name the name of the node or leaf that caused the error.
+     */
+    void PrintError(const char8 * const message,
+                    const char8 * const name);
+
+    /**
+     * The stream to be written.
+     */
+    StreamI *outputStream;
+
+    /**
+     * The StructuredData to be serialised.
+     */
+    StructuredDataI *database;
+
+    /**
+     * The stream to print the error messages.
+     */
+    BufferedStreamI *errorStream;
+
+    /**
+     * The records.
+     */
+    StreamString records;
+
+    /**
+     * The number of records.
+     */
+    uint32 numberOfRecords;
+
+    /**
+     * The string table.
+     */
+    StreamString stringTable;
+
+    /**
+     * Offsets of the names already in the string table.
+     */
+    BinaryTree<uint32, Fnv1aHashFunction> stringTableIndex;
+
+    /**
+     * The data section.
+     */
+    StreamString data;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BINARYWRITER_H_ */
@@ -32,6 +32,8 @@
 
 #include "AdvancedErrorManagement.h"
 #include "AnyObject.h"
+#include "BinaryParser.h"
+#include "BinaryWriter.h"
 #include "ErrorType.h"
 #include "ConfigurationDatabase.h"
 #include "StreamString.h"
@@ -182,6 +184,19 @@ bool ConfigurationDatabase::Initialise(StructuredDataI &data) {
     return ok;
 }
 
+bool ConfigurationDatabase::ExportBinary(StreamI &stream) {
+    BinaryWriter writer(stream, *this);
+    return writer.Write();
+}
+
+bool ConfigurationDatabase::ImportBinary(StreamI &stream) {
+    ReferenceT<ConfigurationDatabaseNode> storeCurrentNode = currentNode;
+    BinaryParser parser(stream, *this);
+    bool ok = parser.Parse();
+    currentNode = storeCurrentNode;
+    return ok;
+}
+
 bool ConfigurationDatabase::MoveToRoot() {
     bool ok = rootNode.IsValid();
     if (ok) {
@@ -37,6 +37,7 @@
 #include "ReferenceT.h"
 #include "ReferenceContainer.h"
 #include "ReferenceContainerFilterObjectName.h"
+#include "StreamI.h"
 #include "StructuredDataI.h"
 #include "TypeConversion.h"
 
@@ -188,6 +189,25 @@ ConfigurationDatabase    ();
      */
     virtual bool Initialise(StructuredDataI &data);
 
+    /**
+     * @brief Serialises the subtree of the current node into a binary configuration (see BinaryWriter).
+     * @param[out] stream the stream where the binary configuration is written.
+     * @return true if the subtree could be serialised and written in the stream.
+     * @post
+     *   The current node is not changed.
+     */
+    bool ExportBinary(StreamI &stream);
+
+    /**
+     * @brief Adds the nodes and leaves of a binary configuration (see BinaryParser) to the current node.
+     * @details Parsing a binary configuration does not require any lexical analysis nor type conversion.
+     * @param[in] stream the stream with the binary configuration (read from its current position).
+     * @return true if the binary configuration is valid and could be added to the current node.
+     * @post
+     *   The current node is not changed.
+     */
+    bool ImportBinary(StreamI &stream);
+
     /**
      * @brief Locks the shared semaphore.
      * @param[in] timeout maximum time to wait for the semaphore to be unlocked.
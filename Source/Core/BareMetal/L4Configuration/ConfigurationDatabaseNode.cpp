@@ -31,6 +31,7 @@
 #include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabaseNode.h"
 #include "StreamString.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -49,6 +50,8 @@ ConfigurationDatabaseNode::ConfigurationDatabaseNode() :
     maxSize = 0u;
     container = NULL_PTR(Reference *);
     muxTimeout = TTInfiniteWait;
+    indexed = false;
+    indexCollisions = false;
 }
 
 /*lint -e{1579} .Justification: The destructor calls an external function. */
@@ -75,10 +78,17 @@ void ConfigurationDatabaseNode::Purge() {
     containerSize = 0u;
     maxSize = 0u;
     binTree.Reset();
+    indexed = false;
+    indexCollisions = false;
 }
 
 bool ConfigurationDatabaseNode::Insert(Reference ref) {
     bool ok = Lock();
+    if (ok) {
+        //The names are unique inside a node
+        uint32 existingIndex;
+        ok = !FindIndex(ref->GetName(), existingIndex);
+    }
     if (ok) {
         uint32 index = containerSize;
         if (index >= maxSize) {
@@ -101,10 +111,18 @@ bool ConfigurationDatabaseNode::Insert(Reference ref) {
             }
         }
         container[index] = ref;
-        ok = (binTree.Insert(ref->GetName(), index) != 0xFFFFFFFFu);
-    }
-    if (ok) {
         containerSize++;
+        if (indexed) {
+            if (binTree.Insert(ref->GetName(), index) == 0xFFFFFFFFu) {
+                indexCollisions = true;
+            }
+        }
+        else if (containerSize >= CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) {
+            BuildIndex();
+        }
+        else {
+            //NOOP
+        }
     }
     UnLock();
     return ok;
@@ -139,30 +157,26 @@ Reference ConfigurationDatabaseNode::Find(const char8 * const path) {
     char8 term;
 
     if (toTokenize.GetToken(token, ".", term)) {
-        uint32 bindex;
-        //binary search
+        uint32 index;
         if (Lock()) {
-            if (binTree.Search(token.Buffer(), bindex)) {
-                uint32 index = binTree[bindex];
-                if (index < containerSize) {
-                    if (term == '.') {
-                        ReferenceT<ConfigurationDatabaseNode> containerI;
-                        containerI = container[index];
-                        UnLock();
-                        if (containerI.IsValid()) {
-                            StreamString next = &toTokenize.Buffer()[token.Size() + 1u];
-                            if (next.Size() > 0u) {
-                                //continue only for the path
-                                ret = containerI->Find(next.Buffer());
-                            }
-                            else {
-                                ret = containerI;
-                            }
+            if (FindIndex(token.Buffer(), index)) {
+                if (term == '.') {
+                    ReferenceT<ConfigurationDatabaseNode> containerI;
+                    containerI = container[index];
+                    UnLock();
+                    if (containerI.IsValid()) {
+                        const char8 * const next = &path[token.Size() + 1u];
+                        if (StringHelper::Length(next) > 0u) {
+                            //continue only for the path
+                            ret = containerI->Find(next);
+                        }
+                        else {
+                            ret = containerI;
                         }
                     }
-                    else {
-                        ret = container[index];
-                    }
+                }
+                else {
+                    ret = container[index];
                 }
             }
         }
@@ -174,14 +188,10 @@ Reference ConfigurationDatabaseNode::Find(const char8 * const path) {
 
 Reference ConfigurationDatabaseNode::FindLeaf(const char8 * const name) {
     Reference ret;
-    uint32 bindex;
-    //binary search
+    uint32 index;
     if (Lock()) {
-        if (binTree.Search(name, bindex)) {
-            uint32 index = binTree[bindex];
-            if (index < containerSize) {
-                ret = container[index];
-            }
+        if (FindIndex(name, index)) {
+            ret = container[index];
         }
     }
     UnLock();
@@ -193,13 +203,8 @@ bool ConfigurationDatabaseNode::Delete(Reference ref) {
     if (ok) {
         ok = ref.IsValid();
         uint32 index = 0u;
-        //binary search
         if (ok) {
-            uint32 bindex;
-            if (binTree.Search(ref->GetName(), bindex)) {
-                index = binTree[bindex];
-                ok = (index < containerSize);
-            }
+            ok = FindIndex(ref->GetName(), index);
         }
         if (ok) {
             containerSize--;
@@ -233,12 +238,13 @@ bool ConfigurationDatabaseNode::Delete(Reference ref) {
         }
         //Need to remap...
         if (ok) {
-            binTree.Reset();
-            uint32 i;
-            for (i=0u; (i<containerSize) && (ok); i++) {
-                /*lint -e{613} containerSize > 0 => container != NULL*/
-                Reference eRef = container[i];
-                ok = (binTree.Insert(eRef->GetName(), static_cast<uint32>(i)) != 0xFFFFFFFFu);
+            if (containerSize >= CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) {
+                BuildIndex();
+            }
+            else {
+                binTree.Reset();
+                indexed = false;
+                indexCollisions = false;
             }
         }
         if (ok) {
@@ -262,6 +268,53 @@ void ConfigurationDatabaseNode::SetParent(ReferenceT<ConfigurationDatabaseNode>
     parent = parentIn;
 }
 
+bool ConfigurationDatabaseNode::IsIndexed() {
+    bool ret = false;
+    if (Lock()) {
+        ret = indexed;
+    }
+    UnLock();
+    return ret;
+}
+
+bool ConfigurationDatabaseNode::FindIndex(const char8 * const name,
+                                          uint32 &index) {
+    bool found = false;
+    if (indexed) {
+        uint32 bindex;
+        //binary search
+        if (binTree.Search(name, bindex)) {
+            index = binTree[bindex];
+            if (index < containerSize) {
+                found = (StringHelper::Compare(container[index]->GetName(), name) == 0);
+            }
+        }
+    }
+    //Small nodes and the children not indexed due to hash collisions are searched linearly
+    if ((!found) && ((!indexed) || (indexCollisions))) {
+        for (uint32 i = 0u; (i < containerSize) && (!found); i++) {
+            /*lint -e{613} containerSize > 0 => container != NULL*/
+            found = (StringHelper::Compare(container[i]->GetName(), name) == 0);
+            if (found) {
+                index = i;
+            }
+        }
+    }
+    return found;
+}
+
+void ConfigurationDatabaseNode::BuildIndex() {
+    binTree.Reset();
+    indexCollisions = false;
+    for (uint32 i = 0u; i < containerSize; i++) {
+        /*lint -e{613} containerSize > 0 => container != NULL*/
+        if (binTree.Insert(container[i]->GetName(), i) == 0xFFFFFFFFu) {
+            indexCollisions = true;
+        }
+    }
+    indexed = true;
+}
+
 bool ConfigurationDatabaseNode::Lock() {
     return (mux.FastLock(muxTimeout) == ErrorManagement::NoError);
 }
@@ -42,11 +42,20 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of children above which a ConfigurationDatabaseNode indexes its children by name.
+ */
+const uint32 CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD = 8u;
+
 /**
  * @brief A ReferenceContainer like node implementation optimised for the ConfigurationDatabase.
  * @details With respect to the ReferenceContainer, the ConfigurationDatabaseNode offers an optimised Find method,
  * based on the BinaryTree and allows to directly navigate to the parent Container.
  *
+ * Nodes with less than CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD children are searched linearly (which is faster than
+ * hashing for a few names). When a node reaches the threshold its children are indexed by the hash of their name, so that
+ * the lookups on wide nodes (e.g. a Signals block with thousands of signals) are logarithmic. The names found in the index are
+ * always verified and the children whose name hash collides with the one of another child are found by a linear search.
  */
 class DLL_API ConfigurationDatabaseNode: public Object {
 
@@ -121,8 +130,28 @@ ConfigurationDatabaseNode    ();
      */
     void SetParent(ReferenceT<ConfigurationDatabaseNode> parentIn);
 
+    /**
+     * @brief Checks if the children of this node are indexed by name.
+     * @return true if the node has at least CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD children.
+     */
+    bool IsIndexed();
+
 private:
 
+    /**
+     * @brief Gets the position of the child with a given \a name. Does not lock the node.
+     * @param[in] name the name of the child.
+     * @param[out] index the position of the child in the container.
+     * @return true if a child with the given \a name exists.
+     */
+    bool FindIndex(const char8 * const name,
+                   uint32 &index);
+
+    /**
+     * @brief Indexes all the children by name. Does not lock the node.
+     */
+    void BuildIndex();
+
     /**
      * @brief Locks the internal spin-lock mutex.
      * @return true if the lock succeeds.
@@ -170,6 +199,16 @@ private:
      */
     BinaryTree<uint32, Fnv1aHashFunction> binTree;
 
+    /**
+     * True if the children are indexed in binTree.
+     */
+    bool indexed;
+
+    /**
+     * True if at least one child could not be indexed in binTree (because of a name hash collision).
+     */
+    bool indexCollisions;
+
     /**
      * The parent node
      */
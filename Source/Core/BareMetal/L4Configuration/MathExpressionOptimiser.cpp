@@ -0,0 +1,519 @@
+/**
+ * @file MathExpressionOptimiser.cpp
+ * @brief Source file for class MathExpressionOptimiser
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiser (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MathExpressionOptimiser.h"
+#include "RuntimeEvaluator.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief An instruction known by the optimiser.
+ */
+struct MathExpressionOperation {
+    /**
+     * The instruction name.
+     */
+    const char8 *name;
+
+    /**
+     * The number of operands.
+     */
+    uint32 numberOfInputs;
+
+    /**
+     * The estimated cost (1 for a READ, WRITE or arithmetic operation).
+     */
+    uint32 cost;
+};
+
+/**
+ * The instructions that can be part of an expression tree (the math functions are more expensive than the operators).
+ */
+static const MathExpressionOperation mathExpressionOperations[] = {
+        { "ADD", 2u, 1u }, { "SUB", 2u, 1u }, { "MUL", 2u, 1u }, { "DIV", 2u, 1u }, { "POW", 2u, 8u },
+        { "AND", 2u, 1u }, { "OR", 2u, 1u }, { "XOR", 2u, 1u },
+        { "EQ", 2u, 1u }, { "NEQ", 2u, 1u }, { "GT", 2u, 1u }, { "LT", 2u, 1u }, { "GTE", 2u, 1u }, { "LTE", 2u, 1u },
+        { "NEG", 1u, 1u }, { "NOT", 1u, 1u }, { "CAST", 1u, 1u },
+        { "SIN", 1u, 8u }, { "COS", 1u, 8u }, { "TAN", 1u, 8u }, { "EXP", 1u, 8u }, { "LOG", 1u, 8u }, { "LOG10", 1u, 8u },
+        { static_cast<const char8 *>(NULL), 0u, 0u } };
+
+/**
+ * @brief Splits a line of stack machine code in the instruction and its parameters.
+ */
+static void SplitLine(const StreamString &line,
+                      StreamString &command,
+                      StreamString &parameter1,
+                      StreamString &parameter2) {
+    StreamString lineCopy = line;
+    char8 terminator;
+    if (lineCopy.Seek(0ull)) {
+        (void) lineCopy.GetToken(command, " \t,", terminator, " \t,");
+        (void) lineCopy.GetToken(parameter1, " \t,", terminator, " \t,");
+        (void) lineCopy.GetToken(parameter2, " \t,", terminator, " \t,");
+    }
+}
+
+/**
+ * @brief Computes the result of an operation on float64 constants (the same way of the RuntimeEvaluator).
+ * @return false if the operation cannot be folded.
+ */
+static bool FoldOperation(const StreamString &command,
+                          const float64 x1,
+                          const float64 x2,
+                          float64 &result) {
+    bool ok = true;
+    if (command == "ADD") {
+        result = x1 + x2;
+    }
+    else if (command == "SUB") {
+        result = x1 - x2;
+    }
+    else if (command == "MUL") {
+        result = x1 * x2;
+    }
+    else if (command == "DIV") {
+        ok = (x2 != 0.0);
+        if (ok) {
+            result = x1 / x2;
+        }
+    }
+    else if (command == "POW") {
+        result = pow(x1, x2);
+    }
+    else if (command == "NEG") {
+        result = -x1;
+    }
+    else if (command == "SIN") {
+        result = sin(x1);
+    }
+    else if (command == "COS") {
+        result = cos(x1);
+    }
+    else if (command == "TAN") {
+        result = tan(x1);
+    }
+    else if (command == "EXP") {
+        result = exp(x1);
+    }
+    else if (command == "LOG") {
+        result = log(x1);
+    }
+    else if (command == "LOG10") {
+        result = log10(x1);
+    }
+    else {
+        ok = false;
+    }
+    //Zero is not folded as its sign would be lost.
+    if (ok) {
+        ok = ((!IsNaN(result)) && (!IsInf(result)) && (result != 0.0));
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MathExpressionOptimiser::MathExpressionOptimiser() {
+    lines = NULL_PTR(StreamString *);
+    numberOfLines = 0u;
+    nodes = NULL_PTR(MathExpressionNode *);
+    numberOfNodes = 0u;
+    maxNumberOfNodes = 0u;
+    selected = NULL_PTR(uint32 *);
+    selectedCount = NULL_PTR(uint32 *);
+    selectedVariable = NULL_PTR(StreamString *);
+    numberOfSelected = 0u;
+    numberOfTemporaries = 0u;
+}
+
+/*lint -e{1551} Justification: Memory has to be freed in the destructor.
+ * No exceptions should be thrown given that the memory is managed exclusively by this class. */
+MathExpressionOptimiser::~MathExpressionOptimiser() {
+    delete[] lines;
+    delete[] nodes;
+    delete[] selected;
+    delete[] selectedCount;
+    delete[] selectedVariable;
+}
+
+bool MathExpressionOptimiser::Optimise(const StreamString &input,
+                                       StreamString &output) {
+    delete[] lines;
+    delete[] nodes;
+    delete[] selected;
+    delete[] selectedCount;
+    delete[] selectedVariable;
+    lines = NULL_PTR(StreamString *);
+    nodes = NULL_PTR(MathExpressionNode *);
+    selected = NULL_PTR(uint32 *);
+    selectedCount = NULL_PTR(uint32 *);
+    selectedVariable = NULL_PTR(StreamString *);
+    numberOfLines = 0u;
+
+    StreamString code = input;
+    StreamString line;
+    char8 terminator;
+    bool ok = code.Seek(0ull);
+    while ((ok) && (code.GetToken(line, "\n", terminator, "\n\r"))) {
+        numberOfLines++;
+        line = "";
+    }
+    if (ok) {
+        ok = code.Seek(0ull);
+    }
+    if ((ok) && (numberOfLines > 0u)) {
+        lines = new StreamString[numberOfLines];
+        //Each instruction adds at most one node (POW with an exponent of 2 is replaced by one MUL).
+        maxNumberOfNodes = numberOfLines;
+        nodes = new MathExpressionNode[maxNumberOfNodes];
+        selected = new uint32[maxNumberOfNodes];
+        selectedCount = new uint32[maxNumberOfNodes];
+        selectedVariable = new StreamString[maxNumberOfNodes];
+        for (uint32 i = 0u; (i < numberOfLines) && (ok); i++) {
+            ok = code.GetToken(lines[i], "\n", terminator, "\n\r");
+        }
+    }
+    if (ok) {
+        ok = output.SetSize(0ull);
+    }
+    uint32 firstLine = 0u;
+    for (uint32 i = 0u; (i < numberOfLines) && (ok); i++) {
+        StreamString command;
+        StreamString parameter1;
+        StreamString parameter2;
+        SplitLine(lines[i], command, parameter1, parameter2);
+        if (command == "WRITE") {
+            StreamString statement;
+            if (!OptimiseStatement(firstLine, i, statement)) {
+                //Copy the statement unchanged.
+                ok = statement.SetSize(0ull);
+                for (uint32 j = firstLine; (j < i) && (ok); j++) {
+                    ok = statement.Printf("%s\n", lines[j].Buffer());
+                }
+            }
+            if (ok) {
+                ok = output.Printf("%s%s\n", statement.Buffer(), lines[i].Buffer());
+            }
+            firstLine = i + 1u;
+        }
+    }
+    //Instructions after the last WRITE.
+    for (uint32 j = firstLine; (j < numberOfLines) && (ok); j++) {
+        ok = output.Printf("%s\n", lines[j].Buffer());
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to optimise the stack machine code");
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiser::OptimiseStatement(const uint32 firstLine,
+                                                const uint32 lastLine,
+                                                StreamString &output) {
+    numberOfNodes = 0u;
+    numberOfSelected = 0u;
+    //The stack of the expression (the nodes are never more than the lines).
+    uint32 *stack = new uint32[(lastLine - firstLine) + 1u];
+    uint32 stackSize = 0u;
+    bool ok = (lastLine > firstLine);
+    for (uint32 i = firstLine; (i < lastLine) && (ok); i++) {
+        StreamString command;
+        StreamString parameter1;
+        StreamString parameter2;
+        SplitLine(lines[i], command, parameter1, parameter2);
+        if ((command == "READ") && (parameter1.Size() > 0u)) {
+            stack[stackSize] = AddLeaf(lines[i], false, 0.0);
+            stackSize++;
+        }
+        else if ((command == "CONST") && (parameter2.Size() > 0u)) {
+            float64 value = 0.0;
+            bool isConstant = (parameter1 == "float64");
+            if (isConstant) {
+                isConstant = TypeConvert(value, parameter2.Buffer());
+            }
+            stack[stackSize] = AddLeaf(lines[i], isConstant, value);
+            stackSize++;
+        }
+        else {
+            const MathExpressionOperation *operation = &mathExpressionOperations[0];
+            while ((operation->name != NULL) && (!(command == operation->name))) {
+                operation = &operation[1];
+            }
+            ok = (operation->name != NULL);
+            if (ok) {
+                ok = (stackSize >= operation->numberOfInputs);
+            }
+            if (ok) {
+                stackSize -= operation->numberOfInputs;
+                uint32 input1 = stack[stackSize];
+                uint32 input2 = stack[stackSize + operation->numberOfInputs - 1u];
+                stack[stackSize] = AddOperation(lines[i], operation->numberOfInputs, operation->cost, input1, input2);
+                stackSize++;
+            }
+        }
+    }
+    if (ok) {
+        ok = (stackSize == 1u);
+    }
+    if (ok) {
+        SelectSubexpressions(stack[0]);
+        ok = WriteNode(stack[0], output);
+    }
+    delete[] stack;
+    return ok;
+}
+
+uint32 MathExpressionOptimiser::AddLeaf(const StreamString &code,
+                                        const bool isConstant,
+                                        const float64 value) {
+    uint32 node = numberOfNodes;
+    numberOfNodes++;
+    nodes[node].code = code;
+    nodes[node].numberOfInputs = 0u;
+    nodes[node].inputs[0] = 0u;
+    nodes[node].inputs[1] = 0u;
+    nodes[node].isConstant = isConstant;
+    nodes[node].value = value;
+    nodes[node].cost = 1u;
+    nodes[node].key = code;
+    (void) nodes[node].key.Printf("%s", "\n");
+    return node;
+}
+
+uint32 MathExpressionOptimiser::AddOperation(const StreamString &code,
+                                             const uint32 numberOfInputs,
+                                             const uint32 operationCost,
+                                             const uint32 input1,
+                                             const uint32 input2) {
+    StreamString command;
+    StreamString parameter1;
+    StreamString parameter2;
+    SplitLine(code, command, parameter1, parameter2);
+
+    bool folded = (nodes[input1].isConstant) && (nodes[input2].isConstant);
+    float64 result = 0.0;
+    if (folded) {
+        folded = FoldOperation(command, nodes[input1].value, nodes[input2].value, result);
+    }
+    StreamString value;
+    if (folded) {
+        //Only fold if the text representation gives back exactly the same value.
+        float64 converted = 0.0;
+        folded = value.Printf("%.17e", result);
+        if (folded) {
+            folded = TypeConvert(converted, value.Buffer());
+        }
+        if (folded) {
+            /*lint -e{777} Justification: the values must be exactly the same.*/
+            folded = (converted == result);
+        }
+    }
+    uint32 node = 0u;
+    bool isSquare = false;
+    //Only x^2 is replaced: x * x is rounded once, as pow, whereas x * x * x is rounded twice and may differ in the last bit.
+    if ((!folded) && (numberOfInputs == 2u) && (command == "POW") && (nodes[input2].isConstant)) {
+        /*lint -e{777} Justification: only the exact exponent is replaced.*/
+        isSquare = (nodes[input2].value == 2.0);
+    }
+    if (folded) {
+        StreamString constantCode;
+        (void) constantCode.Printf("CONST float64 %s", value.Buffer());
+        node = AddLeaf(constantCode, true, result);
+    }
+    else if (isSquare) {
+        node = AddOperation("MUL", 2u, 1u, input1, input1);
+    }
+    else {
+        node = numberOfNodes;
+        numberOfNodes++;
+        nodes[node].code = code;
+        nodes[node].numberOfInputs = numberOfInputs;
+        nodes[node].inputs[0] = input1;
+        nodes[node].inputs[1] = input2;
+        nodes[node].isConstant = false;
+        nodes[node].value = 0.0;
+        nodes[node].cost = operationCost + nodes[input1].cost;
+        nodes[node].key = nodes[input1].key;
+        if (numberOfInputs > 1u) {
+            nodes[node].cost += nodes[input2].cost;
+            nodes[node].key += nodes[input2].key;
+        }
+        nodes[node].key += code;
+        (void) nodes[node].key.Printf("%s", "\n");
+    }
+    return node;
+}
+
+void MathExpressionOptimiser::SelectSubexpressions(const uint32 root) {
+    //Candidates are tried from the largest to the smallest, so that the largest repeated subexpression is stored.
+    bool *tried = new bool[numberOfNodes];
+    for (uint32 i = 0u; i < numberOfNodes; i++) {
+        tried[i] = (nodes[i].numberOfInputs == 0u);
+    }
+    bool done = false;
+    while (!done) {
+        uint32 candidate = numberOfNodes;
+        for (uint32 i = 0u; i < numberOfNodes; i++) {
+            if (!tried[i]) {
+                if (candidate == numberOfNodes) {
+                    candidate = i;
+                }
+                else if (nodes[i].key.Size() > nodes[candidate].key.Size()) {
+                    candidate = i;
+                }
+                else {
+                    //NOOP
+                }
+            }
+        }
+        done = (candidate == numberOfNodes);
+        if (!done) {
+            tried[candidate] = true;
+            if (FindSubexpression(candidate) == numberOfSelected) {
+                selected[numberOfSelected] = candidate;
+                selectedVariable[numberOfSelected] = "";
+                numberOfSelected++;
+                for (uint32 s = 0u; s < numberOfSelected; s++) {
+                    selectedCount[s] = 0u;
+                }
+                CountSubexpressions(root);
+                //Evaluating once and then reading must cost less than evaluating every time.
+                uint32 count = selectedCount[numberOfSelected - 1u];
+                bool worth = (count > 1u);
+                if (worth) {
+                    worth = (((count - 1u) * nodes[candidate].cost) > (count + 1u));
+                }
+                if (!worth) {
+                    numberOfSelected--;
+                }
+            }
+        }
+    }
+    delete[] tried;
+}
+
+void MathExpressionOptimiser::CountSubexpressions(const uint32 node) {
+    uint32 s = FindSubexpression(node);
+    bool visit = true;
+    if (s < numberOfSelected) {
+        //Only the first occurrence is evaluated.
+        visit = (selectedCount[s] == 0u);
+        selectedCount[s]++;
+    }
+    if (visit) {
+        for (uint32 i = 0u; i < nodes[node].numberOfInputs; i++) {
+            CountSubexpressions(nodes[node].inputs[i]);
+        }
+    }
+}
+
+uint32 MathExpressionOptimiser::FindSubexpression(const uint32 node) const {
+    uint32 s = 0u;
+    bool found = false;
+    while ((s < numberOfSelected) && (!found)) {
+        const MathExpressionNode &candidate = nodes[selected[s]];
+        found = (candidate.cost == nodes[node].cost);
+        if (found) {
+            found = (candidate.key == nodes[node].key);
+        }
+        if (!found) {
+            s++;
+        }
+    }
+    return s;
+}
+
+bool MathExpressionOptimiser::WriteNode(const uint32 node,
+                                        StreamString &output) {
+    bool ok = true;
+    uint32 s = FindSubexpression(node);
+    bool isStored = false;
+    if (s < numberOfSelected) {
+        isStored = (selectedVariable[s].Size() > 0u);
+    }
+    if (isStored) {
+        ok = output.Printf("READ %s\n", selectedVariable[s].Buffer());
+    }
+    else {
+        for (uint32 i = 0u; (i < nodes[node].numberOfInputs) && (ok); i++) {
+            ok = WriteNode(nodes[node].inputs[i], output);
+        }
+        if (ok) {
+            ok = output.Printf("%s\n", nodes[node].code.Buffer());
+        }
+        if ((ok) && (s < numberOfSelected)) {
+            StreamString variable;
+            do {
+                ok = (variable = runtimeEvaluatorInternalVariablePrefix);
+                if (ok) {
+                    ok = variable.Printf("cse%u", numberOfTemporaries);
+                }
+                numberOfTemporaries++;
+            }
+            while ((ok) && (IsVariableName(variable)));
+            if (ok) {
+                selectedVariable[s] = variable;
+                ok = output.Printf("WRITE %s\nREAD %s\n", variable.Buffer(), variable.Buffer());
+            }
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiser::IsVariableName(const StreamString &name) const {
+    bool found = false;
+    for (uint32 i = 0u; (i < numberOfLines) && (!found); i++) {
+        StreamString command;
+        StreamString parameter1;
+        StreamString parameter2;
+        SplitLine(lines[i], command, parameter1, parameter2);
+        if ((command == "READ") || (command == "WRITE") || (command == "RREAD") || (command == "RWRITE")) {
+            found = (parameter1 == name);
+        }
+    }
+    return found;
+}
+
+}
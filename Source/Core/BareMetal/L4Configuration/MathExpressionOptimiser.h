@@ -0,0 +1,269 @@
+/**
+ * @file MathExpressionOptimiser.h
+ * @brief Header file for class MathExpressionOptimiser
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionOptimiser
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONOPTIMISER_H_
+#define MATHEXPRESSIONOPTIMISER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A node of the expression tree built by the MathExpressionOptimiser.
+ */
+struct MathExpressionNode {
+    /**
+     * The stack machine instruction of the node (e.g. "READ A", "CONST float64 2" or "ADD").
+     */
+    StreamString code;
+
+    /**
+     * The number of operands (0 for READ and CONST, 1 or 2 for the operations).
+     */
+    uint32 numberOfInputs;
+
+    /**
+     * The index of the operand nodes. The first operand is the deepest in the stack.
+     */
+    uint32 inputs[2];
+
+    /**
+     * True if the node is a float64 constant.
+     */
+    bool isConstant;
+
+    /**
+     * The value of the node if it is a float64 constant.
+     */
+    float64 value;
+
+    /**
+     * The estimated cost of evaluating the subtree of the node.
+     */
+    uint32 cost;
+
+    /**
+     * The stack machine code of the subtree of the node (used to detect duplicated subexpressions).
+     */
+    StreamString key;
+};
+
+/**
+ * @brief Optimises the stack machine code produced by the MathExpressionParser before
+ * it is compiled by the RuntimeEvaluator.
+ *
+ * @details Each statement (i.e. all the instructions up to a WRITE) is converted into an expression
+ * tree which is then written back as stack machine code after applying the following optimisations:
+ *  - constant folding: operations (ADD, SUB, MUL, DIV, POW, NEG, SIN, COS, TAN, EXP, LOG and LOG10) whose operands
+ *  are all float64 constants are replaced by their result. The result is only folded if it is finite and
+ *  if its text representation converts back to exactly the same value, so that the folded code computes
+ *  the same values of the original code;
+ *  - strength reduction: POW with a constant exponent of 2 is replaced by a multiplication. Other exponents
+ *  (e.g. 3) are kept, given that the equivalent chain of multiplications is not rounded as pow;
+ *  - common subexpression elimination: a subexpression that occurs more than once in the same statement
+ *  is evaluated once and its value is stored (WRITE) and then read (READ) from a temporary variable.
+ *  This is only done when the saved operations are worth more than the additional WRITE and READ instructions.
+ *
+ * The operands are never reordered nor reassociated (e.g. A + 2 + 3 is not folded).
+ * Subexpressions are not shared between statements, given that each statement may change any of the variables.
+ *
+ * The temporary variables are named \@cseN. Their names start with runtimeEvaluatorInternalVariablePrefix, so that
+ * they are internal variables of the RuntimeEvaluator and not output variables. Names already used by the code are
+ * skipped. The temporaries are numbered across all the calls to Optimise() on the same instance, so that the code
+ * optimised by successive calls can be concatenated.
+ *
+ * Statements with instructions not known by the optimiser (e.g. functions that are not registered in the
+ * RuntimeEvaluator by default) are copied unchanged.
+ *
+ * The MathExpressionParser applies this optimisation to the code returned by
+ * MathExpressionParser::GetStackMachineExpression().
+ */
+class DLL_API MathExpressionOptimiser {
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    MathExpressionOptimiser();
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~MathExpressionOptimiser();
+
+    /**
+     * @brief Optimises the stack machine code.
+     * @param[in] input the stack machine code to be optimised.
+     * @param[out] output the optimised stack machine code.
+     * @return true if the code could be read and written. Statements that cannot be optimised are
+     * copied unchanged and do not cause a failure.
+     */
+    bool Optimise(const StreamString &input,
+                  StreamString &output);
+
+private:
+
+    /**
+     * @brief Builds the expression tree of the statement in the lines [firstLine, lastLine[ and writes
+     * the optimised code of the statement in \a output.
+     * @param[in] firstLine the index of the first line of the statement.
+     * @param[in] lastLine the index of the WRITE line of the statement.
+     * @param[out] output where the optimised code is appended.
+     * @return false if the statement contains unknown instructions or is not a single expression.
+     */
+    bool OptimiseStatement(const uint32 firstLine,
+                           const uint32 lastLine,
+                           StreamString &output);
+
+    /**
+     * @brief Adds an operation node to the expression tree, folding it if possible.
+     * @param[in] code the instruction.
+     * @param[in] numberOfInputs the number of operands.
+     * @param[in] operationCost the cost of the operation.
+     * @param[in] input1 the index of the first operand node.
+     * @param[in] input2 the index of the second operand node.
+     * @return the index of the new node.
+     */
+    uint32 AddOperation(const StreamString &code,
+                        const uint32 numberOfInputs,
+                        const uint32 operationCost,
+                        const uint32 input1,
+                        const uint32 input2);
+
+    /**
+     * @brief Adds a READ or CONST node to the expression tree.
+     * @param[in] code the instruction.
+     * @param[in] isConstant true if the node is a float64 constant.
+     * @param[in] value the value of the float64 constant.
+     * @return the index of the new node.
+     */
+    uint32 AddLeaf(const StreamString &code,
+                   const bool isConstant,
+                   const float64 value);
+
+    /**
+     * @brief Selects the subexpressions that are worth storing in a temporary variable.
+     * @param[in] root the index of the root node of the statement.
+     */
+    void SelectSubexpressions(const uint32 root);
+
+    /**
+     * @brief Counts how many times each selected subexpression is evaluated.
+     * @param[in] node the index of the node to visit.
+     */
+    void CountSubexpressions(const uint32 node);
+
+    /**
+     * @brief Writes the code of the subtree of \a node in \a output.
+     * @param[in] node the index of the node.
+     * @param[out] output where the code is appended.
+     * @return true if the code could be written.
+     */
+    bool WriteNode(const uint32 node,
+                   StreamString &output);
+
+    /**
+     * @brief Gets the index of the selected subexpression equal to the subtree of \a node.
+     * @param[in] node the index of the node.
+     * @return the index of the selected subexpression or numberOfSelected if it was not selected.
+     */
+    uint32 FindSubexpression(const uint32 node) const;
+
+    /**
+     * @brief Checks if \a name is used as a variable in the code.
+     * @param[in] name the name to search.
+     * @return true if \a name is read or written by the code.
+     */
+    bool IsVariableName(const StreamString &name) const;
+
+    /**
+     * The lines of the code.
+     */
+    StreamString *lines;
+
+    /**
+     * The number of lines.
+     */
+    uint32 numberOfLines;
+
+    /**
+     * The nodes of the statement being optimised.
+     */
+    MathExpressionNode *nodes;
+
+    /**
+     * The number of nodes of the statement being optimised.
+     */
+    uint32 numberOfNodes;
+
+    /**
+     * The maximum number of nodes of a statement.
+     */
+    uint32 maxNumberOfNodes;
+
+    /**
+     * The nodes of the selected subexpressions.
+     */
+    uint32 *selected;
+
+    /**
+     * The number of times each selected subexpression is evaluated.
+     */
+    uint32 *selectedCount;
+
+    /**
+     * The temporary variable of each selected subexpression (empty until it is written).
+     */
+    StreamString *selectedVariable;
+
+    /**
+     * The number of selected subexpressions.
+     */
+    uint32 numberOfSelected;
+
+    /**
+     * The number of temporary variables already created (by all the calls to Optimise()).
+     */
+    uint32 numberOfTemporaries;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONOPTIMISER_H_ */
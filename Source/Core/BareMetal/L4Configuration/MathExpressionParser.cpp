@@ -133,7 +133,8 @@ namespace MARTe {
 MathExpressionParser::MathExpressionParser(StreamI &stream,
                                            BufferedStreamI * const err) :
     ParserI(stream, err, MathGrammar) {
-        
+
+    statementStart = 0ull;
     Action[0] = static_cast<void (MathExpressionParser::*)(void)>(NULL);
     Action [ 1 ] = &MathExpressionParser::StoreAssignment;
     Action [ 2 ] = &MathExpressionParser::PopAssignment;
@@ -403,6 +404,16 @@ void MathExpressionParser::PopAssignment() {
     stackMachineExpr += "WRITE ";
     stackMachineExpr += assignmentVarName.Buffer();
     stackMachineExpr += "\n";
+
+    // Optimise the statement just completed
+    const char8 * const statementBuffer = stackMachineExpr.Buffer();
+    StreamString statement = &statementBuffer[statementStart];
+    StreamString optimisedStatement;
+    if (!optimiser.Optimise(statement, optimisedStatement)) {
+        optimisedStatement = statement;
+    }
+    optimisedStackMachineExpr += optimisedStatement;
+    statementStart = stackMachineExpr.Size();
 }
 
 void MathExpressionParser::Execute(const uint32 number) {
@@ -451,7 +462,14 @@ uint32 MathExpressionParser::GetConstant(const uint32 index) const {
 
 StreamString MathExpressionParser::GetStackMachineExpression() const {
 
-    return stackMachineExpr;
+    StreamString expr = optimisedStackMachineExpr;
+    StreamString literalExpr = stackMachineExpr;
+    // Code not terminated by an assignment is not optimised
+    if (statementStart < literalExpr.Size()) {
+        const char8 * const statementBuffer = literalExpr.Buffer();
+        expr += &statementBuffer[statementStart];
+    }
+    return expr;
 }
 
 }
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "MathExpressionOptimiser.h"
 #include "ParserI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -122,8 +123,10 @@ namespace MARTe{
  * ~~~~~~~~~~~~
  * READ theta
  * SIN
- * CONST float64 2
- * POW
+ * WRITE @cse0
+ * READ @cse0
+ * READ @cse0
+ * MUL
  * READ theta
  * COS
  * CONST int64 2
@@ -132,6 +135,11 @@ namespace MARTe{
  * WRITE retVar
  * ~~~~~~~~~~~~
  *
+ * where `pow(sin(theta), 2)` was replaced by the MathExpressionOptimiser
+ * with a multiplication and `sin(theta)` is only computed once. The
+ * temporary `@cse0` is an internal variable of the RuntimeEvaluator and
+ * is neither an input nor an output.
+ *
  * All the instances of this parser use the lexical elements defined
  * in the MathGrammar of MARTe::GrammarInfo and apply the parsing rules
  * defined in MathGrammar.ll:
@@ -162,6 +170,10 @@ public:
     
     /**
      * @brief   Returns the input expression in stack machine form.
+     * @details The stack machine code is optimised by the MathExpressionOptimiser
+     *          (constant folding, strength reduction and common subexpression
+     *          elimination), which computes the same values of the literal code.
+     *          Each statement is optimised once, when its assignment is parsed.
      * @returns the input expression in stack machine form.
      * @pre     Parse() method must have been called.
      */
@@ -391,6 +403,21 @@ protected:
      * @brief Holds the mathematical expression in stack machine form while parsing.
      */
     StreamString              stackMachineExpr;
+
+    /**
+     * @brief Holds the optimised stack machine code of the statements parsed so far.
+     */
+    StreamString              optimisedStackMachineExpr;
+
+    /**
+     * @brief Position in #stackMachineExpr where the statement being parsed starts.
+     */
+    uint64                    statementStart;
+
+    /**
+     * @brief Optimises each statement. Its temporaries are numbered across all the statements.
+     */
+    MathExpressionOptimiser   optimiser;
     
 private:
     
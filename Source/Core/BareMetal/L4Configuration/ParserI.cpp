@@ -80,21 +80,14 @@ ParserI::ParserI(StreamI &stream,
     currentToken = static_cast<Token*>(NULL);
     isError = false;
     
-    // create a local copy of the stream (used by PrintErrorLine)
-    uint64 pos = stream.Position();
-    bool ok = stream.Seek(0ull);
-    if (ok) {
-        ok = inputStream.Copy(dynamic_cast<BufferedStreamI&>(stream));
-        ok = ( (stream.Seek(pos)) && (ok) );
-    }
-    if (!ok) {
-        inputStream = "";
-    }
+    // the error line is read back from the input stream (see PrintErrorLine)
+    inputStream = dynamic_cast<BufferedStreamI*>(&stream);
 }
 
 ParserI::~ParserI() {
     currentToken = static_cast<Token*>(NULL);
     errorStream=static_cast<BufferedStreamI*>(NULL);
+    inputStream=static_cast<BufferedStreamI*>(NULL);
 }
 
 uint32 ParserI::GetNextTokenType() {
@@ -154,14 +147,22 @@ void ParserI::PrintErrorLine() {
     uint32 lineNumber = GetCurrentTokenLineNumber(currentToken);
     char8 line[200];
     char8* startLinePtr = &line[0];
-    bool ok = inputStream.Seek(0ull);
+    bool ok = (inputStream != NULL);
+    uint64 pos = 0ull;
+    if (ok) {
+        pos = inputStream->Position();
+        ok = inputStream->Seek(0ull);
+    }
     if (ok) {
         for (uint32 i = 0u; (i < lineNumber) && (ok); i++) {
-            ok = inputStream.GetLine(startLinePtr, 200u);
+            ok = inputStream->GetLine(startLinePtr, 200u);
         }
         if (ok) {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s", line);
         }
+        if (!inputStream->Seek(pos)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "PrintErrorLine: Failed to restore the input stream position");
+        }
     }
     
     // create an arrow that points to the error
@@ -62,6 +62,10 @@ namespace MARTe {
  * found on the input stream of characters.
  *
  * Storage of the output is up to subclasses. 
+ *
+ * The input stream is read directly (no intermediate copy is made), but it is
+ * parsed in a single pass: every node and leaf is created in the output when
+ * Parse() is called, regardless of whether it will later be read.
  * 
  * At construction time the parser is initialized with the lexical
  * elements that the language used in the input stream of characters needs,
@@ -236,9 +240,11 @@ protected:
     BufferedStreamI *errorStream;
     
     /**
-     * A copy of the input stream.
+     * The input stream (used by PrintErrorLine). The stream is no longer copied, so that
+     * large (e.g. memory-mapped) inputs do not have to be duplicated in memory.
+     * NULL if the input stream is not a BufferedStreamI.
      */
-    StreamString inputStream;
+    BufferedStreamI *inputStream;
     
     /**
      * Stores the information about the language to be parsed.
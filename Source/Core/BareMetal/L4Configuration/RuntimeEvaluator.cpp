@@ -29,6 +29,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "MemoryOperationsHelper.h"
 #include "RuntimeEvaluator.h"
 #include "RuntimeEvaluatorFunction.h"
 
@@ -125,6 +126,7 @@ RuntimeEvaluator::RuntimeEvaluator(StreamString RPNCodeIn){
     codeMemoryPtr = NULL_PTR(CodeMemoryElement*);
     stackPtr = NULL_PTR(DataMemoryElement*);
     startOfVariables = 0u;
+    startOfOutputs = 0u;
 }
 
 RuntimeEvaluator::~RuntimeEvaluator(){
@@ -204,6 +206,15 @@ ErrorManagement::ErrorType RuntimeEvaluator::FindVariable(const DataMemoryAddres
             ret.unsupportedFeature = (variableInformation == NULL);
         }
     }
+
+    if (!ret.ErrorsCleared()){
+        internalVariableInfo.ListIterate(&finder);
+        ret = finder.error;
+        if (ret.ErrorsCleared()){
+            variableInformation = finder.variable;
+            ret.unsupportedFeature = (variableInformation == NULL);
+        }
+    }
     return ret;
 }
 
@@ -604,6 +615,7 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         noErrors = ret.ErrorsCleared();
     }
 
+    startOfOutputs = nextVariableAddress;
     index = 0u;
     noErrors = ret.ErrorsCleared();
     while(BrowseOutputVariable(index,var) && noErrors) {
@@ -632,9 +644,20 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         noErrors = ret.ErrorsCleared();
     }
 
+    // internal variables are local: reserve 8 bytes for each
+    index = 0u;
+    var = internalVariableInfo.ListPeek(index);
+    while(var != NULL) {
+        var->location = nextVariableAddress;
+        nextVariableAddress += ByteSizeToDataMemorySize(static_cast<uint16>(sizeof(float64)));
+        index++;
+        var = internalVariableInfo.ListPeek(index);
+    }
+
     // already
     dataMemory.SetSize(nextVariableAddress);
     variablesMemoryPtr = static_cast<DataMemoryElement *>(dataMemory.GetDataPointer());
+    batchVariables.SetSize(static_cast<uint32>(nextVariableAddress - startOfOutputs) * runtimeEvaluatorBatchSize);
 
     // initialise compilation memory
     StaticStack<TypeDescriptor,32u> typeStack;
@@ -645,6 +668,9 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
 
     // clean all the memory
     codeMemory.Clean();
+    threadedCode.Clean();
+    // position in codeMemory of the operands of each threaded instruction
+    StaticList<CodeMemoryAddress,32u> threadedCodePositions;
 
     StreamString line;
     char8 terminator;
@@ -676,6 +702,8 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         if (hasCommand){
             // assign invalid value
             CodeMemoryElement code2 = TypeCharacteristics<CodeMemoryElement>::MaxValue();
+            // the variable at code2 (NULL for constants)
+            VariableInformation *operandVariable = NULL_PTR(VariableInformation *);
             bool matchOutput = false;
 
             // PROCESS CAST command
@@ -765,6 +793,7 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
                 if (ret.ErrorsCleared()){
                     matchOutput = true;
                     code2 = variableInformation->location;
+                    operandVariable = variableInformation;
                     variableInformation->variableUsed = true;
                 }
 
@@ -827,6 +856,7 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
                 if (ret.ErrorsCleared()){
                     matchOutput = true;
                     code2 = variableInformation->location;
+                    operandVariable = variableInformation;
                 }
 
             }
@@ -920,7 +950,53 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
                 if (!ret.ErrorsCleared()){
                     REPORT_ERROR_STATIC(ret, "Failed to add instruction to code");
                 }
-                
+
+                // the threaded instruction resolves now the function and the address of its operand
+                if (ret.ErrorsCleared()){
+                    ThreadedInstruction instruction;
+                    instruction.function = functionRecords[code].GetFunction();
+                    instruction.threadedFunction = functionRecords[code].GetThreadedFunction();
+                    if (instruction.threadedFunction == NULL_PTR(ThreadedFunction)){
+                        instruction.threadedFunction = &ExecuteRegisteredFunction;
+                    }
+                    instruction.code = NULL_PTR(const CodeMemoryElement *);
+                    instruction.operand = NULL_PTR(void *);
+                    instruction.pCode = code;
+                    instruction.batchFunction = functionRecords[code].GetBatchFunction();
+                    instruction.batchOperand = NULL_PTR(void *);
+                    instruction.batchOperandType = batchScalarOperand;
+                    if (code2 != TypeCharacteristics<CodeMemoryElement>::MaxValue()){
+                        instruction.operand = &variablesMemoryPtr[code2];
+                        instruction.batchOperand = instruction.operand;
+                        if (operandVariable != NULL){
+                            if (operandVariable->externalLocation != NULL){
+                                instruction.batchOperand = operandVariable->externalLocation;
+                                instruction.batchOperandType = batchArrayOperand;
+                            }
+                            else if (code2 >= startOfOutputs){
+                                instruction.batchOperand = &batchVariables[static_cast<uint32>(code2 - startOfOutputs) * runtimeEvaluatorBatchSize];
+                                instruction.batchOperandType = batchBlockOperand;
+                            }
+                            else {
+                                //NOOP
+                            }
+                        }
+                        if (instruction.batchFunction == NULL_PTR(BatchFunction)){
+                            instruction.batchFunction = &ExecuteBatchUnsupportedFunction;
+                        }
+                    }
+                    if (instruction.batchFunction == NULL_PTR(BatchFunction)){
+                        instruction.batchFunction = &ExecuteBatchRegisteredFunction;
+                    }
+                    ret.fatalError = !threadedCode.Add(instruction);
+                    if (ret.ErrorsCleared()){
+                        ret.fatalError = !threadedCodePositions.Add(static_cast<CodeMemoryAddress>(codeMemory.GetSize()));
+                    }
+                    if (!ret.ErrorsCleared()){
+                        REPORT_ERROR_STATIC(ret, "Failed to add instruction to threaded code");
+                    }
+                }
+
                 noErrors = ret.ErrorsCleared();
                 if ( (code2 != TypeCharacteristics<CodeMemoryElement>::MaxValue()) && noErrors ){
                     ret.fatalError = !codeMemory.Add(code2);
@@ -944,6 +1020,8 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         // size the stack
         stack.SetSize(maxDataStackSize);
         stackPtr = static_cast<DataMemoryElement*>(stack.GetDataPointer());
+        batchStack.SetSize(static_cast<uint32>(maxDataStackSize) * runtimeEvaluatorBatchSize);
+        batchOutputs.SetSize(static_cast<uint32>(maxDataStackSize) * runtimeEvaluatorBatchSize);
 
         variablesMemoryPtr = static_cast<DataMemoryElement *>(dataMemory.GetDataPointer());
     }
@@ -956,6 +1034,27 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         }
     }
 
+    // now that codeMemory will no longer move, link the threaded code to the operands
+    // (also when the compilation failed, so that the threaded code always mirrors codeMemory)
+    bool linked = true;
+    for (uint32 i = 0u; (i < threadedCode.GetSize()) && (linked); i++){
+        ThreadedInstruction instruction;
+        CodeMemoryAddress position = 0u;
+        linked = threadedCode.Peek(i, instruction);
+        if (linked){
+            linked = threadedCodePositions.Peek(i, position);
+        }
+        if (linked){
+            instruction.code = &(codeMemory.GetAllocatedMemoryConst()[position]);
+            linked = threadedCode.Set(i, instruction);
+        }
+    }
+    if (!linked){
+        threadedCode.Clean();
+        ret.fatalError = true;
+        REPORT_ERROR_STATIC(ret, "Failed to link the threaded code");
+    }
+
     return ret;
 }
 
@@ -1127,6 +1226,13 @@ ErrorManagement::ErrorType RuntimeEvaluator::FunctionRecordOutputs2String(Runtim
     return ret;
 }
 
+DataMemoryElement *RuntimeEvaluator::ExecuteRegisteredFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    context.stackPtr = stackPointer;
+    context.codeMemoryPtr = instruction.code;
+    instruction.function(context);
+    return context.stackPtr;
+}
+
 /*lint -e{946, 947, 9016} codeMemoryMaxPtr is calculated from pointers pointing to the same array
  * and is only used as a safety check, thus it cannot go out of bounds */
 ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, StreamI* const debugStream){
@@ -1143,10 +1249,16 @@ ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, S
 
     switch (mode){
     case fastMode:{
-        while(codeMemoryPtr < codeMemoryMaxPtr){
-            CodeMemoryElement pCode = GetPseudoCode();
-            functionRecords[pCode].ExecuteFunction(*this);
+        // the stack pointer is handed over from instruction to instruction
+        DataMemoryElement *threadedStackPtr = stackPtr;
+        const ThreadedInstruction *instruction = threadedCode.GetAllocatedMemoryConst();
+        const ThreadedInstruction *instructionMaxPtr = instruction + threadedCode.GetSize();
+        while(instruction < instructionMaxPtr){
+            threadedStackPtr = instruction->threadedFunction(threadedStackPtr, *instruction, *this);
+            instruction++;
         }
+        stackPtr = threadedStackPtr;
+        codeMemoryPtr = codeMemoryMaxPtr;
     }break;
     case safeMode:{
         DataMemoryElement *stackMinPtr = stackPtr;
@@ -1257,6 +1369,110 @@ ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, S
     return runtimeError;
 }
 
+DataMemoryElement *RuntimeEvaluator::ExecuteBatchRegisteredFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    RuntimeEvaluatorFunction &functionRecord = functionRecords[instruction.pCode];
+    Vector<TypeDescriptor> inputTypes = functionRecord.GetInputTypes();
+    Vector<TypeDescriptor> outputTypes = functionRecord.GetOutputTypes();
+    uint32 numberOfInputs = inputTypes.GetNumberOfElements();
+    uint32 numberOfOutputs = outputTypes.GetNumberOfElements();
+
+    // inputTypes[0] is the type of the top of the stack
+    DataMemoryElement *inputs = stackPointer;
+    for (uint32 i = 0u; i < numberOfInputs; i++){
+        inputs -= runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(inputTypes[i].numberOfBits / 8u);
+    }
+
+    // each sample is executed on the scalar stack
+    DataMemoryElement * const scalarStack = static_cast<DataMemoryElement *>(context.stack.GetDataPointer());
+    DataMemoryElement * const outputs = static_cast<DataMemoryElement *>(context.batchOutputs.GetDataPointer());
+    bool ok = true;
+    for (uint32 sample = 0u; (sample < numberOfSamples) && (ok); sample++){
+        context.stackPtr = scalarStack;
+        DataMemoryElement *element = inputs;
+        for (uint32 i = numberOfInputs; (i > 0u) && (ok); i--){
+            uint16 byteSize = static_cast<uint16>(inputTypes[i - 1u].numberOfBits / 8u);
+            ok = MemoryOperationsHelper::Copy(context.stackPtr, &(reinterpret_cast<char8 *>(element)[sample * byteSize]), byteSize);
+            context.stackPtr += ByteSizeToDataMemorySize(byteSize);
+            element += runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(byteSize);
+        }
+        context.codeMemoryPtr = instruction.code;
+        instruction.function(context);
+        DataMemoryElement *scalarElement = scalarStack;
+        element = outputs;
+        for (uint32 o = 0u; (o < numberOfOutputs) && (ok); o++){
+            uint16 byteSize = static_cast<uint16>(outputTypes[o].numberOfBits / 8u);
+            ok = MemoryOperationsHelper::Copy(&(reinterpret_cast<char8 *>(element)[sample * byteSize]), scalarElement, byteSize);
+            scalarElement += ByteSizeToDataMemorySize(byteSize);
+            element += runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(byteSize);
+        }
+    }
+    context.stackPtr = scalarStack;
+
+    // the outputs replace the inputs on the stack
+    uint32 outputsSize = 0u;
+    for (uint32 o = 0u; o < numberOfOutputs; o++){
+        outputsSize += runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(outputTypes[o].numberOfBits / 8u);
+    }
+    if (ok){
+        ok = MemoryOperationsHelper::Copy(inputs, outputs, outputsSize * static_cast<uint32>(sizeof(DataMemoryElement)));
+    }
+    if (!ok){
+        context.runtimeError.fatalError = true;
+    }
+    return &inputs[outputsSize];
+}
+
+DataMemoryElement *RuntimeEvaluator::ExecuteBatchUnsupportedFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    context.runtimeError.unsupportedFeature = true;
+    return stackPointer;
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::ExecuteBatch(const uint32 numberOfSamples){
+
+    variablesMemoryPtr = static_cast<DataMemoryElement *>(dataMemory.GetDataPointer());
+    runtimeError = ErrorManagement::ErrorType(true);
+
+    DataMemoryElement * const batchStackPtr = static_cast<DataMemoryElement *>(batchStack.GetDataPointer());
+    const ThreadedInstruction * const firstInstruction = threadedCode.GetAllocatedMemoryConst();
+    const ThreadedInstruction * const instructionMaxPtr = firstInstruction + threadedCode.GetSize();
+
+    uint32 blockSize = runtimeEvaluatorBatchSize;
+    for (uint32 firstSample = 0u; (firstSample < numberOfSamples) && (!runtimeError.internalSetupError); firstSample += runtimeEvaluatorBatchSize){
+        if ((numberOfSamples - firstSample) < blockSize){
+            blockSize = numberOfSamples - firstSample;
+        }
+        DataMemoryElement *batchStackPointer = batchStackPtr;
+        const ThreadedInstruction *instruction = firstInstruction;
+        while(instruction < instructionMaxPtr){
+            batchStackPointer = instruction->batchFunction(batchStackPointer, *instruction, firstSample, blockSize, *this);
+            instruction++;
+        }
+        runtimeError.internalSetupError = (batchStackPointer != batchStackPtr);
+        if (!runtimeError){
+            REPORT_ERROR_STATIC(runtimeError, "Stack pointer not back to origin : %i elements left", static_cast<int64>(batchStackPointer - batchStackPtr));
+        }
+    }
+
+    // the internal output variables keep the value of the last sample
+    if ((numberOfSamples > 0u) && (runtimeError.ErrorsCleared())){
+        uint32 index = 0u;
+        VariableInformation *var;
+        while(BrowseOutputVariable(index,var) == ErrorManagement::NoError){
+            if ((var->externalLocation == NULL) && (var->location >= startOfOutputs)){
+                uint32 byteSize = var->type.numberOfBits / 8u;
+                char8 *block = reinterpret_cast<char8 *>(&batchVariables[static_cast<uint32>(var->location - startOfOutputs) * runtimeEvaluatorBatchSize]);
+                runtimeError.fatalError = !MemoryOperationsHelper::Copy(&variablesMemoryPtr[var->location], &block[(blockSize - 1u) * byteSize], byteSize);
+            }
+            index++;
+        }
+    }
+    if (!runtimeError){
+        REPORT_ERROR_STATIC(runtimeError, "Execution error");
+    }
+
+    return runtimeError;
+}
+
 /*lint -e{946, 947, 9016} codeMemoryMaxPtr is calculated from pointers pointing to the same array
  * and is only used as a safety check, thus it cannot go out of bounds */
 ErrorManagement::ErrorType RuntimeEvaluator::DeCompile(StreamString &DeCompileRPNCode, const bool showTypes) {
@@ -56,6 +56,110 @@ namespace MARTe {
 
 // Forward declaration required (RuntimeEvaluator and RuntimeEvaluatorFunction are circular-dependant).
 class RuntimeEvaluatorFunction;
+class RuntimeEvaluator;
+struct ThreadedInstruction;
+
+/**
+ * @brief   Type of the functions executed by the threaded code of RuntimeEvaluator (see RuntimeEvaluator::fastMode).
+ * @details A ThreadedFunction receives the current stack pointer and returns the updated one, so that the
+ *          stack pointer is kept in a register for the whole execution.
+ * @param[in] stackPointer the stack pointer before the operation.
+ * @param[in] instruction  the instruction being executed (with the precomputed operand).
+ * @param[in] context      the RuntimeEvaluator (used to report runtime errors).
+ * @return the stack pointer after the operation.
+ */
+typedef DataMemoryElement *(*ThreadedFunction)(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context);
+
+/**
+ * @brief   Number of samples processed at once by each instruction in RuntimeEvaluator::ExecuteBatch().
+ */
+static const uint32 runtimeEvaluatorBatchSize = 64u;
+
+/**
+ * @brief   First character of the names of the internal variables of RuntimeEvaluator.
+ * @details An internal variable (e.g. a temporary written by the MathExpressionOptimiser) is
+ *          written and read by the code like a local output variable, but it is neither an
+ *          input nor an output variable of the RuntimeEvaluator.
+ */
+static const char8 runtimeEvaluatorInternalVariablePrefix = '@';
+
+/**
+ * @brief   Type of the functions executed by RuntimeEvaluator::ExecuteBatch().
+ * @details A BatchFunction applies the operation to a block of samples. Each stack element holds
+ *          runtimeEvaluatorBatchSize values (of which only \a numberOfSamples are used).
+ * @param[in] stackPointer    the stack pointer before the operation.
+ * @param[in] instruction     the instruction being executed (with the precomputed operand).
+ * @param[in] firstSample     the index of the first sample of the block.
+ * @param[in] numberOfSamples the number of samples in the block (<= runtimeEvaluatorBatchSize).
+ * @param[in] context         the RuntimeEvaluator (used to report runtime errors).
+ * @return the stack pointer after the operation.
+ */
+typedef DataMemoryElement *(*BatchFunction)(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context);
+
+/**
+ * @brief How the operand of a ThreadedInstruction is addressed by RuntimeEvaluator::ExecuteBatch().
+ */
+enum BatchOperandType {
+    /**
+     * The same value for all the samples (a constant or an internal input variable).
+     */
+    batchScalarOperand,
+
+    /**
+     * An internal output variable, which holds the samples of the current block only.
+     */
+    batchBlockOperand,
+
+    /**
+     * An external array with one element for each sample.
+     */
+    batchArrayOperand
+};
+
+/**
+ * @brief An instruction of the threaded code built by RuntimeEvaluator::Compile().
+ */
+struct ThreadedInstruction {
+    /**
+     * The function to execute.
+     */
+    ThreadedFunction threadedFunction;
+
+    /**
+     * The registered function (executed by the threaded code when there is no specialised ThreadedFunction).
+     */
+    void (*function)(RuntimeEvaluator &context);
+
+    /**
+     * The code memory following the pseudo-code of the instruction (i.e. the instruction operands).
+     */
+    const CodeMemoryElement *code;
+
+    /**
+     * The address of the variable or constant that is read or written by the instruction (NULL if not applicable).
+     */
+    void *operand;
+
+    /**
+     * The function executed by RuntimeEvaluator::ExecuteBatch().
+     */
+    BatchFunction batchFunction;
+
+    /**
+     * The pseudo-code of the instruction (i.e. its index in functionRecords).
+     */
+    CodeMemoryElement pCode;
+
+    /**
+     * The address of the first element of the operand in RuntimeEvaluator::ExecuteBatch() (NULL if not applicable).
+     */
+    void *batchOperand;
+
+    /**
+     * How batchOperand is addressed.
+     */
+    BatchOperandType batchOperandType;
+};
 
 /**
  * @brief Runtime mathematical expression evaluation engine.
@@ -320,6 +424,16 @@ class RuntimeEvaluatorFunction;
  * Pop(), Push() and Peek() methods. See RuntimeEvaluatorFunction
  * documentation for further details.
  * 
+ * Compile() also translates the pseudocode into threaded code, i.e.
+ * an array of ThreadedInstruction that already holds the function to be
+ * called and the address of the variable or constant it operates on.
+ * The fastMode execution walks this array without any further lookup.
+ * The functions that provide a specialised ThreadedFunction (memory
+ * access, floating point arithmetic, comparisons and casts) keep the
+ * stack pointer in a register; all the other functions are called
+ * through their RuntimeEvaluatorFunction as usual. The results are
+ * identical in all the execution modes.
+ * 
  * Supported operators
  * -------------------
  * 
@@ -589,6 +703,8 @@ public:
      *            + writes constants into dataMemory
      *            + checks type consistency
      *            +  grow stack to required size
+     *          - Builds the threaded code used in fastMode and
+     *            in ExecuteBatch()
      * 
      * @pre     ExtractVariables() == true && all variable types must
      *          be set.
@@ -601,7 +717,7 @@ public:
      */
     enum executionMode {
         /**
-         * Executes with minimal checks - assumes compilation was correct and function description was truthful
+         * Executes the threaded code with minimal checks - assumes compilation was correct and function description was truthful
          */
         fastMode,
 
@@ -627,6 +743,30 @@ public:
      */
     ErrorManagement::ErrorType Execute(const executionMode mode = fastMode, StreamI* const debugStream=NULL_PTR(StreamI *));
 
+    /**
+     * @brief     Executes the code on \a numberOfSamples samples.
+     * @details   Equivalent to executing the code \a numberOfSamples times
+     *            in fastMode, where:
+     *            - every external variable (see SetInputVariableMemory() and
+     *              SetOutputVariableMemory()) is an array with \a numberOfSamples
+     *              elements and each execution uses the next element;
+     *            - the internal input variables (and the constants) hold
+     *              the same value for all the samples;
+     *            - the internal output variables hold the value of the last
+     *              sample when the function returns.
+     *
+     *            The samples are processed in blocks of runtimeEvaluatorBatchSize
+     *            and each instruction is applied to the whole block at once.
+     *            Memory access, floating point arithmetic, comparisons and casts
+     *            run as tight loops over the block; all the other functions are
+     *            called once for each sample.
+     * @returns   the combination of error flags reported by all the functions that were executed.
+     * @param[in] numberOfSamples the number of samples.
+     * @pre ExtractVariables() == true && Compile() == true && all
+     *      variable types must be set.
+     */
+    ErrorManagement::ErrorType ExecuteBatch(const uint32 numberOfSamples);
+
     /**
      * @brief Reconstruct the RPNCode with type information
      */
@@ -698,6 +838,51 @@ private:
      * @brief Stack and variable are allocated here.
      */
     StaticList<CodeMemoryElement,32u>   codeMemory;
+
+    /**
+     * @brief The threaded code (one ThreadedInstruction for each function call in codeMemory).
+     */
+    StaticList<ThreadedInstruction,32u> threadedCode;
+
+    /**
+     * @brief   ThreadedFunction that executes a registered RuntimeEvaluatorFunction.
+     * @details Used in the threaded code for all the functions which do not have a specialised ThreadedFunction.
+     */
+    static DataMemoryElement *ExecuteRegisteredFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context);
+
+    /**
+     * @brief   BatchFunction that executes a registered RuntimeEvaluatorFunction once for each sample.
+     * @details Used in ExecuteBatch() for all the functions which do not have a specialised BatchFunction.
+     */
+    static DataMemoryElement *ExecuteBatchRegisteredFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context);
+
+    /**
+     * @brief   BatchFunction of the instructions that access a variable but do not have a specialised BatchFunction.
+     * @details Always flags runtimeError.unsupportedFeature.
+     */
+    static DataMemoryElement *ExecuteBatchUnsupportedFunction(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context);
+
+    /**
+     * @brief The stack used by ExecuteBatch() (runtimeEvaluatorBatchSize values for each element of the stack).
+     */
+    Vector<DataMemoryElement>          batchStack;
+
+    /**
+     * @brief Holds the outputs of ExecuteBatchRegisteredFunction() while the inputs are still in use.
+     */
+    Vector<DataMemoryElement>          batchOutputs;
+
+    /**
+     * @brief   The block of samples of each output variable used by ExecuteBatch().
+     * @details The variable at location L uses the runtimeEvaluatorBatchSize
+     *          elements at (L - startOfOutputs) * runtimeEvaluatorBatchSize.
+     */
+    Vector<DataMemoryElement>          batchVariables;
+
+    /**
+     * @brief Address of first output variable.
+     */
+    DataMemoryAddress                  startOfOutputs;
     
     /**
      * @brief Address of first variable (after constants)
@@ -725,12 +910,14 @@ private:
     /**
      * @brief   Adds a new output variable.
      * @details Checks existence of name using FindInputVariable.
-     *          If not found add new variable to outputVariableInfo.
+     *          If not found add new variable to outputVariableInfo
+     *          (or to internalVariableInfo if the name starts with
+     *          runtimeEvaluatorInternalVariablePrefix).
      */
     inline ErrorManagement::ErrorType AddOutputVariable(const CCString &name, const TypeDescriptor &td = VoidType,DataMemoryAddress location = MAXDataMemoryAddress);
 
     /**
-     * @brief Looks for a variable of a given name
+     * @brief Looks for a variable of a given name (in internalVariableInfo if the name starts with runtimeEvaluatorInternalVariablePrefix)
      */
     inline ErrorManagement::ErrorType FindOutputVariable(const CCString &name, VariableInformation *&variableInformation);
 
@@ -779,6 +966,13 @@ private:
      */
     LinkedListHolderT<VariableInformation>          outputVariableInfo;
 
+    /**
+     * @brief   The list containing all internal variables.
+     * @details This list is filled by ExtractVariables(). The internal variables are allocated
+     *          after the output variables.
+     */
+    LinkedListHolderT<VariableInformation>          internalVariableInfo;
+
     /**
      * @brief   Pointer to the current active location in the stack.
      * @details Used by Push(), Pop() and Peek().
@@ -871,11 +1065,23 @@ ErrorManagement::ErrorType RuntimeEvaluator::FindInputVariable(const CCString &n
 }
 
 ErrorManagement::ErrorType RuntimeEvaluator::AddOutputVariable(const CCString &name, const TypeDescriptor &td, const DataMemoryAddress location){
-    return AddVariable2DB(name,outputVariableInfo,td,location);
+    ErrorManagement::ErrorType ret;
+    if (name[0u] == runtimeEvaluatorInternalVariablePrefix){
+        ret = AddVariable2DB(name,internalVariableInfo,td,location);
+    } else {
+        ret = AddVariable2DB(name,outputVariableInfo,td,location);
+    }
+    return ret;
 }
 
 ErrorManagement::ErrorType RuntimeEvaluator::FindOutputVariable(const CCString &name, VariableInformation *&variableInformation){
-    return FindVariableinDB(name,variableInformation,outputVariableInfo);
+    ErrorManagement::ErrorType ret;
+    if (name[0u] == runtimeEvaluatorInternalVariablePrefix){
+        ret = FindVariableinDB(name,variableInformation,internalVariableInfo);
+    } else {
+        ret = FindVariableinDB(name,variableInformation,outputVariableInfo);
+    }
+    return ret;
 }
 
 } // MARTe
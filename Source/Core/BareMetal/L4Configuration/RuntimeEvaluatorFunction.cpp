@@ -47,11 +47,11 @@ uint32 availableFunctions = 0u;
 RuntimeEvaluatorFunction functionRecords[maxFunctions];
 
 RuntimeEvaluatorFunction::RuntimeEvaluatorFunction():
-    name(""), numberOfInputs(0u), numberOfOutputs(0u), types(NULL_PTR(TypeDescriptor*)), function(NULL_PTR(Function))
+    name(""), numberOfInputs(0u), numberOfOutputs(0u), types(NULL_PTR(TypeDescriptor*)), function(NULL_PTR(Function)), threadedFunction(NULL_PTR(ThreadedFunction)), batchFunction(NULL_PTR(BatchFunction))
     {}
 
-RuntimeEvaluatorFunction::RuntimeEvaluatorFunction(const CCString &nameIn, const uint16 numberOfInputsIn, const uint16 numberOfOutputsIn, TypeDescriptor* const typesIn, const Function functionIn):
-    name(nameIn), numberOfInputs(numberOfInputsIn), numberOfOutputs(numberOfOutputsIn), types(typesIn), function(functionIn)
+RuntimeEvaluatorFunction::RuntimeEvaluatorFunction(const CCString &nameIn, const uint16 numberOfInputsIn, const uint16 numberOfOutputsIn, TypeDescriptor* const typesIn, const Function functionIn, const ThreadedFunction threadedFunctionIn, const BatchFunction batchFunctionIn):
+    name(nameIn), numberOfInputs(numberOfInputsIn), numberOfOutputs(numberOfOutputsIn), types(typesIn), function(functionIn), threadedFunction(threadedFunctionIn), batchFunction(batchFunctionIn)
     {}
 
 bool RuntimeEvaluatorFunction::TryConsume(CCString nameIn,StaticStack<TypeDescriptor,32u> &typeStack, const bool matchOutput,DataMemoryAddress &dataStackSize) const {
@@ -161,27 +161,69 @@ template <typename T> void Write(RuntimeEvaluator &context){
     context.Pop(context.Variable<T>(index));
 }
 
-REGISTER_PCODE_FUNCTION(READ,double,0u,1u,Read<float64>,Float64Bit          )
-REGISTER_PCODE_FUNCTION(READ,float, 0u,1u,Read<float32>,Float32Bit          )
-REGISTER_PCODE_FUNCTION(READ,uint64,0u,1u,Read<uint64> ,UnsignedInteger64Bit)
-REGISTER_PCODE_FUNCTION(READ,int64, 0u,1u,Read<int64>  ,SignedInteger64Bit  )
-REGISTER_PCODE_FUNCTION(READ,uint32,0u,1u,Read<uint32> ,UnsignedInteger32Bit)
-REGISTER_PCODE_FUNCTION(READ,int32, 0u,1u,Read<int32>  ,SignedInteger32Bit  )
-REGISTER_PCODE_FUNCTION(READ,uint16,0u,1u,Read<uint16> ,UnsignedInteger16Bit)
-REGISTER_PCODE_FUNCTION(READ,int16, 0u,1u,Read<int16>  ,SignedInteger16Bit  )
-REGISTER_PCODE_FUNCTION(READ,uint8, 0u,1u,Read<uint8>  ,UnsignedInteger8Bit )
-REGISTER_PCODE_FUNCTION(READ,int8,  0u,1u,Read<int8>   ,SignedInteger8Bit   )
-
-REGISTER_PCODE_FUNCTION(WRITE,double,1u,0u,Write<float64>,Float64Bit          ,Float64Bit          )
-REGISTER_PCODE_FUNCTION(WRITE,float, 1u,0u,Write<float32>,Float32Bit          ,Float32Bit          )
-REGISTER_PCODE_FUNCTION(WRITE,uint64,1u,0u,Write<uint64> ,UnsignedInteger64Bit,UnsignedInteger64Bit)
-REGISTER_PCODE_FUNCTION(WRITE,int64, 1u,0u,Write<int64>  ,SignedInteger64Bit  ,SignedInteger64Bit  )
-REGISTER_PCODE_FUNCTION(WRITE,uint32,1u,0u,Write<uint32> ,UnsignedInteger32Bit,UnsignedInteger32Bit)
-REGISTER_PCODE_FUNCTION(WRITE,int32, 1u,0u,Write<int32>  ,SignedInteger32Bit  ,SignedInteger32Bit  )
-REGISTER_PCODE_FUNCTION(WRITE,uint16,1u,0u,Write<uint16> ,UnsignedInteger16Bit,UnsignedInteger16Bit)
-REGISTER_PCODE_FUNCTION(WRITE,int16, 1u,0u,Write<int16>  ,SignedInteger16Bit  ,SignedInteger16Bit  )
-REGISTER_PCODE_FUNCTION(WRITE,uint8, 1u,0u,Write<uint8>  ,UnsignedInteger8Bit ,UnsignedInteger8Bit )
-REGISTER_PCODE_FUNCTION(WRITE,int8,  1u,0u,Write<int8>   ,SignedInteger8Bit   ,SignedInteger8Bit   )
+// the operand of the threaded instruction is the address of the variable
+template <typename T> DataMemoryElement *ThreadedRead(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    ThreadedPush(sp, *(static_cast<T *>(instruction.operand)));
+    return sp;
+}
+
+template <typename T> DataMemoryElement *ThreadedWrite(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    ThreadedPop(sp, *(static_cast<T *>(instruction.operand)));
+    return sp;
+}
+
+// the batch operand is already resolved for both local and remote variables
+template <typename T> DataMemoryElement *BatchRead(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    const T *x = BatchOperand<T>(instruction, firstSample);
+    T *y = BatchPush<T>(sp);
+    if (instruction.batchOperandType == batchScalarOperand){
+        const T value = *x;
+        for (uint32 i = 0u; i < numberOfSamples; i++){
+            y[i] = value;
+        }
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfSamples; i++){
+            y[i] = x[i];
+        }
+    }
+    return sp;
+}
+
+template <typename T> DataMemoryElement *BatchWrite(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    const T *x = BatchPop<T>(sp);
+    T *y = BatchOperand<T>(instruction, firstSample);
+    for (uint32 i = 0u; i < numberOfSamples; i++){
+        y[i] = x[i];
+    }
+    return sp;
+}
+
+REGISTER_THREADED_PCODE_FUNCTION(READ,double,0u,1u,Read<float64>,ThreadedRead<float64>,BatchRead<float64>,Float64Bit          )
+REGISTER_THREADED_PCODE_FUNCTION(READ,float, 0u,1u,Read<float32>,ThreadedRead<float32>,BatchRead<float32>,Float32Bit          )
+REGISTER_THREADED_PCODE_FUNCTION(READ,uint64,0u,1u,Read<uint64> ,ThreadedRead<uint64> ,BatchRead<uint64> ,UnsignedInteger64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(READ,int64, 0u,1u,Read<int64>  ,ThreadedRead<int64>  ,BatchRead<int64>  ,SignedInteger64Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(READ,uint32,0u,1u,Read<uint32> ,ThreadedRead<uint32> ,BatchRead<uint32> ,UnsignedInteger32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(READ,int32, 0u,1u,Read<int32>  ,ThreadedRead<int32>  ,BatchRead<int32>  ,SignedInteger32Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(READ,uint16,0u,1u,Read<uint16> ,ThreadedRead<uint16> ,BatchRead<uint16> ,UnsignedInteger16Bit)
+REGISTER_THREADED_PCODE_FUNCTION(READ,int16, 0u,1u,Read<int16>  ,ThreadedRead<int16>  ,BatchRead<int16>  ,SignedInteger16Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(READ,uint8, 0u,1u,Read<uint8>  ,ThreadedRead<uint8>  ,BatchRead<uint8>  ,UnsignedInteger8Bit )
+REGISTER_THREADED_PCODE_FUNCTION(READ,int8,  0u,1u,Read<int8>   ,ThreadedRead<int8>   ,BatchRead<int8>   ,SignedInteger8Bit   )
+
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,double,1u,0u,Write<float64>,ThreadedWrite<float64>,BatchWrite<float64>,Float64Bit          ,Float64Bit          )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,float, 1u,0u,Write<float32>,ThreadedWrite<float32>,BatchWrite<float32>,Float32Bit          ,Float32Bit          )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,uint64,1u,0u,Write<uint64> ,ThreadedWrite<uint64> ,BatchWrite<uint64> ,UnsignedInteger64Bit,UnsignedInteger64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,int64, 1u,0u,Write<int64>  ,ThreadedWrite<int64>  ,BatchWrite<int64>  ,SignedInteger64Bit  ,SignedInteger64Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,uint32,1u,0u,Write<uint32> ,ThreadedWrite<uint32> ,BatchWrite<uint32> ,UnsignedInteger32Bit,UnsignedInteger32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,int32, 1u,0u,Write<int32>  ,ThreadedWrite<int32>  ,BatchWrite<int32>  ,SignedInteger32Bit  ,SignedInteger32Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,uint16,1u,0u,Write<uint16> ,ThreadedWrite<uint16> ,BatchWrite<uint16> ,UnsignedInteger16Bit,UnsignedInteger16Bit)
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,int16, 1u,0u,Write<int16>  ,ThreadedWrite<int16>  ,BatchWrite<int16>  ,SignedInteger16Bit  ,SignedInteger16Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,uint8, 1u,0u,Write<uint8>  ,ThreadedWrite<uint8>  ,BatchWrite<uint8>  ,UnsignedInteger8Bit ,UnsignedInteger8Bit )
+REGISTER_THREADED_PCODE_FUNCTION(WRITE,int8,  1u,0u,Write<int8>   ,ThreadedWrite<int8>   ,BatchWrite<int8>   ,SignedInteger8Bit   ,SignedInteger8Bit   )
 
 /*********************************************************************************************************
  *********************************************************************************************************
@@ -194,7 +236,7 @@ REGISTER_PCODE_FUNCTION(WRITE,int8,  1u,0u,Write<int8>   ,SignedInteger8Bit   ,S
 /*lint --emacro( {1502}, REGISTER_CAST_FUNCTION ) Justification: name ## subName ## RegisterClass class intentionally has no data member. */
 #define REGISTER_CAST_FUNCTION(name,type1,type2,function)\
     static TypeDescriptor name ## type1 ## type2 ## _FunctionTypes[] = {Type2TypeDescriptor<type1>(), Type2TypeDescriptor<type2>()}; \
-    static const RuntimeEvaluatorFunction name ## type1 ## type2 ## _RuntimeEvaluatorFunction(#name,1u,1u,&name ## type1 ## type2 ## _FunctionTypes[0u], static_cast<Function>(&function<type1,type2>)); \
+    static const RuntimeEvaluatorFunction name ## type1 ## type2 ## _RuntimeEvaluatorFunction(#name,1u,1u,&name ## type1 ## type2 ## _FunctionTypes[0u], static_cast<Function>(&function<type1,type2>), static_cast<ThreadedFunction>(&Threaded ## function<type1,type2>), static_cast<BatchFunction>(&Batch ## function<type1,type2>)); \
     static class name ## type1 ## type2 ## RegisterClass { \
     public: name ## type1 ## type2 ## RegisterClass(){\
             RegisterFunction(name ## type1 ## type2 ## _RuntimeEvaluatorFunction);\
@@ -213,6 +255,46 @@ template <typename T1,typename T2> void Casting(RuntimeEvaluator &context){
     }
 }
 
+template <typename T1,typename T2> DataMemoryElement *ThreadedCasting(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    T1 x1;
+    T2 x2;
+    bool ret;
+    ThreadedPop(sp, x1);
+    ret = SafeNumber2Number(x1,x2);
+    ThreadedPush(sp, x2);
+    if (!ret){
+        context.runtimeError.outOfRange = true;
+    }
+    return sp;
+}
+
+template <typename T1,typename T2> DataMemoryElement *BatchCasting(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    const T1 *x1 = BatchPop<T1>(sp);
+    T2 *x2 = BatchPush<T2>(sp);
+    bool ret = true;
+    // x2 overlaps x1: when T2 is larger the conversion must start from the last sample
+    if (sizeof(T2) > sizeof(T1)){
+        for (uint32 i = numberOfSamples; i > 0u; i--){
+            T2 y;
+            ret = SafeNumber2Number(x1[i - 1u], y) && ret;
+            x2[i - 1u] = y;
+        }
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfSamples; i++){
+            T2 y;
+            ret = SafeNumber2Number(x1[i], y) && ret;
+            x2[i] = y;
+        }
+    }
+    if (!ret){
+        context.runtimeError.outOfRange = true;
+    }
+    return sp;
+}
+
 #define REGISTER_CAST_FUNCTION_BLOCK(type1,function)   \
   REGISTER_CAST_FUNCTION(CAST,type1,float64,function)  \
   REGISTER_CAST_FUNCTION(CAST,type1,float32,function)  \
@@ -303,16 +385,39 @@ REGISTER_2_FUNCTION(POW,pow)
             ret = x2 oper x1;                                                       \
             context.Push(ret);                                                      \
         }                                                                           \
-        REGISTER_PCODE_FUNCTION(name,float64,2u,1u,function ## fname ## ication <float64>,Float64Bit          ,Float64Bit             ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,float32,2u,1u,function ## fname ## ication <float32>,Float32Bit          ,Float32Bit             ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,uint64 ,2u,1u,function ## fname ## ication <uint64> ,UnsignedInteger64Bit,UnsignedInteger64Bit   ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,int64  ,2u,1u,function ## fname ## ication <int64>  ,SignedInteger64Bit  ,SignedInteger64Bit     ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,uint32 ,2u,1u,function ## fname ## ication <uint32> ,UnsignedInteger32Bit,UnsignedInteger32Bit   ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,int32  ,2u,1u,function ## fname ## ication <int32>  ,SignedInteger32Bit  ,SignedInteger32Bit     ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,uint16 ,2u,1u,function ## fname ## ication <uint16> ,UnsignedInteger16Bit,UnsignedInteger16Bit   ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,int16  ,2u,1u,function ## fname ## ication <int16>  ,SignedInteger16Bit  ,SignedInteger16Bit     ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,uint8  ,2u,1u,function ## fname ## ication <uint8>  ,UnsignedInteger8Bit,UnsignedInteger8Bit     ,UnsignedInteger8Bit) \
-        REGISTER_PCODE_FUNCTION(name,int8   ,2u,1u,function ## fname ## ication <int8>   ,SignedInteger8Bit   ,SignedInteger8Bit      ,UnsignedInteger8Bit)
+        template <typename T> DataMemoryElement *threaded ## fname ## ication (DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){ \
+            DataMemoryElement *sp = stackPointer;                                   \
+            T x1;                                                                   \
+            T x2;                                                                   \
+            bool ret;                                                               \
+            ThreadedPop(sp, x1);                                                    \
+            ThreadedPop(sp, x2);                                                    \
+            ret = x2 oper x1;                                                       \
+            ThreadedPush(sp, ret);                                                  \
+            return sp;                                                              \
+        }                                                                           \
+        template <typename T> DataMemoryElement *batch ## fname ## ication (DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){ \
+            DataMemoryElement *sp = stackPointer;                                   \
+            const T *x1 = BatchPop<T>(sp);                                          \
+            const T *x2 = BatchPop<T>(sp);                                          \
+            bool *ret = BatchPush<bool>(sp);                                        \
+            /* ret overlaps x2 but each x2[i] is read before ret[i] is written */   \
+            for (uint32 i = 0u; i < numberOfSamples; i++){                          \
+                const T x = x2[i];                                                  \
+                ret[i] = x oper x1[i];                                              \
+            }                                                                       \
+            return sp;                                                              \
+        }                                                                           \
+        REGISTER_THREADED_PCODE_FUNCTION(name,float64,2u,1u,function ## fname ## ication <float64>,threaded ## fname ## ication <float64>,batch ## fname ## ication <float64>,Float64Bit          ,Float64Bit             ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,float32,2u,1u,function ## fname ## ication <float32>,threaded ## fname ## ication <float32>,batch ## fname ## ication <float32>,Float32Bit          ,Float32Bit             ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,uint64 ,2u,1u,function ## fname ## ication <uint64> ,threaded ## fname ## ication <uint64> ,batch ## fname ## ication <uint64> ,UnsignedInteger64Bit,UnsignedInteger64Bit   ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,int64  ,2u,1u,function ## fname ## ication <int64>  ,threaded ## fname ## ication <int64>  ,batch ## fname ## ication <int64>  ,SignedInteger64Bit  ,SignedInteger64Bit     ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,uint32 ,2u,1u,function ## fname ## ication <uint32> ,threaded ## fname ## ication <uint32> ,batch ## fname ## ication <uint32> ,UnsignedInteger32Bit,UnsignedInteger32Bit   ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,int32  ,2u,1u,function ## fname ## ication <int32>  ,threaded ## fname ## ication <int32>  ,batch ## fname ## ication <int32>  ,SignedInteger32Bit  ,SignedInteger32Bit     ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,uint16 ,2u,1u,function ## fname ## ication <uint16> ,threaded ## fname ## ication <uint16> ,batch ## fname ## ication <uint16> ,UnsignedInteger16Bit,UnsignedInteger16Bit   ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,int16  ,2u,1u,function ## fname ## ication <int16>  ,threaded ## fname ## ication <int16>  ,batch ## fname ## ication <int16>  ,SignedInteger16Bit  ,SignedInteger16Bit     ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,uint8  ,2u,1u,function ## fname ## ication <uint8>  ,threaded ## fname ## ication <uint8>  ,batch ## fname ## ication <uint8>  ,UnsignedInteger8Bit,UnsignedInteger8Bit     ,UnsignedInteger8Bit) \
+        REGISTER_THREADED_PCODE_FUNCTION(name,int8   ,2u,1u,function ## fname ## ication <int8>   ,threaded ## fname ## ication <int8>   ,batch ## fname ## ication <int8>   ,SignedInteger8Bit   ,SignedInteger8Bit      ,UnsignedInteger8Bit)
 
 REGISTER_COMPARE_OPERATOR(GT,  >  ,Greater  )
 REGISTER_COMPARE_OPERATOR(LT,  <  ,Smaller  )
@@ -411,8 +516,27 @@ REGISTER_UNARY_LOGICAL_OPERATOR(NOT, !, Not)
             x3 = static_cast<T>(x2 oper x1);                                        \
             context.Push(x3);                                                       \
         }                                                                           \
-        REGISTER_PCODE_FUNCTION(name,float64,2u,1u,function ## fname ## ication <float64>,Float64Bit,Float64Bit,Float64Bit)  \
-        REGISTER_PCODE_FUNCTION(name,float32,2u,1u,function ## fname ## ication <float32>,Float32Bit,Float32Bit,Float32Bit)  \
+        template <typename T> DataMemoryElement *threaded ## fname ## ication (DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){ \
+            DataMemoryElement *sp = stackPointer;                                   \
+            T x1;                                                                   \
+            T x2;                                                                   \
+            ThreadedPop(sp, x1);                                                    \
+            ThreadedPop(sp, x2);                                                    \
+            ThreadedPush(sp, static_cast<T>(x2 oper x1));                           \
+            return sp;                                                              \
+        }                                                                           \
+        template <typename T> DataMemoryElement *batch ## fname ## ication (DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){ \
+            DataMemoryElement *sp = stackPointer;                                   \
+            const T *x1 = BatchPop<T>(sp);                                          \
+            T *x2 = BatchPop<T>(sp);                                                \
+            T *x3 = BatchPush<T>(sp);                                               \
+            for (uint32 i = 0u; i < numberOfSamples; i++){                          \
+                x3[i] = static_cast<T>(x2[i] oper x1[i]);                           \
+            }                                                                       \
+            return sp;                                                              \
+        }                                                                           \
+        REGISTER_THREADED_PCODE_FUNCTION(name,float64,2u,1u,function ## fname ## ication <float64>,threaded ## fname ## ication <float64>,batch ## fname ## ication <float64>,Float64Bit,Float64Bit,Float64Bit)  \
+        REGISTER_THREADED_PCODE_FUNCTION(name,float32,2u,1u,function ## fname ## ication <float32>,threaded ## fname ## ication <float32>,batch ## fname ## ication <float32>,Float32Bit,Float32Bit,Float32Bit)  \
 
 REGISTER_OPERATOR(ADD, + ,Addition)
 REGISTER_OPERATOR(SUB, - ,Subtract)
@@ -984,12 +1108,40 @@ template <typename Tin,typename Tout> void Write_2T(RuntimeEvaluator &context){
     context.Variable<Tout>(index) = x2;
 }
 
+template <typename Tin,typename Tout> DataMemoryElement *ThreadedWrite_2T(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    Tin x1;
+    ThreadedPop(sp, x1);
+    bool ret;
+    ret = SafeNumber2Number(x1,*(static_cast<Tout *>(instruction.operand)));
+    if (!ret){
+        context.runtimeError.outOfRange = true;
+    }
+    return sp;
+}
+
+template <typename Tin,typename Tout> DataMemoryElement *BatchWrite_2T(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    const Tin *x1 = BatchPop<Tin>(sp);
+    Tout *x2 = BatchOperand<Tout>(instruction, firstSample);
+    bool ret = true;
+    for (uint32 i = 0u; i < numberOfSamples; i++){
+        ret = SafeNumber2Number(x1[i],x2[i]) && ret;
+    }
+    if (!ret){
+        context.runtimeError.outOfRange = true;
+    }
+    return sp;
+}
+
 
 
 // register function with difference between input and outout type   fun(type1)==>typeOut
 #define REGISTER_WRITECONV(name,fname,typeIn,typeOut)                                           \
     static Function functionP ## fname ## typeIn ## typeOut = & fname ## _2T<typeIn,typeOut>;    \
-    REGISTER_PCODE_FUNCTION(name,typeIn ## typeOut,1u,0u,*functionP ## fname ## typeIn ## typeOut,Type2TypeDescriptor<typeIn>(),Type2TypeDescriptor<typeOut>())
+    static ThreadedFunction threadedFunctionP ## fname ## typeIn ## typeOut = & Threaded ## fname ## _2T<typeIn,typeOut>;    \
+    static BatchFunction batchFunctionP ## fname ## typeIn ## typeOut = & Batch ## fname ## _2T<typeIn,typeOut>;    \
+    REGISTER_THREADED_PCODE_FUNCTION(name,typeIn ## typeOut,1u,0u,*functionP ## fname ## typeIn ## typeOut,*threadedFunctionP ## fname ## typeIn ## typeOut,*batchFunctionP ## fname ## typeIn ## typeOut,Type2TypeDescriptor<typeIn>(),Type2TypeDescriptor<typeOut>())
 
 REGISTER_WRITECONV(WRITE,Write,uint64,uint8)
 REGISTER_WRITECONV(WRITE,Write,uint64,uint16)
@@ -1032,27 +1184,41 @@ template <typename T> void RWrite(RuntimeEvaluator &context){
     context.Pop(*x);
 }
 
-REGISTER_PCODE_FUNCTION(RREAD,double,0u,1u,RRead<float64> ,Float64Bit)
-REGISTER_PCODE_FUNCTION(RREAD,float ,0u,1u,RRead<float32> ,Float32Bit)
-REGISTER_PCODE_FUNCTION(RREAD,uint64,0u,1u,RRead<uint64>  ,UnsignedInteger64Bit)
-REGISTER_PCODE_FUNCTION(RREAD,int64 ,0u,1u,RRead<int64>   ,SignedInteger64Bit)
-REGISTER_PCODE_FUNCTION(RREAD,uint32,0u,1u,RRead<uint32>  ,UnsignedInteger32Bit)
-REGISTER_PCODE_FUNCTION(RREAD,int32 ,0u,1u,RRead<int32>   ,SignedInteger32Bit)
-REGISTER_PCODE_FUNCTION(RREAD,uint16,0u,1u,RRead<uint16>  ,UnsignedInteger16Bit)
-REGISTER_PCODE_FUNCTION(RREAD,int16 ,0u,1u,RRead<int16>   ,SignedInteger16Bit)
-REGISTER_PCODE_FUNCTION(RREAD,uint8 ,0u,1u,RRead<uint8>   ,UnsignedInteger8Bit)
-REGISTER_PCODE_FUNCTION(RREAD,int8  ,0u,1u,RRead<int8>    ,SignedInteger8Bit)
-
-REGISTER_PCODE_FUNCTION(RWRITE,double,1u,0u,RWrite<float64>   ,Float64Bit             ,Float64Bit)
-REGISTER_PCODE_FUNCTION(RWRITE,float ,1u,0u,RWrite<float32>   ,Float32Bit             ,Float32Bit)
-REGISTER_PCODE_FUNCTION(RWRITE,uint64,1u,0u,RWrite<uint64>    ,UnsignedInteger64Bit   ,UnsignedInteger64Bit)
-REGISTER_PCODE_FUNCTION(RWRITE,int64 ,1u,0u,RWrite<int64>     ,SignedInteger64Bit     ,SignedInteger64Bit  )
-REGISTER_PCODE_FUNCTION(RWRITE,uint32,1u,0u,RWrite<uint32>    ,UnsignedInteger32Bit   ,UnsignedInteger32Bit)
-REGISTER_PCODE_FUNCTION(RWRITE,int32 ,1u,0u,RWrite<int32>     ,SignedInteger32Bit     ,SignedInteger32Bit  )
-REGISTER_PCODE_FUNCTION(RWRITE,uint16,1u,0u,RWrite<uint16>    ,UnsignedInteger16Bit   ,UnsignedInteger16Bit)
-REGISTER_PCODE_FUNCTION(RWRITE,int16 ,1u,0u,RWrite<int16>     ,SignedInteger16Bit     ,SignedInteger16Bit  )
-REGISTER_PCODE_FUNCTION(RWRITE,uint8 ,1u,0u,RWrite<uint8>     ,UnsignedInteger8Bit    ,UnsignedInteger8Bit )
-REGISTER_PCODE_FUNCTION(RWRITE,int8  ,1u,0u,RWrite<int8>      ,SignedInteger8Bit      ,SignedInteger8Bit   )
+// the operand of the threaded instruction is the address of the variable holding the external address
+template <typename T> DataMemoryElement *ThreadedRRead(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    T *x = *(static_cast<T **>(instruction.operand));
+    ThreadedPush(sp, *x);
+    return sp;
+}
+template <typename T> DataMemoryElement *ThreadedRWrite(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    T *x = *(static_cast<T **>(instruction.operand));
+    ThreadedPop(sp, *x);
+    return sp;
+}
+
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,double,0u,1u,RRead<float64> ,ThreadedRRead<float64> ,BatchRead<float64> ,Float64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,float ,0u,1u,RRead<float32> ,ThreadedRRead<float32> ,BatchRead<float32> ,Float32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,uint64,0u,1u,RRead<uint64>  ,ThreadedRRead<uint64>  ,BatchRead<uint64>  ,UnsignedInteger64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,int64 ,0u,1u,RRead<int64>   ,ThreadedRRead<int64>   ,BatchRead<int64>   ,SignedInteger64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,uint32,0u,1u,RRead<uint32>  ,ThreadedRRead<uint32>  ,BatchRead<uint32>  ,UnsignedInteger32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,int32 ,0u,1u,RRead<int32>   ,ThreadedRRead<int32>   ,BatchRead<int32>   ,SignedInteger32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,uint16,0u,1u,RRead<uint16>  ,ThreadedRRead<uint16>  ,BatchRead<uint16>  ,UnsignedInteger16Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,int16 ,0u,1u,RRead<int16>   ,ThreadedRRead<int16>   ,BatchRead<int16>   ,SignedInteger16Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,uint8 ,0u,1u,RRead<uint8>   ,ThreadedRRead<uint8>   ,BatchRead<uint8>   ,UnsignedInteger8Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RREAD,int8  ,0u,1u,RRead<int8>    ,ThreadedRRead<int8>    ,BatchRead<int8>    ,SignedInteger8Bit)
+
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,double,1u,0u,RWrite<float64>   ,ThreadedRWrite<float64>   ,BatchWrite<float64>   ,Float64Bit             ,Float64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,float ,1u,0u,RWrite<float32>   ,ThreadedRWrite<float32>   ,BatchWrite<float32>   ,Float32Bit             ,Float32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,uint64,1u,0u,RWrite<uint64>    ,ThreadedRWrite<uint64>    ,BatchWrite<uint64>    ,UnsignedInteger64Bit   ,UnsignedInteger64Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,int64 ,1u,0u,RWrite<int64>     ,ThreadedRWrite<int64>     ,BatchWrite<int64>     ,SignedInteger64Bit     ,SignedInteger64Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,uint32,1u,0u,RWrite<uint32>    ,ThreadedRWrite<uint32>    ,BatchWrite<uint32>    ,UnsignedInteger32Bit   ,UnsignedInteger32Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,int32 ,1u,0u,RWrite<int32>     ,ThreadedRWrite<int32>     ,BatchWrite<int32>     ,SignedInteger32Bit     ,SignedInteger32Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,uint16,1u,0u,RWrite<uint16>    ,ThreadedRWrite<uint16>    ,BatchWrite<uint16>    ,UnsignedInteger16Bit   ,UnsignedInteger16Bit)
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,int16 ,1u,0u,RWrite<int16>     ,ThreadedRWrite<int16>     ,BatchWrite<int16>     ,SignedInteger16Bit     ,SignedInteger16Bit  )
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,uint8 ,1u,0u,RWrite<uint8>     ,ThreadedRWrite<uint8>     ,BatchWrite<uint8>     ,UnsignedInteger8Bit    ,UnsignedInteger8Bit )
+REGISTER_THREADED_PCODE_FUNCTION(RWRITE,int8  ,1u,0u,RWrite<int8>      ,ThreadedRWrite<int8>      ,BatchWrite<int8>      ,SignedInteger8Bit      ,SignedInteger8Bit   )
 
 template <typename Tin,typename Tout> void RWrite_2T(RuntimeEvaluator &context){
     CodeMemoryElement index;
@@ -1067,6 +1233,24 @@ template <typename Tin,typename Tout> void RWrite_2T(RuntimeEvaluator &context){
     }
 }
 
+template <typename Tin,typename Tout> DataMemoryElement *ThreadedRWrite_2T(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, RuntimeEvaluator &context){
+    DataMemoryElement *sp = stackPointer;
+    Tin x1;
+    ThreadedPop(sp, x1);
+    Tout *x2 = *(static_cast<Tout **>(instruction.operand));
+    bool ret;
+    ret = SafeNumber2Number(x1,*x2);
+    if (!ret){
+        context.runtimeError.outOfRange = true;
+    }
+    return sp;
+}
+
+// the batch operand is already resolved to the remote variable
+template <typename Tin,typename Tout> DataMemoryElement *BatchRWrite_2T(DataMemoryElement * const stackPointer, const ThreadedInstruction &instruction, const uint32 firstSample, const uint32 numberOfSamples, RuntimeEvaluator &context){
+    return BatchWrite_2T<Tin,Tout>(stackPointer, instruction, firstSample, numberOfSamples, context);
+}
+
 REGISTER_WRITECONV(RWRITE,RWrite,uint64,uint8)
 REGISTER_WRITECONV(RWRITE,RWrite,uint64,uint16)
 REGISTER_WRITECONV(RWRITE,RWrite,uint64,uint32)
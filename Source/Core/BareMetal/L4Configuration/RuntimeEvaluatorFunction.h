@@ -133,8 +133,15 @@ public:
      *                              the function is expected to manage
      * @param[in] functionIn        pointer to the actual C++ function
      *                              that will be executed.
+     * @param[in] threadedFunctionIn optional specialised version of
+     *                              \a functionIn executed by the
+     *                              RuntimeEvaluator::fastMode threaded code
+     *                              (see RuntimeEvaluator::Compile()).
+     * @param[in] batchFunctionIn   optional version of \a functionIn that
+     *                              processes a block of samples in
+     *                              RuntimeEvaluator::ExecuteBatch().
      */
-    RuntimeEvaluatorFunction(const CCString &nameIn, const uint16 numberOfInputsIn, const uint16 numberOfOutputsIn, TypeDescriptor* const typesIn, const Function functionIn);
+    RuntimeEvaluatorFunction(const CCString &nameIn, const uint16 numberOfInputsIn, const uint16 numberOfOutputsIn, TypeDescriptor* const typesIn, const Function functionIn, const ThreadedFunction threadedFunctionIn = NULL_PTR(ThreadedFunction), const BatchFunction batchFunctionIn = NULL_PTR(BatchFunction));
     
     /**
      * @brief Get the name of the function.
@@ -168,6 +175,23 @@ public:
      */
     void ExecuteFunction(RuntimeEvaluator &context) const {function(context);}
 
+    /**
+     * @brief Get the pointer to the function.
+     */
+    Function GetFunction() const {return function;}
+
+    /**
+     * @brief Get the pointer to the specialised threaded function.
+     * @return NULL if the function does not have a specialised version.
+     */
+    ThreadedFunction GetThreadedFunction() const {return threadedFunction;}
+
+    /**
+     * @brief Get the pointer to the batch function.
+     * @return NULL if the function does not have a batch version.
+     */
+    BatchFunction GetBatchFunction() const {return batchFunction;}
+
     /**
      * @brief   Replaces the type on the stack with the result type.
      * @returns `true` if the name and types matches.
@@ -215,6 +239,16 @@ private:
      */
     Function                function;
 
+    /**
+     * @brief The specialised version of #function used by the threaded code (may be NULL).
+     */
+    ThreadedFunction        threadedFunction;
+
+    /**
+     * @brief The version of #function used by RuntimeEvaluator::ExecuteBatch() (may be NULL).
+     */
+    BatchFunction           batchFunction;
+
 }; /* class RuntimeEvaluatorFunction */
 
 /**
@@ -283,11 +317,99 @@ void RegisterFunction(const RuntimeEvaluatorFunction &record);
         }\
     } name ## subName ## RegisterClassInstance;
 
+/**
+ * @brief   Same as REGISTER_PCODE_FUNCTION but also registers the
+ *          specialised ThreadedFunction \a threadedFunctionIn and the
+ *          BatchFunction \a batchFunctionIn, which shall have exactly
+ *          the same effect of \a functionIn (on each sample).
+ */
+/*lint -emacro( {446}, REGISTER_THREADED_PCODE_FUNCTION ) Type2TypeDescriptor<>() has no side-effects and can thus be used safely in  ..._FunctionTypes[] array initialization.*/
+/*lint --emacro( {1502}, REGISTER_THREADED_PCODE_FUNCTION ) Justification: name ## subName ## RegisterClass class intentionally has no data member. */
+#define REGISTER_THREADED_PCODE_FUNCTION(name,subName,nInputs,nOutputs,functionIn,threadedFunctionIn,batchFunctionIn,...)\
+    static TypeDescriptor name ## subName ## _FunctionTypes[] = {__VA_ARGS__}; \
+    static const RuntimeEvaluatorFunction name ## subName ## _RuntimeEvaluatorFunction(#name,nInputs,nOutputs, &name ## subName ## _FunctionTypes[0u], static_cast<Function>(&functionIn), static_cast<ThreadedFunction>(&threadedFunctionIn), static_cast<BatchFunction>(&batchFunctionIn)); \
+    static class name ## subName ## RegisterClass { \
+    public: name ## subName ## RegisterClass(){\
+            RegisterFunction(name ## subName ## _RuntimeEvaluatorFunction);\
+        }\
+    } name ## subName ## RegisterClassInstance;
+
+/**
+ * @brief   Pops a value from the stack in a ThreadedFunction.
+ * @details Same as RuntimeEvaluator::Pop() but acting on the stack pointer
+ *          handed over by the threaded code.
+ */
+template<typename T>
+inline void ThreadedPop(DataMemoryElement *&stackPointer, T &value);
+
+/**
+ * @brief   Pushes a value to the stack in a ThreadedFunction.
+ * @details Same as RuntimeEvaluator::Push() but acting on the stack pointer
+ *          handed over by the threaded code.
+ */
+template<typename T>
+inline void ThreadedPush(DataMemoryElement *&stackPointer, const T &value);
+
+/**
+ * @brief   Pops a block of samples from the stack in a BatchFunction.
+ * @return  the address of the first sample of the block.
+ */
+template<typename T>
+inline T *BatchPop(DataMemoryElement *&stackPointer);
+
+/**
+ * @brief   Pushes a block of samples to the stack in a BatchFunction.
+ * @return  the address where the first sample of the block shall be written.
+ */
+template<typename T>
+inline T *BatchPush(DataMemoryElement *&stackPointer);
+
+/**
+ * @brief   Gets the address of the operand of a BatchFunction.
+ * @return  the address of the operand for \a firstSample (a batchScalarOperand
+ *          is the same for all the samples).
+ */
+template<typename T>
+inline T *BatchOperand(const ThreadedInstruction &instruction, const uint32 firstSample);
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+template<typename T>
+inline void ThreadedPop(DataMemoryElement *&stackPointer, T &value){
+    stackPointer -= ByteSizeToDataMemorySize(static_cast<uint16>(sizeof(T)));
+    value = *(reinterpret_cast<T *>(stackPointer));
+}
+
+template<typename T>
+inline void ThreadedPush(DataMemoryElement *&stackPointer, const T &value){
+    *(reinterpret_cast<T *>(stackPointer)) = value;
+    stackPointer += ByteSizeToDataMemorySize(static_cast<uint16>(sizeof(T)));
+}
+
+template<typename T>
+inline T *BatchPop(DataMemoryElement *&stackPointer){
+    stackPointer -= runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(static_cast<uint16>(sizeof(T)));
+    return reinterpret_cast<T *>(stackPointer);
+}
+
+template<typename T>
+inline T *BatchPush(DataMemoryElement *&stackPointer){
+    T *block = reinterpret_cast<T *>(stackPointer);
+    stackPointer += runtimeEvaluatorBatchSize * ByteSizeToDataMemorySize(static_cast<uint16>(sizeof(T)));
+    return block;
+}
+
+template<typename T>
+inline T *BatchOperand(const ThreadedInstruction &instruction, const uint32 firstSample){
+    T *operand = static_cast<T *>(instruction.batchOperand);
+    if (instruction.batchOperandType == batchArrayOperand){
+        operand = &operand[firstSample];
+    }
+    return operand;
+}
+
 } // MARTe
 
 #endif /* RUNTIMEEVALUATORFUNCTION_H_ */
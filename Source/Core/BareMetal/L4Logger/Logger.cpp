@@ -31,7 +31,10 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "../../BareMetal/L4Logger/Logger.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -48,11 +51,156 @@ void LoggerErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &
                                        const char8 * const errorDescription) {
     Logger *loggerService = Logger::Instance();
     if (loggerService != NULL_PTR(Logger *)) {
-        LoggerPage *page = loggerService->GetPage();
-        if (page != NULL_PTR(LoggerPage *)) {
-            page->errorInfo = errorInfo;
-            (void)MemoryOperationsHelper::Copy(&page->errorStrBuffer[0u], errorDescription, MAX_ERROR_MESSAGE_SIZE);
-            loggerService->AddLogEntry(page);
+        if (loggerService->AcceptLogEntry(errorInfo)) {
+            LoggerPage *page = loggerService->GetPage();
+            if (page != NULL_PTR(LoggerPage *)) {
+                page->errorInfo = errorInfo;
+                (void)MemoryOperationsHelper::Copy(&page->errorStrBuffer[0u], errorDescription, MAX_ERROR_MESSAGE_SIZE);
+                loggerService->AddLogEntry(page);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Formats the message of the \a page into its errorStrBuffer.
+ * @param[in] page the page to be formatted.
+ * @param[in] parameters the parameters of the message.
+ */
+static void LoggerFormatPage(LoggerPage &page,
+                             const AnyType * const parameters) {
+    StreamMemoryReference smr(&page.errorStrBuffer[0u], MAX_ERROR_MESSAGE_SIZE - 1u);
+    (void) smr.PrintFormatted(page.format, parameters);
+    page.errorStrBuffer[smr.Size()] = '\0';
+    page.format = NULL_PTR(const char8 *);
+}
+
+/**
+ * @brief Copies the value of the \a parameter to the parametersBuffer of the \a page.
+ * @param[in] page the page where the value is copied to.
+ * @param[in] p the index of the parameter.
+ * @param[in] parameter the parameter to copy.
+ * @param[in,out] offset the first free byte of the parametersBuffer.
+ * @return false if the type of the parameter is not supported or if the value does not fit in the parametersBuffer.
+ */
+static bool LoggerCopyParameter(LoggerPage &page,
+                                const uint32 p,
+                                const AnyType &parameter,
+                                uint32 &offset) {
+    const uint32 bufferSize = static_cast<uint32>(sizeof(page.parametersBuffer));
+    char8 * const buffer = reinterpret_cast<char8 *>(&page.parametersBuffer[0u]);
+    TypeDescriptor descriptor = parameter.GetTypeDescriptor();
+    const uint32 numberOfBits = descriptor.numberOfBits;
+    const uint32 numberOfDimensions = parameter.GetNumberOfDimensions();
+    void * const dataPointer = parameter.GetDataPointer();
+    const char8 *str = NULL_PTR(const char8 *);
+    uint32 maxLength = bufferSize;
+    bool ok = ((!descriptor.isStructuredData) && (parameter.GetBitAddress() == 0u));
+    bool isString = false;
+    if (ok) {
+        if (descriptor.type == BT_CCString) {
+            //The pointer is the value (a NULL string is kept as is). The characters are copied below.
+            isString = (dataPointer != NULL);
+            str = static_cast<const char8 *>(dataPointer);
+            page.parameters[p] = parameter;
+        }
+        else if ((descriptor.type == CArray) && (numberOfDimensions == 1u) && (numberOfBits == 8u)) {
+            isString = (dataPointer != NULL);
+            str = static_cast<const char8 *>(dataPointer);
+            maxLength = parameter.GetNumberOfElements(0u);
+        }
+        else if (descriptor.type == Pointer) {
+            //The pointer is the value.
+            ok = (numberOfDimensions == 0u);
+            page.parameters[p] = parameter;
+        }
+        else {
+            ok = (numberOfDimensions == 0u);
+            if (ok) {
+                ok = ((descriptor.type == SignedInteger) || (descriptor.type == UnsignedInteger) || (descriptor.type == Float) || (descriptor.type == CArray));
+            }
+            if (ok) {
+                ok = ((numberOfBits == 8u) || (numberOfBits == 16u) || (numberOfBits == 32u) || (numberOfBits == 64u));
+            }
+            if (ok) {
+                const uint32 alignment = static_cast<uint32>(sizeof(uint64));
+                offset = ((offset + alignment - 1u) / alignment) * alignment;
+                const uint32 size = numberOfBits / 8u;
+                ok = ((offset + size) <= bufferSize);
+                if (ok) {
+                    ok = MemoryOperationsHelper::Copy(&buffer[offset], dataPointer, size);
+                }
+                if (ok) {
+                    page.parameters[p] = AnyType(descriptor, 0u, static_cast<const void *>(&buffer[offset]));
+                    offset += size;
+                }
+            }
+        }
+    }
+    if ((ok) && (isString)) {
+        uint32 length = 0u;
+        while ((length < maxLength) && (str[length] != '\0')) {
+            length++;
+        }
+        ok = ((offset + length + 1u) <= bufferSize);
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(&buffer[offset], str, length);
+        }
+        if (ok) {
+            buffer[offset + length] = '\0';
+            page.parameters[p] = AnyType(ConstCharString, 0u, static_cast<const void *>(&buffer[offset]));
+            offset += (length + 1u);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Deferred callback function for the logger. Copies the values of the parameters to the page
+ * and adds it to the FastResourceContainer queue without formatting the message. If the deferred formatting is
+ * disabled (i.e. the function is registered for the rate limiting) the message is formatted immediately, but only
+ * after being accepted (see Logger::AcceptLogEntry).
+ * @param[in] errorInfo the error information.
+ * @param[in] format the format of the message.
+ * @param[in] parameters the parameters of the message.
+ */
+/*lint -estring(459, "*LoggerDeferredErrorProcessFunction*") this function is supposed to have access to the Logger singleton and to the error information.*/
+void LoggerDeferredErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                        const char8 * const format,
+                                        const AnyType * const parameters) {
+    if (ErrorManagement::errorMessageProcessFunction != &LoggerErrorProcessFunction) {
+        //The errors are no longer processed by the Logger.
+        char8 buffer[MAX_ERROR_MESSAGE_SIZE + 1u];
+        StreamMemoryReference smr(&buffer[0], MAX_ERROR_MESSAGE_SIZE);
+        (void) smr.PrintFormatted(format, parameters);
+        buffer[smr.Size()] = '\0';
+        ErrorManagement::errorMessageProcessFunction(errorInfo, &buffer[0]);
+    }
+    else {
+        Logger *loggerService = Logger::Instance();
+        bool accepted = (loggerService != NULL_PTR(Logger *));
+        if (accepted) {
+            accepted = loggerService->AcceptLogEntry(errorInfo);
+        }
+        if (accepted) {
+            LoggerPage *page = loggerService->GetPage();
+            if (page != NULL_PTR(LoggerPage *)) {
+                page->errorInfo = errorInfo;
+                page->format = format;
+                //Also called with the rate limiting enabled and the deferred formatting disabled.
+                bool ok = ((format != NULL_PTR(const char8 *)) && (loggerService->IsDeferredFormatting()));
+                uint32 offset = 0u;
+                uint32 p;
+                for (p = 0u; (p < MAX_ERROR_MESSAGE_PARAMETERS) && (ok) && (!parameters[p].IsVoid()); p++) {
+                    ok = LoggerCopyParameter(*page, p, parameters[p], offset);
+                }
+                page->parameters[p] = voidAnyType;
+                if (!ok) {
+                    //Not possible to defer. Format with the original parameters.
+                    LoggerFormatPage(*page, parameters);
+                }
+                loggerService->AddLogEntry(page);
+            }
         }
     }
 }
@@ -62,6 +210,9 @@ void LoggerErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+LoggerNotifierI::~LoggerNotifierI() {
+}
+
 Logger *Logger::Instance(const uint32 numberOfPages) {
     static Logger instance(numberOfPages);
     return &instance;
@@ -71,6 +222,24 @@ Logger::Logger(const uint32 numberOfPages) :
         nOfPages(numberOfPages),
         logsIndex(nOfPages, true),
         pagesIndex(nOfPages, false) {
+    deferredFormatting = false;
+    notifier = NULL_PTR(LoggerNotifierI *);
+    notifierUsers = 0;
+    rateLimit = 0u;
+    rateLimitPeriod = 0u;
+    rateLimitPeriodTicks = 0u;
+    lastSummaryCounter = 0u;
+    nOfSuppressedLogs = 0;
+    nOfDroppedLogs = 0;
+    nOfDroppedLogsReported = 0;
+    uint32 i;
+    for (i = 0u; i < LOGGER_NUMBER_OF_CALL_SITES; i++) {
+        callSites[i].state = LOGGER_CALL_SITE_EMPTY;
+        callSites[i].nOfLogs = 0;
+        callSites[i].nOfSuppressed = 0;
+        callSites[i].periodStart = 0;
+        callSites[i].lastErrorInfoBusy = 0;
+    }
     /*lint -e{1732} -e{1733} new in constructor safe as this class can only be used as a singleton*/
     pages = new LoggerPage[nOfPages];
     SetErrorProcessFunction(&LoggerErrorProcessFunction);
@@ -90,6 +259,10 @@ LoggerPage *Logger::GetPage() {
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
             page->index = pageNo;
+            page->format = NULL_PTR(const char8 *);
+        }
+        else {
+            Atomic::Increment(&nOfDroppedLogs);
         }
     }
     return page;
@@ -106,15 +279,33 @@ void Logger::ReturnPage(const LoggerPage * const page) {
 void Logger::AddLogEntry(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
         logsIndex.Return(page->index);
+        //The notifier is read only after announcing its use, so that SetNotifier can wait for it not to be used.
+        Atomic::Increment(&notifierUsers);
+        LoggerNotifierI * const currentNotifier = notifier;
+        if (currentNotifier != NULL_PTR(LoggerNotifierI *)) {
+            currentNotifier->LogEntryAdded();
+        }
+        Atomic::Decrement(&notifierUsers);
     }
 }
 
 LoggerPage *Logger::GetLogEntry() {
     LoggerPage *page = NULL_PTR(LoggerPage *);
     if (pages != NULL_PTR(LoggerPage *)) {
+        AddDroppedLogsEntry();
+        if (rateLimit > 0u) {
+            uint64 now = HighResolutionTimer::Counter();
+            if ((now - lastSummaryCounter) >= rateLimitPeriodTicks) {
+                lastSummaryCounter = now;
+                AddSummaryEntries(now);
+            }
+        }
         uint32 pageNo = logsIndex.Take();
         if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
             page = &pages[pageNo];
+            if (page->format != NULL_PTR(const char8 *)) {
+                LoggerFormatPage(*page, &page->parameters[0u]);
+            }
         }
     }
     return page;
@@ -128,5 +319,239 @@ uint32 Logger::GetNumberOfLogs() const {
     return logsIndex.GetSize();
 }
 
+void Logger::SetDeferredFormatting(const bool enabled) {
+    deferredFormatting = enabled;
+    UpdateDeferredErrorProcessFunction();
+}
+
+void Logger::UpdateDeferredErrorProcessFunction() const {
+    //With the rate limiting the suppressed messages are not even formatted.
+    if ((deferredFormatting) || (rateLimit > 0u)) {
+        ErrorManagement::SetDeferredErrorProcessFunction(&LoggerDeferredErrorProcessFunction);
+    }
+    else {
+        ErrorManagement::SetDeferredErrorProcessFunction(NULL_PTR(ErrorManagement::DeferredErrorProcessFunctionType));
+    }
+}
+
+bool Logger::IsDeferredFormatting() const {
+    return deferredFormatting;
+}
+
+void Logger::SetNotifier(LoggerNotifierI * const notifierIn) {
+    notifier = notifierIn;
+    //Wait for the callers that might have read the previous notifier (the atomic operation also orders the write above).
+    while (!Atomic::CompareAndSwap(&notifierUsers, 0, 0)) {
+        Sleep::MSec(1u);
+    }
+}
+
+LoggerNotifierI *Logger::GetNotifier() const {
+    return notifier;
+}
+
+void Logger::SetRateLimit(const uint32 maxLogsPerPeriod,
+                          const uint32 periodMSec) {
+    //The call sites are not used while the rate limiting is disabled.
+    rateLimit = 0u;
+    uint32 i;
+    for (i = 0u; i < LOGGER_NUMBER_OF_CALL_SITES; i++) {
+        (void) Atomic::Exchange(&callSites[i].state, LOGGER_CALL_SITE_EMPTY);
+    }
+    rateLimitPeriod = periodMSec;
+    rateLimitPeriodTicks = (static_cast<uint64>(periodMSec) * HighResolutionTimer::Frequency()) / 1000u;
+    lastSummaryCounter = HighResolutionTimer::Counter();
+    rateLimit = maxLogsPerPeriod;
+    UpdateDeferredErrorProcessFunction();
+}
+
+uint32 Logger::GetRateLimit() const {
+    return rateLimit;
+}
+
+uint32 Logger::GetRateLimitPeriod() const {
+    return rateLimitPeriod;
+}
+
+bool Logger::AcceptLogEntry(const ErrorManagement::ErrorInformation &errorInfo) {
+    bool accept = true;
+    const uint32 limit = rateLimit;
+    if (limit > 0u) {
+        const uint64 now = HighResolutionTimer::Counter();
+        LoggerCallSite *site = GetCallSite(errorInfo, now);
+        if (site != NULL_PTR(LoggerCallSite *)) {
+            const int64 periodStart = site->periodStart;
+            //Another thread might have started the period after now was read.
+            if ((static_cast<uint64>(periodStart) <= now) && ((now - static_cast<uint64>(periodStart)) >= rateLimitPeriodTicks)) {
+                //Only the thread that starts the new period resets the counter.
+                if (Atomic::CompareAndSwap(&site->periodStart, periodStart, static_cast<int64>(now))) {
+                    (void) Atomic::Exchange(&site->nOfLogs, 0);
+                }
+            }
+            bool counted = false;
+            while (!counted) {
+                const int32 nOfLogs = site->nOfLogs;
+                accept = (static_cast<uint32>(nOfLogs) < limit);
+                if (accept) {
+                    counted = Atomic::CompareAndSwap(&site->nOfLogs, nOfLogs, nOfLogs + 1);
+                }
+                else {
+                    counted = true;
+                }
+            }
+            if (!accept) {
+                //The last error information is not updated if the consumer is reading it.
+                if (Atomic::TestAndSet(&site->lastErrorInfoBusy)) {
+                    site->lastErrorInfo = errorInfo;
+                    (void) Atomic::Exchange(&site->lastErrorInfoBusy, 0);
+                }
+                Atomic::Increment(&site->nOfSuppressed);
+                Atomic::Increment(&nOfSuppressedLogs);
+            }
+        }
+    }
+    return accept;
+}
+
+uint32 Logger::GetNumberOfSuppressedLogs() const {
+    return static_cast<uint32>(nOfSuppressedLogs);
+}
+
+uint32 Logger::GetNumberOfDroppedLogs() const {
+    return static_cast<uint32>(nOfDroppedLogs);
+}
+
+LoggerCallSite *Logger::GetCallSite(const ErrorManagement::ErrorInformation &errorInfo,
+                                    const uint64 now) {
+    /*lint -e{923} [MISRA C++ Rule 5-2-9]. Justification: the address of the (constant) file name is used as hash.*/
+    const uint32 fileHash = static_cast<uint32>(reinterpret_cast<uintp>(errorInfo.fileName) >> 3u);
+    const uint32 lineHash = static_cast<uint32>(static_cast<uint16>(errorInfo.header.lineNumber)) * 2654435761u;
+    uint32 index = (fileHash ^ lineHash) & (LOGGER_NUMBER_OF_CALL_SITES - 1u);
+    LoggerCallSite *site = NULL_PTR(LoggerCallSite *);
+    LoggerCallSite *freeSite = NULL_PTR(LoggerCallSite *);
+    int32 freeState = LOGGER_CALL_SITE_EMPTY;
+    bool claiming = false;
+    bool done = false;
+    uint32 n;
+    //Linear probing until the call site or an empty entry is found.
+    for (n = 0u; (n < LOGGER_NUMBER_OF_CALL_SITES) && (!done); n++) {
+        LoggerCallSite &candidate = callSites[index];
+        const int32 state = candidate.state;
+        if ((state == LOGGER_CALL_SITE_EMPTY) || (state == LOGGER_CALL_SITE_FREED)) {
+            if (freeSite == NULL_PTR(LoggerCallSite *)) {
+                freeSite = &candidate;
+                freeState = state;
+            }
+            done = (state == LOGGER_CALL_SITE_EMPTY);
+        }
+        else if (state == LOGGER_CALL_SITE_USED) {
+            done = ((candidate.lineNumber == errorInfo.header.lineNumber) && (candidate.fileName == errorInfo.fileName)
+                    && (candidate.functionName == errorInfo.functionName));
+            if (done) {
+                site = &candidate;
+            }
+        }
+        else {
+            //Possibly this same call site being added by another thread.
+            claiming = true;
+        }
+        index = (index + 1u) & (LOGGER_NUMBER_OF_CALL_SITES - 1u);
+    }
+    if ((site == NULL_PTR(LoggerCallSite *)) && (freeSite != NULL_PTR(LoggerCallSite *)) && (!claiming)) {
+        bool claimed = Atomic::CompareAndSwap(&freeSite->state, freeState, LOGGER_CALL_SITE_CLAIMED);
+        if (claimed) {
+            //A thread of the previous call site might still be writing the lastErrorInfo.
+            claimed = Atomic::TestAndSet(&freeSite->lastErrorInfoBusy);
+            if (!claimed) {
+                (void) Atomic::Exchange(&freeSite->state, LOGGER_CALL_SITE_FREED);
+            }
+        }
+        if (claimed) {
+            freeSite->fileName = errorInfo.fileName;
+            freeSite->functionName = errorInfo.functionName;
+            freeSite->lineNumber = errorInfo.header.lineNumber;
+            freeSite->lastErrorInfo = errorInfo;
+            (void) Atomic::Exchange(&freeSite->lastErrorInfoBusy, 0);
+            (void) Atomic::Exchange(&freeSite->nOfLogs, 0);
+            (void) Atomic::Exchange(&freeSite->nOfSuppressed, 0);
+            freeSite->periodStart = static_cast<int64>(now);
+            //Published only after being set up.
+            (void) Atomic::Exchange(&freeSite->state, LOGGER_CALL_SITE_USED);
+            site = freeSite;
+        }
+    }
+    return site;
+}
+
+void Logger::AddSummaryEntries(const uint64 now) {
+    uint32 i;
+    for (i = 0u; i < LOGGER_NUMBER_OF_CALL_SITES; i++) {
+        ErrorManagement::ErrorInformation errorInfo;
+        uint32 nOfSuppressed = 0u;
+        LoggerCallSite &site = callSites[i];
+        if (site.state == LOGGER_CALL_SITE_USED) {
+            if (site.nOfSuppressed > 0) {
+                //Never waits for a reporting thread that is writing the lastErrorInfo.
+                if (Atomic::TestAndSet(&site.lastErrorInfoBusy)) {
+                    nOfSuppressed = static_cast<uint32>(Atomic::Exchange(&site.nOfSuppressed, 0));
+                    errorInfo = site.lastErrorInfo;
+                    (void) Atomic::Exchange(&site.lastErrorInfoBusy, 0);
+                }
+            }
+            else if ((static_cast<uint64>(site.periodStart) <= now) && ((now - static_cast<uint64>(site.periodStart)) >= rateLimitPeriodTicks)) {
+                (void) Atomic::CompareAndSwap(&site.state, LOGGER_CALL_SITE_USED, LOGGER_CALL_SITE_FREED);
+            }
+            else {
+                //NOOP
+            }
+        }
+        if (nOfSuppressed > 0u) {
+            //The object might no longer exist.
+            errorInfo.objectName = NULL_PTR(const char8 *);
+            if (!AddLoggerEntry(errorInfo, "Message repeated %u times", nOfSuppressed)) {
+                Atomic::Increment(&nOfDroppedLogs);
+            }
+        }
+    }
+}
+
+void Logger::AddDroppedLogsEntry() {
+    const int32 nOfDropped = nOfDroppedLogs;
+    if (nOfDropped != nOfDroppedLogsReported) {
+        ErrorManagement::ErrorInformation errorInfo;
+        errorInfo.header.errorType = ErrorManagement::Warning;
+        errorInfo.header.lineNumber = static_cast<int16>(__LINE__);
+        errorInfo.header.isObject = false;
+        errorInfo.hrtTime = HighResolutionTimer::Counter();
+        errorInfo.timeSeconds = Sleep::GetDateSeconds();
+        errorInfo.objectName = NULL_PTR(const char8 *);
+        errorInfo.className = "Logger";
+        errorInfo.fileName = __FILE__;
+        errorInfo.functionName = __ERROR_FUNCTION_NAME__;
+        errorInfo.objectPointer = NULL_PTR(const void *);
+        if (AddLoggerEntry(errorInfo, "%u log messages were lost because no page was available", static_cast<uint32>(nOfDropped - nOfDroppedLogsReported))) {
+            nOfDroppedLogsReported = nOfDropped;
+        }
+    }
+}
+
+bool Logger::AddLoggerEntry(const ErrorManagement::ErrorInformation &errorInfo,
+                            const char8 * const format,
+                            const uint32 n) {
+    uint32 pageNo = pagesIndex.Take();
+    bool ok = ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages));
+    if (ok) {
+        LoggerPage &page = pages[pageNo];
+        page.index = pageNo;
+        page.format = NULL_PTR(const char8 *);
+        page.errorInfo = errorInfo;
+        StreamMemoryReference smr(&page.errorStrBuffer[0u], MAX_ERROR_MESSAGE_SIZE - 1u);
+        (void) smr.Printf(format, n);
+        page.errorStrBuffer[smr.Size()] = '\0';
+        AddLogEntry(&page);
+    }
+    return ok;
+}
+
 }
 
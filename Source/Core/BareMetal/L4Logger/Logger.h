@@ -53,6 +53,23 @@ struct LoggerPage {
      */
     char8 errorStrBuffer[MAX_ERROR_MESSAGE_SIZE];
 
+    /**
+     * The format of a message whose formatting was deferred (see Logger::SetDeferredFormatting) or
+     * NULL if errorStrBuffer already holds the message.
+     */
+    const char8 *format;
+
+    /**
+     * The parameters of a message whose formatting was deferred (terminated by a void AnyType).
+     * They point at parametersBuffer or hold the value itself (pointers).
+     */
+    AnyType parameters[MAX_ERROR_MESSAGE_PARAMETERS + 1u];
+
+    /**
+     * Copy of the values of the parameters of a message whose formatting was deferred.
+     */
+    uint64 parametersBuffer[MAX_ERROR_MESSAGE_SIZE / sizeof(uint64)];
+
     /**
      * The page index.
      */
@@ -60,15 +77,128 @@ struct LoggerPage {
     /*lint -e{9150} [MISRA C++ Rule 11-0-1]. Justification this structure behaves like a POD.*/
 };
 
+/**
+ * @brief Interface of the objects that are notified by the Logger when a new log entry is added (see Logger::SetNotifier).
+ */
+class DLL_API LoggerNotifierI {
+public:
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~LoggerNotifierI();
+
+    /**
+     * @brief Called by Logger::AddLogEntry after a new log entry is added.
+     * @details This function is executed by the thread that reported the error, so it shall be fast and it shall not report errors.
+     */
+    virtual void LogEntryAdded() = 0;
+};
+
+/**
+ * @brief Rate limiting information of the messages reported from the same call site (see Logger::SetRateLimit).
+ * @details The members are only updated with atomic operations (see Logger::AcceptLogEntry), so that the threads that report
+ * the errors never wait for each other nor for the thread that consumes the logs.
+ */
+struct LoggerCallSite {
+    /**
+     * The file name of the call site.
+     */
+    const char8 *fileName;
+
+    /**
+     * The function name of the call site.
+     */
+    const char8 *functionName;
+
+    /**
+     * The line number of the call site.
+     */
+    int16 lineNumber;
+
+    /**
+     * LOGGER_CALL_SITE_EMPTY, LOGGER_CALL_SITE_CLAIMED, LOGGER_CALL_SITE_USED or LOGGER_CALL_SITE_FREED.
+     */
+    volatile int32 state;
+
+    /**
+     * Number of messages logged in the current period.
+     */
+    volatile int32 nOfLogs;
+
+    /**
+     * Number of messages suppressed and not yet summarised.
+     */
+    volatile int32 nOfSuppressed;
+
+    /**
+     * HighResolutionTimer counter at the beginning of the current period.
+     */
+    volatile int64 periodStart;
+
+    /**
+     * Set (see Atomic::TestAndSet) while lastErrorInfo is being written or read.
+     */
+    volatile int32 lastErrorInfoBusy;
+
+    /**
+     * Error information of the last suppressed message (or of the first message of the call site).
+     */
+    ErrorManagement::ErrorInformation lastErrorInfo;
+    /*lint -e{9150} [MISRA C++ Rule 11-0-1]. Justification this structure behaves like a POD.*/
+};
+
 /**
  * @brief The default number of pages.
  */
 static const uint32 DEFAULT_NUMBER_OF_LOG_PAGES = 128u;
 
+/**
+ * @brief The number of call sites that can be rate limited at the same time (power of two).
+ */
+static const uint32 LOGGER_NUMBER_OF_CALL_SITES = 128u;
+
+/**
+ * @brief The LoggerCallSite was never used.
+ */
+static const int32 LOGGER_CALL_SITE_EMPTY = 0;
+
+/**
+ * @brief The LoggerCallSite is being used.
+ */
+static const int32 LOGGER_CALL_SITE_USED = 1;
+
+/**
+ * @brief The LoggerCallSite was used and can be reused.
+ */
+static const int32 LOGGER_CALL_SITE_FREED = 2;
+
+/**
+ * @brief The LoggerCallSite is being set up by the thread that claimed it.
+ */
+static const int32 LOGGER_CALL_SITE_CLAIMED = 3;
+
 /**
  * @brief The Logger class registers a callback to the SetErrorProcessFunction and adds
  * the logs to a FastResourceContainer queue. These are expected to be consumed by
  * users of this class.
+ * @details When the deferred formatting is enabled (see SetDeferredFormatting) the messages with parameters
+ * (i.e. REPORT_ERROR and REPORT_ERROR_STATIC with more than two parameters) are not formatted by the thread that
+ * reports the error. Only the format, the ErrorInformation and a copy of the values of the parameters are stored
+ * in the LoggerPage and the message is formatted by GetLogEntry, i.e. by the thread that consumes the logs.
+ * The values of scalar numbers, pointers and strings (char8 * and char8 arrays) are copied. Messages with any other
+ * type of parameter (e.g. a StreamString, which is printed from its current position) or with parameters that do not
+ * fit in LoggerPage::parametersBuffer are formatted immediately, as when the deferred formatting is disabled.
+ * @warning With the deferred formatting the format of the messages must be valid until the message is consumed,
+ * which is the case of string literals.
+ *
+ * When the rate limiting is enabled (see SetRateLimit) only the first maxLogsPerPeriod messages reported from the
+ * same call site (i.e. with the same file name, line number and function name) in each period are logged. The others
+ * are suppressed (see GetNumberOfSuppressedLogs) and, at most once per period, GetLogEntry adds a "Message repeated N times"
+ * entry with the ErrorInformation of the last suppressed message (without the object name, which might no longer be valid).
+ * This keeps a message that repeats at every cycle from exhausting the pages, which would lose the messages reported
+ * afterwards (see GetNumberOfDroppedLogs). Independently of the rate limiting, GetLogEntry adds a warning entry with the
+ * number of messages that were lost since the previous one of this kind.
  */
 class Logger {
 public:
@@ -88,6 +218,9 @@ public:
 
     /**
      * @brief Returns the oldest LoggerPage available or NULL if no LoggerPage is available.
+     * @details If the formatting of the message was deferred, the message is formatted into LoggerPage::errorStrBuffer.
+     * Before taking the oldest LoggerPage, adds the entries with the number of lost messages and, when the rate limiting
+     * period has elapsed, with the number of suppressed messages (see class description).
      * @return the oldest LoggerPage available or NULL if no LoggerPage is available.
      * @warning this page must be later returned to the Logger (see ReturnPage)
      */
@@ -101,12 +234,14 @@ public:
 
     /**
      * @brief Returns a page that is used to write the log message received in the callback function.
+     * @details If no page is available the message is counted as lost (see GetNumberOfDroppedLogs).
      * @return the a free page to write the log message or NULL if no page is available.
      */
     LoggerPage *GetPage();
 
     /**
      * @brief Adds a page to be consumed (see GetLogEntry) by a user of this class.
+     * @details Calls LoggerNotifierI::LogEntryAdded on the registered notifier (if any).
      * @param[in] page the page to be consumed.
      */
     void AddLogEntry(const LoggerPage * const page);
@@ -122,8 +257,122 @@ public:
      * @return the number of LoggerPage elements that were not consumed.
      */
     uint32 GetNumberOfLogs() const;
+
+    /**
+     * @brief Enables or disables the deferred formatting of the messages.
+     * @param[in] enabled true if the messages with parameters are to be formatted by GetLogEntry.
+     */
+    void SetDeferredFormatting(const bool enabled);
+
+    /**
+     * @brief Checks if the deferred formatting of the messages is enabled.
+     * @return true if the deferred formatting of the messages is enabled.
+     */
+    bool IsDeferredFormatting() const;
+
+    /**
+     * @brief Registers the object to be notified when a new log entry is added, so that the consumer can wait for logs
+     * instead of polling GetLogEntry.
+     * @details Waits until no thread is calling LogEntryAdded on the previous notifier, so that once this function returns
+     * the previous notifier is no longer used and can be destroyed.
+     * @param[in] notifierIn the object to be notified or NULL to remove the current one.
+     * @warning The notifier shall be removed before being destroyed. This function shall not be called from LogEntryAdded.
+     */
+    void SetNotifier(LoggerNotifierI * const notifierIn);
+
+    /**
+     * @brief Gets the registered notifier.
+     * @return the registered notifier or NULL if none is registered.
+     */
+    LoggerNotifierI *GetNotifier() const;
+
+    /**
+     * @brief Enables or disables the rate limiting of the messages reported from the same call site (see class description).
+     * @details The state of all the call sites is reset, i.e. the messages suppressed and not yet summarised are discarded.
+     * @param[in] maxLogsPerPeriod the maximum number of messages logged for each call site in each period. 0 disables the rate limiting.
+     * @param[in] periodMSec the period in milliseconds.
+     */
+    void SetRateLimit(const uint32 maxLogsPerPeriod,
+                      const uint32 periodMSec);
+
+    /**
+     * @brief Gets the maximum number of messages logged for each call site in each period.
+     * @return the maximum number of messages logged for each call site in each period (0 if the rate limiting is disabled).
+     */
+    uint32 GetRateLimit() const;
+
+    /**
+     * @brief Gets the rate limiting period.
+     * @return the rate limiting period in milliseconds.
+     */
+    uint32 GetRateLimitPeriod() const;
+
+    /**
+     * @brief Checks if a message reported from the call site of \a errorInfo is to be logged.
+     * @details Counts the message against the limit of its call site. Messages are always accepted if the rate limiting is
+     * disabled, if all the LOGGER_NUMBER_OF_CALL_SITES call sites are being used or if the call site cannot be claimed
+     * without waiting (e.g. it is being added by another thread). This function does not take any lock.
+     * @param[in] errorInfo the error information of the reported message.
+     * @return false if the message is to be suppressed.
+     */
+    bool AcceptLogEntry(const ErrorManagement::ErrorInformation &errorInfo);
+
+    /**
+     * @brief Gets the number of messages suppressed by the rate limiting since the Logger was created.
+     * @return the number of messages suppressed by the rate limiting.
+     */
+    uint32 GetNumberOfSuppressedLogs() const;
+
+    /**
+     * @brief Gets the number of messages lost since the Logger was created because no page was available (see GetPage).
+     * @return the number of messages lost because no page was available.
+     */
+    uint32 GetNumberOfDroppedLogs() const;
 private:
 
+    /**
+     * @brief Finds (or claims) the call site of \a errorInfo.
+     * @details A free call site is claimed with Atomic::CompareAndSwap. A call site that is freed and claimed again while
+     * being compared may (rarely) count a message against the wrong call site, but the call sites are never locked.
+     * @param[in] errorInfo the error information of the reported message.
+     * @param[in] now the current HighResolutionTimer counter.
+     * @return the call site or NULL if all the call sites are being used or if another thread is claiming a call site.
+     */
+    LoggerCallSite *GetCallSite(const ErrorManagement::ErrorInformation &errorInfo,
+                                const uint64 now);
+
+    /**
+     * @brief Adds a "Message repeated N times" entry for each call site with suppressed messages and frees
+     * the call sites whose period has elapsed.
+     * @details The suppressed messages are taken with Atomic::Exchange. If a reporting thread is writing the
+     * last error information of a call site, its messages are summarised in the next period.
+     * @param[in] now the current HighResolutionTimer counter.
+     */
+    void AddSummaryEntries(const uint64 now);
+
+    /**
+     * @brief Adds an entry with the number of messages lost since the last entry of this kind (if any was lost).
+     */
+    void AddDroppedLogsEntry();
+
+    /**
+     * @brief Adds an entry generated by the Logger itself.
+     * @details The page is taken directly from the pagesIndex so that a failure is not counted as a lost message.
+     * @param[in] errorInfo the error information of the entry.
+     * @param[in] format the format of the message, with a single parameter.
+     * @param[in] n the parameter of the message.
+     * @return true if a page was available.
+     */
+    bool AddLoggerEntry(const ErrorManagement::ErrorInformation &errorInfo,
+                        const char8 * const format,
+                        const uint32 n);
+
+    /**
+     * @brief Registers the deferred error process function if either the deferred formatting or the rate limiting
+     * is enabled, so that the messages are not formatted before being accepted. Removes it otherwise.
+     */
+    void UpdateDeferredErrorProcessFunction() const;
+
     /**
      * @brief Default constructor.
      * @param[in] numberOfPages the number of pages to set for the logger.
@@ -154,6 +403,61 @@ private:
      */
     FastResourceContainer pagesIndex;
 
+    /**
+     * True if the deferred formatting is enabled.
+     */
+    bool deferredFormatting;
+
+    /**
+     * The object to be notified when a new log entry is added.
+     */
+    LoggerNotifierI * volatile notifier;
+
+    /**
+     * Number of threads that are (possibly) calling LogEntryAdded on the notifier.
+     */
+    volatile int32 notifierUsers;
+
+    /**
+     * The maximum number of messages logged for each call site in each period (0 if the rate limiting is disabled).
+     */
+    uint32 rateLimit;
+
+    /**
+     * The rate limiting period in milliseconds.
+     */
+    uint32 rateLimitPeriod;
+
+    /**
+     * The rate limiting period in HighResolutionTimer ticks.
+     */
+    uint64 rateLimitPeriodTicks;
+
+    /**
+     * HighResolutionTimer counter of the last call to AddSummaryEntries.
+     */
+    uint64 lastSummaryCounter;
+
+    /**
+     * The rate limiting information of each call site.
+     */
+    LoggerCallSite callSites[LOGGER_NUMBER_OF_CALL_SITES];
+
+    /**
+     * Number of messages suppressed by the rate limiting.
+     */
+    volatile int32 nOfSuppressedLogs;
+
+    /**
+     * Number of messages lost because no page was available.
+     */
+    volatile int32 nOfDroppedLogs;
+
+    /**
+     * Value of nOfDroppedLogs when the last entry with the number of lost messages was added.
+     */
+    int32 nOfDroppedLogsReported;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the numberOfPages must be defined on construction and remain constant
      * during object's lifetime*/
@@ -34,6 +34,7 @@
 #include "AdvancedErrorManagement.h"
 #include "BrokerI.h"
 #include "DataSourceI.h"
+#include "MemoryLock.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -241,4 +242,24 @@ StreamString BrokerI::GetOwnerDataSourceName() const {
     return ownerDataSourceName;
 }
 
+uint64 BrokerI::PreFaultMemory() {
+    uint64 footprint = 0u;
+    if (functionSignalPointers != NULL_PTR(void **)) {
+        uint32 size = static_cast<uint32>(sizeof(void *)) * numberOfCopies;
+        MemoryLock::Touch(reinterpret_cast<void *>(functionSignalPointers), size);
+        footprint += size;
+    }
+    if (copyByteSize != NULL_PTR(uint32 *)) {
+        uint32 size = static_cast<uint32>(sizeof(uint32)) * numberOfCopies;
+        MemoryLock::Touch(reinterpret_cast<void *>(copyByteSize), size);
+        footprint += size;
+    }
+    if (copyOffset != NULL_PTR(uint32 *)) {
+        uint32 size = static_cast<uint32>(sizeof(uint32)) * numberOfCopies;
+        MemoryLock::Touch(reinterpret_cast<void *>(copyOffset), size);
+        footprint += size;
+    }
+    return footprint;
+}
+
 }
@@ -126,6 +126,15 @@ public:
      */
     StreamString GetOwnerDataSourceName() const;
 
+    /**
+     * @brief Touches all the copy tables that are used by this BrokerI during the real-time execution, so that they are mapped before the first cycle.
+     * @details Brokers which hold further tables should override this method and call the BrokerI implementation.
+     * @return the number of bytes that were touched.
+     * @pre
+     *   Init()
+     */
+    virtual uint64 PreFaultMemory();
+
 protected:
     /**
      * @brief Helper function which retrieves from the \a dataSource all the copy information related to the GAM.
@@ -0,0 +1,290 @@
+/**
+ * @file CyclicTimerDataSource.cpp
+ * @brief Source file for class CyclicTimerDataSource
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ REPORT_ERROR_PARAMETERS_OBJby the European Commission - subsequent versions of the EUPL (the "Licence");
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CyclicTimerDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "CyclicTimerDataSource.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+CyclicTimerDataSource::CyclicTimerDataSource() :
+        MemoryDataSourceI() {
+    frequency = 0.F;
+    periodTicks = 0u;
+    periodFraction = 0u;
+    deadlineFraction = 0u;
+    startTicks = 0u;
+    deadlineTicks = 0u;
+    minimumSpinTicks = 0u;
+    latencyTicks = 0u;
+    adaptiveSpin = true;
+    started = false;
+    periods = 0u;
+    overruns = 0u;
+    ticksToMicroSecondsScale = static_cast<uint64>(((HighResolutionTimer::Period() * 1e6) * 4294967296.0) + 0.5);
+    counterSignal = NULL_PTR(uint32 *);
+    timeSignal = NULL_PTR(uint32 *);
+    overrunsSignal = NULL_PTR(uint32 *);
+}
+
+CyclicTimerDataSource::~CyclicTimerDataSource() {
+    counterSignal = NULL_PTR(uint32 *);
+    timeSignal = NULL_PTR(uint32 *);
+    overrunsSignal = NULL_PTR(uint32 *);
+}
+
+bool CyclicTimerDataSource::Initialise(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::Initialise(data);
+    if (ret) {
+        uint32 spinTime = 50u;
+        if (!data.Read("SpinTime", spinTime)) {
+            spinTime = 50u;
+        }
+        /*lint -e{9122} conversion from float to integer allowed*/
+        minimumSpinTicks = static_cast<uint64>((static_cast<float64>(spinTime) * 1e-6) * static_cast<float64>(HighResolutionTimer::Frequency()));
+
+        uint32 adaptive = 1u;
+        if (!data.Read("AdaptiveSpin", adaptive)) {
+            adaptive = 1u;
+        }
+        ret = (adaptive < 2u);
+        if (ret) {
+            adaptiveSpin = (adaptive == 1u);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "AdaptiveSpin shall be 0 or 1");
+        }
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = MemoryDataSourceI::SetConfiguredDatabase(data);
+    uint32 nSignals = GetNumberOfSignals();
+    if (ret) {
+        ret = ((nSignals == 2u) || (nSignals == 3u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Two or three signals shall be defined (Counter, Time and optionally Overruns)");
+        }
+    }
+    uint32 n;
+    for (n = 0u; (n < nSignals) && (ret); n++) {
+        TypeDescriptor signalType = GetSignalType(n);
+        ret = ((signalType == UnsignedInteger32Bit) || (signalType == SignedInteger32Bit));
+        if (ret) {
+            uint32 nElements = 0u;
+            ret = GetSignalNumberOfElements(n, nElements);
+            if (ret) {
+                ret = (nElements == 1u);
+            }
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The signals shall be 32 bit integers with one element");
+        }
+    }
+    uint32 nSynchronising = 0u;
+    uint32 nFunctions = GetNumberOfFunctions();
+    uint32 f;
+    for (f = 0u; (f < nFunctions) && (ret); f++) {
+        uint32 nFunctionSignals = 0u;
+        ret = GetFunctionNumberOfSignals(InputSignals, f, nFunctionSignals);
+        for (n = 0u; (n < nFunctionSignals) && (ret); n++) {
+            float32 signalFrequency = -1.F;
+            ret = GetFunctionSignalReadFrequency(InputSignals, f, n, signalFrequency);
+            if ((ret) && (signalFrequency > 0.F)) {
+                frequency = signalFrequency;
+                nSynchronising++;
+            }
+        }
+    }
+    if (ret) {
+        ret = (nSynchronising == 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Exactly one signal with a Frequency > 0 shall be read from this DataSourceI (%d found)",
+                         nSynchronising);
+        }
+    }
+    if (ret) {
+        float64 period = static_cast<float64>(HighResolutionTimer::Frequency()) / static_cast<float64>(frequency);
+        /*lint -e{9122} conversion from float to integer allowed*/
+        periodTicks = static_cast<uint64>(period);
+        /*lint -e{9122} conversion from float to integer allowed*/
+        periodFraction = static_cast<uint32>((period - static_cast<float64>(periodTicks)) * 4294967296.0);
+        ret = (periodTicks > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Frequency is too high");
+        }
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSource::AllocateMemory() {
+    bool ret = MemoryDataSourceI::AllocateMemory();
+    void *signalAddress = NULL_PTR(void *);
+    if (ret) {
+        ret = GetSignalMemoryBuffer(0u, 0u, signalAddress);
+    }
+    if (ret) {
+        counterSignal = static_cast<uint32 *>(signalAddress);
+        ret = GetSignalMemoryBuffer(1u, 0u, signalAddress);
+    }
+    if (ret) {
+        timeSignal = static_cast<uint32 *>(signalAddress);
+        if (GetNumberOfSignals() > 2u) {
+            ret = GetSignalMemoryBuffer(2u, 0u, signalAddress);
+            if (ret) {
+                overrunsSignal = static_cast<uint32 *>(signalAddress);
+            }
+        }
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSource::Synchronise() {
+    uint64 nowTicks = HighResolutionTimer::Counter();
+    if (!started) {
+        started = true;
+        startTicks = nowTicks;
+        deadlineTicks = nowTicks;
+        deadlineFraction = 0u;
+        periods = 0u;
+    }
+    else {
+        AdvanceDeadline();
+        if (static_cast<int64>(nowTicks - deadlineTicks) > 0) {
+            overruns++;
+            //Skip the deadlines that were missed so that the cycles remain aligned with the grid.
+            while (static_cast<int64>(nowTicks - deadlineTicks) >= 0) {
+                AdvanceDeadline();
+            }
+        }
+        uint64 spinTicks = GetSpinTicks();
+        uint64 wakeTicks = deadlineTicks - spinTicks;
+        if (static_cast<int64>(wakeTicks - nowTicks) > 0) {
+            Sleep::UntilCounter(wakeTicks);
+            if (adaptiveSpin) {
+                int64 lateTicks = static_cast<int64>(HighResolutionTimer::Counter() - wakeTicks);
+                uint64 measuredTicks = (lateTicks > 0) ? (static_cast<uint64>(lateTicks)) : (0u);
+                //Fast attack, slow decay: a single late wake-up is enough to increase the spin time.
+                if (measuredTicks > latencyTicks) {
+                    latencyTicks = measuredTicks;
+                }
+                else {
+                    latencyTicks -= ((latencyTicks - measuredTicks) >> 4u);
+                }
+            }
+        }
+        while (static_cast<int64>(deadlineTicks - HighResolutionTimer::Counter()) > 0) {
+        }
+    }
+    if (counterSignal != NULL_PTR(uint32 *)) {
+        *counterSignal = periods;
+    }
+    if (timeSignal != NULL_PTR(uint32 *)) {
+        *timeSignal = GAMSchedulerI::TicksToMicroSeconds(deadlineTicks - startTicks, ticksToMicroSecondsScale);
+    }
+    if (overrunsSignal != NULL_PTR(uint32 *)) {
+        *overrunsSignal = overruns;
+    }
+    return true;
+}
+
+const char8 *CyclicTimerDataSource::GetBrokerName(StructuredDataI &data,
+                                                  const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    if (direction == InputSignals) {
+        float32 freq = -1.0F;
+        if (!data.Read("Frequency", freq)) {
+            freq = -1.0F;
+        }
+
+        if (freq >= 0.F) {
+            brokerName = "MemoryMapSynchronisedInputBroker";
+        }
+        else {
+            brokerName = "MemoryMapInputBroker";
+        }
+    }
+    return brokerName;
+}
+
+/*lint -e{715} only input signals are supported.*/
+bool CyclicTimerDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                             const char8* const functionName,
+                                             void * const gamMemPtr) {
+    return false;
+}
+
+/*lint -e{715} the timing grid is kept across state changes.*/
+bool CyclicTimerDataSource::PrepareNextState(const char8 * const currentStateName,
+                                             const char8 * const nextStateName) {
+    return true;
+}
+
+float32 CyclicTimerDataSource::GetFrequency() const {
+    return frequency;
+}
+
+uint64 CyclicTimerDataSource::GetPeriodTicks() const {
+    return periodTicks;
+}
+
+uint64 CyclicTimerDataSource::GetSpinTicks() const {
+    uint64 spinTicks = minimumSpinTicks;
+    if (adaptiveSpin) {
+        spinTicks += (2u * latencyTicks);
+    }
+    if (spinTicks > periodTicks) {
+        spinTicks = periodTicks;
+    }
+    return spinTicks;
+}
+
+uint32 CyclicTimerDataSource::GetNumberOfOverruns() const {
+    return overruns;
+}
+
+CLASS_REGISTER(CyclicTimerDataSource, "1.0")
+
+}
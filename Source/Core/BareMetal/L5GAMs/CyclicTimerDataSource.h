@@ -0,0 +1,282 @@
+/**
+ * @file CyclicTimerDataSource.h
+ * @brief Header file for class CyclicTimerDataSource
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CyclicTimerDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CYCLICTIMERDATASOURCE_H_
+#define CYCLICTIMERDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A DataSourceI which paces a real-time thread with a fixed period.
+ * @details The Synchronise method blocks until the next cycle deadline. The deadlines are absolute values of
+ * the HighResolutionTimer::Counter(), computed from the first cycle as start + n * period (the fractional part of the period
+ * is accumulated in fixed-point), so that the jitter of one cycle does not propagate to the next ones (no drift).
+ *
+ * Each wait is split into an operating system sleep until (deadline - spin) (see Sleep::UntilCounter) followed by a
+ * busy wait on the HighResolutionTimer until the deadline. The spin time starts at SpinTime and, if AdaptiveSpin is set,
+ * grows with the measured operating system wake-up latency (immediately when a wake-up is later than expected and slowly decaying
+ * otherwise), so that the busy wait absorbs the scheduler latency while the cpu is released for most of the period.
+ *
+ * If a deadline is already in the past when Synchronise is called (i.e. the previous cycle took longer than the period)
+ * an overrun is counted and all the missed deadlines are skipped, so that the cycles remain aligned with the original grid.
+ *
+ * The cycle frequency is the Frequency of the (single) GAM signal that synchronises with this DataSourceI.
+ *
+ * The signals are identified by their position and shall be 32 bit integers with one element:
+ *  - the first signal holds the number of periods elapsed since the first cycle (it jumps if deadlines were skipped);
+ *  - the second signal holds the time of the current deadline, in micro-seconds, since the first cycle;
+ *  - the third signal (optional) holds the number of overruns.
+ *
+ * The timing grid is kept across state changes.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Timer = {
+ *     Class = CyclicTimerDataSource
+ *     SpinTime = 50 //Optional. Minimum time, in micro-seconds, to busy wait before each deadline. Default = 50.
+ *     AdaptiveSpin = 1 //Optional. If 1 the spin time is adapted to the measured wake-up latency. Default = 1.
+ *     Signals = {
+ *         Counter = {
+ *             Type = uint32
+ *         }
+ *         Time = {
+ *             Type = uint32
+ *         }
+ *         Overruns = { //Optional
+ *             Type = uint32
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class DLL_API CyclicTimerDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    CyclicTimerDataSource();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~CyclicTimerDataSource();
+
+    /**
+     * @brief see MemoryDataSourceI::Initialise.
+     * @details Reads the optional SpinTime and AdaptiveSpin parameters.
+     * @param[in] data see MemoryDataSourceI::Initialise.
+     * @return true if MemoryDataSourceI::Initialise returns true and if AdaptiveSpin (if set) is 0 or 1.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief see DataSourceI::SetConfiguredDatabase.
+     * @details Verifies the signals and computes the period from the Frequency of the synchronising signal.
+     * @param[in] data see DataSourceI::SetConfiguredDatabase.
+     * @return true if there are two or three 32 bit integer signals with one element and exactly one signal with a Frequency > 0.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief see MemoryDataSourceI::AllocateMemory.
+     * @details Caches the address of the signals.
+     * @return see MemoryDataSourceI::AllocateMemory.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief Waits for the next deadline and updates the signals.
+     * @details The first call starts the timing grid and returns immediately.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Returns MemoryMapSynchronisedInputBroker if the signal has a Frequency >= 0, MemoryMapInputBroker otherwise.
+     * @param[in] data the signal properties.
+     * @param[in] direction only InputSignals are supported.
+     * @return the broker name or NULL if \a direction is not InputSignals.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
+
+    /**
+     * @brief Only input signals are supported.
+     * @return false.
+     */
+    virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers, const char8* const functionName, void * const gamMemPtr);
+
+    /**
+     * @brief NOOP. The timing grid is kept across state changes.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief Gets the cycle frequency.
+     * @return the cycle frequency in Hz.
+     */
+    float32 GetFrequency() const;
+
+    /**
+     * @brief Gets the cycle period.
+     * @return the integer part of the cycle period in HighResolutionTimer ticks.
+     */
+    uint64 GetPeriodTicks() const;
+
+    /**
+     * @brief Gets the time which is currently busy waited before each deadline.
+     * @return the spin time in HighResolutionTimer ticks.
+     */
+    uint64 GetSpinTicks() const;
+
+    /**
+     * @brief Gets the number of cycles whose deadline had already expired when Synchronise was called.
+     * @return the number of overruns.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+private:
+
+    /**
+     * @brief Moves the deadline by one period.
+     */
+    inline void AdvanceDeadline();
+
+    /**
+     * The cycle frequency.
+     */
+    float32 frequency;
+
+    /**
+     * Integer part of the period in ticks.
+     */
+    uint64 periodTicks;
+
+    /**
+     * Fractional part of the period in ticks, multiplied by 2^32.
+     */
+    uint32 periodFraction;
+
+    /**
+     * Accumulated fractional part of the deadline.
+     */
+    uint32 deadlineFraction;
+
+    /**
+     * The counter value at the first cycle.
+     */
+    uint64 startTicks;
+
+    /**
+     * The counter value of the current deadline.
+     */
+    uint64 deadlineTicks;
+
+    /**
+     * Minimum spin time in ticks (SpinTime).
+     */
+    uint64 minimumSpinTicks;
+
+    /**
+     * Current estimate of the operating system wake-up latency in ticks.
+     */
+    uint64 latencyTicks;
+
+    /**
+     * True if the spin time is adapted to the wake-up latency.
+     */
+    bool adaptiveSpin;
+
+    /**
+     * True after the first call to Synchronise.
+     */
+    bool started;
+
+    /**
+     * Number of periods since the first cycle.
+     */
+    uint32 periods;
+
+    /**
+     * Number of overruns.
+     */
+    uint32 overruns;
+
+    /**
+     * Conversion factor from ticks to micro-seconds (see GAMSchedulerI::TicksToMicroSeconds).
+     */
+    uint64 ticksToMicroSecondsScale;
+
+    /**
+     * Address of the period counter signal.
+     */
+    uint32 *counterSignal;
+
+    /**
+     * Address of the time signal.
+     */
+    uint32 *timeSignal;
+
+    /**
+     * Address of the overruns signal (NULL if not declared).
+     */
+    uint32 *overrunsSignal;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void CyclicTimerDataSource::AdvanceDeadline() {
+    deadlineTicks += periodTicks;
+    uint32 lastFraction = deadlineFraction;
+    deadlineFraction += periodFraction;
+    if (deadlineFraction < lastFraction) {
+        deadlineTicks++;
+    }
+    periods++;
+}
+
+}
+
+#endif /* CYCLICTIMERDATASOURCE_H_ */
@@ -843,6 +843,10 @@ uint32 DataSourceI::GetCurrentStateBuffer() {
     return 0u;
 }
 
+uint64 DataSourceI::PreFaultMemory() {
+    return 0u;
+}
+
 /*lint -estring(1960, "*external side-effects*") only the default implementation has no external side effects*/
 void DataSourceI::PrepareInputOffsets() {
 }
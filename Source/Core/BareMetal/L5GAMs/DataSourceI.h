@@ -505,6 +505,17 @@ public:
      */
     virtual bool AllocateMemory() = 0;
 
+    /**
+     * @brief Touches all the memory that is used by this DataSourceI during the real-time execution, so that it is mapped before the first cycle.
+     * @details Only called by the RealTimeApplication::ConfigureApplication, before any state is executed. The memory shall only
+     * be read (see MemoryLock::Touch), given that the DataSourceI may already be writing into it. The default implementation does not
+     * know the memory layout and returns 0.
+     * @return the number of bytes that were touched.
+     * @pre
+     *   AllocateMemory()
+     */
+    virtual uint64 PreFaultMemory();
+
     /**
      * @brief Gets the memory address for the signal at index \a signalIdx.
      * @param[in] signalIdx the index of the signal.
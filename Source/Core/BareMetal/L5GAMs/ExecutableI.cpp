@@ -43,9 +43,10 @@ namespace MARTe {
 
 ExecutableI::ExecutableI() {
     timingSignalAddress = NULL_PTR(uint32 * const);
+    timingSignalTicksAddress = NULL_PTR(uint64 * const);
 }
 
-/*lint -e{1540} the timingSignalAddress is to freed by the class that uses the ExecutableI, typically a GAMSchedulerI.*/
+/*lint -e{1540} the timingSignalAddress and the timingSignalTicksAddress are to freed by the class that uses the ExecutableI, typically a GAMSchedulerI.*/
 ExecutableI::~ExecutableI() {
 }
 
@@ -53,4 +54,8 @@ void ExecutableI::SetTimingSignalAddress(uint32 * const timingSignalAddressIn) {
     timingSignalAddress = timingSignalAddressIn;
 }
 
+void ExecutableI::SetTimingSignalTicksAddress(uint64 * const timingSignalTicksAddressIn) {
+    timingSignalTicksAddress = timingSignalTicksAddressIn;
+}
+
 }
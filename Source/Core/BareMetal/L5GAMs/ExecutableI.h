@@ -75,9 +75,29 @@ public:
      */
     inline uint32 *GetTimingSignalAddress();
 
+    /**
+     * @brief Sets the address in memory where the signal which contains the last execution time of this component is stored in
+     * HighResolutionTimer ticks.
+     * @details When set, the GAMSchedulerI stores the raw ticks (measured w.r.t. to the start of a cycle) in this address and does not
+     * write the micro-seconds timing signal (see SetTimingSignalAddress).
+     * @param[in] timingSignalTicksAddressIn the address of the timing signal.
+     */
+    void SetTimingSignalTicksAddress(uint64 * const timingSignalTicksAddressIn);
+
+    /**
+     * @brief Gets the address in memory where the signal which contains the last execution time (in ticks) is stored.
+     * @return the address in memory where the signal which contains the last execution time (in ticks) is stored or NULL if it was not set.
+     */
+    inline uint64 *GetTimingSignalTicksAddress();
+
 private:
 
     uint32 * timingSignalAddress;
+
+    /**
+     * The address of the timing signal in ticks (NULL if the timing signal is in micro-seconds).
+     */
+    uint64 * timingSignalTicksAddress;
 };
 
 
@@ -89,6 +109,10 @@ uint32 * ExecutableI::GetTimingSignalAddress() {
     return timingSignalAddress;
 }
 
+uint64 * ExecutableI::GetTimingSignalTicksAddress() {
+    return timingSignalTicksAddress;
+}
+
 }
 #endif /* EXECUTORI_H_ */
 	
@@ -0,0 +1,174 @@
+/**
+ * @file ExecutionTimeHistogram.cpp
+ * @brief Source file for class ExecutionTimeHistogram
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeHistogram (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ExecutionTimeHistogram::ExecutionTimeHistogram() {
+    overrunThreshold = 0u;
+    Reset();
+}
+
+ExecutionTimeHistogram::~ExecutionTimeHistogram() {
+}
+
+void ExecutionTimeHistogram::Reset() {
+    uint32 i;
+    for (i = 0u; i < EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS; i++) {
+        counts[i] = 0u;
+    }
+    numberOfSamples = 0u;
+    numberOfOverruns = 0u;
+    minimum = 0u;
+    maximum = 0u;
+    sum = 0.0;
+}
+
+void ExecutionTimeHistogram::SetOverrunThreshold(const uint64 overrunThresholdIn) {
+    overrunThreshold = overrunThresholdIn;
+}
+
+uint64 ExecutionTimeHistogram::GetOverrunThreshold() const {
+    return overrunThreshold;
+}
+
+uint64 ExecutionTimeHistogram::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint64 ExecutionTimeHistogram::GetNumberOfOverruns() const {
+    return numberOfOverruns;
+}
+
+uint64 ExecutionTimeHistogram::GetMinimum() const {
+    return minimum;
+}
+
+uint64 ExecutionTimeHistogram::GetMaximum() const {
+    return maximum;
+}
+
+float64 ExecutionTimeHistogram::GetMean() const {
+    float64 mean = 0.0;
+    if (numberOfSamples > 0u) {
+        mean = sum / static_cast<float64>(numberOfSamples);
+    }
+    return mean;
+}
+
+uint64 ExecutionTimeHistogram::GetBucketUpperValue(const uint32 bucketIdx) {
+    uint64 value;
+    if (bucketIdx < EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS) {
+        value = static_cast<uint64>(bucketIdx);
+    }
+    else {
+        uint32 shift = (bucketIdx / EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS) - 1u;
+        uint64 subBucket = static_cast<uint64>(bucketIdx % EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS);
+        uint64 lowest = (static_cast<uint64>(EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS) + subBucket) << shift;
+        value = lowest + ((static_cast<uint64>(1u) << shift) - 1u);
+    }
+    return value;
+}
+
+uint64 ExecutionTimeHistogram::GetValueAtPercentile(const float64 percentile) const {
+    uint64 value = 0u;
+    uint64 samples = numberOfSamples;
+    if (samples > 0u) {
+        float64 p = percentile;
+        if (p < 0.0) {
+            p = 0.0;
+        }
+        if (p > 100.0) {
+            p = 100.0;
+        }
+        //Number of samples that have to be at or below the returned value (at least one).
+        uint64 target = static_cast<uint64>(((p / 100.0) * static_cast<float64>(samples)) + 0.5);
+        if (target == 0u) {
+            target = 1u;
+        }
+        uint64 accumulated = 0u;
+        bool found = false;
+        uint32 i;
+        for (i = 0u; (i < EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS) && (!found); i++) {
+            accumulated += counts[i];
+            if (accumulated >= target) {
+                value = GetBucketUpperValue(i);
+                found = true;
+            }
+        }
+        if ((!found) || (value > maximum)) {
+            value = maximum;
+        }
+    }
+    return value;
+}
+
+bool ExecutionTimeHistogram::ExportData(StructuredDataI &data,
+                                        const float64 period) const {
+    const float64 toMicroSeconds = period * 1e6;
+    bool ok = data.Write("Samples", numberOfSamples);
+    if (ok) {
+        ok = data.Write("Overruns", numberOfOverruns);
+    }
+    if (ok) {
+        float64 minUs = static_cast<float64>(minimum) * toMicroSeconds;
+        ok = data.Write("Min", minUs);
+    }
+    if (ok) {
+        float64 maxUs = static_cast<float64>(maximum) * toMicroSeconds;
+        ok = data.Write("Max", maxUs);
+    }
+    if (ok) {
+        float64 meanUs = GetMean() * toMicroSeconds;
+        ok = data.Write("Mean", meanUs);
+    }
+    const uint32 numberOfPercentiles = 5u;
+    const float64 percentiles[numberOfPercentiles] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+    const char8 * const percentileNames[numberOfPercentiles] = { "P50", "P90", "P99", "P999", "P9999" };
+    uint32 i;
+    for (i = 0u; (i < numberOfPercentiles) && (ok); i++) {
+        float64 valueUs = static_cast<float64>(GetValueAtPercentile(percentiles[i])) * toMicroSeconds;
+        ok = data.Write(percentileNames[i], valueUs);
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,277 @@
+/**
+ * @file ExecutionTimeHistogram.h
+ * @brief Header file for class ExecutionTimeHistogram
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeHistogram
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONTIMEHISTOGRAM_H_
+#define EXECUTIONTIMEHISTOGRAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Number of bits used to linearly sub-divide each power of two of the ExecutionTimeHistogram (i.e. 2^4 = 16 sub-buckets,
+ * which bounds the relative error of any value read from the histogram to 1/16).
+ */
+#define EXECUTION_TIME_HISTOGRAM_SUB_BUCKET_BITS 4u
+
+/**
+ * Number of sub-buckets per power of two.
+ */
+#define EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS (1u << EXECUTION_TIME_HISTOGRAM_SUB_BUCKET_BITS)
+
+/**
+ * Total number of buckets needed to cover the full uint64 range.
+ */
+#define EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS ((65u - EXECUTION_TIME_HISTOGRAM_SUB_BUCKET_BITS) * EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS)
+
+namespace MARTe {
+
+/**
+ * @brief Log-linear (HDR style) histogram of execution times measured in HighResolutionTimer ticks.
+ *
+ * @details Values smaller than EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS are counted exactly. Larger values are counted in
+ * buckets whose width is 1/EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS of the power of two they belong to, so that the
+ * percentiles are returned with a bounded relative error and without storing every sample.
+ *
+ * @details The histogram is designed to be updated by a single real-time thread (see GAMSchedulerI::ExecuteSingleCycle):
+ * Add does not allocate nor lock. Other threads may read it at any time (e.g. ExportData), accepting that the statistics
+ * might be one sample out-of-date.
+ */
+class DLL_API ExecutionTimeHistogram {
+public:
+
+    /**
+     * @brief Constructor. Resets the histogram.
+     * @post
+     *   GetNumberOfSamples() == 0 &&
+     *   GetOverrunThreshold() == 0
+     */
+    ExecutionTimeHistogram();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~ExecutionTimeHistogram();
+
+    /**
+     * @brief Clears all the samples.
+     * @post
+     *   GetNumberOfSamples() == 0 &&
+     *   GetNumberOfOverruns() == 0
+     */
+    void Reset();
+
+    /**
+     * @brief Sets the value above which a sample is counted as an overrun.
+     * @param[in] overrunThresholdIn the overrun threshold in ticks. If 0 no overruns are counted.
+     */
+    void SetOverrunThreshold(const uint64 overrunThresholdIn);
+
+    /**
+     * @brief Gets the value above which a sample is counted as an overrun.
+     * @return the overrun threshold in ticks.
+     */
+    uint64 GetOverrunThreshold() const;
+
+    /**
+     * @brief Adds a sample to the histogram.
+     * @param[in] ticks the sample value.
+     */
+    inline void Add(const uint64 ticks);
+
+    /**
+     * @brief Gets the number of samples added since the last Reset.
+     * @return the number of samples.
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the number of samples that were greater than the overrun threshold.
+     * @return the number of overruns.
+     */
+    uint64 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the smallest sample.
+     * @return the smallest sample or 0 if there are no samples.
+     */
+    uint64 GetMinimum() const;
+
+    /**
+     * @brief Gets the largest sample.
+     * @return the largest sample.
+     */
+    uint64 GetMaximum() const;
+
+    /**
+     * @brief Gets the average of all the samples.
+     * @return the average of all the samples or 0 if there are no samples.
+     */
+    float64 GetMean() const;
+
+    /**
+     * @brief Gets the value below which \a percentile % of the samples are found.
+     * @details The returned value is the upper limit of the bucket which holds the percentile, clipped to GetMaximum().
+     * @param[in] percentile the percentile in the range [0, 100].
+     * @return the value at the percentile or 0 if there are no samples.
+     */
+    uint64 GetValueAtPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Writes the statistics of the histogram in the current node of \a data.
+     * @details The following leafs are written: Samples, Overruns, Min, Max, Mean, P50, P90, P99, P999 and P9999.
+     * All the times are converted to micro-seconds.
+     * @param[out] data where to write the statistics.
+     * @param[in] period the time (in seconds) of a tick.
+     * @return true if all the leafs were successfully written.
+     */
+    bool ExportData(StructuredDataI &data,
+                    const float64 period) const;
+
+    /**
+     * @brief Computes the bucket that holds \a ticks.
+     * @param[in] ticks the value.
+     * @return the bucket index.
+     */
+    static inline uint32 GetBucketIndex(const uint64 ticks);
+
+    /**
+     * @brief Computes the largest value that is counted in the bucket \a bucketIdx.
+     * @param[in] bucketIdx the bucket index.
+     * @return the largest value that is counted in \a bucketIdx.
+     */
+    static uint64 GetBucketUpperValue(const uint32 bucketIdx);
+
+private:
+
+    /**
+     * The counts of each bucket.
+     */
+    uint64 counts[EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS];
+
+    /**
+     * Number of samples.
+     */
+    uint64 numberOfSamples;
+
+    /**
+     * Number of samples above the overrunThreshold.
+     */
+    uint64 numberOfOverruns;
+
+    /**
+     * The overrun threshold.
+     */
+    uint64 overrunThreshold;
+
+    /**
+     * The smallest sample.
+     */
+    uint64 minimum;
+
+    /**
+     * The largest sample.
+     */
+    uint64 maximum;
+
+    /**
+     * The sum of all the samples.
+     */
+    float64 sum;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint32 ExecutionTimeHistogram::GetBucketIndex(const uint64 ticks) {
+    uint32 idx;
+    if (ticks < static_cast<uint64>(EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS)) {
+        idx = static_cast<uint32>(ticks);
+    }
+    else {
+        //Position of the most significant bit (binary search).
+        uint64 v = ticks;
+        uint32 msb = 0u;
+        if ((v >> 32u) != 0u) {
+            v >>= 32u;
+            msb += 32u;
+        }
+        if ((v >> 16u) != 0u) {
+            v >>= 16u;
+            msb += 16u;
+        }
+        if ((v >> 8u) != 0u) {
+            v >>= 8u;
+            msb += 8u;
+        }
+        if ((v >> 4u) != 0u) {
+            v >>= 4u;
+            msb += 4u;
+        }
+        if ((v >> 2u) != 0u) {
+            v >>= 2u;
+            msb += 2u;
+        }
+        if ((v >> 1u) != 0u) {
+            msb += 1u;
+        }
+        uint32 shift = (msb - EXECUTION_TIME_HISTOGRAM_SUB_BUCKET_BITS);
+        uint32 subBucket = static_cast<uint32>(ticks >> shift) & (EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS - 1u);
+        idx = ((shift + 1u) * EXECUTION_TIME_HISTOGRAM_SUB_BUCKETS) + subBucket;
+    }
+    return idx;
+}
+
+void ExecutionTimeHistogram::Add(const uint64 ticks) {
+    counts[GetBucketIndex(ticks)]++;
+    if ((numberOfSamples == 0u) || (ticks < minimum)) {
+        minimum = ticks;
+    }
+    if (ticks > maximum) {
+        maximum = ticks;
+    }
+    if ((overrunThreshold > 0u) && (ticks > overrunThreshold)) {
+        numberOfOverruns++;
+    }
+    sum += static_cast<float64>(ticks);
+    numberOfSamples++;
+}
+
+}
+
+#endif /* EXECUTIONTIMEHISTOGRAM_H_ */
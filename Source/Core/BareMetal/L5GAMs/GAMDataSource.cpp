@@ -35,6 +35,7 @@
 #include "ConfigurationDatabase.h"
 #include "GAMDataSource.h"
 #include "GAM.h"
+#include "MemoryLock.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "ReferenceT.h"
@@ -53,6 +54,7 @@ namespace MARTe {
 GAMDataSource::GAMDataSource() :
         DataSourceI() {
     signalMemory = NULL_PTR(void *);
+    signalMemorySize = 0u;
     signalOffsets = NULL_PTR(uint32 *);
     memoryHeap = NULL_PTR(HeapI *);
     allowNoProducers = false;
@@ -163,9 +165,21 @@ bool GAMDataSource::AllocateMemory() {
         }
         ret = MemoryOperationsHelper::Set(signalMemory, '\0', memorySize);
     }
+    if (ret) {
+        signalMemorySize = memorySize;
+    }
     return ret;
 }
 
+uint64 GAMDataSource::PreFaultMemory() {
+    uint64 footprint = 0u;
+    if (signalMemory != NULL_PTR(void *)) {
+        MemoryLock::Touch(signalMemory, signalMemorySize);
+        footprint = signalMemorySize;
+    }
+    return footprint;
+}
+
 const char8 *GAMDataSource::GetBrokerName(StructuredDataI &data, const SignalDirection direction) {
     const char8* brokerName = NULL_PTR(const char8 *);
 
@@ -106,6 +106,12 @@ public:
      */
     virtual bool AllocateMemory();
 
+    /**
+     * @brief Touches the memory allocated in AllocateMemory (see MemoryLock::Touch).
+     * @return the size of the allocated memory.
+     */
+    virtual uint64 PreFaultMemory();
+
     /**
      * @brief See DataSourceI::GetBrokerName()
      * @return MemoryMapInputBroker if direction is InputSignals, MemoryMapOutputBroker if the direction is OutputSignals
@@ -170,6 +176,11 @@ protected:
      */
     void *signalMemory;
 
+    /**
+     * The size of the signalMemory.
+     */
+    uint32 signalMemorySize;
+
     /**
      * The signal offsets
      */
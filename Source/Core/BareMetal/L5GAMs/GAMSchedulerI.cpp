@@ -53,12 +53,14 @@ namespace MARTe {
 
 GAMSchedulerI::GAMSchedulerI() :
         ReferenceContainer(),
-        clockPeriod(HighResolutionTimer::Period()) {
+        clockPeriod(HighResolutionTimer::Period()),
+        ticksToMicroSecondsScale(static_cast<uint64>(((HighResolutionTimer::Period() * 1e6) * 4294967296.0) + 0.5)) {
     states = NULL_PTR(ScheduledState *);
     scheduledStates[0] = NULL_PTR(ScheduledState *);
     scheduledStates[1] = NULL_PTR(ScheduledState *);
     numberOfStates = 0u;
-
+    executionTimeHistograms = false;
+    executionTimeOverrunTicks = 0u;
 }
 
 GAMSchedulerI::~GAMSchedulerI() {
@@ -73,6 +75,9 @@ GAMSchedulerI::~GAMSchedulerI() {
                         if (states[s].threads[t].executables != NULL_PTR(ExecutableI **)) {
                             delete [] states[s].threads[t].executables;
                         }
+                        if (states[s].threads[t].executionTimeHistograms != NULL_PTR(ExecutionTimeHistogram *)) {
+                            delete [] states[s].threads[t].executionTimeHistograms;
+                        }
                     }
                     delete [] states[s].threads;
                 }
@@ -92,6 +97,28 @@ bool GAMSchedulerI::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify the TimingDataSource address");
         }
     }
+    if (ret) {
+        uint32 executionTimeHistogramsU = 0u;
+        if (!data.Read("ExecutionTimeHistograms", executionTimeHistogramsU)) {
+            executionTimeHistogramsU = 0u;
+        }
+        executionTimeHistograms = (executionTimeHistogramsU == 1u);
+        float64 executionTimeOverrunSec = 0.0;
+        if (!data.Read("ExecutionTimeOverrunSec", executionTimeOverrunSec)) {
+            executionTimeOverrunSec = 0.0;
+        }
+        ret = (executionTimeOverrunSec >= 0.0);
+        if (ret) {
+            executionTimeOverrunTicks = static_cast<uint64>(executionTimeOverrunSec / clockPeriod);
+            //Do not silently disable the overrun counting if the threshold is smaller than one tick
+            if ((executionTimeOverrunTicks == 0u) && (executionTimeOverrunSec > 0.0)) {
+                executionTimeOverrunTicks = 1u;
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "ExecutionTimeOverrunSec shall be >= 0");
+        }
+    }
 
     return ret;
 }
@@ -135,6 +162,9 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                     states[i].name = stateElement->GetName();
 
                     states[i].threads = new ScheduledThread[numberOfThreads];
+                    for (uint32 j = 0u; j < numberOfThreads; j++) {
+                        states[i].threads[j].executionTimeHistograms = NULL_PTR(ExecutionTimeHistogram *);
+                    }
 
                     for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
                         ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
@@ -172,6 +202,12 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 states[i].threads[j].name = threadElement->GetName();
                                 states[i].threads[j].cpu = threadElement->GetCPU().GetProcessorMask();
                                 states[i].threads[j].stackSize = threadElement->GetStackSize();
+                                if (executionTimeHistograms) {
+                                    states[i].threads[j].executionTimeHistograms = new ExecutionTimeHistogram[numberOfExecutables];
+                                    for (uint32 e = 0u; e < numberOfExecutables; e++) {
+                                        states[i].threads[j].executionTimeHistograms[e].SetOverrunThreshold(executionTimeOverrunTicks);
+                                    }
+                                }
                             }
                             uint32 c = 0u;
                             for (uint32 k = 0u; (k < numberOfGams) && (ret); k++) {
@@ -204,8 +240,19 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 threadFullName += "_CycleTime";
                                 uint32 signalIdx;
                                 ret = timingDataSource->GetSignalIndex(signalIdx, threadFullName.Buffer());
+                                void *cycleTimeAddress = NULL_PTR(void *);
                                 if (ret) {
-                                    ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void*&>(states[i].threads[j].cycleTime));
+                                    ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, cycleTimeAddress);
+                                }
+                                if (ret) {
+                                    if (timingDataSource->IsTicksSignal(signalIdx)) {
+                                        states[i].threads[j].cycleTime = NULL_PTR(uint32 *);
+                                        states[i].threads[j].cycleTimeTicks = reinterpret_cast<uint64 *>(cycleTimeAddress);
+                                    }
+                                    else {
+                                        states[i].threads[j].cycleTime = reinterpret_cast<uint32 *>(cycleTimeAddress);
+                                        states[i].threads[j].cycleTimeTicks = NULL_PTR(uint64 *);
+                                    }
                                 }
                             }
                         }
@@ -261,7 +308,7 @@ bool GAMSchedulerI::InsertInputBrokers(ReferenceT<GAM> gam,
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx] = input.operator->();
             //lint -e{613} states != NULL checked before entering here.
-            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            SetExecutableTimingSignal(states[stateIdx].threads[threadIdx].executables[executableIdx], signalIdx, signalAddress);
         }
         executableIdx++;
     }
@@ -298,7 +345,7 @@ bool GAMSchedulerI::InsertGAM(ReferenceT<GAM> gam,
         //lint -e{613} states != NULL checked before entering here.
         states[stateIdx].threads[threadIdx].executables[executableIdx] = gam.operator->();
         //lint -e{613} states != NULL checked before entering here.
-        states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+        SetExecutableTimingSignal(states[stateIdx].threads[threadIdx].executables[executableIdx], signalIdx, signalAddress);
     }
     return ret;
 }
@@ -341,7 +388,7 @@ bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx] = output.operator->();
             //lint -e{613} states != NULL checked before entering here.
-            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            SetExecutableTimingSignal(states[stateIdx].threads[threadIdx].executables[executableIdx], signalIdx, signalAddress);
         }
         executableIdx++;
     }
@@ -386,21 +433,45 @@ bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
 
 bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
                                        const uint32 numberOfExecutables) const {
+    return ExecuteSingleCycle(executables, numberOfExecutables, HighResolutionTimer::Counter());
+}
+
+bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
+                                       const uint32 numberOfExecutables,
+                                       const uint64 startTicks) const {
     // warning: possible segmentation faults if the previous operations
     // lack or fail and the pointers are invalid.
 
     bool ret = true;
-    uint64 absTicks = HighResolutionTimer::Counter();
+    uint64 absTicks = startTicks;
+    ExecutionTimeHistogram *histograms = NULL_PTR(ExecutionTimeHistogram *);
+    if (executionTimeHistograms) {
+        histograms = FindExecutionTimeHistograms(executables);
+    }
+    uint64 lastTicks = HighResolutionTimer::Counter();
     for (uint32 i = 0u; (i < numberOfExecutables) && (ret); i++) {
         // save the time before
         // execute the gam
         ret = executables[i]->Execute();
-        uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
-        float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-        uint32 absTime = static_cast<uint32>(ticksToTime);  //us
+        uint64 nowTicks = HighResolutionTimer::Counter();
+        if (histograms != NULL_PTR(ExecutionTimeHistogram *)) {
+            histograms[i].Add(nowTicks - lastTicks);
+        }
+        lastTicks = nowTicks;
+        uint64 absTime = (nowTicks - absTicks);
         if (ret) {
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            uint64 *timingSignalTicks = executables[i]->GetTimingSignalTicksAddress();
+            if (timingSignalTicks != NULL_PTR(uint64 *)) {
+                *timingSignalTicks = absTime;
+            }
+            else {
+                uint32 *timingSignal = executables[i]->GetTimingSignalAddress();
+                ret = (timingSignal != NULL_PTR(uint32 *));
+                if (ret) {
+                    //lint -e{613} timingSignal != NULL checked before entering here.
+                    *timingSignal = TicksToMicroSeconds(absTime, ticksToMicroSecondsScale);
+                }
+            }
         }
         else {
             BrokerI *broker = dynamic_cast<BrokerI *>(executables[i]);
@@ -456,6 +527,90 @@ ScheduledState * const * GAMSchedulerI::GetSchedulableStates() {
 
 }
 
+void GAMSchedulerI::SetExecutableTimingSignal(ExecutableI * const executable,
+                                              const uint32 signalIdx,
+                                              void * const signalAddress) const {
+    if (timingDataSource->IsTicksSignal(signalIdx)) {
+        executable->SetTimingSignalTicksAddress(reinterpret_cast<uint64 *>(signalAddress));
+    }
+    else {
+        executable->SetTimingSignalAddress(reinterpret_cast<uint32 *>(signalAddress));
+    }
+}
+
+ExecutionTimeHistogram *GAMSchedulerI::FindExecutionTimeHistograms(ExecutableI * const * const executables) const {
+    ExecutionTimeHistogram *histograms = NULL_PTR(ExecutionTimeHistogram *);
+    if (states != NULL_PTR(ScheduledState *)) {
+        /*lint -e{923} cast from pointer to integral type required to find the ScheduledThread that holds the executables.*/
+        uintp address = reinterpret_cast<uintp>(executables);
+        for (uint32 s = 0u; (s < numberOfStates) && (histograms == NULL_PTR(ExecutionTimeHistogram *)); s++) {
+            for (uint32 t = 0u; (t < states[s].numberOfThreads) && (histograms == NULL_PTR(ExecutionTimeHistogram *)); t++) {
+                const ScheduledThread &thread = states[s].threads[t];
+                if (thread.executionTimeHistograms != NULL_PTR(ExecutionTimeHistogram *)) {
+                    /*lint -e{923} cast from pointer to integral type required to find the ScheduledThread that holds the executables.*/
+                    uintp first = reinterpret_cast<uintp>(thread.executables);
+                    uintp end = first + (static_cast<uintp>(thread.numberOfExecutables) * static_cast<uintp>(sizeof(ExecutableI *)));
+                    if ((address >= first) && (address < end)) {
+                        histograms = &thread.executionTimeHistograms[static_cast<uint32>((address - first) / static_cast<uintp>(sizeof(ExecutableI *)))];
+                    }
+                }
+            }
+        }
+    }
+    return histograms;
+}
+
+uint64 GAMSchedulerI::GetTicksToMicroSecondsScale() const {
+    return ticksToMicroSecondsScale;
+}
+
+bool GAMSchedulerI::ExportData(StructuredDataI & data) {
+    bool ok = ReferenceContainer::ExportData(data);
+    if ((ok) && (executionTimeHistograms) && (states != NULL_PTR(ScheduledState *))) {
+        ok = data.CreateRelative("ExecutionTimes");
+        for (uint32 s = 0u; (s < numberOfStates) && (ok); s++) {
+            ok = data.CreateRelative(states[s].name);
+            for (uint32 t = 0u; (t < states[s].numberOfThreads) && (ok); t++) {
+                ScheduledThread &thread = states[s].threads[t];
+                ok = data.CreateRelative(thread.name);
+                for (uint32 e = 0u; (e < thread.numberOfExecutables) && (ok); e++) {
+                    if (thread.executionTimeHistograms != NULL_PTR(ExecutionTimeHistogram *)) {
+                        StreamString nodeName;
+                        ok = nodeName.Printf("Executable%u", e);
+                        if (ok) {
+                            ok = data.CreateRelative(nodeName.Buffer());
+                        }
+                        if (ok) {
+                            Object *obj = dynamic_cast<Object *>(thread.executables[e]);
+                            if (obj != NULL_PTR(Object *)) {
+                                if (obj->GetName() != NULL_PTR(const char8 *)) {
+                                    ok = data.Write("Name", obj->GetName());
+                                }
+                            }
+                        }
+                        if (ok) {
+                            ok = thread.executionTimeHistograms[e].ExportData(data, clockPeriod);
+                        }
+                        if (ok) {
+                            ok = data.MoveToAncestor(1u);
+                        }
+                    }
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            if (ok) {
+                ok = data.MoveToAncestor(1u);
+            }
+        }
+        if (ok) {
+            ok = data.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
 void GAMSchedulerI::Purge(ReferenceContainer &purgeList) {
     if (timingDataSource.IsValid()) {
         timingDataSource->Purge(purgeList);
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ExecutableI.h"
+#include "ExecutionTimeHistogram.h"
 #include "GAM.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
@@ -60,10 +61,20 @@ struct ScheduledThread {
     uint32 numberOfExecutables;
 
     /**
-     * Memory address where the total cycle time signal is stored.
+     * Memory address where the total cycle time signal is stored (micro-seconds).
      */
     uint32 *cycleTime;
 
+    /**
+     * Memory address where the total cycle time signal is stored (HighResolutionTimer ticks). If not NULL it is used instead of cycleTime.
+     */
+    uint64 *cycleTimeTicks;
+
+    /**
+     * The execution time histogram of each ExecutableI of this thread in this state (NULL if the ExecutionTimeHistograms are not enabled).
+     */
+    ExecutionTimeHistogram *executionTimeHistograms;
+
     /**
      * The cpus where is possible to run the thread
      */
@@ -112,9 +123,16 @@ struct ScheduledState {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    ExecutionTimeHistograms = 0 //Optional. If 1 the execution time of each ExecutableI is accumulated in an ExecutionTimeHistogram.
+ *    ExecutionTimeOverrunSec = 0.001 //Optional. Execution times larger than this value are counted as overruns (default 0 = no overrun counting).
  * }\n
  *
  * and it has to be contained in the [RealTimeApplication] declaration.
+ *
+ * @details When the ExecutionTimeHistograms are enabled the distribution (min, max, mean, percentiles and overruns)
+ * of the execution time of every ExecutableI is exported by ExportData (e.g. to the HttpObjectBrowser) in the node
+ * ExecutionTimes.STATE_NAME.THREAD_NAME.ExecutableN, with N the order of the ExecutableI in the thread. Each state
+ * has its own histograms, so that an ExecutableI shared by several states has a distinct distribution in each of them.
  */
 class DLL_API GAMSchedulerI: public ReferenceContainer, public StatefulI {
 
@@ -155,11 +173,26 @@ public:
 
     /**
      * @brief Executes a list of ExecutableIs storing their execution times with respect the start time instant.
+     * @details If the ExecutionTimeHistograms are enabled, the ticks elapsed since the end of the previous ExecutableI
+     * are also added to the histogram of the ExecutableI in the ScheduledThread that holds \a executables.
+     * @details If the ExecutableI timing signal is in ticks (see ExecutableI::SetTimingSignalTicksAddress) the raw ticks are stored,
+     * otherwise the ticks are converted to micro-seconds with TicksToMicroSeconds.
      * @param[in] executables the list of ExecutablesIs to be executed
      * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
      */
     bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables) const;
 
+    /**
+     * @brief Executes a list of ExecutableIs storing their execution times with respect to \a startTicks.
+     * @details Allows to execute a subset of the ExecutableIs of a thread (e.g. from another core) while still
+     * referencing the timing signals to the start of the thread cycle.
+     * @param[in] executables the list of ExecutablesIs to be executed
+     * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
+     * @param[in] startTicks the HighResolutionTimer::Counter value against which the execution times are computed.
+     * @return true if all the ExecutableIs were successfully executed.
+     */
+    bool ExecuteSingleCycle(ExecutableI * const * const executables, const uint32 numberOfExecutables, const uint64 startTicks) const;
+
     /**
      * @brief Gets the number of ExecutableI components for this \a threadName in this \a stateName.
      * @param[in] stateName the name of the state.
@@ -185,6 +218,30 @@ public:
      */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief See ReferenceContainer::ExportData
+     * @details Exports as ReferenceContainer::ExportData together with the ExecutionTimeHistogram statistics (if enabled).
+     * @param[in] data see ReferenceContainer::ExportData.
+     * @return see ReferenceContainer::ExportData
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
+    /**
+     * @brief Gets the fixed-point scale that converts HighResolutionTimer ticks into micro-seconds.
+     * @return the number of micro-seconds per tick multiplied by 2^32.
+     */
+    uint64 GetTicksToMicroSecondsScale() const;
+
+    /**
+     * @brief Converts HighResolutionTimer ticks into micro-seconds without floating-point operations.
+     * @details Allows the consumers of the time signals which hold ticks to get micro-seconds using the scale
+     * precomputed by GetTicksToMicroSecondsScale.
+     * @param[in] ticks the number of ticks to convert.
+     * @param[in] scale the number of micro-seconds per tick multiplied by 2^32.
+     * @return the number of micro-seconds (truncated).
+     */
+    static inline uint32 TicksToMicroSeconds(const uint64 ticks, const uint64 scale);
+
 protected:
     /**
      * @brief Gets a pointer to the address of the two possible ScheduledStates (the current and the next).
@@ -204,6 +261,11 @@ protected:
      */
     const float64 clockPeriod;
 
+    /**
+     * Number of micro-seconds per tick multiplied by 2^32.
+     */
+    const uint64 ticksToMicroSecondsScale;
+
     /**
      * The real-time application linked to this scheduler
      */
@@ -236,6 +298,16 @@ private:
      */
     uint32 numberOfStates;
 
+    /**
+     * True if the execution time of each ExecutableI is to be accumulated in an ExecutionTimeHistogram.
+     */
+    bool executionTimeHistograms;
+
+    /**
+     * Execution times (in ticks) above this value are counted as overruns.
+     */
+    uint64 executionTimeOverrunTicks;
+
     /**
      * @brief Helper function to add the input brokers of the \a gam to the table of states to be executed.
      * @param[in] gamFullName the GAM fully qualified name.
@@ -266,6 +338,21 @@ private:
      */
     bool InsertGAM(ReferenceT<GAM> gam, const char8 * const gamFullName, const uint32 stateIdx, const uint32 threadIdx, const uint32 executableIdx) const;
 
+    /**
+     * @brief Sets the timing signal of an \a executable, in ticks if the signal is declared as uint64 or in micro-seconds otherwise.
+     * @param[in] executable the ExecutableI to be updated.
+     * @param[in] signalIdx the index of the timing signal in the TimingDataSource.
+     * @param[in] signalAddress the memory address of the timing signal.
+     */
+    void SetExecutableTimingSignal(ExecutableI * const executable, const uint32 signalIdx, void * const signalAddress) const;
+
+    /**
+     * @brief Finds the execution time histograms of a list of ExecutableIs.
+     * @param[in] executables a pointer to the ScheduledThread::executables of a state (or to one of its elements).
+     * @return the histograms of \a executables (same indexing) or NULL if \a executables does not belong to any ScheduledThread.
+     */
+    ExecutionTimeHistogram *FindExecutionTimeHistograms(ExecutableI * const * const executables) const;
+
 };
 
 }
@@ -274,5 +361,21 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+uint32 GAMSchedulerI::TicksToMicroSeconds(const uint64 ticks,
+                                          const uint64 scale) {
+    //(ticks * scale) >> 32 computed with 32x32 bit partial products, so that it does not overflow for large values of the ticks.
+    const uint64 lowMask = 0xFFFFFFFFu;
+    uint64 ticksHigh = (ticks >> 32u);
+    uint64 ticksLow = (ticks & lowMask);
+    uint64 scaleHigh = (scale >> 32u);
+    uint64 scaleLow = (scale & lowMask);
+    uint64 microSeconds = ((ticksHigh * scale) + (ticksLow * scaleHigh)) + ((ticksLow * scaleLow) >> 32u);
+    return static_cast<uint32>(microSeconds);
+}
+
+}
+
 #endif /* GAMSCHEDULERI_H_ */
 
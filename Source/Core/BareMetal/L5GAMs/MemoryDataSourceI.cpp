@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "MemoryDataSourceI.h"
+#include "MemoryLock.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -122,6 +123,15 @@ bool MemoryDataSourceI::AllocateMemory() {
 
 }
 
+uint64 MemoryDataSourceI::PreFaultMemory() {
+    uint64 footprint = 0u;
+    if (memory != NULL_PTR(uint8 *)) {
+        MemoryLock::Touch(memory, totalMemorySize);
+        footprint = totalMemorySize;
+    }
+    return footprint;
+}
+
 uint32 MemoryDataSourceI::GetNumberOfMemoryBuffers() {
     return numberOfBuffers;
 }
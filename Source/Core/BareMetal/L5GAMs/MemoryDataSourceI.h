@@ -76,6 +76,12 @@ public:
      */
     virtual bool AllocateMemory();
 
+    /**
+     * @brief Touches the memory allocated in AllocateMemory (see MemoryLock::Touch).
+     * @return the total memory size.
+     */
+    virtual uint64 PreFaultMemory();
+
     /**
      * @brief Gets the number of memory buffers defined in the Initialise method.
      * @return the number of memory buffers defined in the Initialise method.
@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "MemoryLock.h"
 #include "MemoryMapBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -46,6 +47,9 @@ namespace MARTe {
 MemoryMapBroker::MemoryMapBroker() :
         BrokerI() {
     copyTable = NULL_PTR(MemoryMapBrokerCopyTableEntry *);
+    copyRuns = NULL_PTR(MemoryMapBrokerCopyRunEntry *);
+    copyRunsStartIndex = NULL_PTR(uint32 *);
+    numberOfCopyRunsBuffers = 0u;
     dataSource = NULL_PTR(DataSourceI*);
     numberOfCopies = 0u;
 }
@@ -54,6 +58,12 @@ MemoryMapBroker::~MemoryMapBroker() {
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
         delete[] copyTable;
     }
+    if (copyRuns != NULL_PTR(MemoryMapBrokerCopyRunEntry *)) {
+        delete[] copyRuns;
+    }
+    if (copyRunsStartIndex != NULL_PTR(uint32 *)) {
+        delete[] copyRunsStartIndex;
+    }
     /*lint -e{1740} dataSource contains a copy of a pointer. No need to be freed.*/
 }
 
@@ -158,4 +168,112 @@ bool MemoryMapBroker::Init(const SignalDirection direction, DataSourceI &dataSou
     return ret;
 }
 
+uint32 MemoryMapBroker::GetNumberOfCopyRuns(const uint32 bufferIdx) const {
+    uint32 numberOfRuns = 0u;
+    if (bufferIdx < numberOfCopyRunsBuffers) {
+        /*lint -e{613} copyRunsStartIndex cannot be NULL if numberOfCopyRunsBuffers > 0*/
+        numberOfRuns = (copyRunsStartIndex[bufferIdx + 1u] - copyRunsStartIndex[bufferIdx]);
+    }
+    return numberOfRuns;
+}
+
+uint64 MemoryMapBroker::PreFaultMemory() {
+    uint64 footprint = BrokerI::PreFaultMemory();
+    if ((copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) && (dataSource != NULL_PTR(DataSourceI *))) {
+        uint32 size = static_cast<uint32>(sizeof(MemoryMapBrokerCopyTableEntry)) * numberOfCopies * dataSource->GetNumberOfStatefulMemoryBuffers();
+        MemoryLock::Touch(reinterpret_cast<void *>(copyTable), size);
+        footprint += size;
+    }
+    if (copyRunsStartIndex != NULL_PTR(uint32 *)) {
+        uint32 size = static_cast<uint32>(sizeof(uint32)) * (numberOfCopyRunsBuffers + 1u);
+        MemoryLock::Touch(reinterpret_cast<void *>(copyRunsStartIndex), size);
+        footprint += size;
+        if (copyRuns != NULL_PTR(MemoryMapBrokerCopyRunEntry *)) {
+            size = static_cast<uint32>(sizeof(MemoryMapBrokerCopyRunEntry)) * copyRunsStartIndex[numberOfCopyRunsBuffers];
+            MemoryLock::Touch(reinterpret_cast<void *>(copyRuns), size);
+            footprint += size;
+        }
+    }
+    return footprint;
+}
+
+bool MemoryMapBroker::CompileCopyTable(const uint32 numberOfBuffers) {
+    uint32 totalNumberOfElements = (numberOfCopies * numberOfBuffers);
+    bool ret = (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *));
+    //Discard the runs of a previous compilation of the copyTable.
+    if (copyRuns != NULL_PTR(MemoryMapBrokerCopyRunEntry *)) {
+        delete[] copyRuns;
+        copyRuns = NULL_PTR(MemoryMapBrokerCopyRunEntry *);
+    }
+    if (copyRunsStartIndex != NULL_PTR(uint32 *)) {
+        delete[] copyRunsStartIndex;
+        copyRunsStartIndex = NULL_PTR(uint32 *);
+    }
+    numberOfCopyRunsBuffers = 0u;
+    if (ret) {
+        //Worst case: no entry can be coalesced.
+        copyRuns = new MemoryMapBrokerCopyRunEntry[totalNumberOfElements];
+        copyRunsStartIndex = new uint32[numberOfBuffers + 1u];
+    }
+    uint32 r = 0u;
+    for (uint32 b = 0u; (b < numberOfBuffers) && (ret); b++) {
+        /*lint -e{613} copyRunsStartIndex cannot be NULL as otherwise ret would be false*/
+        copyRunsStartIndex[b] = r;
+        uint32 runStart = r;
+        for (uint32 n = 0u; n < numberOfCopies; n++) {
+            //The GAM pointers are the same for all the buffers (see MemoryMapInputBroker::Execute).
+            /*lint -e{613} copyTable cannot be NULL as otherwise ret would be false*/
+            void *gamPointer = copyTable[n].gamPointer;
+            void *dataSourcePointer = copyTable[(b * numberOfCopies) + n].dataSourcePointer;
+            uint32 copySize = copyTable[n].copySize;
+            bool merge = (r > runStart);
+            if (merge) {
+                /*lint -e{613} copyRuns cannot be NULL as otherwise ret would be false*/
+                MemoryMapBrokerCopyRunEntry &lastRun = copyRuns[r - 1u];
+                merge = ((gamPointer != NULL_PTR(void *)) && (dataSourcePointer != NULL_PTR(void *)));
+                if (merge) {
+                    merge = (&(reinterpret_cast<char8 *>(lastRun.gamPointer)[lastRun.copySize]) == gamPointer);
+                }
+                if (merge) {
+                    merge = (&(reinterpret_cast<char8 *>(lastRun.dataSourcePointer)[lastRun.copySize]) == dataSourcePointer);
+                }
+                if (merge) {
+                    lastRun.copySize += copySize;
+                }
+            }
+            if (!merge) {
+                /*lint -e{613} copyRuns cannot be NULL as otherwise ret would be false*/
+                copyRuns[r].gamPointer = gamPointer;
+                copyRuns[r].dataSourcePointer = dataSourcePointer;
+                copyRuns[r].copySize = copySize;
+                r++;
+            }
+        }
+        //Select the copy kernel of each run.
+        for (uint32 k = runStart; k < r; k++) {
+            /*lint -e{613} copyRuns cannot be NULL as otherwise ret would be false*/
+            MemoryMapBrokerCopyRunEntry &run = copyRuns[k];
+            run.kernelSize = 0u;
+            bool scalar = ((run.copySize == 1u) || (run.copySize == 2u) || (run.copySize == 4u) || (run.copySize == 8u));
+            if (scalar) {
+                scalar = ((run.gamPointer != NULL_PTR(void *)) && (run.dataSourcePointer != NULL_PTR(void *)));
+            }
+            if (scalar) {
+                /*lint -e{923} cast from pointer to integral type required to check the alignment.*/
+                uintp misalignment = ((reinterpret_cast<uintp>(run.gamPointer) | reinterpret_cast<uintp>(run.dataSourcePointer)) % run.copySize);
+                scalar = (misalignment == 0u);
+            }
+            if (scalar) {
+                run.kernelSize = run.copySize;
+            }
+        }
+    }
+    if (ret) {
+        numberOfCopyRunsBuffers = numberOfBuffers;
+        /*lint -e{613} copyRunsStartIndex cannot be NULL as otherwise ret would be false*/
+        copyRunsStartIndex[numberOfBuffers] = r;
+    }
+    return ret;
+}
+
 }
@@ -64,12 +64,41 @@ struct MemoryMapBrokerCopyTableEntry {
     TypeDescriptor type;
 };
 
+/**
+ * @brief Helper structure which holds a coalesced copy operation, i.e. a run of
+ * MemoryMapBrokerCopyTableEntry elements which are contiguous both in the GAM and in the DataSource memory.
+ */
+struct MemoryMapBrokerCopyRunEntry {
+    /**
+     * The pointer to the GAM.
+     */
+    void *gamPointer;
+    /**
+     * The pointer to the datasource
+     */
+    void *dataSourcePointer;
+    /**
+     * The size of the copy
+     */
+    uint32 copySize;
+    /**
+     * The size (in bytes) of the scalar kernel to be used in the copy, or 0 if the generic copy is to be used.
+     */
+    uint32 kernelSize;
+};
+
 /**
  * @brief Memory mapped BrokerI implementation.
  * @details This class knows how to copy from/to a DataSourceI memory address to/from a GAM signal memory address.
  * For each GAM signal, the signal name is searched in the provided DataSourceI (see Init) and the memory
  * memory address of the signal retrieved using the GetSignalMemoryBuffer function. The information of each element to
  *  be copied is stored in a MemoryMapBrokerCopyTableEntry.
+ *
+ * Subclasses which copy using the final copy table can call CompileCopyTable to coalesce the entries that are contiguous
+ *  both in the GAM and in the DataSource memory into MemoryMapBrokerCopyRunEntry elements (one set of runs for each
+ *  stateful memory buffer). Runs
+ *  which have the size of an aligned 8, 16, 32 or 64 bit scalar are copied with a direct assignment, while all the other
+ *  runs are copied with MemoryOperationsHelper::Copy.
  */
 class DLL_API MemoryMapBroker: public BrokerI {
 
@@ -106,13 +135,63 @@ public:
                       const char8 * const functionName,
                       void * const gamMemoryAddress);
 
+    /**
+     * @brief Gets the number of coalesced copy operations that are performed for the stateful buffer \a bufferIdx.
+     * @param[in] bufferIdx the index of the stateful buffer (see DataSourceI::GetNumberOfStatefulMemoryBuffers).
+     * @return the number of coalesced copy operations or 0 if \a bufferIdx is not valid or the copyTable was not compiled.
+     * @pre
+     *   Init()
+     */
+    uint32 GetNumberOfCopyRuns(const uint32 bufferIdx) const;
+
+    /**
+     * @brief Touches the BrokerI tables, the copyTable and the copyRuns.
+     * @return the number of bytes that were touched.
+     */
+    virtual uint64 PreFaultMemory();
+
 protected:
 
+    /**
+     * @brief Coalesces the copyTable entries into the copyRuns.
+     * @details For each stateful buffer, consecutive entries of the copyTable where both the gamPointer and the
+     * dataSourcePointer directly follow the previous entry are merged into a single MemoryMapBrokerCopyRunEntry.
+     * The runs are not updated by later changes of the copyTable: a subclass which changes the copyTable after
+     * compiling it shall call this method again (the previous runs are discarded).
+     * @param[in] numberOfBuffers the number of stateful buffers held by the copyTable.
+     * @return true if the copyRuns could be successfully allocated.
+     */
+    bool CompileCopyTable(const uint32 numberOfBuffers);
+
+    /**
+     * @brief Executes the coalesced copies of the stateful buffer \a bufferIdx.
+     * @param[in] bufferIdx the index of the stateful buffer.
+     * @param[in] toGAM if true the copy is from the DataSource to the GAM memory, otherwise from the GAM to the DataSource memory.
+     * @return true if all the copies are successfully performed.
+     */
+    inline bool ExecuteCopyRuns(const uint32 bufferIdx,
+                                const bool toGAM) const;
+
     /**
      * A table with all the elements to be copied
      */
     MemoryMapBrokerCopyTableEntry *copyTable;
 
+    /**
+     * The coalesced copies for all the stateful buffers (copyRuns[copyRunsStartIndex[numberOfCopyRunsBuffers]]).
+     */
+    MemoryMapBrokerCopyRunEntry *copyRuns;
+
+    /**
+     * The index of the first element in copyRuns of each stateful buffer (copyRunsStartIndex[numberOfCopyRunsBuffers + 1]).
+     */
+    uint32 *copyRunsStartIndex;
+
+    /**
+     * The number of stateful buffers that were compiled into the copyRuns.
+     */
+    uint32 numberOfCopyRunsBuffers;
+
     /**
      * The DataSourceI instance
      */
@@ -126,5 +205,44 @@ protected:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+bool MemoryMapBroker::ExecuteCopyRuns(const uint32 bufferIdx,
+                                      const bool toGAM) const {
+    bool ret = (bufferIdx < numberOfCopyRunsBuffers);
+    if (ret) {
+        /*lint -e{613} copyRunsStartIndex cannot be NULL if numberOfCopyRunsBuffers > 0*/
+        uint32 n = copyRunsStartIndex[bufferIdx];
+        /*lint -e{613} copyRunsStartIndex cannot be NULL if numberOfCopyRunsBuffers > 0*/
+        uint32 nEnd = copyRunsStartIndex[bufferIdx + 1u];
+        for (; (n < nEnd) && (ret); n++) {
+            /*lint -e{613} copyRuns cannot be NULL if numberOfCopyRunsBuffers > 0*/
+            const MemoryMapBrokerCopyRunEntry &run = copyRuns[n];
+            void *destination = toGAM ? run.gamPointer : run.dataSourcePointer;
+            const void *source = toGAM ? run.dataSourcePointer : run.gamPointer;
+            //The kernel sizes are only assigned by CompileCopyTable to aligned non-NULL pointers.
+            /*lint -e{927} -e{826} cast from pointer to pointer required to perform the scalar copy.*/
+            if (run.kernelSize == 4u) {
+                *static_cast<uint32 *>(destination) = *static_cast<const uint32 *>(source);
+            }
+            else if (run.kernelSize == 8u) {
+                *static_cast<uint64 *>(destination) = *static_cast<const uint64 *>(source);
+            }
+            else if (run.kernelSize == 2u) {
+                *static_cast<uint16 *>(destination) = *static_cast<const uint16 *>(source);
+            }
+            else if (run.kernelSize == 1u) {
+                *static_cast<uint8 *>(destination) = *static_cast<const uint8 *>(source);
+            }
+            else {
+                ret = MemoryOperationsHelper::Copy(destination, source, run.copySize);
+            }
+        }
+    }
+    return ret;
+}
+
+}
+
 #endif /* MEMORYMAPBROKER_H_ */
 
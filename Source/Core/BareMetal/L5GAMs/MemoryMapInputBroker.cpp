@@ -49,16 +49,23 @@ MemoryMapInputBroker::~MemoryMapInputBroker() {
 
 }
 
+bool MemoryMapInputBroker::Init(const SignalDirection direction,
+                                DataSourceI &dataSourceIn,
+                                const char8 * const functionName,
+                                void * const gamMemoryAddress) {
+    bool ret = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    if (ret) {
+        ret = CompileCopyTable(dataSourceIn.GetNumberOfStatefulMemoryBuffers());
+    }
+    return ret;
+}
+
 bool MemoryMapInputBroker::Execute() {
-    uint32 n;
     /*lint -e{613} null pointer checked before.*/
     uint32 i = dataSource->GetCurrentStateBuffer();
     bool ret = true;
-    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 dataSourceIndex = ((i * numberOfCopies) + n);
-            ret = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize);
-        }
+    if (copyRuns != NULL_PTR(MemoryMapBrokerCopyRunEntry *)) {
+        ret = ExecuteCopyRuns(i, true);
     }
     return ret;
 }
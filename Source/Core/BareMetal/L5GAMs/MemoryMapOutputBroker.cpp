@@ -49,13 +49,21 @@ MemoryMapOutputBroker::~MemoryMapOutputBroker() {
 
 }
 
+bool MemoryMapOutputBroker::Init(const SignalDirection direction,
+                                 DataSourceI &dataSourceIn,
+                                 const char8 * const functionName,
+                                 void * const gamMemoryAddress) {
+    bool ret = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress);
+    if (ret) {
+        ret = CompileCopyTable(dataSourceIn.GetNumberOfStatefulMemoryBuffers());
+    }
+    return ret;
+}
+
 bool MemoryMapOutputBroker::Execute() {
-    uint32 n;
     bool ret = true;
-    for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-            ret = MemoryOperationsHelper::Copy(copyTable[n].dataSourcePointer, copyTable[n].gamPointer, copyTable[n].copySize);
-        }
+    if (copyRuns != NULL_PTR(MemoryMapBrokerCopyRunEntry *)) {
+        ret = ExecuteCopyRuns(0u, false);
     }
     return ret;
 }
@@ -57,9 +57,19 @@ public:
      */
     virtual ~MemoryMapOutputBroker();
 
+    /**
+     * @brief See MemoryMapBroker::Init. Compiles the copyTable into the coalesced copy runs.
+     * @return true if MemoryMapBroker::Init and MemoryMapBroker::CompileCopyTable succeed.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress);
+
     /**
      * @brief Sequentially copies all the signals from the GAM memory to the DataSourceI memory.
      * @details This implementation supports multi-state buffers and will query the DataSource for the GetCurrentStateBuffer.
+     * The copies are performed using the coalesced copy runs compiled by Init.
      * @return true if all copies are successfully performed.
      */
     virtual bool Execute();
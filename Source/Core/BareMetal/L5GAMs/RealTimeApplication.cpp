@@ -32,9 +32,11 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "BrokerI.h"
 #include "GAM.h"
 #include "GAMSchedulerI.h"
 #include "Matrix.h"
+#include "MemoryLock.h"
 #include "RealTimeApplication.h"
 #include "RealTimeApplicationConfigurationBuilder.h"
 #include "RealTimeState.h"
@@ -62,6 +64,9 @@ RealTimeApplication::RealTimeApplication() :
     }
     defaultDataSourceName = "";
     index=1u;
+    lockMemory = false;
+    memoryLocked = false;
+    memoryFootprint = 0u;
 
 }
 
@@ -71,12 +76,22 @@ RealTimeApplication::~RealTimeApplication() {
     if (!ret.ErrorsCleared()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the RealTimeApplication. Was it ever started?");
     }
+    if (memoryLocked) {
+        if (!MemoryLock::UnlockAll()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not unlock the process memory");
+        }
+    }
 
 }
 bool RealTimeApplication::Initialise(StructuredDataI & data) {
     index = 1u;
 
     bool ret = ReferenceContainer::Initialise(data);
+    uint32 lockMemoryValue = 0u;
+    if (!data.Read("LockMemory", lockMemoryValue)) {
+        lockMemoryValue = 0u;
+    }
+    lockMemory = (lockMemoryValue == 1u);
     if (data.MoveRelative("+Data")) {
         if (!data.Read("DefaultDataSource", defaultDataSourceName)) {
             defaultDataSourceName = "";
@@ -184,6 +199,13 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
                     REPORT_ERROR(ErrorManagement::InitialisationError, "No Scheduler block in RealTimeApplication %s", GetName());
                 }
             }
+            if (ret) {
+                //The configuration builder and the schedulers access the functions and the data sources by index.
+                ret = functionsContainer->SetArrayStorage(true);
+                if (ret) {
+                    ret = dataSourceContainer->SetArrayStorage(true);
+                }
+            }
         }
     }
     return ret;
@@ -256,6 +278,13 @@ bool RealTimeApplication::ConfigureApplication() {
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configure scheduler");
         }
     }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to PreFaultMemory");
+        ret = PreFaultMemory();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to PreFaultMemory");
+        }
+    }
 
     return ret;
 }
@@ -337,6 +366,13 @@ bool RealTimeApplication::ConfigureApplication(ConfigurationDatabase &functionsD
             REPORT_ERROR(ErrorManagement::ParametersError, "Failed to configure scheduler");
         }
     }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to PreFaultMemory");
+        ret = PreFaultMemory();
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to PreFaultMemory");
+        }
+    }
     return ret;
 }
 
@@ -437,6 +473,113 @@ bool RealTimeApplication::AddBrokersToFunctions() {
     return ret;
 }
 
+bool RealTimeApplication::PreFaultMemory() {
+    uint64 dataSourcesFootprint = 0u;
+    uint64 brokersFootprint = 0u;
+    uint64 stacksFootprint = 0u;
+    bool ret = dataSourcesDatabase.MoveAbsolute("Data");
+    uint32 numberOfDs = dataSourcesDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfDs) && (ret); i++) {
+        const char8* dsId = dataSourcesDatabase.GetChildName(i);
+        ret = dataSourcesDatabase.MoveRelative(dsId);
+        if (ret) {
+            StreamString fullDsName = "Data.";
+            ret = dataSourcesDatabase.Read("QualifiedName", fullDsName);
+            if (ret) {
+                ReferenceT<DataSourceI> ds = Find(fullDsName.Buffer());
+                ret = ds.IsValid();
+                if (ret) {
+                    dataSourcesFootprint += ds->PreFaultMemory();
+                }
+            }
+        }
+        if (ret) {
+            ret = dataSourcesDatabase.MoveToAncestor(1u);
+        }
+    }
+    if (ret) {
+        ret = functionsDatabase.MoveAbsolute("Functions");
+    }
+    uint32 numberOfFunctions = functionsDatabase.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+        const char8 * functionId = functionsDatabase.GetChildName(i);
+        ret = functionsDatabase.MoveRelative(functionId);
+        if (ret) {
+            StreamString fullGAMName = "Functions.";
+            ret = functionsDatabase.Read("QualifiedName", fullGAMName);
+            ReferenceT<GAM> gam;
+            if (ret) {
+                gam = Find(fullGAMName.Buffer());
+                ret = gam.IsValid();
+            }
+            ReferenceContainer brokers;
+            if (ret) {
+                ret = gam->GetInputBrokers(brokers);
+            }
+            if (ret) {
+                ret = gam->GetOutputBrokers(brokers);
+            }
+            uint32 numberOfBrokers = brokers.Size();
+            for (uint32 b = 0u; (b < numberOfBrokers) && (ret); b++) {
+                ReferenceT<BrokerI> broker = brokers.Get(b);
+                ret = broker.IsValid();
+                if (ret) {
+                    brokersFootprint += broker->PreFaultMemory();
+                }
+            }
+        }
+        if (ret) {
+            ret = functionsDatabase.MoveToAncestor(1u);
+        }
+    }
+    //The thread stacks are only created when the state is executed. They can only be accounted for here and are mapped when the memory is locked (see MemoryLock::LockAll).
+    if (ret) {
+        ret = statesContainer.IsValid();
+    }
+    if (ret) {
+        uint32 numberOfStates = statesContainer->Size();
+        for (uint32 i = 0u; (i < numberOfStates) && (ret); i++) {
+            ReferenceT<RealTimeState> state = statesContainer->Get(i);
+            ret = state.IsValid();
+            ReferenceT<ReferenceContainer> threadContainer;
+            if (ret) {
+                threadContainer = state->Find("Threads");
+                ret = threadContainer.IsValid();
+            }
+            if (ret) {
+                uint32 numberOfThreads = threadContainer->Size();
+                for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
+                    ReferenceT<RealTimeThread> thread = threadContainer->Get(j);
+                    ret = thread.IsValid();
+                    if (ret) {
+                        stacksFootprint += thread->GetStackSize();
+                    }
+                }
+            }
+        }
+    }
+    if (ret) {
+        memoryFootprint = (dataSourcesFootprint + brokersFootprint + stacksFootprint);
+        if ((lockMemory) && (!memoryLocked)) {
+            memoryLocked = MemoryLock::LockAll();
+            if (!memoryLocked) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not lock the memory of RealTimeApplication %s (check the process privileges)", GetName());
+            }
+        }
+        REPORT_ERROR(ErrorManagement::Information, "RealTimeApplication %s memory footprint %u bytes (DataSources: %u, Brokers: %u, thread stacks: %u). Memory locked: %d", GetName(),
+                     memoryFootprint, dataSourcesFootprint, brokersFootprint, stacksFootprint, memoryLocked);
+    }
+    return ret;
+}
+
+uint64 RealTimeApplication::GetMemoryFootprint() const {
+    return memoryFootprint;
+}
+
+bool RealTimeApplication::IsMemoryLocked() const {
+    return memoryLocked;
+}
+
 ErrorManagement::ErrorType RealTimeApplication::PrepareNextState(StreamString nextStateName) {
     bool ret = nextStateName.Seek(0LLU);
     if (ret) {
@@ -100,6 +100,12 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * As the last step of ConfigureApplication, all the memory that is used by the real-time cycle (DataSourceI memory and
+ *  BrokerI copy tables, see DataSourceI::PreFaultMemory and BrokerI::PreFaultMemory) is read so that it is mapped before the
+ *  first cycle. The total footprint, including the stacks of all the RealTimeThread components, is reported (see GetMemoryFootprint).
+ *  If LockMemory = 1 all the current and future memory of the process (including the thread stacks, which are only created
+ *  when the state is executed) is also locked in physical memory (see MemoryLock::LockAll).
  */
 /*lint -e{9109} RealTimeApplication is forward declared in RealTimeApplicationConfigurationBuilder.*/
 class DLL_API RealTimeApplication: public ReferenceContainer, public MessageI {
@@ -161,7 +167,9 @@ public:
      *         Class = Scheduler_class_name (inherited from GAMSchedulerI)
      *         ...
      *     }
+     *     LockMemory = 0 | 1 //Optional. Default = 0. If 1 the process memory is locked in ConfigureApplication.
      *</pre>
+     * The +Functions and +Data containers are switched to array storage (see ReferenceContainer::SetArrayStorage).
      * @param[in] data contains the initialisation data.
      * @return true if the parameters +Functions, +States, +Data and +Scheduler
      * exist and each inherit from ReferenceContainer.
@@ -220,6 +228,18 @@ public:
      */
     uint32 GetIndex() const;
 
+    /**
+     * @brief Gets the memory footprint computed by ConfigureApplication.
+     * @return the number of bytes used by the DataSourceI memory, by the BrokerI copy tables and by the stacks of all the RealTimeThread components.
+     */
+    uint64 GetMemoryFootprint() const;
+
+    /**
+     * @brief Checks if the process memory was locked by ConfigureApplication.
+     * @return true if LockMemory = 1 and the process memory was successfully locked.
+     */
+    bool IsMemoryLocked() const;
+
     /**
      * @see ReferenceContainer::Purge()
      */
@@ -251,6 +271,14 @@ private:
      */
     bool FindStatefulDataSources();
 
+    /**
+     * @brief Calls PreFaultMemory on all the DataSourceI and BrokerI components, computes the memory footprint and, if requested, locks the process memory.
+     * @details Only called by ConfigureApplication, i.e. before the real-time execution. The memory is only read (see MemoryLock::Touch).
+     * A failure to lock the memory is reported as a warning.
+     * @return true if all the DataSourceI, GAM, BrokerI and RealTimeThread components could be retrieved.
+     */
+    bool PreFaultMemory();
+
     /**
      * The current state name.
      */
@@ -301,6 +329,21 @@ private:
      */
     StreamString defaultDataSourceName;
 
+    /**
+     * True if the process memory is to be locked.
+     */
+    bool lockMemory;
+
+    /**
+     * True if the process memory was locked by this RealTimeApplication.
+     */
+    bool memoryLocked;
+
+    /**
+     * The memory footprint computed in PreFaultMemory.
+     */
+    uint64 memoryFootprint;
+
     /**
      * Filter to receive the RPC
      */
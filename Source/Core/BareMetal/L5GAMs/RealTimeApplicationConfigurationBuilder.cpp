@@ -38,6 +38,7 @@
 #include "ReferenceContainerFilterReferencesTemplate.h"
 #include "StandardParser.h"
 #include "StaticList.h"
+#include "TimingDataSource.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -50,12 +51,14 @@ namespace MARTe {
 RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder() : Object() {
     realTimeApplication = NULL_PTR(RealTimeApplication*);
     initialiseAfterInitialisation = true;
+    timeSignalsInTicks = false;
 }
 
 RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder(RealTimeApplication & realTimeApplicationIn, const char8 * const defaultDataSourceNameIn) : Object() {
     defaultDataSourceName = defaultDataSourceNameIn;
     realTimeApplication = &realTimeApplicationIn;
     initialiseAfterInitialisation = true;
+    timeSignalsInTicks = false;
 }
 
 RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder(ConfigurationDatabase &globalDatabaseIn, const char8 * const defaultDataSourceNameIn) : Object() {
@@ -69,6 +72,7 @@ RealTimeApplicationConfigurationBuilder::RealTimeApplicationConfigurationBuilder
     }
     realTimeApplication = NULL_PTR(RealTimeApplication*);
     initialiseAfterInitialisation = true;
+    timeSignalsInTicks = false;
 }
 
 void RealTimeApplicationConfigurationBuilder::SetParameters(RealTimeApplication &realTimeApplicationIn, const char8 * const defaultDataSourceNameIn) {
@@ -391,6 +395,10 @@ bool RealTimeApplicationConfigurationBuilder::InitialiseSignalsDatabase() {
                     if (className == "TimingDataSource") {
                         isTimeStamp++;
                         timeStampDsName = dataSourceN;
+                        ReferenceT<TimingDataSource> timingDataSource = dataSource;
+                        if (timingDataSource.IsValid()) {
+                            timeSignalsInTicks = timingDataSource->IsTimeUnitTicks();
+                        }
                     }
                 }
                 if (ret) {
@@ -470,35 +478,54 @@ bool RealTimeApplicationConfigurationBuilder::FlattenSignalsDatabases() {
         for (n=0u; (n<nOfDataSources) && (ret); n++) {
             ret = dataSourcesDatabase.MoveToChild(n);
             if (ret) {
-                ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourcesDatabase.GetName());
+                ret = IndexDataSourceSignals();
             }
             if (ret) {
-                ret = dataSourcesDatabase.MoveRelative("Signals");
+                ret = dataSourcesDatabase.MoveToAncestor(1u);
             }
+        }
+    }
+
+    return ret;
+}
+
+bool RealTimeApplicationConfigurationBuilder::IndexDataSourceSignals() {
+    StreamString dataSourceId = dataSourcesDatabase.GetName();
+    bool ret = dataSourcesSignalIndexCache.MoveToRoot();
+    if (ret) {
+        //Discard the previous entries (the signals may have been flattened or deleted since).
+        if (dataSourcesSignalIndexCache.MoveRelative(dataSourceId.Buffer())) {
+            ret = dataSourcesSignalIndexCache.MoveToAncestor(1u);
             if (ret) {
-                uint32 s;
-                uint32 nSignals = dataSourcesDatabase.GetNumberOfChildren();
-                for (s=0u; (s<nSignals) && (ret); s++) {
-                    ret = dataSourcesDatabase.MoveToChild(s);
-                    StreamString qname;
-                    if (ret) {
-                        ret = dataSourcesDatabase.Read("QualifiedName", qname);
-                    }
-                    if (ret) {
-                        const uint32 ss = s;
-                        ret = dataSourcesSignalIndexCache.Write(qname.Buffer(), ss);
-                    }
-                    if (ret) {
-                        ret = dataSourcesDatabase.MoveToAncestor(1u);
-                    }
-                }
+                ret = dataSourcesSignalIndexCache.Delete(dataSourceId.Buffer());
             }
-            if (ret) {
-                ret = dataSourcesDatabase.MoveToAncestor(2u);
+        }
+    }
+    if (ret) {
+        ret = dataSourcesSignalIndexCache.CreateRelative(dataSourceId.Buffer());
+    }
+    if (ret) {
+        ConfigurationDatabase dataSourcesDatabaseBeforeMove = dataSourcesDatabase;
+        if (dataSourcesDatabase.MoveRelative("Signals")) {
+            uint32 s;
+            uint32 nSignals = dataSourcesDatabase.GetNumberOfChildren();
+            for (s = 0u; (s < nSignals) && (ret); s++) {
+                ret = dataSourcesDatabase.MoveToChild(s);
+                StreamString qname;
+                if (ret) {
+                    ret = dataSourcesDatabase.Read("QualifiedName", qname);
+                }
+                if (ret) {
+                    const uint32 ss = s;
+                    ret = dataSourcesSignalIndexCache.Write(qname.Buffer(), ss);
+                }
+                if (ret) {
+                    ret = dataSourcesDatabase.MoveToAncestor(1u);
+                }
             }
         }
+        dataSourcesDatabase = dataSourcesDatabaseBeforeMove;
     }
-
     return ret;
 }
 
@@ -1292,6 +1319,7 @@ bool RealTimeApplicationConfigurationBuilder::VerifyDataSourcesSignals() {
                 numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
             }
             uint32 s = 0u;
+            bool signalsDeleted = false;
             ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
             while ((s < numberOfSignals) && (ret)) {
                 dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
@@ -1373,6 +1401,7 @@ bool RealTimeApplicationConfigurationBuilder::VerifyDataSourcesSignals() {
                                 numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
                                 s--;
                                 validSignalFound = true;
+                                signalsDeleted = true;
                             }
                         }
                     }
@@ -1435,6 +1464,14 @@ bool RealTimeApplicationConfigurationBuilder::VerifyDataSourcesSignals() {
                 }
                 s++;
             }
+            //The deleted signals shifted the indexes of the ones that follow.
+            if ((signalsDeleted) && (ret)) {
+                dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
+                ret = dataSourcesDatabase.MoveToAncestor(1u);
+                if (ret) {
+                    ret = IndexDataSourceSignals();
+                }
+            }
         }
     }
     return ret;
@@ -1806,32 +1843,25 @@ bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 * c
             uint32 isTimingDataSource;
             if (dataSourcesDatabase.Read("IsTimingDataSource", isTimingDataSource)) {
                 if (isTimingDataSource == 1u) {
-                    ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourcesDatabase.GetName());
+                    StreamString dataSourceId = dataSourcesDatabase.GetName();
+                    ret = dataSourcesDatabase.MoveRelative("Signals");
+                    bool found = false;
+                    uint32 signalIdx = 0u;
                     if (ret) {
-                        ret = dataSourcesDatabase.MoveRelative("Signals");
+                        found = FindDataSourceSignal(dataSourceId.Buffer(), signalName.Buffer(), signalIdx);
                     }
-                    if (ret) {
-                        uint32 numberOfTimeSignals = dataSourcesDatabase.GetNumberOfChildren();
-                        bool found = false;
-                        uint32 j;
+                    if (ret && found) {
                         ConfigurationDatabase dataSourcesDatabaseBeforeTimeSignals = dataSourcesDatabase;
-                        for (j = 0u; (j < numberOfTimeSignals) && (ret) && (!found); j++) {
-                            ret = dataSourcesDatabase.MoveToChild(j);
-                            StreamString qualifiedName;
-                            if (ret) {
-                                ret = dataSourcesDatabase.Read("QualifiedName", qualifiedName);
-                            }
-                            if (ret) {
-                                found = (qualifiedName == signalName);
-                                if (found) {
-                                    ret = CheckTimeSignalInfo();
-                                }
-                            }
-                            if (ret) {
-                                dataSourcesDatabase = dataSourcesDatabaseBeforeTimeSignals;
-                            }
+                        ret = dataSourcesDatabase.MoveToChild(signalIdx);
+                        if (ret) {
+                            ret = CheckTimeSignalInfo();
+                        }
+                        if (ret) {
+                            dataSourcesDatabase = dataSourcesDatabaseBeforeTimeSignals;
                         }
-                        if (ret && (!found)) {
+                    }
+                    if (ret) {
+                        if (!found) {
                             uint32 numberOfSignals = dataSourcesDatabase.GetNumberOfChildren();
                             StreamString newSignalId;
                             ret = newSignalId.Printf("%d", numberOfSignals);
@@ -1839,7 +1869,10 @@ bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 * c
                                 ret = dataSourcesDatabase.CreateRelative(newSignalId.Buffer());
                             }
                             if (ret) {
-                                ret = dataSourcesSignalIndexCache.Write(signalName.Buffer(), newSignalId.Buffer());
+                                ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourceId.Buffer());
+                            }
+                            if (ret) {
+                                ret = dataSourcesSignalIndexCache.Write(signalName.Buffer(), numberOfSignals);
                             }
                             if (ret) {
                                 ret = WriteTimeSignalInfo(signalName.Buffer());
@@ -1853,10 +1886,19 @@ bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 * c
     return ret;
 }
 
+const char8 *RealTimeApplicationConfigurationBuilder::GetDefaultTimeSignalType() const {
+    const char8 *type = "uint32";
+    if (timeSignalsInTicks) {
+        type = "uint64";
+    }
+    return type;
+}
+
 bool RealTimeApplicationConfigurationBuilder::WriteTimeSignalInfo(const char8 * const signalName) {
+    const char8 * const type = GetDefaultTimeSignalType();
     bool ret = dataSourcesDatabase.Write("QualifiedName", signalName);
     if (ret) {
-        ret = dataSourcesDatabase.Write("Type", "uint32");
+        ret = dataSourcesDatabase.Write("Type", type);
     }
     if (ret) {
         uint32 numberOfDimensions = 0u;
@@ -1867,7 +1909,7 @@ bool RealTimeApplicationConfigurationBuilder::WriteTimeSignalInfo(const char8 *
         ret = dataSourcesDatabase.Write("NumberOfElements", numberOfElements);
     }
     if (ret) {
-        uint32 byteSize = 4u;
+        uint32 byteSize = static_cast<uint32>(TypeDescriptor::GetTypeDescriptorFromTypeName(type).numberOfBits) / 8u;
         ret = dataSourcesDatabase.Write("ByteSize", byteSize);
     }
     if (ret) {
@@ -1877,7 +1919,7 @@ bool RealTimeApplicationConfigurationBuilder::WriteTimeSignalInfo(const char8 *
         while ((signalNameStr.SkipTokens(1u, ".")) && (ret)) {
             fullType += "Node.";
         }
-        fullType += "uint32";
+        fullType += type;
         ret = dataSourcesDatabase.Write("FullType", fullType.Buffer());
     }
     if (ret) {
@@ -1894,14 +1936,15 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
     StreamString signalName;
     bool ret = dataSourcesDatabase.Read("QualifiedName", signalName);
 
+    StreamString type;
     if (ret) {
-        StreamString type;
-
         if (!dataSourcesDatabase.Read("Type", type)) {
-            ret = dataSourcesDatabase.Write("Type", "uint32");
+            type = GetDefaultTimeSignalType();
+            ret = dataSourcesDatabase.Write("Type", type.Buffer());
         }
         else {
-            ret = (type == "uint32");
+            //uint32 signals hold micro-seconds, uint64 signals hold HighResolutionTimer ticks.
+            ret = ((type == "uint32") || (type == "uint64"));
         }
     }
     if (ret) {
@@ -1910,7 +1953,7 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
         while ((signalName.SkipTokens(1u, ".")) && (ret)) {
             fullTypeTest += "Node.";
         }
-        fullTypeTest += "uint32";
+        fullTypeTest += type;
         StreamString fullType;
         if (!dataSourcesDatabase.Read("FullType", fullType)) {
             ret = dataSourcesDatabase.Write("FullType", fullTypeTest.Buffer());
@@ -1940,13 +1983,14 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
         }
     }
     if (ret) {
+        uint32 typeByteSize = static_cast<uint32>(TypeDescriptor::GetTypeDescriptorFromTypeName(type.Buffer()).numberOfBits) / 8u;
         uint32 byteSize;
         if (!dataSourcesDatabase.Read("ByteSize", byteSize)) {
-            byteSize = static_cast<uint32>(sizeof(uint32));
+            byteSize = typeByteSize;
             ret = dataSourcesDatabase.Write("ByteSize", byteSize);
         }
         else {
-            ret = (byteSize == sizeof(uint32));
+            ret = (byteSize == typeByteSize);
         }
     }
     return ret;
@@ -2220,7 +2264,18 @@ bool RealTimeApplicationConfigurationBuilder::CheckProducersRanges(const uint32
     return ret;
 }
 
+bool RealTimeApplicationConfigurationBuilder::FindDataSourceSignal(const char8 * const dataSourceId,
+                                                                   const char8 * const signalName,
+                                                                   uint32 &signalIdx) {
+    bool found = dataSourcesSignalIndexCache.MoveAbsolute(dataSourceId);
+    if (found) {
+        found = dataSourcesSignalIndexCache.Read(signalName, signalIdx);
+    }
+    return found;
+}
+
 bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
+    StreamString dataSourceId = dataSourcesDatabase.GetName();
     bool ret = dataSourcesDatabase.MoveRelative("Signals");
     if (ret) {
         ret = functionsDatabase.MoveAbsolute("Functions");
@@ -2242,22 +2297,13 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
             for (uint32 k = 0u; (postfix[k] != NULL) && ret; k++) {
                 StreamString signalNameStr = functionName;
                 signalNameStr += postfix[k];
-                uint32 numberOfPresentSignals = dataSourcesDatabase.GetNumberOfChildren();
-                bool found = false;
-                uint32 j;
+                uint32 signalIdx = 0u;
+                bool found = FindDataSourceSignal(dataSourceId.Buffer(), signalNameStr.Buffer(), signalIdx);
                 ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
-                for (j = 0u; (j < numberOfPresentSignals) && (ret) && (!found); j++) {
-                    dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
-                    ret = dataSourcesDatabase.MoveToChild(j);
-                    StreamString toAdd;
+                if (found) {
+                    ret = dataSourcesDatabase.MoveToChild(signalIdx);
                     if (ret) {
-                        ret = dataSourcesDatabase.Read("QualifiedName", toAdd);
-                    }
-                    if (ret) {
-                        found = (toAdd == signalNameStr);
-                        if (found) {
-                            ret = CheckTimeSignalInfo();
-                        }
+                        ret = CheckTimeSignalInfo();
                     }
                 }
                 if (ret) {
@@ -2266,14 +2312,31 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
                 if ((!found) && (ret)) {
                     StreamString newSignalIdx;
                     uint32 nextIndex = dataSourcesDatabase.GetNumberOfChildren();
-                    ret = newSignalIdx.Printf("%d", nextIndex);
                     ConfigurationDatabase dataSourcesDatabaseBeforeCreate = dataSourcesDatabase;
+                    //The signals deleted by VerifyDataSourcesSignals may leave a node already named as nextIndex.
+                    uint32 newSignalId = nextIndex;
+                    bool nameInUse = true;
+                    while ((nameInUse) && (ret)) {
+                        newSignalIdx = "";
+                        ret = newSignalIdx.Printf("%d", newSignalId);
+                        if (ret) {
+                            nameInUse = dataSourcesDatabase.MoveRelative(newSignalIdx.Buffer());
+                            dataSourcesDatabase = dataSourcesDatabaseBeforeCreate;
+                            newSignalId++;
+                        }
+                    }
                     if (ret) {
                         ret = dataSourcesDatabase.CreateRelative(newSignalIdx.Buffer());
                     }
                     if (ret) {
                         ret = WriteTimeSignalInfo(signalNameStr.Buffer());
                     }
+                    if (ret) {
+                        ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourceId.Buffer());
+                    }
+                    if (ret) {
+                        ret = dataSourcesSignalIndexCache.Write(signalNameStr.Buffer(), nextIndex);
+                    }
                     if (ret) {
                         dataSourcesDatabase = dataSourcesDatabaseBeforeCreate;
                     }
@@ -3647,6 +3710,10 @@ bool RealTimeApplicationConfigurationBuilder::SearchDataSources(ConfigurationDat
                     isTimingDataSource = 1u;
                     ret = outputDatabase.Write("IsTimingDataSource", isTimingDataSource);
                 }
+                StreamString timeUnit;
+                if (inputDatabase.Read("TimeUnit", timeUnit)) {
+                    timeSignalsInTicks = (timeUnit == "Ticks");
+                }
                 timingDataSourceCounter++;
             }
         }
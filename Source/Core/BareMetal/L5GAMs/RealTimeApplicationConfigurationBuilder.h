@@ -737,7 +737,8 @@ private:
     ConfigurationDatabase functionsIndexesCache;
 
     /**
-     * Cache the datasource signal index
+     * Cache the datasource signal index (DataSource index -> signal QualifiedName -> signal index).
+     * After FlattenSignalsDatabases it holds all the signals of all the DataSources.
      */
     ConfigurationDatabase dataSourcesSignalIndexCache;
 
@@ -761,6 +762,11 @@ private:
      */
     RealTimeApplication *realTimeApplication;
 
+    /**
+     * True if the TimingDataSource was configured with TimeUnit = "Ticks".
+     */
+    bool timeSignalsInTicks;
+
     /**
      * @brief Flattens all the nested structures in a Database.
      * @details All the introspection elements are expanded and the signals are flatten, so that nested structured
@@ -1055,6 +1061,31 @@ private:
      */
     bool AddThreadCycleTime(const char8 * const threadFullName);
 
+    /**
+     * @brief Searches a signal, by qualified name, in the Signals node of a DataSource.
+     * @details The dataSourcesSignalIndexCache holds all the signals of the DataSource (see IndexDataSourceSignals), so that
+     * a signal which is not in the cache does not exist.
+     * @param[in] dataSourceId the node name of the DataSource in the dataSourcesDatabase (i.e. its index).
+     * @param[in] signalName the qualified name of the signal to search.
+     * @param[out] signalIdx the index of the signal in the Signals node (only valid if the signal was found).
+     * @return true if the signal was found.
+     */
+    bool FindDataSourceSignal(const char8 * const dataSourceId,
+                              const char8 * const signalName,
+                              uint32 &signalIdx);
+
+    /**
+     * @brief Rebuilds the dataSourcesSignalIndexCache entries of a DataSource.
+     * @details Maps the QualifiedName of every signal of the DataSource to its index in the Signals node. Any previous entry
+     * of the DataSource is discarded.
+     * @return true if all the signals of the DataSource have a QualifiedName.
+     * @pre
+     *   The dataSourcesDatabase is positioned in the DataSource node.
+     * @post
+     *   The dataSourcesDatabase is positioned in the DataSource node.
+     */
+    bool IndexDataSourceSignals();
+
     /**
      * @brief Writes all the properties related to the TimingDataSource signals.
      * @param[in] signalName the signal name to be updated.
@@ -1063,11 +1094,20 @@ private:
     bool WriteTimeSignalInfo(const char8 * const signalName);
 
     /**
-     * @brief Verifies if all the TimingDataSource signals have the correct properties (type = uint32, NumberOfElements = 1).
+     * @brief Verifies if all the TimingDataSource signals have the correct properties (type = uint32 or uint64, NumberOfElements = 1).
+     * @details Signals without a type are assigned the type returned by GetDefaultTimeSignalType.
      * @return true if all the TimingDataSource signals have the correct properties.
      */
     bool CheckTimeSignalInfo();
 
+    /**
+     * @brief Gets the type of the TimingDataSource signals that do not declare a type.
+     * @details The type is uint64 (HighResolutionTimer ticks) if the TimingDataSource was configured with TimeUnit = "Ticks"
+     * and uint32 (micro-seconds) otherwise.
+     * @return the name of the type of the time signals.
+     */
+    const char8 *GetDefaultTimeSignalType() const;
+
     /**
      * Clear the caches,
      */
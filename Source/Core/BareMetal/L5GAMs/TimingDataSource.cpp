@@ -46,9 +46,34 @@ namespace MARTe {
 
 TimingDataSource::TimingDataSource() :
         GAMDataSource() {
+    timeUnitTicks = false;
+    ticksSignals = NULL_PTR(bool *);
+    numberOfTicksSignals = 0u;
 }
 
 TimingDataSource::~TimingDataSource() {
+    if (ticksSignals != NULL_PTR(bool *)) {
+        delete[] ticksSignals;
+    }
+}
+
+bool TimingDataSource::Initialise(StructuredDataI & data) {
+    bool ret = GAMDataSource::Initialise(data);
+    if (ret) {
+        StreamString timeUnit;
+        if (data.Read("TimeUnit", timeUnit)) {
+            timeUnitTicks = (timeUnit == "Ticks");
+            ret = ((timeUnitTicks) || (timeUnit == "MicroSeconds"));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "TimeUnit %s not supported. Possible values are MicroSeconds or Ticks", timeUnit.Buffer());
+            }
+        }
+    }
+    return ret;
+}
+
+bool TimingDataSource::IsTimeUnitTicks() const {
+    return timeUnitTicks;
 }
 
 bool TimingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
@@ -77,9 +102,28 @@ bool TimingDataSource::SetConfiguredDatabase(StructuredDataI & data) {
             }
         }
     }
+    if (ret) {
+        if (ticksSignals != NULL_PTR(bool *)) {
+            delete[] ticksSignals;
+        }
+        ticksSignals = new bool[nSignals];
+        numberOfTicksSignals = nSignals;
+        for (n = 0u; n < nSignals; n++) {
+            ticksSignals[n] = (GetSignalType(n) == UnsignedInteger64Bit);
+        }
+    }
     return ret;
 }
 
+bool TimingDataSource::IsTicksSignal(const uint32 signalIdx) const {
+    bool ticks = false;
+    if (signalIdx < numberOfTicksSignals) {
+        /*lint -e{613} ticksSignals cannot be NULL if numberOfTicksSignals > 0.*/
+        ticks = ticksSignals[signalIdx];
+    }
+    return ticks;
+}
+
 CLASS_REGISTER(TimingDataSource, "1.0")
 
 }
@@ -51,6 +51,20 @@ namespace MARTe {
  *  for this GAM_NAME have been executed. The GAM_NAME_WriteTime holds the time elapsed from the beginning of the cycle
  *  until all the output brokers for this GAM_NAME have been executed. The GAM_NAME_ExecTime holds the time elapsed
  *  from the beginning of the cycle until this GAM_NAME has finished its execution.
+ *
+ * @details By default the times are stored in micro-seconds, which requires the GAMSchedulerI to convert the
+ * HighResolutionTimer ticks on every execution. If the optional parameter TimeUnit is set to "Ticks", the signals whose
+ * type is not explicitly declared are created as uint64 and hold the raw HighResolutionTimer ticks, deferring the unit
+ * conversion to the consumers (see GAMSchedulerI::TicksToMicroSeconds). Signals explicitly declared as uint64 always hold
+ * ticks and signals declared as uint32 always hold micro-seconds.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Timings = {
+ *     Class = TimingDataSource
+ *     TimeUnit = "Ticks" //Optional. Possible values: "MicroSeconds" (default) or "Ticks".
+ * }
+ * </pre>
  */
 class DLL_API TimingDataSource: public GAMDataSource {
 public:
@@ -62,10 +76,24 @@ public:
     TimingDataSource();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the signal time unit table.
      */
     virtual ~TimingDataSource();
 
+    /**
+     * @brief see GAMDataSource::Initialise.
+     * @details Reads the optional TimeUnit parameter.
+     * @param[in] data see GAMDataSource::Initialise.
+     * @return true if GAMDataSource::Initialise returns true and if the TimeUnit (if set) is either "MicroSeconds" or "Ticks".
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Returns true if the time signals, whose type is not explicitly declared, hold HighResolutionTimer ticks.
+     * @return true if TimeUnit = "Ticks".
+     */
+    bool IsTimeUnitTicks() const;
+
     /**
      * @brief see GAMDataSource::Initialise.
      * @details Verifies that there are no producers assigned to this DataSourceI. The timing data will be produced by
@@ -74,6 +102,31 @@ public:
      * @return true if GAMDataSource::Initialise returns true and if there are no producers assigned to this DataSourceI.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
+    /**
+     * @brief Returns true if the signal holds HighResolutionTimer ticks (i.e. its type is uint64), false if it holds micro-seconds.
+     * @details The information is cached by SetConfiguredDatabase, so that it is available after the configuration of the application.
+     * @param[in] signalIdx the index of the signal.
+     * @return true if the signal with index \a signalIdx holds HighResolutionTimer ticks.
+     */
+    bool IsTicksSignal(const uint32 signalIdx) const;
+
+private:
+
+    /**
+     * True if TimeUnit = "Ticks".
+     */
+    bool timeUnitTicks;
+
+    /**
+     * For each signal, true if it holds HighResolutionTimer ticks.
+     */
+    bool *ticksSignals;
+
+    /**
+     * Number of elements in ticksSignals.
+     */
+    uint32 numberOfTicksSignals;
 };
 
 }
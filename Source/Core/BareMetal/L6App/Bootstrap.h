@@ -65,7 +65,7 @@ public:
      * - Filename: the name of the file to be load;
      * - DefaultCPUs: sets the threads defaults CPUs (see ProcessorType::SetDefaultCPUs);\n
      * - SchedulerGranularity: sets the scheduler granularity in micro-seconds (i.e. any requests to sleep no more than this value, will busy sleep).
-     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
+     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml, json and bin;\n
      * - MessageDestination (optional): the name of the Object that will receive the message upon program Start (see Loader::Initialise);\n
      * - MessageFunction (optional): the name of the Function to be called in the MessageDestination (see Loader::Initialise);\n
      * - FirstState (optional): the name of the FirstState in a RealTimeApplication (see RealTimeLoader::Initialise).
@@ -75,6 +75,10 @@ public:
 
     /**
      * @brief Gets the configuration stream to be used for the application start.
+     * @details Environments that support it may return a stream over a memory mapped view of the configuration file
+     * (which avoids copying the file while it is being parsed). This view is released by Run.
+     * The parser still reads the whole view and builds the full ConfigurationDatabase before the application is
+     * initialised, i.e. nodes are not materialised lazily from the mapped file.
      * @param[in] loaderParameters the parameters that were read with ReadParameters.
      * @param[out] configurationStream the stream to be read.
      * @return ErrorManagement::NoError if the stream is ready to be read. A specific ErrorType otherwise.
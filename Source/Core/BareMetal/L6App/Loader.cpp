@@ -30,6 +30,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "BinaryParser.h"
 #include "ConfigurationDatabase.h"
 #include "JsonParser.h"
 #include "Loader.h"
@@ -125,6 +126,10 @@ ErrorManagement::ErrorType Loader::Configure(StructuredDataI &data, StreamI &con
             StandardParser parser(configuration, parsedConfiguration, &parserError);
             ret.initialisationError = !parser.Parse();
         }
+        else if (parserType == "bin") {
+            BinaryParser parser(configuration, parsedConfiguration, &parserError);
+            ret.initialisationError = !parser.Parse();
+        }
         else {
             ret = ErrorManagement::ParametersError;
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown Parser specified");
@@ -57,6 +57,11 @@ namespace MARTe {
 class DLL_API BasicUDPSocket: public BasicSocket {
 public:
 
+    /**
+     * Maximum number of datagrams that are transmitted in a single system call by WriteDatagrams.
+     */
+    static const uint32 MAX_DATAGRAMS_PER_CALL = 64u;
+
     /**
      * @brief Default constructor.
      */
@@ -116,6 +121,22 @@ public:
     bool Connect(const char8 * const address,
                  const uint16 port);
 
+    /**
+     * @brief Writes a set of datagrams to the destination with as few system calls as possible.
+     * @details Each of the \a inputs buffers is sent as one independent datagram.
+     * On Linux all the datagrams are transmitted with sendmmsg (in chunks of at most
+     * MAX_DATAGRAMS_PER_CALL datagrams), other environments send them one at a time.
+     * The errors are not reported (i.e. no REPORT_ERROR), given that this function is used to transmit the log messages
+     * (see UDPLogger) and a reported error would be added to the same log messages that failed to be transmitted.
+     * @param[in] inputs the buffers to be sent.
+     * @param[in] sizes the number of bytes of each buffer.
+     * @param[in,out] nOfDatagrams the number of datagrams to write. On exit is the number of datagrams actually written.
+     * @return true if all the datagrams were successfully written.
+     */
+    bool WriteDatagrams(const char8 * const * const inputs,
+                        const uint32 * const sizes,
+                        uint32 &nOfDatagrams);
+
     /**
      * @brief The UDP socket support writing.
      * @return true.
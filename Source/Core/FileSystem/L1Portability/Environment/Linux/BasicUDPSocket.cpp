@@ -133,6 +133,46 @@ bool BasicUDPSocket::Write(const char8* const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::WriteDatagrams(const char8 * const * const inputs,
+                                    const uint32 * const sizes,
+                                    uint32 &nOfDatagrams) {
+    uint32 nOfDatagramsToWrite = nOfDatagrams;
+    nOfDatagrams = 0u;
+    bool ok = IsValid();
+    if (ok) {
+        struct mmsghdr messages[MAX_DATAGRAMS_PER_CALL];
+        struct iovec vectors[MAX_DATAGRAMS_PER_CALL];
+        while ((ok) && (nOfDatagrams < nOfDatagramsToWrite)) {
+            uint32 nOfDatagramsInCall = (nOfDatagramsToWrite - nOfDatagrams);
+            if (nOfDatagramsInCall > MAX_DATAGRAMS_PER_CALL) {
+                nOfDatagramsInCall = MAX_DATAGRAMS_PER_CALL;
+            }
+            uint32 i;
+            for (i = 0u; i < nOfDatagramsInCall; i++) {
+                /*lint -e{9005} [MISRA C++ Rule 5-2-5]. Justification: the operating system API does not modify the buffer but requires a non-const pointer.*/
+                vectors[i].iov_base = const_cast<char8 *>(inputs[nOfDatagrams + i]);
+                vectors[i].iov_len = static_cast<size_t>(sizes[nOfDatagrams + i]);
+                /*lint -e{740} [MISRA C++ Rule 5-2-6], [MISRA C++ Rule 5-2-7]. Justification: Pointer to Pointer cast required by operating system API.*/
+                messages[i].msg_hdr.msg_name = reinterpret_cast<struct sockaddr*>(destination.GetInternetHost());
+                messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(destination.Size());
+                messages[i].msg_hdr.msg_iov = &vectors[i];
+                messages[i].msg_hdr.msg_iovlen = 1u;
+                messages[i].msg_hdr.msg_control = NULL_PTR(void *);
+                messages[i].msg_hdr.msg_controllen = 0u;
+                messages[i].msg_hdr.msg_flags = 0;
+                messages[i].msg_len = 0u;
+            }
+            int32 ret = static_cast<int32>(sendmmsg(connectionSocket, &messages[0], nOfDatagramsInCall, 0));
+            ok = (ret > 0);
+            if (ok) {
+                /*lint -e{9117} -e{732}  [MISRA C++ Rule 5-0-4]. Justification: the casted number is positive. */
+                nOfDatagrams += static_cast<uint32>(ret);
+            }
+        }
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Open() {
     /*lint -e{641} .Justification the socket type descriptor is an integer */
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
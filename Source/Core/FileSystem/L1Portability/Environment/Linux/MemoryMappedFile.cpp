@@ -0,0 +1,195 @@
+/**
+ * @file MemoryMappedFile.cpp
+ * @brief Source file for class MemoryMappedFile
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMappedFile (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "MemoryMappedFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MemoryMappedFile::MemoryMappedFile() {
+    fileHandle = -1;
+    mappingHandle = -1;
+    memory = NULL_PTR(void *);
+    size = 0u;
+    readOnly = false;
+}
+
+/*lint -e{1551} the destructor must guarantee that the file is unmapped and closed.*/
+MemoryMappedFile::~MemoryMappedFile() {
+    (void) Close();
+}
+
+bool MemoryMappedFile::Open(const char8 * const fileName,
+                            const uint32 sizeIn) {
+    bool ok = ((memory == NULL_PTR(void *)) && (sizeIn > 0u));
+    Handle newHandle = -1;
+    if (ok) {
+        newHandle = open(fileName, O_RDWR | O_CREAT, 0644);
+        ok = (newHandle >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed open()");
+        }
+    }
+    if (ok) {
+        struct stat fileStatus;
+        ok = (fstat(newHandle, &fileStatus) == 0);
+        if (ok) {
+            if (fileStatus.st_size != static_cast<off_t>(sizeIn)) {
+                ok = (ftruncate(newHandle, static_cast<off_t>(sizeIn)) == 0);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed to set the size of the file");
+        }
+    }
+    if (ok) {
+        //Allocate all the blocks of the (possibly sparse) file. Otherwise writing to the mapped memory raises SIGBUS when the disk is full.
+        ok = (posix_fallocate(newHandle, 0, static_cast<off_t>(sizeIn)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed posix_fallocate()");
+        }
+    }
+    if (ok) {
+        void *mapped = mmap(NULL_PTR(void *), static_cast<size_t>(sizeIn), PROT_READ | PROT_WRITE, MAP_SHARED, newHandle, 0);
+        /*lint -e{923} [MISRA C++ Rule 5-2-9]. Justification: MAP_FAILED is defined by the operating system API.*/
+        ok = (mapped != MAP_FAILED);
+        if (ok) {
+            fileHandle = newHandle;
+            memory = mapped;
+            size = sizeIn;
+            readOnly = false;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed mmap()");
+        }
+    }
+    if ((!ok) && (newHandle >= 0)) {
+        (void) close(newHandle);
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::OpenReadOnly(const char8 * const fileName) {
+    bool ok = (memory == NULL_PTR(void *));
+    Handle newHandle = -1;
+    if (ok) {
+        newHandle = open(fileName, O_RDONLY);
+        ok = (newHandle >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed open()");
+        }
+    }
+    uint32 fileSize = 0u;
+    if (ok) {
+        struct stat fileStatus;
+        ok = (fstat(newHandle, &fileStatus) == 0);
+        if (ok) {
+            ok = ((fileStatus.st_size > 0) && (fileStatus.st_size <= static_cast<off_t>(0xFFFFFFFFu)));
+        }
+        if (ok) {
+            fileSize = static_cast<uint32>(fileStatus.st_size);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Invalid file size");
+        }
+    }
+    if (ok) {
+        void *mapped = mmap(NULL_PTR(void *), static_cast<size_t>(fileSize), PROT_READ, MAP_SHARED, newHandle, 0);
+        /*lint -e{923} [MISRA C++ Rule 5-2-9]. Justification: MAP_FAILED is defined by the operating system API.*/
+        ok = (mapped != MAP_FAILED);
+        if (ok) {
+            fileHandle = newHandle;
+            memory = mapped;
+            size = fileSize;
+            readOnly = true;
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed mmap()");
+        }
+    }
+    if ((!ok) && (newHandle >= 0)) {
+        (void) close(newHandle);
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::Close() {
+    bool ok = (memory != NULL_PTR(void *));
+    if (ok) {
+        ok = (munmap(memory, static_cast<size_t>(size)) == 0);
+        memory = NULL_PTR(void *);
+        size = 0u;
+        if (close(fileHandle) != 0) {
+            ok = false;
+        }
+        fileHandle = -1;
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed to close the file");
+        }
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::Flush() {
+    bool ok = ((memory != NULL_PTR(void *)) && (!readOnly));
+    if (ok) {
+        ok = (msync(memory, static_cast<size_t>(size), MS_ASYNC) == 0);
+    }
+    return ok;
+}
+
+void *MemoryMappedFile::GetMemory() const {
+    return memory;
+}
+
+uint32 MemoryMappedFile::GetSize() const {
+    return size;
+}
+
+bool MemoryMappedFile::IsReadOnly() const {
+    return readOnly;
+}
+
+}
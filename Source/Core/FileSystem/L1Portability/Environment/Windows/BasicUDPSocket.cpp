@@ -131,6 +131,24 @@ bool BasicUDPSocket::Write(const char8* const input,
     return (ret > 0);
 }
 
+bool BasicUDPSocket::WriteDatagrams(const char8 * const * const inputs,
+                                    const uint32 * const sizes,
+                                    uint32 &nOfDatagrams) {
+    uint32 nOfDatagramsToWrite = nOfDatagrams;
+    nOfDatagrams = 0u;
+    bool ok = IsValid();
+    //Not using Write, which reports the errors.
+    while ((ok) && (nOfDatagrams < nOfDatagramsToWrite)) {
+        int32 ret = static_cast<int32>(sendto(connectionSocket, inputs[nOfDatagrams], sizes[nOfDatagrams], 0,
+                                              reinterpret_cast<struct sockaddr*>(destination.GetInternetHost()), destination.Size()));
+        ok = (ret != SOCKET_ERROR);
+        if (ok) {
+            nOfDatagrams++;
+        }
+    }
+    return ok;
+}
+
 bool BasicUDPSocket::Open() {
     connectionSocket = (socket(PF_INET, SOCK_DGRAM, 0));
     if (connectionSocket != INVALID_SOCKET) {
@@ -0,0 +1,247 @@
+/**
+ * @file MemoryMappedFile.cpp
+ * @brief Source file for class MemoryMappedFile
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMappedFile (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <windows.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "MemoryMappedFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MemoryMappedFile::MemoryMappedFile() {
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = NULL;
+    memory = NULL_PTR(void *);
+    size = 0u;
+    readOnly = false;
+}
+
+/*lint -e{1551} the destructor must guarantee that the file is unmapped and closed.*/
+MemoryMappedFile::~MemoryMappedFile() {
+    (void) Close();
+}
+
+/**
+ * @brief Maps the already open \a file with the requested access.
+ */
+static bool MapFile(const Handle file,
+                    const uint32 sizeIn,
+                    const bool readOnlyIn,
+                    Handle &mapping,
+                    void *&mapped) {
+    mapping = CreateFileMapping(file, NULL, readOnlyIn ? PAGE_READONLY : PAGE_READWRITE, 0u, sizeIn, NULL);
+    bool ok = (mapping != NULL);
+    if (ok) {
+        mapped = MapViewOfFile(mapping, readOnlyIn ? FILE_MAP_READ : FILE_MAP_WRITE, 0u, 0u, static_cast<SIZE_T>(sizeIn));
+        ok = (mapped != NULL);
+        if (!ok) {
+            (void) CloseHandle(mapping);
+            mapping = NULL;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed to map the file");
+    }
+    return ok;
+}
+
+/**
+ * @brief Grows the already open \a file from \a currentSize to \a sizeIn by writing zeros, so that all the disk space is allocated
+ * (and the error reported) before the file is mapped.
+ */
+static bool AllocateFile(const Handle file,
+                         const uint32 currentSize,
+                         const uint32 sizeIn) {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(currentSize);
+    bool ok = (SetFilePointerEx(file, position, NULL, FILE_BEGIN) != 0);
+    const uint32 blockSize = 4096u;
+    char8 zeros[blockSize];
+    for (uint32 i = 0u; i < blockSize; i++) {
+        zeros[i] = '\0';
+    }
+    uint32 written = currentSize;
+    while ((ok) && (written < sizeIn)) {
+        uint32 toWrite = sizeIn - written;
+        if (toWrite > blockSize) {
+            toWrite = blockSize;
+        }
+        DWORD writtenBlock = 0u;
+        ok = (WriteFile(file, &zeros[0], static_cast<DWORD>(toWrite), &writtenBlock, NULL) != 0);
+        if (ok) {
+            ok = (writtenBlock == static_cast<DWORD>(toWrite));
+        }
+        written += toWrite;
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::Open(const char8 * const fileName,
+                            const uint32 sizeIn) {
+    bool ok = ((memory == NULL_PTR(void *)) && (sizeIn > 0u));
+    Handle newHandle = INVALID_HANDLE_VALUE;
+    if (ok) {
+        newHandle = CreateFile(fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        ok = (newHandle != INVALID_HANDLE_VALUE);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed CreateFile()");
+        }
+    }
+    if (ok) {
+        //The disk space of a sparse file is only allocated when the mapped memory is written, which then fails when the disk is full.
+        BY_HANDLE_FILE_INFORMATION fileInformation;
+        ok = (GetFileInformationByHandle(newHandle, &fileInformation) != 0);
+        if (ok) {
+            ok = ((fileInformation.dwFileAttributes & FILE_ATTRIBUTE_SPARSE_FILE) == 0u);
+        }
+        LARGE_INTEGER fileSize;
+        if (ok) {
+            ok = (GetFileSizeEx(newHandle, &fileSize) != 0);
+        }
+        if ((ok) && (fileSize.QuadPart > static_cast<LONGLONG>(sizeIn))) {
+            fileSize.QuadPart = static_cast<LONGLONG>(sizeIn);
+            ok = (SetFilePointerEx(newHandle, fileSize, NULL, FILE_BEGIN) != 0);
+            if (ok) {
+                ok = (SetEndOfFile(newHandle) != 0);
+            }
+        }
+        else if ((ok) && (fileSize.QuadPart < static_cast<LONGLONG>(sizeIn))) {
+            ok = AllocateFile(newHandle, static_cast<uint32>(fileSize.QuadPart), sizeIn);
+        }
+        else {
+            //Already with the requested size
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed to set the size of the file");
+        }
+    }
+    if (ok) {
+        ok = MapFile(newHandle, sizeIn, false, mappingHandle, memory);
+        if (ok) {
+            fileHandle = newHandle;
+            size = sizeIn;
+            readOnly = false;
+        }
+    }
+    if ((!ok) && (newHandle != INVALID_HANDLE_VALUE)) {
+        (void) CloseHandle(newHandle);
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::OpenReadOnly(const char8 * const fileName) {
+    bool ok = (memory == NULL_PTR(void *));
+    Handle newHandle = INVALID_HANDLE_VALUE;
+    if (ok) {
+        newHandle = CreateFile(fileName, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        ok = (newHandle != INVALID_HANDLE_VALUE);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed CreateFile()");
+        }
+    }
+    uint32 fileSize = 0u;
+    if (ok) {
+        LARGE_INTEGER fileSizeL;
+        ok = (GetFileSizeEx(newHandle, &fileSizeL) != 0);
+        if (ok) {
+            ok = ((fileSizeL.QuadPart > 0) && (fileSizeL.QuadPart <= static_cast<LONGLONG>(0xFFFFFFFFu)));
+        }
+        if (ok) {
+            fileSize = static_cast<uint32>(fileSizeL.QuadPart);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Invalid file size");
+        }
+    }
+    if (ok) {
+        ok = MapFile(newHandle, fileSize, true, mappingHandle, memory);
+        if (ok) {
+            fileHandle = newHandle;
+            size = fileSize;
+            readOnly = true;
+        }
+    }
+    if ((!ok) && (newHandle != INVALID_HANDLE_VALUE)) {
+        (void) CloseHandle(newHandle);
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::Close() {
+    bool ok = (memory != NULL_PTR(void *));
+    if (ok) {
+        ok = (UnmapViewOfFile(memory) != 0);
+        memory = NULL_PTR(void *);
+        size = 0u;
+        if (CloseHandle(mappingHandle) == 0) {
+            ok = false;
+        }
+        mappingHandle = NULL;
+        if (CloseHandle(fileHandle) == 0) {
+            ok = false;
+        }
+        fileHandle = INVALID_HANDLE_VALUE;
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "MemoryMappedFile: Failed to close the file");
+        }
+    }
+    return ok;
+}
+
+bool MemoryMappedFile::Flush() {
+    bool ok = ((memory != NULL_PTR(void *)) && (!readOnly));
+    if (ok) {
+        ok = (FlushViewOfFile(memory, 0u) != 0);
+    }
+    return ok;
+}
+
+void *MemoryMappedFile::GetMemory() const {
+    return memory;
+}
+
+uint32 MemoryMappedFile::GetSize() const {
+    return size;
+}
+
+bool MemoryMappedFile::IsReadOnly() const {
+    return readOnly;
+}
+
+}
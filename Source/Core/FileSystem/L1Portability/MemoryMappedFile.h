@@ -0,0 +1,148 @@
+/**
+ * @file MemoryMappedFile.h
+ * @brief Header file for class MemoryMappedFile
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMappedFile
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPPEDFILE_H_
+#define MEMORYMAPPEDFILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Maps the contents of a file in memory.
+ * @details The mapping is shared, i.e. the changes to the memory are written to the file by the operating system
+ * (even if the process crashes) and are visible to any other process mapping the same file.
+ */
+class DLL_API MemoryMappedFile {
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   GetMemory() == NULL &&
+     *   GetSize() == 0u
+     */
+    MemoryMappedFile();
+
+    /**
+     * @brief Destructor. Calls Close().
+     */
+    virtual ~MemoryMappedFile();
+
+    /**
+     * @brief Opens (creating it if needed) the file with read and write access, sets its size and maps it in memory.
+     * @details The disk space of the whole file is allocated before the file is mapped, so that a full disk is reported here
+     * and not when the mapped memory is written (which would otherwise raise an access error, e.g. SIGBUS in Linux).
+     * @param[in] fileName the name of the file.
+     * @param[in] sizeIn the size of the file in bytes. Files with a different size are resized.
+     * @return true if the file was successfully opened, resized, allocated and mapped.
+     * @pre
+     *   sizeIn > 0u
+     */
+    bool Open(const char8 * const fileName,
+              const uint32 sizeIn);
+
+    /**
+     * @brief Opens an existing file with read only access and maps all its contents in memory.
+     * @param[in] fileName the name of the file.
+     * @return true if the file was successfully opened and mapped.
+     */
+    bool OpenReadOnly(const char8 * const fileName);
+
+    /**
+     * @brief Unmaps the memory and closes the file.
+     * @return true if the file was open and was successfully closed.
+     */
+    bool Close();
+
+    /**
+     * @brief Requests the operating system to (asynchronously) write the modified memory to the file.
+     * @return true if the request was successful.
+     */
+    bool Flush();
+
+    /**
+     * @brief Gets the mapped memory.
+     * @return the mapped memory or NULL if the file is not open.
+     */
+    void *GetMemory() const;
+
+    /**
+     * @brief Gets the size of the mapped memory.
+     * @return the size of the mapped memory in bytes.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Checks if the mapped memory is read only.
+     * @return true if the file was open with OpenReadOnly.
+     */
+    bool IsReadOnly() const;
+
+private:
+
+    /**
+     * The file handle.
+     */
+    Handle fileHandle;
+
+    /**
+     * The handle of the mapping (if required by the operating system).
+     */
+    Handle mappingHandle;
+
+    /**
+     * The mapped memory.
+     */
+    void *memory;
+
+    /**
+     * The size of the mapped memory.
+     */
+    uint32 size;
+
+    /**
+     * True if the file was open with OpenReadOnly.
+     */
+    bool readOnly;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPPEDFILE_H_ */
@@ -0,0 +1,219 @@
+/**
+ * @file RingFileLogReader.cpp
+ * @brief Source file for class RingFileLogReader
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLogReader (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "RingFileLogReader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Gets the string at \a position of the record, checking that it is terminated where expected.
+ * @return the string or NULL if it is not valid.
+ */
+static const char8 *GetString(const char8 * const record,
+                              uint32 &position,
+                              const uint16 size,
+                              const uint32 recordSize) {
+    const char8 *str = NULL_PTR(const char8 *);
+    uint32 end = (position + static_cast<uint32>(size));
+    if (end < recordSize) {
+        if (record[end] == '\0') {
+            str = &record[position];
+        }
+    }
+    position = (end + 1u);
+    return str;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+RingFileLogReader::RingFileLogReader() {
+    header = NULL_PTR(const RingFileLoggerHeader *);
+    dataArea = NULL_PTR(const char8 *);
+    dataSize = 0u;
+    readOffset = 0u;
+    headOffset = 0u;
+    sequence = 0u;
+    nOfRecords = 0u;
+}
+
+RingFileLogReader::~RingFileLogReader() {
+    (void) Close();
+}
+
+bool RingFileLogReader::Open(const char8 * const fileName) {
+    bool ok = (dataArea == NULL_PTR(const char8 *));
+    if (ok) {
+        ok = file.OpenReadOnly(fileName);
+    }
+    if (ok) {
+        ok = (file.GetSize() > RING_FILE_LOGGER_HEADER_SIZE);
+    }
+    const char8 *memory = NULL_PTR(const char8 *);
+    if (ok) {
+        memory = static_cast<const char8 *>(file.GetMemory());
+        /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the header is at the beginning of the (page aligned) file.*/
+        header = reinterpret_cast<const RingFileLoggerHeader *>(memory);
+        ok = ((header->magic == RING_FILE_LOGGER_MAGIC) && (header->version == RING_FILE_LOGGER_VERSION));
+    }
+    if (ok) {
+        ok = (header->headerSize == RING_FILE_LOGGER_HEADER_SIZE);
+    }
+    if (ok) {
+        ok = ((header->dataSize > 0u) && ((header->dataSize % RING_FILE_LOGGER_ALIGNMENT) == 0u));
+    }
+    if (ok) {
+        ok = (header->dataSize <= (file.GetSize() - RING_FILE_LOGGER_HEADER_SIZE));
+    }
+    if (ok) {
+        headOffset = header->headOffset;
+        readOffset = header->tailOffset;
+        nOfRecords = header->nextSequence;
+        ok = ((headOffset >= readOffset) && ((headOffset - readOffset) <= header->dataSize));
+    }
+    if (ok) {
+        dataSize = header->dataSize;
+        dataArea = &memory[RING_FILE_LOGGER_HEADER_SIZE];
+        sequence = 0u;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is not a valid ring log file", fileName);
+        header = NULL_PTR(const RingFileLoggerHeader *);
+        (void) file.Close();
+    }
+    return ok;
+}
+
+bool RingFileLogReader::Close() {
+    header = NULL_PTR(const RingFileLoggerHeader *);
+    dataArea = NULL_PTR(const char8 *);
+    dataSize = 0u;
+    readOffset = 0u;
+    headOffset = 0u;
+    return file.Close();
+}
+
+bool RingFileLogReader::Read(LoggerPage &page) {
+    bool found = false;
+    bool ok = (dataArea != NULL_PTR(const char8 *));
+    /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the copy is aligned as the records in the data area.*/
+    char8 *recordBytes = reinterpret_cast<char8 *>(&recordCopy[0]);
+    const RingFileLoggerRecord *record = reinterpret_cast<const RingFileLoggerRecord *>(recordBytes);
+    while ((ok) && (!found)) {
+        //The records before the tail may have been overwritten by the writer (see RingFileLogger::Reserve).
+        uint64 tailOffset = header->tailOffset;
+        if (readOffset < tailOffset) {
+            readOffset = tailOffset;
+        }
+        ok = (readOffset < headOffset);
+        uint32 position = 0u;
+        uint32 recordSize = 0u;
+        if (ok) {
+            position = static_cast<uint32>(readOffset % dataSize);
+            /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the records are aligned in the data area.*/
+            recordSize = reinterpret_cast<const RingFileLoggerRecord *>(&dataArea[position])->size;
+            ok = ((recordSize >= RING_FILE_LOGGER_ALIGNMENT) && ((recordSize % RING_FILE_LOGGER_ALIGNMENT) == 0u));
+        }
+        if (ok) {
+            ok = (((position + recordSize) <= dataSize) && ((readOffset + recordSize) <= headOffset));
+        }
+        if (ok) {
+            ok = (recordSize <= RING_FILE_LOGGER_MAX_RECORD_SIZE);
+        }
+        if (ok) {
+            (void) MemoryOperationsHelper::Copy(recordBytes, &dataArea[position], recordSize);
+        }
+        //The writer moves the tail before overwriting: if the tail did not move past the record, the copy (and the size read before) is valid.
+        bool overwritten = (header->tailOffset > readOffset);
+        if (overwritten) {
+            ok = true;
+        }
+        else if (ok) {
+            if (record->magic == RING_FILE_LOGGER_WRAP_MAGIC) {
+                readOffset += recordSize;
+            }
+            else {
+                ok = ((record->magic == RING_FILE_LOGGER_RECORD_MAGIC) && (recordSize >= sizeof(RingFileLoggerRecord)));
+                found = ok;
+            }
+        }
+        else {
+            //Invalid record
+        }
+        if (found) {
+            uint32 stringPosition = static_cast<uint32>(sizeof(RingFileLoggerRecord));
+            ErrorManagement::ErrorInformation &errorInfo = page.errorInfo;
+            errorInfo.fileName = GetString(recordBytes, stringPosition, record->fileNameSize, recordSize);
+            errorInfo.functionName = GetString(recordBytes, stringPosition, record->functionNameSize, recordSize);
+            errorInfo.className = GetString(recordBytes, stringPosition, record->classNameSize, recordSize);
+            errorInfo.objectName = GetString(recordBytes, stringPosition, record->objectNameSize, recordSize);
+            const char8 *message = GetString(recordBytes, stringPosition, record->messageSize, recordSize);
+            ok = ((errorInfo.fileName != NULL_PTR(const char8 *)) && (errorInfo.functionName != NULL_PTR(const char8 *)));
+            if (ok) {
+                ok = ((errorInfo.className != NULL_PTR(const char8 *)) && (errorInfo.objectName != NULL_PTR(const char8 *)));
+            }
+            if (ok) {
+                ok = ((message != NULL_PTR(const char8 *)) && (record->messageSize < MAX_ERROR_MESSAGE_SIZE));
+            }
+            if (ok) {
+                (void) MemoryOperationsHelper::Copy(&page.errorStrBuffer[0], message, static_cast<uint32>(record->messageSize) + 1u);
+                page.format = NULL_PTR(const char8 *);
+                errorInfo.header.errorType = static_cast<ErrorManagement::ErrorIntegerFormat>(record->errorType);
+                errorInfo.header.lineNumber = record->lineNumber;
+                errorInfo.header.isObject = (record->isObject != 0u);
+                errorInfo.hrtTime = record->hrtTime;
+                errorInfo.timeSeconds = record->timeSeconds;
+                /*lint -e{923} [MISRA C++ Rule 5-2-9]. Justification: the pointer is only stored to be printed.*/
+                errorInfo.objectPointer = reinterpret_cast<const void *>(static_cast<uintp>(record->objectPointer));
+                sequence = record->sequence;
+                readOffset += recordSize;
+            }
+            found = ok;
+        }
+    }
+    return found;
+}
+
+uint64 RingFileLogReader::GetSequence() const {
+    return sequence;
+}
+
+uint64 RingFileLogReader::GetNumberOfRecords() const {
+    return nOfRecords;
+}
+
+}
@@ -0,0 +1,151 @@
+/**
+ * @file RingFileLogReader.h
+ * @brief Header file for class RingFileLogReader
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RingFileLogReader
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef L4LOGGERSERVICE_RINGFILELOGREADER_H_
+#define L4LOGGERSERVICE_RINGFILELOGREADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Logger.h"
+#include "MemoryMappedFile.h"
+#include "RingFileLogger.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Decodes the records of a ring log file written by the RingFileLogger.
+ * @details The file is mapped in memory (read only) and the records are read from the oldest to the newest.
+ * The file may be read while it is being written, in which case only the records committed when Open was called are read.
+ * Each record is copied before being decoded and is discarded if the writer moved the RingFileLoggerHeader::tailOffset past it
+ * in the meanwhile (i.e. if it may have been overwritten). The records that are overwritten before being read are thus skipped
+ * (see GetSequence).
+ */
+class RingFileLogReader {
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    RingFileLogReader();
+
+    /**
+     * @brief Destructor. Calls Close().
+     */
+    virtual ~RingFileLogReader();
+
+    /**
+     * @brief Maps the ring log file and validates its header.
+     * @param[in] fileName the name of the ring log file.
+     * @return true if the file could be mapped and is a valid ring log file.
+     */
+    bool Open(const char8 * const fileName);
+
+    /**
+     * @brief Unmaps the ring log file.
+     * @return true if the file was open and was successfully closed.
+     */
+    bool Close();
+
+    /**
+     * @brief Reads the next record into \a page.
+     * @details The page.errorInfo strings point at an internal copy of the record and are only valid until the next Read or Close.
+     * The message is copied into page.errorStrBuffer.
+     * @param[out] page where to write the record.
+     * @return true if a record was read, false if there are no more records or if an invalid record was found.
+     */
+    bool Read(LoggerPage &page);
+
+    /**
+     * @brief Gets the sequence number of the last record read (i.e. the number of records written before it).
+     * @return the sequence number of the last record read.
+     */
+    uint64 GetSequence() const;
+
+    /**
+     * @brief Gets the number of records that were written to the file when Open was called.
+     * @return the number of records that were written to the file.
+     */
+    uint64 GetNumberOfRecords() const;
+
+private:
+
+    /**
+     * The memory mapped ring log file.
+     */
+    MemoryMappedFile file;
+
+    /**
+     * The header of the ring log file (updated by the writer).
+     */
+    const RingFileLoggerHeader *header;
+
+    /**
+     * The data area of the ring log file.
+     */
+    const char8 *dataArea;
+
+    /**
+     * Size of the data area.
+     */
+    uint32 dataSize;
+
+    /**
+     * Offset of the next record to be read.
+     */
+    uint64 readOffset;
+
+    /**
+     * The head offset when Open was called.
+     */
+    uint64 headOffset;
+
+    /**
+     * Sequence number of the last record read.
+     */
+    uint64 sequence;
+
+    /**
+     * Number of records written when Open was called.
+     */
+    uint64 nOfRecords;
+
+    /**
+     * Copy of the last record read (uint64 so that the copy is aligned as in the data area).
+     */
+    uint64 recordCopy[RING_FILE_LOGGER_MAX_RECORD_SIZE / sizeof(uint64)];
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L4LOGGERSERVICE_RINGFILELOGREADER_H_ */
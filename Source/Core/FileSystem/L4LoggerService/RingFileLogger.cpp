@@ -0,0 +1,244 @@
+/**
+ * @file RingFileLogger.cpp
+ * @brief Source file for class RingFileLogger
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLogger (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "RingFileLogger.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Computes the length of \a str, up to \a maxSize characters.
+ * @return the length of \a str or 0 if \a str is NULL.
+ */
+static uint16 BoundedLength(const char8 * const str,
+                            const uint32 maxSize) {
+    uint32 length = 0u;
+    if (str != NULL_PTR(const char8 *)) {
+        while ((length < maxSize) && (str[length] != '\0')) {
+            length++;
+        }
+    }
+    return static_cast<uint16>(length);
+}
+
+/**
+ * @brief Copies \a size characters of \a str to \a destination and terminates them with a '\0'.
+ * @return the position in \a destination after the '\0'.
+ */
+static char8 *CopyString(char8 * const destination,
+                         const char8 * const str,
+                         const uint16 size) {
+    if (size > 0u) {
+        (void) MemoryOperationsHelper::Copy(destination, str, static_cast<uint32>(size));
+    }
+    destination[size] = '\0';
+    return &destination[size + 1u];
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+RingFileLogger::RingFileLogger() :
+        Object(), LoggerConsumerI() {
+    header = NULL_PTR(RingFileLoggerHeader *);
+    dataArea = NULL_PTR(char8 *);
+}
+
+/*lint -e{1551} the destructor must guarantee that the file is closed.*/
+RingFileLogger::~RingFileLogger() {
+    if (header != NULL_PTR(RingFileLoggerHeader *)) {
+        (void) file.Flush();
+        if (!file.Close()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed to close the ring log file");
+        }
+        header = NULL_PTR(RingFileLoggerHeader *);
+        dataArea = NULL_PTR(char8 *);
+    }
+}
+
+void RingFileLogger::Reserve(const uint32 nOfBytes) {
+    const uint32 dataSize = header->dataSize;
+    const uint64 head = header->headOffset;
+    uint64 tail = header->tailOffset;
+    while (((head + nOfBytes) - tail) > dataSize) {
+        /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the records are aligned in the data area.*/
+        const RingFileLoggerRecord *oldest = reinterpret_cast<const RingFileLoggerRecord *>(&dataArea[tail % dataSize]);
+        uint32 oldestSize = oldest->size;
+        bool valid = ((oldestSize >= RING_FILE_LOGGER_ALIGNMENT) && ((oldestSize % RING_FILE_LOGGER_ALIGNMENT) == 0u));
+        if (valid) {
+            valid = ((tail + oldestSize) <= head);
+        }
+        if (valid) {
+            tail += oldestSize;
+        }
+        else {
+            //Should never happen (the file was corrupted by someone else): discard all the records.
+            tail = head;
+        }
+    }
+    //Move the tail before overwriting, so that the records between the tail and the head are always valid.
+    header->tailOffset = tail;
+}
+
+void RingFileLogger::ConsumeLogMessage(LoggerPage * const logPage) {
+    if (header != NULL_PTR(RingFileLoggerHeader *)) {
+        const ErrorManagement::ErrorInformation &errorInfo = logPage->errorInfo;
+        RingFileLoggerRecord record;
+        record.magic = 0u;
+        record.sequence = header->nextSequence;
+        record.hrtTime = errorInfo.hrtTime;
+        /*lint -e{923} [MISRA C++ Rule 5-2-9]. Justification: the pointer is only stored to be printed.*/
+        record.objectPointer = static_cast<uint64>(reinterpret_cast<uintp>(errorInfo.objectPointer));
+        record.timeSeconds = errorInfo.timeSeconds;
+        record.errorType = static_cast<uint32>(static_cast<ErrorManagement::ErrorIntegerFormat>(errorInfo.header.errorType));
+        record.lineNumber = errorInfo.header.lineNumber;
+        record.isObject = errorInfo.header.isObject ? 1u : 0u;
+        record.reserved0 = 0u;
+        record.fileNameSize = BoundedLength(errorInfo.fileName, RING_FILE_LOGGER_MAX_NAME_SIZE);
+        record.functionNameSize = BoundedLength(errorInfo.functionName, RING_FILE_LOGGER_MAX_NAME_SIZE);
+        record.classNameSize = BoundedLength(errorInfo.className, RING_FILE_LOGGER_MAX_NAME_SIZE);
+        record.objectNameSize = BoundedLength(errorInfo.objectName, RING_FILE_LOGGER_MAX_NAME_SIZE);
+        record.messageSize = BoundedLength(&logPage->errorStrBuffer[0], MAX_ERROR_MESSAGE_SIZE - 1u);
+        record.reserved1 = 0u;
+        uint32 recordSize = static_cast<uint32>(sizeof(RingFileLoggerRecord)) + 5u;
+        recordSize += static_cast<uint32>(record.fileNameSize) + static_cast<uint32>(record.functionNameSize);
+        recordSize += static_cast<uint32>(record.classNameSize) + static_cast<uint32>(record.objectNameSize);
+        recordSize += static_cast<uint32>(record.messageSize);
+        recordSize = ((recordSize + (RING_FILE_LOGGER_ALIGNMENT - 1u)) / RING_FILE_LOGGER_ALIGNMENT) * RING_FILE_LOGGER_ALIGNMENT;
+        record.size = recordSize;
+
+        const uint32 dataSize = header->dataSize;
+        uint32 position = static_cast<uint32>(header->headOffset % dataSize);
+        //Records are never split: if it does not fit until the end of the data area, pad the end with a wrap record.
+        uint32 wrapSize = 0u;
+        if ((position + recordSize) > dataSize) {
+            wrapSize = (dataSize - position);
+        }
+        Reserve(wrapSize + recordSize);
+        if (wrapSize > 0u) {
+            /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the records are aligned in the data area.*/
+            RingFileLoggerRecord *wrap = reinterpret_cast<RingFileLoggerRecord *>(&dataArea[position]);
+            wrap->size = wrapSize;
+            wrap->magic = RING_FILE_LOGGER_WRAP_MAGIC;
+            header->headOffset += wrapSize;
+            position = 0u;
+        }
+        char8 *destination = &dataArea[position];
+        (void) MemoryOperationsHelper::Copy(destination, &record, static_cast<uint32>(sizeof(RingFileLoggerRecord)));
+        char8 *strings = &destination[sizeof(RingFileLoggerRecord)];
+        strings = CopyString(strings, errorInfo.fileName, record.fileNameSize);
+        strings = CopyString(strings, errorInfo.functionName, record.functionNameSize);
+        strings = CopyString(strings, errorInfo.className, record.classNameSize);
+        strings = CopyString(strings, errorInfo.objectName, record.objectNameSize);
+        (void) CopyString(strings, &logPage->errorStrBuffer[0], record.messageSize);
+        //Commit the record only after it was completely written.
+        /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the records are aligned in the data area.*/
+        volatile uint32 *magic = reinterpret_cast<volatile uint32 *>(destination);
+        *magic = RING_FILE_LOGGER_RECORD_MAGIC;
+        header->headOffset += recordSize;
+        header->nextSequence = (record.sequence + 1u);
+    }
+}
+
+bool RingFileLogger::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    StreamString fileName;
+    if (ok) {
+        ok = data.Read("FileName", fileName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The FileName parameter is compulsory");
+        }
+    }
+    uint32 size = RING_FILE_LOGGER_DEFAULT_SIZE;
+    if (ok) {
+        if (!data.Read("Size", size)) {
+            size = RING_FILE_LOGGER_DEFAULT_SIZE;
+        }
+        ok = (size >= RING_FILE_LOGGER_MIN_SIZE);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Size shall be at least %u bytes", RING_FILE_LOGGER_MIN_SIZE);
+        }
+    }
+    if (ok) {
+        ok = (header == NULL_PTR(RingFileLoggerHeader *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The RingFileLogger was already initialised");
+        }
+    }
+    const uint32 dataSize = ((size - RING_FILE_LOGGER_HEADER_SIZE) / RING_FILE_LOGGER_ALIGNMENT) * RING_FILE_LOGGER_ALIGNMENT;
+    if (ok) {
+        ok = file.Open(fileName.Buffer(), RING_FILE_LOGGER_HEADER_SIZE + dataSize);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to map the file %s", fileName.Buffer());
+        }
+    }
+    if (ok) {
+        char8 *memory = static_cast<char8 *>(file.GetMemory());
+        /*lint -e{927} -e{826} [MISRA C++ Rule 5-2-7]. Justification: the header is at the beginning of the (page aligned) file.*/
+        header = reinterpret_cast<RingFileLoggerHeader *>(memory);
+        dataArea = &memory[RING_FILE_LOGGER_HEADER_SIZE];
+        //Append to the existing records if the file is valid and has the same size.
+        bool valid = (header->magic == RING_FILE_LOGGER_MAGIC);
+        if (valid) {
+            valid = ((header->version == RING_FILE_LOGGER_VERSION) && (header->headerSize == RING_FILE_LOGGER_HEADER_SIZE));
+        }
+        if (valid) {
+            valid = (header->dataSize == dataSize);
+        }
+        if (valid) {
+            valid = ((header->headOffset >= header->tailOffset) && ((header->headOffset - header->tailOffset) <= dataSize));
+        }
+        if (valid) {
+            REPORT_ERROR(ErrorManagement::Information, "Appending to the ring log file %s", fileName.Buffer());
+        }
+        else {
+            header->version = RING_FILE_LOGGER_VERSION;
+            header->headerSize = RING_FILE_LOGGER_HEADER_SIZE;
+            header->dataSize = dataSize;
+            header->headOffset = 0u;
+            header->tailOffset = 0u;
+            header->nextSequence = 0u;
+            header->magic = RING_FILE_LOGGER_MAGIC;
+            REPORT_ERROR(ErrorManagement::Information, "Created the ring log file %s with %u bytes", fileName.Buffer(), file.GetSize());
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(RingFileLogger, "1.0")
+
+}
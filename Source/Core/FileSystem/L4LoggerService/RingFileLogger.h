@@ -0,0 +1,298 @@
+/**
+ * @file RingFileLogger.h
+ * @brief Header file for class RingFileLogger
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RingFileLogger
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L4LOGGERSERVICE_RINGFILELOGGER_H_
+#define L4LOGGERSERVICE_RINGFILELOGGER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "LoggerConsumerI.h"
+#include "MemoryMappedFile.h"
+#include "Object.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Identifies a ring log file ("MRLG").
+ */
+static const uint32 RING_FILE_LOGGER_MAGIC = 0x474C524Du;
+
+/**
+ * Version of the ring log file format.
+ */
+static const uint32 RING_FILE_LOGGER_VERSION = 1u;
+
+/**
+ * Size in bytes reserved for the RingFileLoggerHeader at the beginning of the file.
+ */
+static const uint32 RING_FILE_LOGGER_HEADER_SIZE = 64u;
+
+/**
+ * Identifies a committed log record.
+ */
+static const uint32 RING_FILE_LOGGER_RECORD_MAGIC = 0x43455252u;
+
+/**
+ * Identifies the padding written when a record does not fit before the end of the data area.
+ */
+static const uint32 RING_FILE_LOGGER_WRAP_MAGIC = 0x50415257u;
+
+/**
+ * Records are aligned to this number of bytes.
+ */
+static const uint32 RING_FILE_LOGGER_ALIGNMENT = 8u;
+
+/**
+ * Maximum number of characters stored for the file, function, class and object names.
+ */
+static const uint32 RING_FILE_LOGGER_MAX_NAME_SIZE = 127u;
+
+/**
+ * Default size in bytes of the ring log file.
+ */
+static const uint32 RING_FILE_LOGGER_DEFAULT_SIZE = 16777216u;
+
+/**
+ * Minimum size in bytes of the ring log file.
+ */
+static const uint32 RING_FILE_LOGGER_MIN_SIZE = 4096u;
+
+/**
+ * @brief Header at the beginning of a ring log file.
+ * @details The offsets are monotonic, i.e. they count all the bytes ever written to the data area and the position
+ * in the data area is the offset modulo dataSize. The records between tailOffset and headOffset are always complete.
+ */
+struct RingFileLoggerHeader {
+    /**
+     * RING_FILE_LOGGER_MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * RING_FILE_LOGGER_VERSION.
+     */
+    uint32 version;
+
+    /**
+     * Offset of the data area from the beginning of the file (RING_FILE_LOGGER_HEADER_SIZE).
+     */
+    uint32 headerSize;
+
+    /**
+     * Size in bytes of the data area.
+     */
+    uint32 dataSize;
+
+    /**
+     * Offset where the next record is to be written.
+     */
+    volatile uint64 headOffset;
+
+    /**
+     * Offset of the oldest record.
+     */
+    volatile uint64 tailOffset;
+
+    /**
+     * Sequence number of the next record.
+     */
+    volatile uint64 nextSequence;
+};
+
+/**
+ * @brief Fixed size part of a log record. The fileName, functionName, className, objectName and message follow,
+ * each terminated by a '\0'. The record is padded to a multiple of RING_FILE_LOGGER_ALIGNMENT.
+ * @details Wrap records only have a valid magic and size.
+ */
+struct RingFileLoggerRecord {
+    /**
+     * RING_FILE_LOGGER_RECORD_MAGIC or RING_FILE_LOGGER_WRAP_MAGIC.
+     */
+    uint32 magic;
+
+    /**
+     * Total size in bytes of the record, including the strings and the padding.
+     */
+    uint32 size;
+
+    /**
+     * Sequence number of the record.
+     */
+    uint64 sequence;
+
+    /**
+     * ErrorManagement::ErrorInformation::hrtTime.
+     */
+    uint64 hrtTime;
+
+    /**
+     * ErrorManagement::ErrorInformation::objectPointer.
+     */
+    uint64 objectPointer;
+
+    /**
+     * ErrorManagement::ErrorInformation::timeSeconds.
+     */
+    int32 timeSeconds;
+
+    /**
+     * ErrorManagement::ErrorInformation::header.errorType.
+     */
+    uint32 errorType;
+
+    /**
+     * ErrorManagement::ErrorInformation::header.lineNumber.
+     */
+    int16 lineNumber;
+
+    /**
+     * ErrorManagement::ErrorInformation::header.isObject.
+     */
+    uint8 isObject;
+
+    /**
+     * Padding.
+     */
+    uint8 reserved0;
+
+    /**
+     * Length of the fileName (without the '\0').
+     */
+    uint16 fileNameSize;
+
+    /**
+     * Length of the functionName (without the '\0').
+     */
+    uint16 functionNameSize;
+
+    /**
+     * Length of the className (without the '\0').
+     */
+    uint16 classNameSize;
+
+    /**
+     * Length of the objectName (without the '\0').
+     */
+    uint16 objectNameSize;
+
+    /**
+     * Length of the message (without the '\0').
+     */
+    uint16 messageSize;
+
+    /**
+     * Padding.
+     */
+    uint16 reserved1;
+};
+
+/**
+ * Maximum size of a record, i.e. with names of RING_FILE_LOGGER_MAX_NAME_SIZE characters and a message of MAX_ERROR_MESSAGE_SIZE - 1 characters.
+ */
+static const uint32 RING_FILE_LOGGER_MAX_RECORD_SIZE = ((((static_cast<uint32>(sizeof(RingFileLoggerRecord)) + (4u * (RING_FILE_LOGGER_MAX_NAME_SIZE + 1u)))
+        + MAX_ERROR_MESSAGE_SIZE) + (RING_FILE_LOGGER_ALIGNMENT - 1u)) / RING_FILE_LOGGER_ALIGNMENT) * RING_FILE_LOGGER_ALIGNMENT;
+
+/**
+ * @brief A LoggerConsumerI which writes compact binary log records into a preallocated memory-mapped ring file.
+ * @details The log messages are not formatted. Each message is copied as a RingFileLoggerRecord (followed by its strings)
+ * into a file of fixed size which is mapped in memory, so that logging does not require any system call and the records
+ * survive a crash of the process (the operating system writes the mapped memory to the file).
+ * When the file is full the oldest records are overwritten. A record is only made visible (by moving the RingFileLoggerHeader::headOffset)
+ * after being completely written, so that a crash while writing cannot corrupt the file.
+ *
+ * If the file already exists and has the same size, the new records are appended to the existing ones.
+ * The file can be decoded with the RingFileLogReader (see the MARTeLogReader application).
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +RingFileLogger = {
+ *     Class = RingFileLogger
+ *     FileName = "/tmp/MARTe.log.bin" //Compulsory. The name of the ring log file.
+ *     Size = 16777216 //Optional. Size in bytes of the ring log file (>= RING_FILE_LOGGER_MIN_SIZE). Default is RING_FILE_LOGGER_DEFAULT_SIZE.
+ * }
+ * </pre>
+ */
+class RingFileLogger: public Object, public LoggerConsumerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     */
+    RingFileLogger();
+
+    /**
+     * @brief Destructor. Flushes and closes the ring log file.
+     */
+    virtual ~RingFileLogger();
+
+    /**
+     * @brief Writes the logPage as a record in the ring log file (see class description).
+     * @param logPage the log message to be written.
+     */
+    virtual void ConsumeLogMessage(LoggerPage *logPage);
+
+    /**
+     * @brief Calls Object::Initialise, reads the parameters (see class description) and maps the ring log file.
+     * @param[in] data see Object::Initialise.
+     * @return true if Object::Initialise returns true, all the parameters are valid and the file could be mapped.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+private:
+
+    /**
+     * @brief Moves the tailOffset forward until \a nOfBytes can be written at the headOffset without overwriting any valid record.
+     * @param[in] nOfBytes the number of bytes to be written.
+     */
+    void Reserve(const uint32 nOfBytes);
+
+    /**
+     * The memory mapped ring log file.
+     */
+    MemoryMappedFile file;
+
+    /**
+     * The header of the ring log file.
+     */
+    RingFileLoggerHeader *header;
+
+    /**
+     * The data area of the ring log file.
+     */
+    char8 *dataArea;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L4LOGGERSERVICE_RINGFILELOGGER_H_ */
@@ -29,6 +29,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamMemoryReference.h"
 #include "UDPLogger.h"
 
 /*---------------------------------------------------------------------------*/
@@ -41,20 +44,80 @@
 namespace MARTe {
 UDPLogger::UDPLogger() :
         Object(), LoggerConsumerI() {
+    mtu = UDP_LOGGER_DEFAULT_MTU;
+    batchSize = UDP_LOGGER_DEFAULT_BATCH_SIZE;
+    flushPeriodTicks = 0u;
+    firstEntryCounter = 0u;
+    datagramsMemory = NULL_PTR(char8 *);
+    datagrams = NULL_PTR(const char8 **);
+    datagramSizes = NULL_PTR(uint32 *);
+    nOfDatagrams = 0u;
+    entryBuffer = NULL_PTR(char8 *);
 }
 
 /*lint -e{1551} the destructor must guarantee that the socket is closed.*/
 UDPLogger::~UDPLogger() {
+    Flush();
     if (!udpSocket.Close()) {
         REPORT_ERROR(ErrorManagement::Warning, "Failed to close the UDP socket");
     }
+    if (datagramsMemory != NULL_PTR(char8 *)) {
+        delete[] datagramsMemory;
+    }
+    if (datagrams != NULL_PTR(const char8 **)) {
+        delete[] datagrams;
+    }
+    if (datagramSizes != NULL_PTR(uint32 *)) {
+        delete[] datagramSizes;
+    }
+    if (entryBuffer != NULL_PTR(char8 *)) {
+        delete[] entryBuffer;
+    }
 }
 
 void UDPLogger::ConsumeLogMessage(LoggerPage * const logPage) {
-    StreamString logMsg;
-    PrintToStream(logPage, logMsg);
-    uint32 msgSize = static_cast<uint32>(logMsg.Size());
-    (void) udpSocket.Write(logMsg.Buffer(), msgSize);
+    if (entryBuffer != NULL_PTR(char8 *)) {
+        StreamMemoryReference entry(entryBuffer, mtu);
+        PrintToStream(logPage, entry);
+        uint32 entrySize = static_cast<uint32>(entry.Size());
+        //Try to pack the message (separated by a new line) in the current datagram...
+        bool packed = false;
+        if (nOfDatagrams > 0u) {
+            uint32 current = (nOfDatagrams - 1u);
+            uint32 used = datagramSizes[current];
+            packed = ((used + 1u + entrySize) <= mtu);
+            if (packed) {
+                char8 *datagram = &datagramsMemory[current * mtu];
+                datagram[used] = '\n';
+                (void) MemoryOperationsHelper::Copy(&datagram[used + 1u], entryBuffer, entrySize);
+                datagramSizes[current] = (used + 1u + entrySize);
+            }
+        }
+        //...otherwise start a new one.
+        if (!packed) {
+            if (nOfDatagrams == batchSize) {
+                Flush();
+            }
+            if (nOfDatagrams == 0u) {
+                firstEntryCounter = HighResolutionTimer::Counter();
+            }
+            (void) MemoryOperationsHelper::Copy(&datagramsMemory[nOfDatagrams * mtu], entryBuffer, entrySize);
+            datagramSizes[nOfDatagrams] = entrySize;
+            nOfDatagrams++;
+        }
+        if ((HighResolutionTimer::Counter() - firstEntryCounter) >= flushPeriodTicks) {
+            Flush();
+        }
+    }
+}
+
+void UDPLogger::Flush() {
+    if (nOfDatagrams > 0u) {
+        uint32 nOfDatagramsToWrite = nOfDatagrams;
+        //Errors are not reported so that the failure to log does not generate more log messages.
+        (void) udpSocket.WriteDatagrams(datagrams, datagramSizes, nOfDatagramsToWrite);
+        nOfDatagrams = 0u;
+    }
 }
 
 bool UDPLogger::Initialise(StructuredDataI &data) {
@@ -73,6 +136,55 @@ bool UDPLogger::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "The Port parameter is compulsory");
         }
     }
+    if (ok) {
+        if (!data.Read("MTU", mtu)) {
+            mtu = UDP_LOGGER_DEFAULT_MTU;
+        }
+        ok = (mtu > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The MTU shall be greater than zero");
+        }
+    }
+    if (ok) {
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = UDP_LOGGER_DEFAULT_BATCH_SIZE;
+        }
+        ok = (batchSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The BatchSize shall be greater than zero");
+        }
+    }
+    if (ok) {
+        //The memory of all the datagrams is allocated at once.
+        ok = (batchSize <= (0xFFFFFFFFu / mtu));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The BatchSize * MTU shall fit in a uint32");
+        }
+    }
+    if (ok) {
+        uint32 flushPeriod;
+        if (!data.Read("FlushPeriod", flushPeriod)) {
+            flushPeriod = UDP_LOGGER_DEFAULT_FLUSH_PERIOD;
+        }
+        flushPeriodTicks = (static_cast<uint64>(flushPeriod) * HighResolutionTimer::Frequency()) / 1000u;
+    }
+    if (ok) {
+        ok = (entryBuffer == NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "The UDPLogger was already initialised");
+        }
+    }
+    if (ok) {
+        datagramsMemory = new char8[batchSize * mtu];
+        datagrams = new const char8*[batchSize];
+        datagramSizes = new uint32[batchSize];
+        entryBuffer = new char8[mtu];
+        uint32 i;
+        for (i = 0u; i < batchSize; i++) {
+            datagrams[i] = &datagramsMemory[i * mtu];
+            datagramSizes[i] = 0u;
+        }
+    }
     if (ok) {
         ok = udpSocket.Open();
     }
@@ -39,9 +39,29 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Default maximum size in bytes of each datagram (Ethernet MTU minus the IPv4 and UDP headers).
+ */
+static const uint32 UDP_LOGGER_DEFAULT_MTU = 1472u;
+
+/**
+ * Default maximum number of datagrams to buffer before transmitting.
+ */
+static const uint32 UDP_LOGGER_DEFAULT_BATCH_SIZE = 16u;
+
+/**
+ * Default maximum time in milliseconds that a log message is buffered.
+ */
+static const uint32 UDP_LOGGER_DEFAULT_FLUSH_PERIOD = 100u;
+
 /**
  * @brief A LoggerConsumerI which outputs the log messages to a UDP socket.
- * @details The configuration syntax is (names are only given as an example):
+ * @details The log messages are formatted into preallocated datagrams. Consecutive messages are packed
+ * (separated by a new line) in the same datagram up to MTU bytes and the datagrams are only transmitted
+ * (see BasicUDPSocket::WriteDatagrams) when BatchSize datagrams are full, when FlushPeriod has elapsed since
+ * the oldest buffered message, or when the LoggerService has no more pending messages (see Flush).
+ *
+ * The configuration syntax is (names are only given as an example):
  * <pre>
  * +UDPLogger = {
  *     Class = UDPLogger
@@ -49,6 +69,11 @@ namespace MARTe {
  *     Port = 44444 //Compulsory. The port of the destination where the logs are to be sent to.
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
+ *     MTU = 1472 //Optional. Maximum size in bytes of each datagram. Longer log messages are truncated. Default is UDP_LOGGER_DEFAULT_MTU.
+ *     BatchSize = 16 //Optional. Maximum number of datagrams to buffer before transmitting. Default is UDP_LOGGER_DEFAULT_BATCH_SIZE.
+ *                    //BatchSize * MTU bytes are allocated, which shall fit in a uint32.
+ *     FlushPeriod = 100 //Optional. Maximum time in milliseconds that a log message is buffered while the LoggerService is consuming messages.
+ *                       //If 0 each log message is immediately sent in its own datagram. Default is UDP_LOGGER_DEFAULT_FLUSH_PERIOD.
  * }
  * </pre>
  */
@@ -62,20 +87,26 @@ public:
     UDPLogger();
 
     /**
-     * @brief Destructor. Closes the socket.
+     * @brief Destructor. Sends any buffered log message and closes the socket.
      */
     virtual ~UDPLogger();
 
     /**
-     * @brief Prints the logPage in the socket output.
+     * @brief Prints the logPage in the current datagram (see class description).
+     * @details The buffered datagrams are sent if all the BatchSize datagrams are full or if the FlushPeriod has elapsed.
      * @param logPage the log message to be printed.
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
     /**
-     * @brief Calls Object::Initialise and reads the Format parameter (see class description) .
+     * @brief Sends all the buffered datagrams.
+     */
+    virtual void Flush();
+
+    /**
+     * @brief Calls Object::Initialise and reads the parameters (see class description). Allocates the datagrams memory.
      * @param[in] data see Object::Initialise.
-     * @return true if Object::Initialise returns true.
+     * @return true if Object::Initialise returns true and all the parameters are valid.
      */
     virtual bool Initialise(StructuredDataI &data);
 private:
@@ -85,6 +116,51 @@ private:
      */
     UDPSocket udpSocket;
 
+    /**
+     * Maximum size in bytes of each datagram.
+     */
+    uint32 mtu;
+
+    /**
+     * Maximum number of datagrams to buffer.
+     */
+    uint32 batchSize;
+
+    /**
+     * The FlushPeriod in HighResolutionTimer ticks.
+     */
+    uint64 flushPeriodTicks;
+
+    /**
+     * HighResolutionTimer counter when the oldest buffered log message was printed.
+     */
+    uint64 firstEntryCounter;
+
+    /**
+     * Memory of all the datagrams (batchSize * mtu bytes).
+     */
+    char8 *datagramsMemory;
+
+    /**
+     * Pointer to each of the datagrams in datagramsMemory.
+     */
+    const char8 **datagrams;
+
+    /**
+     * Number of bytes in each of the datagrams.
+     */
+    uint32 *datagramSizes;
+
+    /**
+     * Number of datagrams with buffered log messages.
+     */
+    uint32 nOfDatagrams;
+
+    /**
+     * Memory where each log message is printed before being packed into a datagram (mtu bytes).
+     */
+    char8 *entryBuffer;
+
 };
 }
 
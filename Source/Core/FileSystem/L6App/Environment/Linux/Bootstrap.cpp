@@ -37,6 +37,7 @@
 #include "ConfigurationDatabase.h"
 #include "File.h"
 #include "MessageI.h"
+#include "StreamMemoryReference.h"
 #include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -48,6 +49,18 @@ namespace MARTe {
  * The configuration file.
  */
 static File inputConfigurationFile;
+/**
+ * The memory mapped view of the configuration file (if the file could be mapped).
+ */
+static StreamMemoryReference *mappedConfigurationStream = NULL_PTR(StreamMemoryReference *);
+/**
+ * The memory mapped configuration file.
+ */
+static void *mappedConfiguration = MAP_FAILED;
+/**
+ * The size of the memory mapped configuration file.
+ */
+static size_t mappedConfigurationSize = 0u;
 /**
  * True while the application is to be running.
  */
@@ -61,6 +74,43 @@ static bool killApp = false;
  * The message to be sent when the application is stopped.
  */
 static ReferenceT<Message> stopMessage;
+/**
+ * Maps the (already opened) configuration file in read-only memory, so that the parser reads it directly from the page cache
+ * without intermediate copies. Returns NULL if the file cannot be mapped, in which case the File shall be read instead.
+ */
+static StreamMemoryReference *MapConfigurationFile() {
+    uint64 fileSize = inputConfigurationFile.Size();
+    bool ok = ((fileSize > 0u) && (fileSize < 0xFFFFFFFFu));
+    if (ok) {
+        mappedConfigurationSize = static_cast<size_t>(fileSize);
+        mappedConfiguration = mmap(NULL_PTR(void *), mappedConfigurationSize, PROT_READ, MAP_PRIVATE, inputConfigurationFile.GetReadHandle(), 0);
+        ok = (mappedConfiguration != MAP_FAILED);
+    }
+    if (ok) {
+        (void) madvise(mappedConfiguration, mappedConfigurationSize, MADV_SEQUENTIAL);
+        mappedConfigurationStream = new StreamMemoryReference(static_cast<const char8 *>(mappedConfiguration), static_cast<uint32>(mappedConfigurationSize));
+    }
+    else {
+        mappedConfigurationSize = 0u;
+    }
+    return mappedConfigurationStream;
+}
+
+/**
+ * Releases the memory mapped configuration file (see MapConfigurationFile).
+ */
+static void UnmapConfigurationFile() {
+    if (mappedConfigurationStream != NULL_PTR(StreamMemoryReference *)) {
+        delete mappedConfigurationStream;
+        mappedConfigurationStream = NULL_PTR(StreamMemoryReference *);
+    }
+    if (mappedConfiguration != MAP_FAILED) {
+        (void) munmap(mappedConfiguration, mappedConfigurationSize);
+        mappedConfiguration = MAP_FAILED;
+        mappedConfigurationSize = 0u;
+    }
+}
+
 /**
  * Callback function for the signal (see Run below).
  */
@@ -131,12 +181,17 @@ ErrorManagement::ErrorType Bootstrap::GetConfigurationStream(StructuredDataI &lo
         }
     }
     if (ret) {
-        configurationStream = &inputConfigurationFile;
+        configurationStream = MapConfigurationFile();
+        if (configurationStream == NULL_PTR(StreamI *)) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Could not memory map %s. Reading it as a file.", filename.Buffer());
+            configurationStream = &inputConfigurationFile;
+        }
     }
     return ret;
 }
 
 ErrorManagement::ErrorType Bootstrap::Run() {
+    UnmapConfigurationFile();
     ErrorManagement::ErrorType ret = inputConfigurationFile.Close();
     if (ret) {
         mlockall(MCL_CURRENT | MCL_FUTURE);
@@ -51,6 +51,10 @@ LoggerConsumerI::~LoggerConsumerI() {
 
 }
 
+void LoggerConsumerI::Flush() {
+
+}
+
 void LoggerConsumerI::PrintToStream(LoggerPage * const logPage, BufferedStreamI &err) const {
     StreamString errorCodeStr;
     ErrorManagement::ErrorInformation errorInfo = logPage->errorInfo;
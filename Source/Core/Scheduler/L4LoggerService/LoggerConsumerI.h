@@ -62,6 +62,12 @@ public:
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage) = 0;
 
+    /**
+     * @brief This function is called after all the pending log messages have been consumed.
+     * @details Allows consumers that batch log messages to output any message that is still buffered. NOOP by default.
+     */
+    virtual void Flush();
+
 protected:
     /**
      * @brief Helper function which prints the log message into a stream.
@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "LoggerService.h"
 #include "ReferenceT.h"
 
@@ -42,19 +43,41 @@
 namespace MARTe {
 
 LoggerService::LoggerService() :
-        ReferenceContainer(), EmbeddedServiceMethodBinderI(), logThreadService(*this) {
+        ReferenceContainer(), EmbeddedServiceMethodBinderI(), LoggerNotifierI(), logThreadService(*this) {
     consumers = NULL_PTR(LoggerConsumerI **);
     logger = NULL_PTR(Logger *);
     nOfConsumers = 0u;
+    deferredFormatting = false;
+    rateLimit = 0u;
+    stopping = false;
+    waiting = 0;
+    if (!logEvent.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the logEvent");
+    }
 }
 
 /*lint -e{1551} -e{1740} the destructor must guarantee that the SingleThreadService. The logger is a singleton and is freed by the Logger class at the end of program execution*/
 LoggerService::~LoggerService() {
+    //Release the thread if it is waiting for new log entries.
+    stopping = true;
+    (void) logEvent.Post();
     if (logThreadService.Stop() != ErrorManagement::NoError) {
         if (logThreadService.Stop() != ErrorManagement::NoError) {
             REPORT_ERROR(ErrorManagement::Warning, "Could not Stop the logThreadService");
         }
     }
+    if ((deferredFormatting) && (logger != NULL_PTR(Logger *))) {
+        logger->SetDeferredFormatting(false);
+    }
+    if ((rateLimit > 0u) && (logger != NULL_PTR(Logger *))) {
+        logger->SetRateLimit(0u, 0u);
+    }
+    if (logger != NULL_PTR(Logger *)) {
+        if (logger->GetNotifier() == static_cast<LoggerNotifierI *>(this)) {
+            logger->SetNotifier(NULL_PTR(LoggerNotifierI *));
+        }
+    }
+    (void) logEvent.Close();
     if (consumers != NULL_PTR(LoggerConsumerI **)) {
         delete[] consumers;
     }
@@ -65,6 +88,9 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     uint32 cpuMask = 0x1u;
     uint32 stackSize = THREADS_DEFAULT_STACKSIZE;
     uint32 numberOfLogPages = DEFAULT_NUMBER_OF_LOG_PAGES;
+    uint32 deferredFormattingIn = 0u;
+    uint32 rateLimitIn = 0u;
+    uint32 rateLimitPeriod = 1000u;
     if (ok) {
         ok = data.Read("CPUs", cpuMask);
         if (!ok) {
@@ -85,6 +111,21 @@ bool LoggerService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Warning, "NumberOfLogPages must be > 0");
         }
     }
+    if (ok) {
+        (void) data.Read("DeferredFormatting", deferredFormattingIn);
+        ok = (deferredFormattingIn < 2u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "DeferredFormatting must be 0 or 1");
+        }
+    }
+    if (ok) {
+        (void) data.Read("RateLimit", rateLimitIn);
+        (void) data.Read("RateLimitPeriod", rateLimitPeriod);
+        ok = (rateLimitPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "RateLimitPeriod must be > 0");
+        }
+    }
     if (ok) {
         nOfConsumers = Size();
         ok = (nOfConsumers > 0u);
@@ -109,6 +150,15 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     }
     if (ok) {
         logger = Logger::Instance(numberOfLogPages);
+        deferredFormatting = (deferredFormattingIn == 1u);
+        if (deferredFormatting) {
+            logger->SetDeferredFormatting(true);
+        }
+        rateLimit = rateLimitIn;
+        if (rateLimit > 0u) {
+            logger->SetRateLimit(rateLimit, rateLimitPeriod);
+        }
+        logger->SetNotifier(this);
         logThreadService.SetStackSize(stackSize);
         logThreadService.SetCPUMask(cpuMask);
         logThreadService.SetName(GetName());
@@ -132,26 +182,54 @@ ErrorManagement::ErrorType LoggerService::Execute(ExecutionInfo & info) {
             //If terminating wait a couple of seconds for the log to flush before...
             Sleep::Sec(1.0F);
         }
-        uint32 i;
         if (consumers != NULL_PTR(LoggerConsumerI **)) {
-            LoggerPage *page = logger->GetLogEntry();
-            while (page != NULL_PTR(LoggerPage *)) {
-                for (i = 0u; (i < nOfConsumers); i++) {
-                    consumers[i]->ConsumeLogMessage(page);
-                }
-                logger->ReturnPage(page);
-                page = logger->GetLogEntry();
+            (void) ConsumeLogEntries();
+            for (uint32 i = 0u; (i < nOfConsumers); i++) {
+                consumers[i]->Flush();
             }
         }
         if (terminate) {
             //.. and after
             Sleep::Sec(1.0F);
         }
+        else if (!stopping) {
+            //Sleep until a new log entry is added. The event is reset before announcing that the thread is waiting, so that the Post
+            //of the first entry added afterwards is not lost.
+            (void) logEvent.Reset();
+            (void) Atomic::Exchange(&waiting, 1);
+            //The entries added before waiting was set did not post the logEvent. These are flushed in the next iteration.
+            if (!ConsumeLogEntries()) {
+                (void) logEvent.Wait(LOGGER_SERVICE_WAIT_TIMEOUT);
+            }
+            (void) Atomic::Exchange(&waiting, 0);
+        }
+        else {
+            //Stopping: do not wait on the logEvent (already posted by the destructor).
+            Sleep::Sec(1e-3F);
+        }
+    }
+    else {
+        Sleep::Sec(1e-3F);
     }
-    Sleep::Sec(1e-3F);
     return ErrorManagement::NoError;
 }
 
+bool LoggerService::ConsumeLogEntries() {
+    bool consumed = false;
+    if (consumers != NULL_PTR(LoggerConsumerI **)) {
+        LoggerPage *page = logger->GetLogEntry();
+        while (page != NULL_PTR(LoggerPage *)) {
+            for (uint32 i = 0u; (i < nOfConsumers); i++) {
+                consumers[i]->ConsumeLogMessage(page);
+            }
+            logger->ReturnPage(page);
+            consumed = true;
+            page = logger->GetLogEntry();
+        }
+    }
+    return consumed;
+}
+
 uint32 LoggerService::GetNumberOfLogPages() const {
     uint32 n = 0u;
     if (logger != NULL_PTR(Logger *)) {
@@ -168,6 +246,22 @@ uint32 LoggerService::GetStackSize() const {
     return logThreadService.GetStackSize();
 }
 
+bool LoggerService::IsDeferredFormatting() const {
+    return deferredFormatting;
+}
+
+uint32 LoggerService::GetRateLimit() const {
+    return rateLimit;
+}
+
+void LoggerService::LogEntryAdded() {
+    //Only the first entry added while the thread is waiting posts the logEvent. The other callers (possibly real-time threads) do not
+    //enter the EventSem, so that they cannot be blocked by (or wake) the lower priority logging thread more than once per drain.
+    if (Atomic::CompareAndSwap(&waiting, 1, 0)) {
+        (void) logEvent.Post();
+    }
+}
+
 CLASS_REGISTER(LoggerService, "1.0")
 
 }
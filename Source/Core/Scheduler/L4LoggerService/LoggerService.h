@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "Logger.h"
 #include "LoggerConsumerI.h"
 #include "ReferenceContainer.h"
@@ -42,10 +43,18 @@
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
+/**
+ * @brief The maximum time in milliseconds that the LoggerService thread waits for a new log entry before checking the Logger again.
+ */
+static const uint32 LOGGER_SERVICE_WAIT_TIMEOUT = 1000u;
+
 /**
  * @brief The LoggerService registers itself as a callback for the logging messages and
  * asynchronously offer these messages to all the registered LoggerConsumerI.
- * @details The configuration syntax is (names are only given as an example):
+ * @details The LoggerService registers itself as the Logger notifier (see Logger::SetNotifier), so that its thread
+ * sleeps until a new log entry is added and then offers all the pending log entries to the consumers.
+ *
+ * The configuration syntax is (names are only given as an example):
  *
  * <pre>
  * +LoggerService = {
@@ -53,6 +62,9 @@ namespace MARTe {
  *     CPUs = 0x1 //Compulsory. The CPU mask where the asynchronous thread will run.
  *     StackSize = 32768 //Optional. The stack size of the asynchronous thread.
  *     NumberOfLogPages = 128 //Optional. The number of log pages.
+ *     DeferredFormatting = 0 //Optional. If 1 the messages with parameters are formatted by the asynchronous thread (see Logger::SetDeferredFormatting).
+ *     RateLimit = 0 //Optional. Maximum number of messages logged for each call site in each RateLimitPeriod. 0 (default) disables the rate limiting (see Logger::SetRateLimit).
+ *     RateLimitPeriod = 1000 //Optional. The rate limiting period in milliseconds. Shall be > 0. Default is 1000.
  *     +LoggerConsumer1 = {
  *         Class = ALoggerConsumer
  *         ...
@@ -64,7 +76,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class LoggerService: public ReferenceContainer, public EmbeddedServiceMethodBinderI {
+class LoggerService: public ReferenceContainer, public EmbeddedServiceMethodBinderI, public LoggerNotifierI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -73,7 +85,7 @@ public:
 LoggerService    ();
 
     /**
-     * @brief Destructor. Stops the SingleThreadService callback function.
+     * @brief Destructor. Stops the SingleThreadService callback function and removes the Logger notifier.
      */
     virtual ~LoggerService();
 
@@ -86,9 +98,9 @@ LoggerService    ();
     virtual bool Initialise(StructuredDataI &data);
 
     /**
-     * @brief Callback function for the EmbeddedThread that polls data from the Logger.
-     * @details Polls data from the Logger and if a new log message is available calls ConsumeLogMessage on all
-     *  the registered consumers.
+     * @brief Callback function for the EmbeddedThread that consumes data from the Logger.
+     * @details Calls ConsumeLogMessage on all the registered consumers for all the pending log messages, then calls Flush on all the consumers and waits
+     *  until a new log message is added (see LogEntryAdded) or until LOGGER_SERVICE_WAIT_TIMEOUT elapses.
      * @param[in] info see EmbeddedServiceMethodBinderI
      * @return ErrorManagement::NoError.
      */
@@ -117,6 +129,29 @@ LoggerService    ();
      *   Initialise()
      */
     uint32 GetStackSize() const;
+
+    /**
+     * @brief Checks if the messages are formatted by the asynchronous thread.
+     * @return true if DeferredFormatting = 1.
+     * @pre
+     *   Initialise()
+     */
+    bool IsDeferredFormatting() const;
+
+    /**
+     * @brief Gets the maximum number of messages logged for each call site in each RateLimitPeriod.
+     * @return the RateLimit (0 if the rate limiting is disabled).
+     * @pre
+     *   Initialise()
+     */
+    uint32 GetRateLimit() const;
+
+    /**
+     * @brief Wakes the thread that consumes the log messages.
+     * @details Called by the Logger when a new log entry is added. The logEvent is only posted if the thread is waiting for
+     * new log entries and only by the first caller that finds it waiting.
+     */
+    virtual void LogEntryAdded();
 private:
 
     /**
@@ -138,6 +173,37 @@ private:
      * Number of consumers.
      */
     uint32 nOfConsumers;
+
+    /**
+     * True if the messages are formatted by the asynchronous thread.
+     */
+    bool deferredFormatting;
+
+    /**
+     * Maximum number of messages logged for each call site in each period (0 if the rate limiting is disabled).
+     */
+    uint32 rateLimit;
+
+    /**
+     * @brief Offers all the pending log entries to the consumers.
+     * @return true if at least one log entry was consumed.
+     */
+    bool ConsumeLogEntries();
+
+    /**
+     * Posted when a new log entry is added while the thread is waiting.
+     */
+    EventSem logEvent;
+
+    /**
+     * 1 while the thread is waiting (or about to wait) on the logEvent. Cleared by the first LogEntryAdded that posts the logEvent.
+     */
+    volatile int32 waiting;
+
+    /**
+     * True when the LoggerService is being destroyed (so that the thread no longer waits for new log entries).
+     */
+    volatile bool stopping;
 };
 }
 
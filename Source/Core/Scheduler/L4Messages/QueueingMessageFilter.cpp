@@ -29,6 +29,8 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "QueueingMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -43,74 +45,190 @@ namespace MARTe {
 QueueingMessageFilter::QueueingMessageFilter() :
         MessageFilter(true),
         Object() {
-    mutexSemQ.Create();
+    for (uint32 c = 0u; c < QueueingMessageFilterMaximumNumberOfChunks; c++) {
+        chunks[c] = NULL_PTR(QueueingMessageFilterNode *);
+    }
+    numberOfChunks = 0;
+    freeListHead = 0;
+    lastNode = 0;
+    firstNode = 0;
+    consumerWaiting = 0;
+    growSem.Create(false, true);
+    consumerSem.Create(false, true);
     if (!newMessagesAlarm.Create()) {
         REPORT_ERROR_FULL(ErrorManagement::InitialisationError, "EventSem::Create() has failed");
     }
+    //The queue always holds a (stub) node which precedes the oldest message.
+    int32 stub = AllocateNode();
+    if (stub != 0) {
+        GetNode(stub).next = 0;
+        lastNode = stub;
+        firstNode = stub;
+    }
+    else {
+        REPORT_ERROR_FULL(ErrorManagement::InitialisationError, "Failed to allocate the queue nodes");
+    }
 }
 
 QueueingMessageFilter::~QueueingMessageFilter() {
+    for (uint32 c = 0u; c < QueueingMessageFilterMaximumNumberOfChunks; c++) {
+        if (chunks[c] != NULL_PTR(QueueingMessageFilterNode *)) {
+            delete[] chunks[c];
+            chunks[c] = NULL_PTR(QueueingMessageFilterNode *);
+        }
+    }
+}
+
+int32 QueueingMessageFilter::AllocateNode() {
+    int32 nodeIndex = 0;
+    bool done = false;
+    while (!done) {
+        uint64 head = static_cast<uint64>(freeListHead);
+        uint32 index = static_cast<uint32>(head & 0xFFFFFFFFu);
+        uint32 numberOfNodes = static_cast<uint32>(numberOfChunks) * QueueingMessageFilterNodesPerChunk;
+        if (index == 0u) {
+            //No free nodes
+            done = !Grow();
+        }
+        //index > numberOfNodes can only be read if the head was changed while being read (non-atomic 64 bit read). Retry.
+        else if (index <= numberOfNodes) {
+            uint64 next = static_cast<uint64>(static_cast<uint32>(GetNode(static_cast<int32>(index)).nextFree));
+            uint64 newHead = (((head >> 32u) + 1u) << 32u) | next;
+            if (Atomic::CompareAndSwap(&freeListHead, static_cast<int64>(head), static_cast<int64>(newHead))) {
+                nodeIndex = static_cast<int32>(index);
+                done = true;
+            }
+        }
+        else {
+            Atomic::Pause();
+        }
+    }
+    return nodeIndex;
+}
 
+void QueueingMessageFilter::FreeNode(const int32 nodeIndex) {
+    bool done = false;
+    QueueingMessageFilterNode &node = GetNode(nodeIndex);
+    while (!done) {
+        uint64 head = static_cast<uint64>(freeListHead);
+        node.nextFree = static_cast<int32>(head & 0xFFFFFFFFu);
+        uint64 newHead = (((head >> 32u) + 1u) << 32u) | static_cast<uint64>(static_cast<uint32>(nodeIndex));
+        done = Atomic::CompareAndSwap(&freeListHead, static_cast<int64>(head), static_cast<int64>(newHead));
+    }
+}
+
+bool QueueingMessageFilter::Grow() {
+    ErrorManagement::ErrorType err = growSem.FastLock();
+    bool ok = err.ErrorsCleared();
+    if (ok) {
+        //Another thread may have grown the pool (or a node may have been freed) in the meanwhile.
+        if ((static_cast<uint64>(freeListHead) & 0xFFFFFFFFu) == 0u) {
+            uint32 chunkIdx = static_cast<uint32>(numberOfChunks);
+            ok = (chunkIdx < QueueingMessageFilterMaximumNumberOfChunks);
+            if (ok) {
+                chunks[chunkIdx] = new QueueingMessageFilterNode[QueueingMessageFilterNodesPerChunk];
+                //The chunk must be visible before any of its nodes can be read from the free list.
+                (void) Atomic::Exchange(&numberOfChunks, static_cast<int32>(chunkIdx + 1u));
+                uint32 firstIndex = (chunkIdx * QueueingMessageFilterNodesPerChunk) + 1u;
+                for (uint32 n = 0u; n < QueueingMessageFilterNodesPerChunk; n++) {
+                    chunks[chunkIdx][n].next = 0;
+                    FreeNode(static_cast<int32>(firstIndex + n));
+                }
+            }
+            else {
+                REPORT_ERROR_FULL(ErrorManagement::FatalError, "The maximum number of queued messages was reached");
+            }
+        }
+        growSem.FastUnLock();
+    }
+    return ok;
 }
 
 ErrorManagement::ErrorType QueueingMessageFilter::ConsumeMessage(ReferenceT<Message> &messageToTest) {
     ErrorManagement::ErrorType err;
-    err.timeout = !mutexSemQ.FastLock();
+    err.fatalError = !messageToTest.IsValid();
+    int32 nodeIndex = 0;
     if (err.ErrorsCleared()) {
-        err.fatalError = !messageQ.Insert(messageToTest, -1);
-
-        // handle the case of an element to an empty Q
-        uint32 queueSize = messageQ.Size();
-        if ((err.ErrorsCleared()) && (queueSize == 1u)) {
+        nodeIndex = AllocateNode();
+        err.fatalError = (nodeIndex == 0);
+    }
+    if (err.ErrorsCleared()) {
+        QueueingMessageFilterNode &node = GetNode(nodeIndex);
+        node.message = messageToTest;
+        node.next = 0;
+        int32 previous = Atomic::Exchange(&lastNode, nodeIndex);
+        //Exchange (and not a plain store) so that the link is visible before consumerWaiting is read.
+        (void) Atomic::Exchange(&GetNode(previous).next, nodeIndex);
+        if (consumerWaiting != 0) {
             err.timeout = !newMessagesAlarm.Post();
         }
-
-        mutexSemQ.FastUnLock();
     }
     return err;
 }
 
-ErrorManagement::ErrorType QueueingMessageFilter::GetMessage(ReferenceT<Message> &message,
-                                                             const TimeoutType &timeout) {
-    ErrorManagement::ErrorType err = mutexSemQ.FastLock();
-    bool locked = !err.timeout;
-
-    // handle the empty Q case
-    if (messageQ.Size() == 0u) {
-        if (err.ErrorsCleared()) {
-            err.fatalError = !newMessagesAlarm.Reset();
-        }
-        if (locked) {
-            mutexSemQ.FastUnLock();
-            locked = false;
-        }
-        if (err.ErrorsCleared()) {
-            err = newMessagesAlarm.Wait(timeout);
-        }
-        if (err.ErrorsCleared()) {
-            err = mutexSemQ.FastLock();
-            locked = !err.timeout;
-        }
+bool QueueingMessageFilter::PopMessage(ReferenceT<Message> &message) {
+    bool ok = (firstNode != 0);
+    int32 next = 0;
+    if (ok) {
+        next = GetNode(firstNode).next;
+        ok = (next != 0);
     }
+    if (ok) {
+        //The next node becomes the new stub.
+        QueueingMessageFilterNode &node = GetNode(next);
+        message = node.message;
+        node.message.RemoveReference();
+        FreeNode(firstNode);
+        firstNode = next;
+        ok = message.IsValid();
+    }
+    return ok;
+}
 
-    if (err.ErrorsCleared()) {
-        Reference ref = messageQ.Get(0u);
-
-        err.fatalError = !ref.IsValid();
-
-        if (err.ErrorsCleared()) {
-            if (messageQ.Delete(ref)) {
-                message = ref;
-                err.fatalError = !message.IsValid();
+ErrorManagement::ErrorType QueueingMessageFilter::GetMessage(ReferenceT<Message> &message,
+                                                             const TimeoutType &timeout) {
+    //The timeout applies to the whole call and not to each wait.
+    uint64 startCounter = HighResolutionTimer::Counter();
+    ErrorManagement::ErrorType err = consumerSem.FastLock(timeout);
+    bool locked = err.ErrorsCleared();
+    bool done = !locked;
+    while (!done) {
+        done = PopMessage(message);
+        if (!done) {
+            TimeoutType remainingTimeout = timeout;
+            if (timeout.IsFinite()) {
+                uint64 elapsed = (HighResolutionTimer::Counter() - startCounter);
+                uint64 delta = timeout.HighResolutionTimerTicks();
+                if (elapsed < delta) {
+                    remainingTimeout.SetTimeoutHighResolutionTimerTicks(delta - elapsed);
+                }
+                else {
+                    err.timeout = true;
+                }
+            }
+            if (err.ErrorsCleared()) {
+                err.fatalError = !newMessagesAlarm.Reset();
+            }
+            (void) Atomic::Exchange(&consumerWaiting, 1);
+            //Check again after announcing the wait, as a message may have been added in the meanwhile.
+            done = PopMessage(message);
+            if ((!done) && (err.ErrorsCleared())) {
+                err = newMessagesAlarm.Wait(remainingTimeout);
+            }
+            (void) Atomic::Exchange(&consumerWaiting, 0);
+            if (!err.ErrorsCleared()) {
+                //Last chance after a timeout.
+                if (PopMessage(message)) {
+                    err = ErrorManagement::NoError;
+                }
+                done = true;
             }
         }
     }
-
     if (locked) {
-        mutexSemQ.FastUnLock();
+        consumerSem.FastUnLock();
     }
     return err;
-
 }
 
 }
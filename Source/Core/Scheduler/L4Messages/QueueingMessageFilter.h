@@ -34,6 +34,7 @@
 
 #include "MessageFilter.h"
 #include "EventSem.h"
+#include "FastPollingMutexSem.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -41,9 +42,48 @@
 
 namespace MARTe {
 
+/**
+ * Number of nodes that are allocated each time the node pool of a QueueingMessageFilter grows.
+ */
+static const uint32 QueueingMessageFilterNodesPerChunk = 64u;
+
+/**
+ * Maximum number of node chunks, i.e. the maximum number of queued messages is
+ *  QueueingMessageFilterNodesPerChunk * QueueingMessageFilterMaximumNumberOfChunks - 1.
+ */
+static const uint32 QueueingMessageFilterMaximumNumberOfChunks = 256u;
+
+/**
+ * @brief A node of the QueueingMessageFilter queue.
+ */
+struct QueueingMessageFilterNode {
+    /**
+     * The queued message.
+     */
+    ReferenceT<Message> message;
+
+    /**
+     * Index + 1 of the next node in the queue (0 if this is the last node).
+     */
+    volatile int32 next;
+
+    /**
+     * Index + 1 of the next node in the free list (0 if this is the last free node).
+     */
+    volatile int32 nextFree;
+};
+
 /**
  * @brief Adds message to a queue.
  * @details Messages consumed by this filter are added to a queue. The queue is consumed by calling the GetMessage method.
+ *
+ * The queue is an intrusive multiple-producer single-consumer lock-free queue: ConsumeMessage atomically
+ *  exchanges the last node of the queue and then links it to the new node, so that senders never block each other.
+ *  The nodes are taken from a preallocated pool (lock-free free list with a version tag). The pool only
+ *  grows (under a lock) when all the nodes are in use.
+ *
+ * The GetMessage method is expected to be called by a single thread (e.g. the QueuedMessageI thread). Concurrent
+ *  calls are serialised.
  */
 class DLL_API QueueingMessageFilter: public MessageFilter, public Object {
 public:
@@ -68,7 +108,8 @@ public:
     /**
      * @brief Gets the oldest message from the queue or waits for a message to be available.
      * @param[out] message The oldest message available on the queue.
-     * @param[out] timeout The maximum time to wait for a message to be available on the queue.
+     * @param[out] timeout The maximum time to wait for a message to be available on the queue. This is the total time of the call,
+     * including the wait for other concurrent callers, and not the time of each wait on the semaphore.
      * @return ErrorManagement::NoError if the message can be successfully retrieved from the queue with-in the specified timeout.
      */
     ErrorManagement::ErrorType GetMessage(ReferenceT<Message> &message, const TimeoutType &timeout = TTInfiniteWait);
@@ -76,14 +117,76 @@ public:
 private:
 
     /**
-     * Holds the messages consumed by this QueueingMessageFilter
+     * @brief Gets the node with index \a nodeIndex + 1.
+     * @param[in] nodeIndex the node index + 1 (as stored in the queue and free list).
+     * @return the node.
+     */
+    inline QueueingMessageFilterNode &GetNode(const int32 nodeIndex);
+
+    /**
+     * @brief Gets a free node from the pool, growing the pool if required.
+     * @return the node index + 1 or 0 if the maximum number of nodes is in use.
+     */
+    int32 AllocateNode();
+
+    /**
+     * @brief Returns a node to the pool.
+     * @param[in] nodeIndex the node index + 1.
+     */
+    void FreeNode(const int32 nodeIndex);
+
+    /**
+     * @brief Allocates a new chunk of nodes and adds them to the free list.
+     * @return true if a new chunk was allocated or if, in the meanwhile, another thread has already freed nodes.
+     */
+    bool Grow();
+
+    /**
+     * @brief Removes the oldest message from the queue.
+     * @param[out] message the oldest message.
+     * @return true if there was a message in the queue.
+     */
+    bool PopMessage(ReferenceT<Message> &message);
+
+    /**
+     * The node chunks.
+     */
+    QueueingMessageFilterNode *chunks[QueueingMessageFilterMaximumNumberOfChunks];
+
+    /**
+     * The number of allocated chunks.
+     */
+    volatile int32 numberOfChunks;
+
+    /**
+     * The head of the free list: version tag in the upper 32 bits and node index + 1 in the lower 32 bits.
      */
-    ReferenceContainer messageQ;
+    volatile int64 freeListHead;
 
     /**
-     * Locks the adding/removing of messages to the queue
+     * Index + 1 of the last node added to the queue (written by the producers).
      */
-    FastPollingMutexSem mutexSemQ;
+    volatile int32 lastNode;
+
+    /**
+     * Index + 1 of the node that precedes the oldest message (only accessed by the consumer).
+     */
+    int32 firstNode;
+
+    /**
+     * Set (to 1) while the consumer is waiting for new messages.
+     */
+    volatile int32 consumerWaiting;
+
+    /**
+     * Serialises the growth of the node pool.
+     */
+    FastPollingMutexSem growSem;
+
+    /**
+     * Serialises concurrent calls to GetMessage.
+     */
+    FastPollingMutexSem consumerSem;
 
     /**
      * Wakes threads waiting on the queue
@@ -98,6 +201,10 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+QueueingMessageFilterNode &QueueingMessageFilter::GetNode(const int32 nodeIndex) {
+    uint32 index = static_cast<uint32>(nodeIndex) - 1u;
+    return chunks[index / QueueingMessageFilterNodesPerChunk][index % QueueingMessageFilterNodesPerChunk];
+}
 
 }
 
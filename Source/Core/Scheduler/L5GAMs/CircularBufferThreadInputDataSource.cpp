@@ -170,6 +170,8 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
     if (ret) {
         if (!data.Read("SleepInMutexSec", sleepInMutexSec)) {
             sleepInMutexSec = 1e-6F;
+            //No polling sleep was requested: spin for a bounded time and then park the waiting thread.
+            mutex.Create(false, true);
         }
     }
 
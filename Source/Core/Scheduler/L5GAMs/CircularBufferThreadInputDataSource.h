@@ -73,6 +73,7 @@ namespace MARTe {
  *     *ReceiverThreadPriority = 0-31 (the priority of the internal thread, default is 31)
  *     *ReceiverThreadStackSize = 0-31 (the stack size of the internal thread, default is THREADS_DEFAULT_STACKSIZE)
  *     *GetFirst = 0/1 (if 0, default, do not wait for the first valid buffer to arrive)
+ *     *SleepInMutexSec = 1e-6 (the time to sleep while polling the internal mutex. If not specified the mutex is adaptive, see FastPollingMutexSem::Create)
  *     Signals = {
  *         *InternalTimeStamp = {
  *             Type = uint64
@@ -119,6 +120,7 @@ public:
      * @details Initialises the following parameters:
      *   CpuMask: a mask to select the cpus where the internal thread is allowed to be executed (default 0xFFFFu)\n
      *   ReceiverThreadPriority: the priority of the internal thread between 0 (min) and 31 (max) (default 31)\n
+     *   SleepInMutexSec: the time to sleep while polling the internal mutex (default: adaptive mutex which spins and then parks the thread)\n
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -194,6 +194,7 @@ void GAMScheduler::CustomPrepareNextState() {
                     rtThreadInfo[nextBuffer][i].executables = nextState->threads[i].executables;
                     rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                     rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
+                    rtThreadInfo[nextBuffer][i].cycleTimeTicks = nextState->threads[i].cycleTimeTicks;
                     rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
                     multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
                     multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
@@ -239,17 +240,21 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
                     }
                 }
             }
-            uint32 absTime = 0u;
+            uint64 nowTicks = HighResolutionTimer::Counter();
+            uint64 absTime = 0u;
             if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
-                uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                absTime = static_cast<uint32>(ticksToTime);  //us
+                absTime = (nowTicks - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
             }
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            if (!MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy)) {
+            if (rtThreadInfo[idx][threadNumber].cycleTimeTicks != NULL_PTR(uint64 *)) {
+                *rtThreadInfo[idx][threadNumber].cycleTimeTicks = absTime;
+            }
+            else if (rtThreadInfo[idx][threadNumber].cycleTime != NULL_PTR(uint32 *)) {
+                *rtThreadInfo[idx][threadNumber].cycleTime = TicksToMicroSeconds(absTime, ticksToMicroSecondsScale);
+            }
+            else {
                 REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
             }
-            rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
+            rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = nowTicks;
         }
         else {
             REPORT_ERROR(ErrorManagement::FatalError, "RTThreadParam is NULL.");
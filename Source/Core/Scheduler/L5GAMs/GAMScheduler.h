@@ -56,9 +56,13 @@ struct RTThreadParam {
      */
     uint32 numberOfExecutables;
     /**
-     * The cycle time
+     * The cycle time (micro-seconds)
      */
     uint32* cycleTime;
+    /**
+     * The cycle time (HighResolutionTimer ticks). If not NULL it is used instead of cycleTime.
+     */
+    uint64* cycleTimeTicks;
     /**
      * HRT value last cycle time
      */
@@ -29,6 +29,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MemoryMapAsyncOutputBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -53,8 +54,7 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     if (!sem.Reset()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not Reset the EventSem.");
     }
-    fastSem.Create();
-    posted = false;
+    consumerWaiting = 0;
     destroying = false;
     ignoreBufferOverrun = false;
 }
@@ -62,13 +62,11 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
 /*lint -e{1551} the destructor must guarantee that the SingleThreadService is stopped and that buffer memory is freed.*/
 MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
     if (!sem.IsClosed()) {
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            destroying = true;
-            fastSem.FastUnLock();
-            if (!sem.Post()) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
-            }
-            posted = true;
+        destroying = true;
+        //Full barrier so that the BufferLoop sees destroying before the sem is posted.
+        (void) Atomic::Exchange(&consumerWaiting, 0);
+        if (!sem.Post()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
         }
         if (!sem.Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Close the EventSem.");
@@ -153,7 +151,7 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
             bufferMemoryMap[i].index = i;
-            bufferMemoryMap[i].toConsume = false;
+            bufferMemoryMap[i].toConsume = 0;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
             for (c = 0u; (c < numberOfCopies) && (ok); c++) {
@@ -167,7 +165,7 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
         service.SetCPUMask(cpuMask);
     }
     if (ok) {
-        readSynchIdx = numberOfBuffers - 1u;
+        readSynchIdx = 0u;
         StreamString serviceName;
         if (serviceName.Printf("%s:MemoryMapAsyncOutputBroker", dataSourceIn.GetName())) {
             service.SetName(serviceName.Buffer());
@@ -194,7 +192,7 @@ bool MemoryMapAsyncOutputBroker::Execute() {
 
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry *)) {
         if (!ignoreBufferOverrun) {
-            if (bufferMemoryMap[writeIdx].toConsume) {
+            if (bufferMemoryMap[writeIdx].toConsume != 0) {
                 //Buffer overrun...
                 const uint32 idx = writeIdx;
                 REPORT_ERROR(ErrorManagement::FatalError, "Buffer overrun for index %d ", idx);
@@ -208,20 +206,18 @@ bool MemoryMapAsyncOutputBroker::Execute() {
                 ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
             }
         }
-        bufferMemoryMap[writeIdx].toConsume = true;
-        if (ret) {
-            //Fast semaphore to increment writeIdx and to atomically Post the semaphore which warns the BufferLoop that there might be new data to be consumed.
-            ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        }
+        //Publish the buffer. The exchange is a full barrier, so the copies above are visible to the BufferLoop before the flag.
+        (void) Atomic::Exchange(&bufferMemoryMap[writeIdx].toConsume, 1);
         writeIdx++;
         if (writeIdx == numberOfBuffers) {
             writeIdx = 0u;
         }
         if (ret) {
-            ret = sem.Post();
-            posted = true;
+            //Only wake the BufferLoop if it is (or is about to be) waiting on the semaphore.
+            if (Atomic::Exchange(&consumerWaiting, 0) != 0) {
+                ret = sem.Post();
+            }
         }
-        fastSem.FastUnLock();
     }
     return ret;
 }
@@ -230,67 +226,55 @@ bool MemoryMapAsyncOutputBroker::Execute() {
 ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo & info) {
     ErrorManagement::ErrorType err;
     if (info.GetStage() == ExecutionInfo::MainStage) {
-        int32 synchStopIdx = 0;
-        if (fastSem.FastLock() == ErrorManagement::NoError) {
-            //Always stay preTriggerBuffers behind from the writeIdx so that we don't lose the pre-trigger buffers
-            synchStopIdx = static_cast<int32>(writeIdx);
-        }
-        fastSem.FastUnLock();
-
-        //Have to treat the special case when only one buffer is configured
-        if (numberOfBuffers == 1u) {
-            readSynchIdx = 0u;
-            synchStopIdx = 1;
-        }
         bool ret = true;
-        //Check all the buffers until writeIdx - preTriggerBuffers (inclusive)
-        while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
-            if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry *)) {
-                if (bufferMemoryMap[readSynchIdx].toConsume) {
-                    uint32 c;
-                    for (c = 0u; (c < numberOfCopies) && (ret); c++) {
-                        //Copy from the buffer to the DataSource memory
-                        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-                            ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
-                        }
-                    }
-                    if (ret) {
-                        if (dataSourceRef.IsValid()) {
-                            //Make sure that the dataSourceRef consumes this data.
-                            ret = dataSourceRef->Synchronise();
-                        }
-                    }
-                    bufferMemoryMap[readSynchIdx].toConsume = false;
+        bool validBuffer = (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry *));
+        //Consume all the buffers that were published by the Execute method.
+        /*lint -e{613} bufferMemoryMap cannot be NULL as otherwise validBuffer would be false*/
+        while ((validBuffer) && (ret) && (bufferMemoryMap[readSynchIdx].toConsume != 0)) {
+            uint32 c;
+            for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+                //Copy from the buffer to the DataSource memory
+                if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
+                    ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[readSynchIdx].mem[c], copyTable[c].copySize);
                 }
-                readSynchIdx++;
-                if (numberOfBuffers > 1u) {
-                    if (readSynchIdx == numberOfBuffers) {
-                        readSynchIdx = 0u;
-                    }
+            }
+            if (ret) {
+                if (dataSourceRef.IsValid()) {
+                    //Make sure that the dataSourceRef consumes this data.
+                    ret = dataSourceRef->Synchronise();
                 }
             }
+            //Release the buffer back to the Execute method.
+            (void) Atomic::Exchange(&bufferMemoryMap[readSynchIdx].toConsume, 0);
+            readSynchIdx++;
+            if (readSynchIdx == numberOfBuffers) {
+                readSynchIdx = 0u;
+            }
         }
 
         if (ret) {
             //Wait for new data to be available from the real-time thread.
             if (!destroying) {
-                err = sem.Wait(TTInfiniteWait);
+                err.fatalError = !sem.Reset();
+                if (err.ErrorsCleared()) {
+                    //Announce that the BufferLoop is going to sleep and check again for buffers published before the announcement.
+                    (void) Atomic::Exchange(&consumerWaiting, 1);
+                    bool dataAvailable = false;
+                    if (validBuffer) {
+                        /*lint -e{613} bufferMemoryMap cannot be NULL as otherwise validBuffer would be false*/
+                        dataAvailable = (bufferMemoryMap[readSynchIdx].toConsume != 0);
+                    }
+                    if ((!dataAvailable) && (!destroying)) {
+                        err = sem.Wait(TTInfiniteWait);
+                    }
+                    (void) Atomic::Exchange(&consumerWaiting, 0);
+                }
             }
             else {
                 Sleep::Sec(0.1F);
             }
-            if (err.ErrorsCleared()) {
-                //Only reset the semaphore if it was not posted in-between the Wait exit and now...
-                if (fastSem.FastLock() == ErrorManagement::NoError) {
-                    if (!posted) {
-                        err.fatalError = !sem.Reset();
-                    }
-                    if (destroying) {
-                        err = ErrorManagement::Completed;
-                    }
-                    posted = false;
-                }
-                fastSem.FastUnLock();
+            if (destroying) {
+                err = ErrorManagement::Completed;
             }
         }
     }
@@ -38,6 +38,11 @@
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
+/**
+ * Size (in bytes) used to keep the variables shared between the producer and the consumer on different cache lines.
+ */
+#define MEMORY_MAP_ASYNC_OUTPUT_BROKER_CACHE_LINE_SIZE 64u
+
 namespace MARTe {
 /**
  * @brief Structure which describes a page of memory.
@@ -50,9 +55,9 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
     MARTe::uint32 index;
 
     /**
-     * Data ready to be consumed?
+     * Data ready to be consumed? (1 if true). Only set by the producer (Execute) and only cleared by the consumer (BufferLoop).
      */
-    bool toConsume;
+    volatile int32 toConsume;
 
     /**
      * Signal addresses
@@ -65,6 +70,10 @@ struct MemoryMapAsyncOutputBrokerBufferEntry {
  * in the context of a different thread (SingleThreadService).
  *
  * Only one GAM is allowed to interact with this MemoryMapAsyncOutputBroker (an IOGAM can be used to collate all the signals).
+ *
+ * The buffers are handed over to the consumer thread through a single-producer/single-consumer ring. No lock is taken by the real-time
+ * thread: each buffer is published by atomically setting its toConsume flag and the consumer thread is only woken up (i.e. the EventSem is
+ * only posted) when it has announced that it is going to sleep.
  */
 class MemoryMapAsyncOutputBroker: public MemoryMapBroker {
 public:
@@ -191,29 +200,39 @@ private:
     uint32 numberOfBuffers;
 
     /**
-     * The current index where the Execute method is writing to.
+     * Keeps the producer owned index on a different cache line from the consumer owned variables.
+     */
+    char8 producerPadding[MEMORY_MAP_ASYNC_OUTPUT_BROKER_CACHE_LINE_SIZE];
+
+    /**
+     * The current index where the Execute method is writing to. Only accessed by the producer.
      */
     uint32 writeIdx;
 
     /**
-     * The read index where the BufferLoop is reading from.
+     * Keeps the consumer owned index on a different cache line from the producer owned variables.
+     */
+    char8 consumerPadding[MEMORY_MAP_ASYNC_OUTPUT_BROKER_CACHE_LINE_SIZE];
+
+    /**
+     * The read index where the BufferLoop is reading from. Only accessed by the consumer.
      */
     uint32 readSynchIdx;
 
     /**
-     * Semaphore that synchronises the Execute and the BufferLoop methods.
+     * Keeps the consumerWaiting flag on a different cache line from the consumer owned index.
      */
-    EventSem sem;
+    char8 waitingPadding[MEMORY_MAP_ASYNC_OUTPUT_BROKER_CACHE_LINE_SIZE];
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Set to 1 by the BufferLoop before blocking on the sem. The Execute method only posts the sem if it can atomically clear this flag.
      */
-    FastPollingMutexSem fastSem;
+    volatile int32 consumerWaiting;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Semaphore where the BufferLoop waits for new data to be available.
      */
-    bool posted;
+    EventSem sem;
 
     /**
      * Allows a clean exit of the BufferLoop thread
@@ -0,0 +1,939 @@
+/**
+ * @file MultiCoreGAMScheduler.cpp
+ * @brief Source file for class MultiCoreGAMScheduler
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MultiCoreGAMScheduler (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "ExecutionInfo.h"
+#include "GAMDataSource.h"
+#include "MultiCoreGAMScheduler.h"
+#include "Threads.h"
+#include "TimingDataSource.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Number of times that a worker polls for work before returning the control to its MultiThreadService (so that it can be stopped).
+ */
+#define MULTICORE_GAM_SCHEDULER_WORKER_POLLS 100000u
+
+/**
+ * Signal index used to state that all the signals of a DataSourceI are accessed.
+ */
+#define MULTICORE_GAM_SCHEDULER_ALL_SIGNALS 0xFFFFFFFFu
+
+namespace MARTe {
+
+/**
+ * @brief A signal (or a whole DataSourceI) that is accessed by a GAM.
+ */
+struct MultiCoreGAMSchedulerAccess {
+    /**
+     * The DataSourceI.
+     */
+    const DataSourceI *dataSource;
+
+    /**
+     * The signal index in the DataSourceI or MULTICORE_GAM_SCHEDULER_ALL_SIGNALS.
+     */
+    uint32 signalIdx;
+
+    /**
+     * True if the signal is produced by the GAM.
+     */
+    bool write;
+};
+
+/**
+ * @brief The signals accessed by a GAM and whether the GAM shall be executed in isolation.
+ */
+struct MultiCoreGAMSchedulerAccesses {
+    /**
+     * The accessed signals.
+     */
+    MultiCoreGAMSchedulerAccess *accesses;
+
+    /**
+     * Number of accessed signals.
+     */
+    uint32 numberOfAccesses;
+
+    /**
+     * Maximum number of accessed signals.
+     */
+    uint32 maxNumberOfAccesses;
+
+    /**
+     * True if the GAM must wait for all the previous GAMs and all the following GAMs must wait for it.
+     */
+    bool barrier;
+
+    /**
+     * True if the GAM must wait for all the previous GAMs.
+     */
+    bool dependsOnAll;
+};
+
+/**
+ * @brief Adds to \a gamAccesses the signals that \a gam accesses in a given \a direction.
+ * @param[in] rtApp the RealTimeApplication where the DataSourceI are to be found.
+ * @param[in] gam the GAM.
+ * @param[in] direction the signal direction.
+ * @param[out] gamAccesses where to add the accessed signals.
+ * @return true if all the signals were mapped to their DataSourceI.
+ */
+static bool MultiCoreGAMSchedulerAddAccesses(ReferenceT<RealTimeApplication> rtApp,
+                                             ReferenceT<GAM> gam,
+                                             const SignalDirection direction,
+                                             MultiCoreGAMSchedulerAccesses &gamAccesses) {
+    StreamString gamName;
+    bool ret = gam->GetQualifiedName(gamName);
+    uint32 numberOfSignals = 0u;
+    if (direction == InputSignals) {
+        numberOfSignals = gam->GetNumberOfInputSignals();
+    }
+    else {
+        numberOfSignals = gam->GetNumberOfOutputSignals();
+    }
+    const bool write = (direction == OutputSignals);
+    for (uint32 s = 0u; (s < numberOfSignals) && (ret); s++) {
+        StreamString dataSourceName;
+        ret = gam->GetSignalDataSourceName(direction, s, dataSourceName);
+        //Each DataSourceI is only visited once (all its signals are visited at once).
+        bool visited = false;
+        for (uint32 p = 0u; (p < s) && (ret) && (!visited); p++) {
+            StreamString previousDataSourceName;
+            ret = gam->GetSignalDataSourceName(direction, p, previousDataSourceName);
+            if (ret) {
+                visited = (StringHelper::Compare(dataSourceName.Buffer(), previousDataSourceName.Buffer()) == 0);
+            }
+        }
+        ReferenceT<DataSourceI> dataSource;
+        if ((ret) && (!visited)) {
+            StreamString fullDataSourcePath = "Data.";
+            fullDataSourcePath += dataSourceName;
+            dataSource = rtApp->Find(fullDataSourcePath.Buffer());
+            ret = dataSource.IsValid();
+            if (!ret) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s is not a valid DataSourceI", fullDataSourcePath.Buffer());
+            }
+        }
+        uint32 functionIdx = 0u;
+        uint32 numberOfFunctionSignals = 0u;
+        if ((ret) && (!visited)) {
+            ret = dataSource->GetFunctionIndex(functionIdx, gamName.Buffer());
+            if (ret) {
+                ret = dataSource->GetFunctionNumberOfSignals(direction, functionIdx, numberOfFunctionSignals);
+            }
+        }
+        if ((ret) && (!visited)) {
+            ReferenceT<TimingDataSource> timingDataSource = dataSource;
+            ReferenceT<GAMDataSource> gamDataSource = dataSource;
+            //The timing signals are written by the scheduler after each GAM is executed.
+            if ((timingDataSource.IsValid()) && (!write)) {
+                gamAccesses.dependsOnAll = true;
+            }
+            for (uint32 f = 0u; (f < numberOfFunctionSignals) && (ret); f++) {
+                float32 frequency = -1.0F;
+                uint32 trigger = 0u;
+                ret = dataSource->GetFunctionSignalReadFrequency(direction, functionIdx, f, frequency);
+                if (ret) {
+                    ret = dataSource->GetFunctionSignalTrigger(direction, functionIdx, f, trigger);
+                }
+                if (ret) {
+                    if ((frequency > 0.F) || (trigger > 0u)) {
+                        gamAccesses.barrier = true;
+                    }
+                }
+                uint32 signalIdx = MULTICORE_GAM_SCHEDULER_ALL_SIGNALS;
+                if ((ret) && (gamDataSource.IsValid())) {
+                    StreamString alias;
+                    ret = dataSource->GetFunctionSignalAlias(direction, functionIdx, f, alias);
+                    if (ret) {
+                        uint32 dataSourceSignalIdx = 0u;
+                        if (dataSource->GetSignalIndex(dataSourceSignalIdx, alias.Buffer())) {
+                            signalIdx = dataSourceSignalIdx;
+                        }
+                    }
+                }
+                if (ret) {
+                    if (gamAccesses.numberOfAccesses < gamAccesses.maxNumberOfAccesses) {
+                        gamAccesses.accesses[gamAccesses.numberOfAccesses].dataSource = dataSource.operator->();
+                        gamAccesses.accesses[gamAccesses.numberOfAccesses].signalIdx = signalIdx;
+                        gamAccesses.accesses[gamAccesses.numberOfAccesses].write = write;
+                        gamAccesses.numberOfAccesses++;
+                    }
+                    else {
+                        //Not expected, but keep the GAM isolated as the dependencies are not fully known.
+                        gamAccesses.barrier = true;
+                    }
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Checks if two GAMs access the same signal and at least one of them writes it.
+ * @param[in] first the signals accessed by the first GAM.
+ * @param[in] second the signals accessed by the second GAM.
+ * @return true if the GAMs cannot be executed in parallel.
+ */
+static bool MultiCoreGAMSchedulerConflict(const MultiCoreGAMSchedulerAccesses &first,
+                                          const MultiCoreGAMSchedulerAccesses &second) {
+    bool conflict = false;
+    for (uint32 i = 0u; (i < first.numberOfAccesses) && (!conflict); i++) {
+        for (uint32 j = 0u; (j < second.numberOfAccesses) && (!conflict); j++) {
+            const MultiCoreGAMSchedulerAccess &a = first.accesses[i];
+            const MultiCoreGAMSchedulerAccess &b = second.accesses[j];
+            if ((a.write) || (b.write)) {
+                if (a.dataSource == b.dataSource) {
+                    conflict = (a.signalIdx == b.signalIdx);
+                    if (!conflict) {
+                        conflict = ((a.signalIdx == MULTICORE_GAM_SCHEDULER_ALL_SIGNALS) || (b.signalIdx == MULTICORE_GAM_SCHEDULER_ALL_SIGNALS));
+                    }
+                }
+            }
+        }
+    }
+    return conflict;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+MultiCoreGAMScheduler::MultiCoreGAMScheduler() :
+        GAMSchedulerI(),
+        binder(*this, &MultiCoreGAMScheduler::Execute) {
+    multiThreadService[0] = NULL_PTR(MultiThreadService *);
+    multiThreadService[1] = NULL_PTR(MultiThreadService *);
+    rtThreadInfo[0] = NULL_PTR(MultiCoreThreadParam *);
+    rtThreadInfo[1] = NULL_PTR(MultiCoreThreadParam *);
+    numberOfRealTimeThreads[0] = 0u;
+    numberOfRealTimeThreads[1] = 0u;
+    parallelThreads[0] = NULL_PTR(uint32 *);
+    parallelThreads[1] = NULL_PTR(uint32 *);
+    numberOfParallelThreads[0] = 0u;
+    numberOfParallelThreads[1] = 0u;
+    graphs = NULL_PTR(MultiCoreTaskGraph **);
+    numberOfGraphStates = 0u;
+    numberOfGraphThreads = NULL_PTR(uint32 *);
+    graphStateNames = NULL_PTR(StreamString *);
+    graphThreadNames = NULL_PTR(StreamString **);
+    numberOfWorkers = 0u;
+    workerCPUs = NULL_PTR(uint32 *);
+    if (!eventSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
+    }
+}
+
+/*lint -e{1551} the destructor must guarantee that the resources are stopped and freed. No exception should be thrown given that
+ * the memory addresses are checked before being used.*/
+MultiCoreGAMScheduler::~MultiCoreGAMScheduler() {
+    for (uint32 b = 0u; b < 2u; b++) {
+        if (multiThreadService[b] != NULL) {
+            ErrorManagement::ErrorType err;
+            err = multiThreadService[b]->Stop();
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[%d]", b);
+            }
+            delete multiThreadService[b];
+        }
+        if (rtThreadInfo[b] != NULL) {
+            delete[] rtThreadInfo[b];
+        }
+        if (parallelThreads[b] != NULL) {
+            delete[] parallelThreads[b];
+        }
+    }
+    FreeTaskGraphs();
+    if (workerCPUs != NULL) {
+        delete[] workerCPUs;
+    }
+}
+
+bool MultiCoreGAMScheduler::Initialise(StructuredDataI & data) {
+    bool ret = GAMSchedulerI::Initialise(data);
+    if (ret) {
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = 0u;
+        }
+        AnyType workerCPUsArray = data.GetType("WorkerCPUs");
+        if (workerCPUsArray.GetDataPointer() != NULL) {
+            ret = (workerCPUsArray.GetNumberOfElements(0u) == numberOfWorkers);
+            if ((ret) && (numberOfWorkers > 0u)) {
+                workerCPUs = new uint32[numberOfWorkers];
+                Vector<uint32> workerCPUsVector(workerCPUs, numberOfWorkers);
+                ret = data.Read("WorkerCPUs", workerCPUsVector);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "WorkerCPUs shall have exactly NumberOfWorkers (%d) elements", numberOfWorkers);
+            }
+        }
+        else if (numberOfWorkers > 0u) {
+            ret = false;
+            REPORT_ERROR(ErrorManagement::ParametersError, "WorkerCPUs shall be defined if NumberOfWorkers > 0");
+        }
+        else {
+            //No workers
+        }
+    }
+    if ((ret) && (workerCPUs != NULL_PTR(uint32 *))) {
+        //The workers busy-wait. Two workers sharing a CPU could starve each other.
+        uint32 usedCPUs = 0u;
+        for (uint32 n = 0u; (n < numberOfWorkers) && (ret); n++) {
+            ret = ((workerCPUs[n] != 0u) && ((workerCPUs[n] & usedCPUs) == 0u));
+            if (ret) {
+                usedCPUs |= workerCPUs[n];
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The WorkerCPUs shall be non-zero and disjoint");
+            }
+        }
+    }
+    if (ret) {
+        if (Size() > 0u) {
+            ret = (Size() == 1u);
+            if (ret) {
+                errorMessage = Get(0u);
+                ret = errorMessage.IsValid();
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The ErrorMessage is not valid");
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Only one ErrorMessage shall be defined");
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool MultiCoreGAMScheduler::ConfigureScheduler(Reference realTimeAppIn) {
+    bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+    ReferenceT<RealTimeApplication> rtApp = realTimeAppIn;
+    ReferenceT<ReferenceContainer> statesContainer;
+    if (ret) {
+        ret = rtApp.IsValid();
+    }
+    if (ret) {
+        statesContainer = rtApp->Find("States");
+        ret = statesContainer.IsValid();
+    }
+    if (ret) {
+        FreeTaskGraphs();
+        numberOfGraphStates = statesContainer->Size();
+        graphs = new MultiCoreTaskGraph*[numberOfGraphStates];
+        numberOfGraphThreads = new uint32[numberOfGraphStates];
+        graphStateNames = new StreamString[numberOfGraphStates];
+        graphThreadNames = new StreamString*[numberOfGraphStates];
+        for (uint32 i = 0u; i < numberOfGraphStates; i++) {
+            graphs[i] = NULL_PTR(MultiCoreTaskGraph *);
+            numberOfGraphThreads[i] = 0u;
+            graphThreadNames[i] = NULL_PTR(StreamString *);
+        }
+    }
+    for (uint32 i = 0u; (i < numberOfGraphStates) && (ret); i++) {
+        ReferenceT<RealTimeState> stateElement = statesContainer->Get(i);
+        ret = stateElement.IsValid();
+        ReferenceT<ReferenceContainer> threadContainer;
+        if (ret) {
+            graphStateNames[i] = stateElement->GetName();
+            threadContainer = stateElement->Find("Threads");
+            ret = threadContainer.IsValid();
+        }
+        if (ret) {
+            uint32 numberOfThreads = threadContainer->Size();
+            numberOfGraphThreads[i] = numberOfThreads;
+            graphs[i] = new MultiCoreTaskGraph[numberOfThreads];
+            graphThreadNames[i] = new StreamString[numberOfThreads];
+            for (uint32 j = 0u; j < numberOfThreads; j++) {
+                graphs[i][j].tasks = NULL_PTR(MultiCoreTask *);
+                graphs[i][j].numberOfTasks = 0u;
+            }
+            for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
+                ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
+                ret = threadElement.IsValid();
+                if (ret) {
+                    graphThreadNames[i][j] = threadElement->GetName();
+                    if (!BuildTaskGraph(threadElement, graphs[i][j])) {
+                        REPORT_ERROR(ErrorManagement::Warning, "Could not compute the GAM dependencies of %s.%s. The thread will be executed sequentially",
+                                     graphStateNames[i].Buffer(), graphThreadNames[i][j].Buffer());
+                    }
+                }
+            }
+            if (ret) {
+                ret = CheckWorkerCPUs(threadContainer, graphs[i]);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid WorkerCPUs for the state %s", graphStateNames[i].Buffer());
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool MultiCoreGAMScheduler::CheckWorkerCPUs(ReferenceT<ReferenceContainer> threadContainer,
+                                            const MultiCoreTaskGraph * const stateGraphs) const {
+    bool ret = true;
+    uint32 numberOfParallelThreads = 0u;
+    uint32 allWorkerCPUs = 0u;
+    uint32 numberOfThreads = threadContainer->Size();
+    if (numberOfWorkers > 0u) {
+        for (uint32 j = 0u; j < numberOfThreads; j++) {
+            if (stateGraphs[j].numberOfTasks > 1u) {
+                numberOfParallelThreads++;
+            }
+        }
+        for (uint32 n = 0u; n < numberOfWorkers; n++) {
+            allWorkerCPUs |= workerCPUs[n];
+        }
+    }
+    for (uint32 j = 0u; (j < numberOfThreads) && (ret) && (numberOfParallelThreads > 0u); j++) {
+        ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
+        ret = threadElement.IsValid();
+        if (ret) {
+            //Same defaults as in Threads::BeginThread
+            uint32 threadCPUs = threadElement->GetCPU().GetProcessorMask();
+            if (threadCPUs == 0u) {
+                threadCPUs = ProcessorType::GetDefaultCPUs();
+            }
+            if (threadCPUs == 0u) {
+                threadCPUs = 0xFFFFFFFFu;
+            }
+            //A real-time thread that shares a CPU with a busy-waiting worker of the same priority would never be scheduled.
+            ret = ((threadCPUs & allWorkerCPUs) == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The CPUs (0x%x) of %s shall be disjoint from the WorkerCPUs (0x%x)", threadCPUs,
+                             threadElement->GetName(), allWorkerCPUs);
+            }
+        }
+    }
+    return ret;
+}
+
+bool MultiCoreGAMScheduler::BuildTaskGraph(ReferenceT<RealTimeThread> thread,
+                                           MultiCoreTaskGraph &graph) const {
+    ReferenceT<RealTimeApplication> rtApp = realTimeApp;
+    ReferenceContainer gams;
+    bool ret = thread->GetGAMs(gams);
+    uint32 numberOfGAMs = 0u;
+    if (ret) {
+        numberOfGAMs = gams.Size();
+        ret = (numberOfGAMs > 0u);
+    }
+    MultiCoreTask *tasks = NULL_PTR(MultiCoreTask *);
+    MultiCoreGAMSchedulerAccesses *gamAccesses = NULL_PTR(MultiCoreGAMSchedulerAccesses *);
+    if (ret) {
+        tasks = new MultiCoreTask[numberOfGAMs];
+        gamAccesses = new MultiCoreGAMSchedulerAccesses[numberOfGAMs];
+        for (uint32 k = 0u; k < numberOfGAMs; k++) {
+            tasks[k].firstExecutable = 0u;
+            tasks[k].numberOfExecutables = 0u;
+            tasks[k].numberOfPredecessors = 0u;
+            tasks[k].successors = NULL_PTR(uint32 *);
+            tasks[k].numberOfSuccessors = 0u;
+            tasks[k].pendingPredecessors = 0;
+            //Only released by ExecuteCycle.
+            tasks[k].claimed = 1;
+            gamAccesses[k].accesses = NULL_PTR(MultiCoreGAMSchedulerAccess *);
+            gamAccesses[k].numberOfAccesses = 0u;
+            gamAccesses[k].maxNumberOfAccesses = 0u;
+            gamAccesses[k].barrier = false;
+            gamAccesses[k].dependsOnAll = false;
+        }
+    }
+    //Same order as in GAMSchedulerI::ConfigureScheduler: input brokers, GAM, output brokers.
+    uint32 executableIdx = 0u;
+    for (uint32 k = 0u; (k < numberOfGAMs) && (ret); k++) {
+        ReferenceT<GAM> gam = gams.Get(k);
+        ret = gam.IsValid();
+        ReferenceContainer inputBrokers;
+        ReferenceContainer outputBrokers;
+        if (ret) {
+            ret = gam->GetInputBrokers(inputBrokers);
+        }
+        if (ret) {
+            ret = gam->GetOutputBrokers(outputBrokers);
+        }
+        if (ret) {
+            /*lint -e{613} tasks cannot be NULL if ret is true*/
+            tasks[k].firstExecutable = executableIdx;
+            tasks[k].numberOfExecutables = (inputBrokers.Size() + 1u) + outputBrokers.Size();
+            executableIdx += tasks[k].numberOfExecutables;
+            uint32 maxNumberOfAccesses = gam->GetNumberOfInputSignals() + gam->GetNumberOfOutputSignals();
+            /*lint -e{613} gamAccesses cannot be NULL if ret is true*/
+            gamAccesses[k].maxNumberOfAccesses = maxNumberOfAccesses;
+            if (maxNumberOfAccesses > 0u) {
+                gamAccesses[k].accesses = new MultiCoreGAMSchedulerAccess[maxNumberOfAccesses];
+            }
+            ret = MultiCoreGAMSchedulerAddAccesses(rtApp, gam, InputSignals, gamAccesses[k]);
+        }
+        if (ret) {
+            ret = MultiCoreGAMSchedulerAddAccesses(rtApp, gam, OutputSignals, gamAccesses[k]);
+        }
+    }
+    bool *dependencies = NULL_PTR(bool *);
+    if (ret) {
+        //dependencies[(p * numberOfGAMs) + s] is true if s has to wait for p.
+        dependencies = new bool[numberOfGAMs * numberOfGAMs];
+        for (uint32 p = 0u; p < numberOfGAMs; p++) {
+            for (uint32 s = 0u; s < numberOfGAMs; s++) {
+                bool dependent = false;
+                if (p < s) {
+                    /*lint -e{613} gamAccesses cannot be NULL if ret is true*/
+                    dependent = ((gamAccesses[p].barrier) || (gamAccesses[s].barrier) || (gamAccesses[s].dependsOnAll));
+                    if (!dependent) {
+                        dependent = MultiCoreGAMSchedulerConflict(gamAccesses[p], gamAccesses[s]);
+                    }
+                }
+                dependencies[(p * numberOfGAMs) + s] = dependent;
+                if (dependent) {
+                    /*lint -e{613} tasks cannot be NULL if ret is true*/
+                    tasks[p].numberOfSuccessors++;
+                    tasks[s].numberOfPredecessors++;
+                }
+            }
+        }
+        for (uint32 p = 0u; p < numberOfGAMs; p++) {
+            /*lint -e{613} tasks cannot be NULL if ret is true*/
+            if (tasks[p].numberOfSuccessors > 0u) {
+                tasks[p].successors = new uint32[tasks[p].numberOfSuccessors];
+                uint32 n = 0u;
+                for (uint32 s = 0u; s < numberOfGAMs; s++) {
+                    if (dependencies[(p * numberOfGAMs) + s]) {
+                        tasks[p].successors[n] = s;
+                        n++;
+                    }
+                }
+            }
+        }
+        delete[] dependencies;
+    }
+    if (gamAccesses != NULL) {
+        for (uint32 k = 0u; k < numberOfGAMs; k++) {
+            if (gamAccesses[k].accesses != NULL) {
+                delete[] gamAccesses[k].accesses;
+            }
+        }
+        delete[] gamAccesses;
+    }
+    if (ret) {
+        graph.tasks = tasks;
+        graph.numberOfTasks = numberOfGAMs;
+    }
+    else if (tasks != NULL) {
+        for (uint32 k = 0u; k < numberOfGAMs; k++) {
+            if (tasks[k].successors != NULL) {
+                delete[] tasks[k].successors;
+            }
+        }
+        delete[] tasks;
+    }
+    else {
+        //NOOP
+    }
+    return ret;
+}
+
+void MultiCoreGAMScheduler::FreeTaskGraphs() {
+    if (graphs != NULL) {
+        for (uint32 i = 0u; i < numberOfGraphStates; i++) {
+            if (graphs[i] != NULL) {
+                for (uint32 j = 0u; j < numberOfGraphThreads[i]; j++) {
+                    if (graphs[i][j].tasks != NULL) {
+                        for (uint32 k = 0u; k < graphs[i][j].numberOfTasks; k++) {
+                            if (graphs[i][j].tasks[k].successors != NULL) {
+                                delete[] graphs[i][j].tasks[k].successors;
+                            }
+                        }
+                        delete[] graphs[i][j].tasks;
+                    }
+                }
+                delete[] graphs[i];
+            }
+            if (graphThreadNames[i] != NULL) {
+                delete[] graphThreadNames[i];
+            }
+        }
+        delete[] graphs;
+        delete[] graphThreadNames;
+        delete[] graphStateNames;
+        delete[] numberOfGraphThreads;
+    }
+    graphs = NULL_PTR(MultiCoreTaskGraph **);
+    graphThreadNames = NULL_PTR(StreamString **);
+    graphStateNames = NULL_PTR(StreamString *);
+    numberOfGraphThreads = NULL_PTR(uint32 *);
+    numberOfGraphStates = 0u;
+}
+
+const MultiCoreTaskGraph *MultiCoreGAMScheduler::FindTaskGraph(const char8 * const stateName,
+                                                               const char8 * const threadName) const {
+    const MultiCoreTaskGraph *graph = NULL_PTR(const MultiCoreTaskGraph *);
+    if (graphs != NULL) {
+        for (uint32 i = 0u; (i < numberOfGraphStates) && (graph == NULL); i++) {
+            if (StringHelper::Compare(graphStateNames[i].Buffer(), stateName) == 0) {
+                for (uint32 j = 0u; (j < numberOfGraphThreads[i]) && (graph == NULL); j++) {
+                    if (StringHelper::Compare(graphThreadNames[i][j].Buffer(), threadName) == 0) {
+                        graph = &graphs[i][j];
+                    }
+                }
+            }
+        }
+    }
+    return graph;
+}
+
+uint32 MultiCoreGAMScheduler::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+uint32 MultiCoreGAMScheduler::GetNumberOfTasks(const char8 * const stateName,
+                                               const char8 * const threadName) const {
+    uint32 numberOfTasks = 0u;
+    const MultiCoreTaskGraph *graph = FindTaskGraph(stateName, threadName);
+    if (graph != NULL) {
+        numberOfTasks = graph->numberOfTasks;
+    }
+    return numberOfTasks;
+}
+
+bool MultiCoreGAMScheduler::IsTaskDependent(const char8 * const stateName,
+                                            const char8 * const threadName,
+                                            const uint32 predecessorIdx,
+                                            const uint32 successorIdx) const {
+    bool dependent = false;
+    const MultiCoreTaskGraph *graph = FindTaskGraph(stateName, threadName);
+    if (graph != NULL) {
+        if (predecessorIdx < graph->numberOfTasks) {
+            const MultiCoreTask &task = graph->tasks[predecessorIdx];
+            for (uint32 n = 0u; (n < task.numberOfSuccessors) && (!dependent); n++) {
+                dependent = (task.successors[n] == successorIdx);
+            }
+        }
+    }
+    return dependent;
+}
+
+void MultiCoreGAMScheduler::Purge(ReferenceContainer &purgeList) {
+    //Post the semaphore to make sure that no Threads are awaiting to start!
+    if (!eventSem.Post()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
+    }
+    for (uint32 b = 0u; b < 2u; b++) {
+        if (multiThreadService[b] != NULL) {
+            ErrorManagement::ErrorType err;
+            err = multiThreadService[b]->Stop();
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[%d]", b);
+            }
+        }
+    }
+    ReferenceContainer::Purge(purgeList);
+}
+
+ErrorManagement::ErrorType MultiCoreGAMScheduler::StartNextStateExecution() {
+    ErrorManagement::ErrorType err;
+    if (GetSchedulableStates() != NULL_PTR(ScheduledState **)) {
+        err = !realTimeApplicationT.IsValid();
+        if (err.ErrorsCleared()) {
+            uint32 newBuffer = realTimeApplicationT->GetIndex();
+            ScheduledState *newState = GetSchedulableStates()[newBuffer];
+            if (newState != NULL_PTR(ScheduledState *)) {
+                if (!eventSem.Post()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "newState is NULL. Did you call PrepareNextState?");
+                err.fatalError = true;
+            }
+        }
+    }
+    else {
+        //This should not be reachable as the RealTimeApplication will fail in such case.
+        REPORT_ERROR(ErrorManagement::FatalError, "No states defined.");
+        err.fatalError = true;
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType MultiCoreGAMScheduler::StopCurrentStateExecution() {
+    ErrorManagement::ErrorType err(realTimeApplicationT.IsValid());
+    if (err.ErrorsCleared()) {
+        uint32 currentIndex = realTimeApplicationT->GetIndex();
+        if (multiThreadService[currentIndex] != NULL) {
+            err = multiThreadService[currentIndex]->Stop();
+        }
+    }
+    return err;
+}
+
+void MultiCoreGAMScheduler::CustomPrepareNextState() {
+    ErrorManagement::ErrorType err;
+    if (eventSem.Reset()) {
+        realTimeApplicationT = realTimeApp;
+        err = !realTimeApplicationT.IsValid();
+        if (err.ErrorsCleared()) {
+            //Launches the threads for the next state
+            uint32 nextBuffer = (realTimeApplicationT->GetIndex() + 1u) % 2u;
+            ScheduledState *nextState = GetSchedulableStates()[nextBuffer];
+            uint32 numberOfThreads = nextState->numberOfThreads;
+            if (multiThreadService[nextBuffer] != NULL) {
+                err = multiThreadService[nextBuffer]->Stop();
+                delete multiThreadService[nextBuffer];
+                multiThreadService[nextBuffer] = NULL_PTR(MultiThreadService *);
+            }
+            if (rtThreadInfo[nextBuffer] != NULL) {
+                delete[] rtThreadInfo[nextBuffer];
+            }
+            if (parallelThreads[nextBuffer] != NULL) {
+                delete[] parallelThreads[nextBuffer];
+            }
+            parallelThreads[nextBuffer] = NULL_PTR(uint32 *);
+            numberOfParallelThreads[nextBuffer] = 0u;
+            rtThreadInfo[nextBuffer] = new MultiCoreThreadParam[numberOfThreads];
+            numberOfRealTimeThreads[nextBuffer] = numberOfThreads;
+            for (uint32 i = 0u; i < numberOfThreads; i++) {
+                rtThreadInfo[nextBuffer][i].executables = nextState->threads[i].executables;
+                rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
+                rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
+                rtThreadInfo[nextBuffer][i].cycleTimeTicks = nextState->threads[i].cycleTimeTicks;
+                rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
+                rtThreadInfo[nextBuffer][i].cycleStartTicks = 0u;
+                rtThreadInfo[nextBuffer][i].completedTasks = 0;
+                rtThreadInfo[nextBuffer][i].cycleFailed = 0;
+                rtThreadInfo[nextBuffer][i].graph = NULL_PTR(MultiCoreTaskGraph *);
+                if (numberOfWorkers > 0u) {
+                    /*lint -e{1925} the graph is only modified by ConfigureScheduler, which cannot be called while the threads are running*/
+                    MultiCoreTaskGraph *graph = const_cast<MultiCoreTaskGraph *>(FindTaskGraph(nextState->name, nextState->threads[i].name));
+                    if (graph != NULL) {
+                        if (graph->numberOfTasks > 1u) {
+                            const MultiCoreTask &lastTask = graph->tasks[graph->numberOfTasks - 1u];
+                            if ((lastTask.firstExecutable + lastTask.numberOfExecutables) == nextState->threads[i].numberOfExecutables) {
+                                rtThreadInfo[nextBuffer][i].graph = graph;
+                                numberOfParallelThreads[nextBuffer]++;
+                            }
+                        }
+                    }
+                }
+            }
+            //The workers are shared by all the threads that are executed in parallel.
+            uint32 numberOfThreadWorkers = 0u;
+            if (numberOfParallelThreads[nextBuffer] > 0u) {
+                numberOfThreadWorkers = numberOfWorkers;
+                parallelThreads[nextBuffer] = new uint32[numberOfParallelThreads[nextBuffer]];
+                uint32 p = 0u;
+                for (uint32 i = 0u; i < numberOfThreads; i++) {
+                    if (rtThreadInfo[nextBuffer][i].graph != NULL) {
+                        parallelThreads[nextBuffer][p] = i;
+                        p++;
+                    }
+                }
+            }
+            if (err.ErrorsCleared()) {
+                multiThreadService[nextBuffer] = new (NULL) MultiThreadService(binder);
+                multiThreadService[nextBuffer]->SetNumberOfPoolThreads(numberOfThreads + numberOfThreadWorkers);
+                err = multiThreadService[nextBuffer]->CreateThreads();
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to Stop() MultiThreadService.");
+            }
+            if (err.ErrorsCleared()) {
+                for (uint32 i = 0u; i < numberOfThreads; i++) {
+                    multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
+                    multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
+                    multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, i);
+                    multiThreadService[nextBuffer]->SetThreadNameThreadPool(nextState->threads[i].name, i);
+                }
+                //The workers execute the GAMs of any of the parallel threads.
+                uint32 stackSize = 0u;
+                for (uint32 p = 0u; p < numberOfParallelThreads[nextBuffer]; p++) {
+                    /*lint -e{613} parallelThreads cannot be NULL if numberOfParallelThreads > 0*/
+                    uint32 threadStackSize = nextState->threads[parallelThreads[nextBuffer][p]].stackSize;
+                    if (threadStackSize > stackSize) {
+                        stackSize = threadStackSize;
+                    }
+                }
+                for (uint32 w = 0u; w < numberOfThreadWorkers; w++) {
+                    /*lint -e{613} workerCPUs cannot be NULL if numberOfWorkers > 0 (see Initialise)*/
+                    uint32 cpu = workerCPUs[w];
+                    StreamString workerName;
+                    (void) workerName.Printf("%s_Worker%d", nextState->name, w);
+                    multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, numberOfThreads + w);
+                    multiThreadService[nextBuffer]->SetCPUMaskThreadPool(cpu, numberOfThreads + w);
+                    multiThreadService[nextBuffer]->SetStackSizeThreadPool(stackSize, numberOfThreads + w);
+                    multiThreadService[nextBuffer]->SetThreadNameThreadPool(workerName.Buffer(), numberOfThreads + w);
+                }
+                err = multiThreadService[nextBuffer]->Start();
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to CreateThreads().");
+            }
+            if (!err.ErrorsCleared()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to Start() MultiThreadService.");
+            }
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the event semaphore");
+    }
+}
+
+bool MultiCoreGAMScheduler::ExecuteTasks(MultiCoreThreadParam &param) const {
+    bool executed = false;
+    MultiCoreTaskGraph *graph = param.graph;
+    //The tasks are claimed in topological order, so that the predecessors of a claimed task were already claimed by someone else who is making progress.
+    for (uint32 t = 0u; t < graph->numberOfTasks; t++) {
+        MultiCoreTask &task = graph->tasks[t];
+        if (task.claimed == 0) {
+            if (Atomic::TestAndSet(&task.claimed)) {
+                while (task.pendingPredecessors > 0) {
+                    Atomic::Pause();
+                }
+                if (param.cycleFailed == 0) {
+                    if (!ExecuteSingleCycle(&param.executables[task.firstExecutable], task.numberOfExecutables, param.cycleStartTicks)) {
+                        (void) Atomic::Exchange(&param.cycleFailed, 1);
+                    }
+                }
+                for (uint32 n = 0u; n < task.numberOfSuccessors; n++) {
+                    Atomic::Decrement(&graph->tasks[task.successors[n]].pendingPredecessors);
+                }
+                Atomic::Increment(&param.completedTasks);
+                executed = true;
+            }
+        }
+    }
+    return executed;
+}
+
+bool MultiCoreGAMScheduler::ExecuteCycle(MultiCoreThreadParam &param) const {
+    MultiCoreTaskGraph *graph = param.graph;
+    const int32 numberOfTasks = static_cast<int32>(graph->numberOfTasks);
+    //All the tasks of the previous cycle were claimed and completed (join point), so no worker can be accessing the counters.
+    param.cycleStartTicks = HighResolutionTimer::Counter();
+    (void) Atomic::Exchange(&param.cycleFailed, 0);
+    for (uint32 t = 0u; t < graph->numberOfTasks; t++) {
+        (void) Atomic::Exchange(&graph->tasks[t].pendingPredecessors, static_cast<int32>(graph->tasks[t].numberOfPredecessors));
+    }
+    //The Atomic::Exchange is a full memory barrier: the counters are reset before any claim is released.
+    (void) Atomic::Exchange(&param.completedTasks, 0);
+    //Releasing the claims opens the cycle to the workers.
+    for (uint32 t = 0u; t < graph->numberOfTasks; t++) {
+        (void) Atomic::Exchange(&graph->tasks[t].claimed, 0);
+    }
+    (void) ExecuteTasks(param);
+    //Join point
+    while (param.completedTasks < numberOfTasks) {
+        Atomic::Pause();
+    }
+    return (param.cycleFailed == 0);
+}
+
+/*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
+ErrorManagement::ErrorType MultiCoreGAMScheduler::Execute(ExecutionInfo & information) {
+    ErrorManagement::ErrorType ret;
+    uint32 threadNumber = information.GetThreadNumber();
+    uint32 idx = realTimeApplicationT->GetIndex();
+
+    if (information.GetStage() == MARTe::ExecutionInfo::StartupStage) {
+        ret = eventSem.Wait(TTInfiniteWait);
+    }
+    else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+        if (rtThreadInfo[idx] == NULL_PTR(MultiCoreThreadParam *)) {
+            REPORT_ERROR(ErrorManagement::FatalError, "MultiCoreThreadParam is NULL.");
+        }
+        else if (threadNumber < numberOfRealTimeThreads[idx]) {
+            MultiCoreThreadParam &param = rtThreadInfo[idx][threadNumber];
+            bool ok;
+            if (param.graph != NULL_PTR(MultiCoreTaskGraph *)) {
+                ok = ExecuteCycle(param);
+            }
+            else {
+                ok = ExecuteSingleCycle(param.executables, param.numberOfExecutables);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
+                //See GAMScheduler::Execute on why the ret.fatalError is not set.
+                if (errorMessage.IsValid()) {
+                    if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
+                    }
+                }
+            }
+            uint64 nowTicks = HighResolutionTimer::Counter();
+            uint64 absTime = 0u;
+            if (param.lastCycleTimeStamp != 0u) {
+                absTime = (nowTicks - param.lastCycleTimeStamp);
+            }
+            if (param.cycleTimeTicks != NULL_PTR(uint64 *)) {
+                *param.cycleTimeTicks = absTime;
+            }
+            else if (param.cycleTime != NULL_PTR(uint32 *)) {
+                *param.cycleTime = TicksToMicroSeconds(absTime, ticksToMicroSecondsScale);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
+            }
+            param.lastCycleTimeStamp = nowTicks;
+        }
+        else if (parallelThreads[idx] != NULL_PTR(uint32 *)) {
+            //Return from time to time so that the MultiThreadService can stop the worker.
+            bool executed = false;
+            for (uint32 n = 0u; (n < MULTICORE_GAM_SCHEDULER_WORKER_POLLS) && (!executed); n++) {
+                for (uint32 p = 0u; p < numberOfParallelThreads[idx]; p++) {
+                    if (ExecuteTasks(rtThreadInfo[idx][parallelThreads[idx][p]])) {
+                        executed = true;
+                    }
+                }
+                if (!executed) {
+                    Atomic::Pause();
+                }
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::FatalError, "Worker thread %d is not associated to any real-time thread.", threadNumber);
+        }
+    }
+    else {
+        //Other states not used.
+    }
+    return ret;
+}
+
+CLASS_REGISTER(MultiCoreGAMScheduler, "1.0")
+
+}
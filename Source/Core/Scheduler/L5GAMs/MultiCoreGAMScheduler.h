@@ -0,0 +1,418 @@
+/**
+ * @file MultiCoreGAMScheduler.h
+ * @brief Header file for class MultiCoreGAMScheduler
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MultiCoreGAMScheduler
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MULTICOREGAMSCHEDULER_H_
+#define MULTICOREGAMSCHEDULER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "EventSem.h"
+#include "GAMSchedulerI.h"
+#include "Message.h"
+#include "MultiThreadService.h"
+#include "RealTimeApplication.h"
+#include "RealTimeThread.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A node of the dependency graph of a real-time thread: one GAM together with its input and output brokers.
+ */
+struct MultiCoreTask {
+    /**
+     * Index of the first ExecutableI (the first input broker of the GAM) in the thread list of executables.
+     */
+    uint32 firstExecutable;
+
+    /**
+     * Number of ExecutableI (input brokers + GAM + output brokers) of this task.
+     */
+    uint32 numberOfExecutables;
+
+    /**
+     * Number of tasks that have to be completed before this task can be executed.
+     */
+    uint32 numberOfPredecessors;
+
+    /**
+     * Indexes of the tasks that depend on this task.
+     */
+    uint32 *successors;
+
+    /**
+     * Number of tasks that depend on this task.
+     */
+    uint32 numberOfSuccessors;
+
+    /**
+     * Number of predecessors that were not yet completed in the current cycle.
+     */
+    volatile int32 pendingPredecessors;
+
+    /**
+     * Set (Atomic::TestAndSet) by the thread which executes this task in the current cycle. Only released by the
+     * real-time thread at the beginning of each cycle, so that no task can be claimed outside of a cycle.
+     */
+    volatile int32 claimed;
+};
+
+/**
+ * @brief The dependency graph of the GAMs of one real-time thread.
+ */
+struct MultiCoreTaskGraph {
+    /**
+     * The tasks, one per GAM, in the order in which the GAMs are declared in the thread. This is always a topological order of the graph.
+     */
+    MultiCoreTask *tasks;
+
+    /**
+     * Number of tasks.
+     */
+    uint32 numberOfTasks;
+};
+
+/**
+ * @brief Thread parameter structure of the MultiCoreGAMScheduler.
+ */
+struct MultiCoreThreadParam {
+    /**
+     * The list of executables
+     */
+    ExecutableI **executables;
+
+    /**
+     * The number of executables
+     */
+    uint32 numberOfExecutables;
+
+    /**
+     * The dependency graph. NULL if the thread is to be executed sequentially.
+     */
+    MultiCoreTaskGraph *graph;
+
+    /**
+     * The cycle time (micro-seconds)
+     */
+    uint32* cycleTime;
+
+    /**
+     * The cycle time (HighResolutionTimer ticks). If not NULL it is used instead of cycleTime.
+     */
+    uint64* cycleTimeTicks;
+
+    /**
+     * HRT value last cycle time
+     */
+    uint64 lastCycleTimeStamp;
+
+    /**
+     * HRT value at the beginning of the current cycle. All the timing signals of the cycle are referenced to this value.
+     */
+    uint64 cycleStartTicks;
+
+    /**
+     * Number of tasks completed in the current cycle.
+     */
+    volatile int32 completedTasks;
+
+    /**
+     * Set to 1 if any task failed in the current cycle.
+     */
+    volatile int32 cycleFailed;
+};
+
+/**
+ * @brief A GAMSchedulerI which executes the independent GAMs of a real-time thread in parallel, using a pool of worker threads.
+ *
+ * @details For every real-time thread a dependency graph is derived from the signals that its GAMs produce and consume
+ * (as resolved by the RealTimeApplicationConfigurationBuilder). A GAM (together with its input and output brokers) depends
+ * on a previously declared GAM of the same thread if both access the same signal of a GAMDataSource and at least one of them
+ * writes it (read after write, write after read and write after write). Signals of any other DataSourceI are assumed to share
+ * the same resource, i.e. all the GAMs that write to (or read from a DataSourceI that is written by) the same driver keep their order.
+ * A GAM which has any synchronising signal (Frequency or Trigger), or which reads from the TimingDataSource, is a barrier:
+ * it waits for all the previous GAMs and all the following GAMs wait for it.
+ *
+ * @details In every cycle the real-time thread and the NumberOfWorkers workers claim the tasks in the order in which the GAMs are
+ * declared, wait for their predecessors and execute them. The tasks are only released by the real-time thread at the beginning of
+ * each of its cycles. The cycle only ends when all the tasks were completed (join point), so that from the outside each real-time
+ * thread still behaves as if its GAMs had been executed sequentially.
+ * If NumberOfWorkers is zero, or if a thread only has one GAM, the thread is executed as in the GAMScheduler.
+ *
+ * @details The NumberOfWorkers workers are shared by all the real-time threads of a state which have more than one GAM: each worker
+ * polls the released tasks of all these threads. The workers busy-wait for the next cycle (see Atomic::Pause) and are thus allocated
+ * to dedicated cores: the WorkerCPUs shall be disjoint between them and disjoint from the CPUs of every real-time thread of a state
+ * where the workers are used (a real-time thread without CPUs runs on all the CPUs).
+ *
+ * @details The syntax in the configuration stream has to be:
+ *
+ * +Scheduler = {\n
+ *    Class = MultiCoreGAMScheduler
+ *    TimingDataSource = "Name of the TimingDataSource"
+ *    NumberOfWorkers = 2 //Optional. Number of worker threads that help each real-time thread to execute its GAMs. Default = 0.
+ *    WorkerCPUs = { 0x4 0x8 } //Compulsory if NumberOfWorkers > 0. The CPU mask of each worker thread.
+ *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
+ *        Class = Message
+ *        ...
+ *    }
+ * }\n
+ */
+class MultiCoreGAMScheduler: public GAMSchedulerI {
+
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor
+     * @post
+     *   GetNumberOfWorkers() == 0
+     */
+    MultiCoreGAMScheduler();
+
+    /**
+     * @brief Destructor. Stops the threads and frees the dependency graphs.
+     */
+    virtual ~MultiCoreGAMScheduler();
+
+    /**
+     * @brief Reads the NumberOfWorkers and the WorkerCPUs and verifies if there is an ErrorMessage defined.
+     * @param[in] data the StructuredDataI with the TimingDataSource name and with the optional parameters defined above.
+     * @return true if GAMSchedulerI::Initialise returns true, at most one valid ErrorMessage is defined and, if
+     * NumberOfWorkers > 0, WorkerCPUs has exactly NumberOfWorkers non-zero and disjoint elements.
+     * @see GAMSchedulerI::Initialise.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Calls GAMSchedulerI::ConfigureScheduler and builds the dependency graph of every real-time thread.
+     * @details Shall be called by the RealTimeApplication while the signal producers and consumers are still resolved, i.e. during
+     * RealTimeApplication::ConfigureApplication.
+     * @param[in] realTimeAppIn the RealTimeApplication.
+     * @return true if GAMSchedulerI::ConfigureScheduler returns true, all the graphs could be built and the WorkerCPUs are
+     * disjoint from the CPUs of the real-time threads (see the class description).
+     */
+    virtual bool ConfigureScheduler(Reference realTimeAppIn);
+
+    /**
+     * @brief Starts the multi-thread execution for the current state.
+     * @return ErrorManagement::NoError if the next state was configured (see PrepareNextState) and the MultiThreadService could be successfully started.
+     * @pre
+     *   PrepareNextState()
+     */
+    virtual ErrorManagement::ErrorType StartNextStateExecution();
+
+    /**
+     * @brief Stops the execution application
+     * @return ErrorManagement::NoError if the current state was configured (see PrepareNextState) and the MultiThreadService could be successfully stopped.
+     * @pre
+     *   PrepareNextState()
+     */
+    virtual ErrorManagement::ErrorType StopCurrentStateExecution();
+
+    /**
+     * @brief Callback function for the MultiThreadService.
+     * @details The first threads of the pool are the real-time threads, which execute one cycle each time they are called.
+     * The remaining threads are the workers, which help executing the tasks of the real-time threads of the state.
+     * @param[in] information (see EmbeddedThread)
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType Execute(ExecutionInfo &information);
+
+    /**
+     * @brief Stops the active MultiThreadService running services and calls ReferenceContainer::Purge
+     * @see ReferenceContainer::Purge
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
+    /**
+     * @brief Gets the number of worker threads that help each real-time thread.
+     * @return the number of worker threads that help each real-time thread.
+     */
+    uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Gets the number of tasks (i.e. of GAMs) in the dependency graph of a real-time thread.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @return the number of tasks or 0 if the thread is not found.
+     */
+    uint32 GetNumberOfTasks(const char8 * const stateName, const char8 * const threadName) const;
+
+    /**
+     * @brief Checks if a task directly depends on another task.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @param[in] predecessorIdx the index of the GAM in the thread.
+     * @param[in] successorIdx the index of the GAM in the thread.
+     * @return true if the GAM at \a successorIdx has to wait for the GAM at \a predecessorIdx.
+     */
+    bool IsTaskDependent(const char8 * const stateName, const char8 * const threadName, const uint32 predecessorIdx, const uint32 successorIdx) const;
+
+protected:
+
+    /**
+     * @brief Starts the threads for the next state
+     */
+    virtual void CustomPrepareNextState();
+
+private:
+
+    /**
+     * @brief Builds the dependency graph of a real-time thread.
+     * @param[in] thread the real-time thread.
+     * @param[out] graph the graph to build.
+     * @return true if all the GAM signals could be mapped to their DataSourceI.
+     */
+    bool BuildTaskGraph(ReferenceT<RealTimeThread> thread, MultiCoreTaskGraph &graph) const;
+
+    /**
+     * @brief Verifies that the workers of a state cannot starve its real-time threads (see the class description).
+     * @param[in] threadContainer the threads of the state.
+     * @param[in] stateGraphs the graphs of each thread of the state.
+     * @return true if no thread is executed by the workers or if the WorkerCPUs are disjoint from the CPUs of all the threads.
+     */
+    bool CheckWorkerCPUs(ReferenceT<ReferenceContainer> threadContainer, const MultiCoreTaskGraph * const stateGraphs) const;
+
+    /**
+     * @brief Finds the graph of a given state and thread.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @return the graph or NULL if not found.
+     */
+    const MultiCoreTaskGraph *FindTaskGraph(const char8 * const stateName, const char8 * const threadName) const;
+
+    /**
+     * @brief Claims and executes tasks of \a param until all the tasks of the current cycle are claimed.
+     * @param[in] param the parameters of the real-time thread.
+     * @return true if at least one task was executed.
+     */
+    bool ExecuteTasks(MultiCoreThreadParam &param) const;
+
+    /**
+     * @brief Executes one cycle of the real-time thread.
+     * @param[in] param the parameters of the real-time thread.
+     * @return true if all the tasks were successfully executed.
+     */
+    bool ExecuteCycle(MultiCoreThreadParam &param) const;
+
+    /**
+     * @brief Frees the dependency graphs.
+     */
+    void FreeTaskGraphs();
+
+    /**
+     * The array of identifiers of the thread in execution.
+     */
+    MultiThreadService *multiThreadService[2];
+
+    /**
+     * The array of the thread parameters
+     */
+    MultiCoreThreadParam *rtThreadInfo[2];
+
+    /**
+     * Number of real-time threads in each buffer.
+     */
+    uint32 numberOfRealTimeThreads[2];
+
+    /**
+     * The real-time threads helped by the workers, in each buffer.
+     */
+    uint32 *parallelThreads[2];
+
+    /**
+     * Number of real-time threads helped by the workers, in each buffer.
+     */
+    uint32 numberOfParallelThreads[2];
+
+    /**
+     * The dependency graphs, indexed by state and by thread.
+     */
+    MultiCoreTaskGraph **graphs;
+
+    /**
+     * Number of states in the graphs array.
+     */
+    uint32 numberOfGraphStates;
+
+    /**
+     * Number of threads of each state in the graphs array.
+     */
+    uint32 *numberOfGraphThreads;
+
+    /**
+     * Names of the states in the graphs array.
+     */
+    StreamString *graphStateNames;
+
+    /**
+     * Names of the threads in the graphs array.
+     */
+    StreamString **graphThreadNames;
+
+    /**
+     * Number of worker threads that help each real-time thread.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * CPU mask of each worker. NULL if there are no workers.
+     */
+    uint32 *workerCPUs;
+
+    /**
+     * The eventSemaphore
+     */
+    EventSem eventSem;
+
+    /**
+     * Registers the callback function to be called by the MultiThreadService
+     */
+    EmbeddedServiceMethodBinderT<MultiCoreGAMScheduler> binder;
+
+    /**
+     * Message to be fired in case of execution error
+     */
+    ReferenceT<Message> errorMessage;
+
+    /**
+     * Specialised real-time application reference.
+     */
+    ReferenceT<RealTimeApplication> realTimeApplicationT;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MULTICOREGAMSCHEDULER_H_ */
@@ -0,0 +1,216 @@
+/**
+ * @file ArenaHeapTest.cpp
+ * @brief Source file for class ArenaHeapTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeapTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeapTest.h"
+#include "HeapManager.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ArenaHeapTest::TestConstructor() {
+    ArenaHeap heap;
+    bool ok = (heap.GetSize() == 0u);
+    if (ok) {
+        ok = (heap.GetUsedSize() == 0u);
+    }
+    if (ok) {
+        ok = (heap.FirstAddress() == 0u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "") == 0);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestCreate() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 1024u, false);
+    if (ok) {
+        ok = (heap.GetSize() >= 1024u);
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == 0u);
+    }
+    if (ok) {
+        ok = ((heap.LastAddress() - heap.FirstAddress()) == (heap.GetSize() - 1u));
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "ArenaHeapTest") == 0);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("ArenaHeapTest") == &heap);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestCreate_False() {
+    ArenaHeap heap1;
+    bool ok = heap1.Create("ArenaHeapTest", 1024u, false);
+    if (ok) {
+        ok = !heap1.Create("ArenaHeapTest", 1024u, false);
+    }
+    ArenaHeap heap2;
+    if (ok) {
+        ok = !heap2.Create(NULL_PTR(const char8 *), 1024u, false);
+    }
+    ArenaHeap heap3;
+    if (ok) {
+        ok = !heap3.Create("ArenaHeapTest3", 0u, false);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestMalloc() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 256u, false);
+    uint8 *block1 = NULL_PTR(uint8 *);
+    uint8 *block2 = NULL_PTR(uint8 *);
+    if (ok) {
+        block1 = static_cast<uint8 *>(heap.Malloc(10u));
+        block2 = static_cast<uint8 *>(heap.Malloc(20u));
+        ok = ((block1 != NULL_PTR(uint8 *)) && (block2 != NULL_PTR(uint8 *)));
+    }
+    if (ok) {
+        //header + 16 bytes
+        ok = (block2 == &block1[2u * ArenaHeapAlignment]);
+    }
+    if (ok) {
+        /*lint -e{9091} -e{923} check the alignment*/
+        ok = ((reinterpret_cast<uintp>(block2) % ArenaHeapAlignment) == 0u);
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == (5u * ArenaHeapAlignment));
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap(block2) == &heap);
+    }
+    if (ok) {
+        ok = (heap.Malloc(0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.Malloc(256u) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestFree() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 256u, false);
+    void *block = NULL_PTR(void *);
+    if (ok) {
+        block = heap.Malloc(10u);
+        ok = (block != NULL_PTR(void *));
+    }
+    uint32 usedSize = heap.GetUsedSize();
+    if (ok) {
+        ok = HeapManager::Free(block);
+    }
+    if (ok) {
+        ok = (block == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == usedSize);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRealloc() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 256u, false);
+    void *block = NULL_PTR(void *);
+    if (ok) {
+        block = heap.Realloc(block, 10u);
+        ok = (block != NULL_PTR(void *));
+    }
+    void *sameBlock = block;
+    if (ok) {
+        (void) StringHelper::Copy(static_cast<char8 *>(block), "Realloc");
+        ok = (heap.Realloc(block, 8u) == sameBlock);
+    }
+    if (ok) {
+        ok = (heap.Realloc(block, 40u) != sameBlock);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(block), "Realloc") == 0);
+    }
+    if (ok) {
+        ok = (heap.Realloc(block, 0u) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestDuplicate() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 256u, false);
+    void *duplicate = NULL_PTR(void *);
+    if (ok) {
+        duplicate = heap.Duplicate("Duplicate");
+        ok = (duplicate != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(duplicate), "Duplicate") == 0);
+    }
+    if (ok) {
+        duplicate = heap.Duplicate("Duplicate", 3u);
+        ok = (duplicate != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (StringHelper::CompareN(static_cast<char8 *>(duplicate), "Dup", 3u) == 0);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestReset() {
+    ArenaHeap heap;
+    bool ok = heap.Create("ArenaHeapTest", 256u, false);
+    void *block1 = NULL_PTR(void *);
+    if (ok) {
+        block1 = heap.Malloc(100u);
+        ok = (block1 != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() > 0u);
+    }
+    if (ok) {
+        heap.Reset();
+        ok = (heap.GetUsedSize() == 0u);
+    }
+    if (ok) {
+        ok = (heap.Malloc(100u) == block1);
+    }
+    return ok;
+}
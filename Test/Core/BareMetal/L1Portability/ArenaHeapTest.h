@@ -0,0 +1,94 @@
+/**
+ * @file ArenaHeapTest.h
+ * @brief Header file for class ArenaHeapTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENAHEAPTEST_H_
+#define ARENAHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeap.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the ArenaHeap functions.
+ */
+class ArenaHeapTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Create allocates the arena and registers the heap in the HeapManager.
+     */
+    bool TestCreate();
+
+    /**
+     * @brief Tests that Create fails if called twice or with invalid parameters.
+     */
+    bool TestCreate_False();
+
+    /**
+     * @brief Tests that Malloc returns aligned and consecutive memory until the arena is exhausted.
+     */
+    bool TestMalloc();
+
+    /**
+     * @brief Tests that Free does not reclaim memory.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests the Realloc function.
+     */
+    bool TestRealloc();
+
+    /**
+     * @brief Tests the Duplicate function.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests that Reset reclaims all the memory.
+     */
+    bool TestReset();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENAHEAPTEST_H_ */
@@ -78,6 +78,12 @@ public:
      */
     bool TestExchange();
 
+    /**
+     * @brief Tests the compare and swap function.
+     * @return true if the value is only swapped when it is equal to the expected value.
+     */
+    bool TestCompareAndSwap();
+
     /**
      * @brief Tests the addition function.
      * @return true if the testValue can be successfully added to a dummy value (10).
@@ -169,6 +175,24 @@ bool AtomicTest<T>::TestExchange() {
     return testResult;
 }
 
+template<class T>
+bool AtomicTest<T>::TestCompareAndSwap() {
+    volatile T auxValue = testValue;
+
+    bool testResult = !Atomic::CompareAndSwap(&auxValue, static_cast<T>(testValue + 1), static_cast<T>(1234));
+    if (testResult) {
+        testResult = (auxValue == testValue);
+    }
+    if (testResult) {
+        testResult = Atomic::CompareAndSwap(&auxValue, testValue, static_cast<T>(1234));
+    }
+    if (testResult) {
+        testResult = (auxValue == 1234);
+    }
+
+    return testResult;
+}
+
 template<class T>
 bool AtomicTest<T>::TestAdd() {
     bool testResult = false;
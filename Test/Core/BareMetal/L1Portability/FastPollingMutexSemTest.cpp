@@ -325,3 +325,139 @@ bool FastPollingMutexSemTest::TestRecursive() {
     }
     return test;
 }
+
+bool FastPollingMutexSemTest::TestCreateAdaptive(bool locked) {
+    FastPollingMutexSem testSem;
+    bool test = !testSem.IsAdaptive();
+    testSem.Create(locked, true);
+    test &= testSem.IsAdaptive();
+    if (locked) {
+        test &= testSem.Locked();
+    }
+    else {
+        test &= !testSem.Locked();
+    }
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastLockAdaptive(int32 nOfThreads,
+                                                   TimeoutType timeout) {
+    testMutex.Create(false, true);
+    bool test = GenericMutexTestCaller(nOfThreads, timeout, (ThreadFunctionType) TestFastLockCallback);
+    if (test) {
+        test = !testMutex.Locked();
+    }
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastLockErrorCodeAdaptive() {
+    testMutex.Create(false, true);
+    bool ok = TestFastLockErrorCode();
+    if (ok) {
+        ok = !testMutex.Locked();
+    }
+    return ok;
+}
+
+void TestFastUnLockAdaptiveCallback(FastPollingMutexSemTest &mt) {
+    mt.failed = (mt.testMutex.FastLock() != ErrorManagement::NoError);
+    mt.sharedVariable++;
+    mt.testMutex.FastUnLock();
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+/**
+ * Number of lock/unlock iterations of each thread in TestFastLockAdaptive_Contention.
+ */
+static const int32 FAST_POLLING_MUTEX_SEM_TEST_CONTENTION_ITERATIONS = 2000;
+
+void TestFastLockAdaptiveContentionCallback(FastPollingMutexSemTest &mt) {
+    mt.synchSem.Wait();
+    for (int32 i = 0; i < FAST_POLLING_MUTEX_SEM_TEST_CONTENTION_ITERATIONS; i++) {
+        if (mt.testMutex.FastLock() != ErrorManagement::NoError) {
+            mt.failed = true;
+        }
+        mt.sharedVariable++;
+        //Hold the lock for longer once in a while so that the other threads exhaust the spin and park.
+        if ((i % 64) == 0) {
+            Sleep::MSec(1);
+        }
+        mt.testMutex.FastUnLock();
+    }
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+bool FastPollingMutexSemTest::TestFastLockAdaptive_Contention(int32 nOfThreads) {
+    testMutex.Create(false, true);
+    sharedVariable = 0;
+    nOfExecutingThreads = nOfThreads;
+    failed = false;
+    synchSem.Reset();
+    for (int32 i = 0; i < nOfThreads; i++) {
+        Threads::BeginThread((ThreadFunctionType) TestFastLockAdaptiveContentionCallback, this);
+    }
+    synchSem.Post();
+    //A lost wake-up leaves a thread parked forever.
+    int32 counter = 0;
+    while ((nOfExecutingThreads > 0) && (counter < 3000)) {
+        Sleep::MSec(10);
+        counter++;
+    }
+    bool test = (nOfExecutingThreads == 0);
+    if (test) {
+        test = (sharedVariable == (nOfThreads * FAST_POLLING_MUTEX_SEM_TEST_CONTENTION_ITERATIONS)) && (!failed) && (!testMutex.Locked());
+    }
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastTryLockAdaptive_Parked() {
+    testMutex.Create(true, true);
+    sharedVariable = 0;
+    nOfExecutingThreads = 1;
+    failed = false;
+    Threads::BeginThread((ThreadFunctionType) TestFastUnLockAdaptiveCallback, this);
+    //Let the thread exhaust the spin and park
+    Sleep::MSec(100);
+    bool test = (sharedVariable == 0);
+    //Another thread failing to acquire while the thread is parked.
+    if (test) {
+        test = !testMutex.FastTryLock();
+    }
+    testMutex.FastUnLock();
+    int32 counter = 0;
+    while ((nOfExecutingThreads > 0) && (counter < 100)) {
+        Sleep::MSec(10);
+        counter++;
+    }
+    if (test) {
+        test = (nOfExecutingThreads == 0);
+    }
+    if (test) {
+        test = (sharedVariable == 1) && (!failed) && (!testMutex.Locked());
+    }
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastUnLockAdaptive() {
+    testMutex.Create(true, true);
+    sharedVariable = 0;
+    nOfExecutingThreads = 1;
+    failed = false;
+    Threads::BeginThread((ThreadFunctionType) TestFastUnLockAdaptiveCallback, this);
+    //Let the thread exhaust the spin and park
+    Sleep::MSec(100);
+    bool test = (sharedVariable == 0);
+    testMutex.FastUnLock();
+    int32 counter = 0;
+    while ((nOfExecutingThreads > 0) && (counter < 100)) {
+        Sleep::MSec(10);
+        counter++;
+    }
+    if (test) {
+        test = (nOfExecutingThreads == 0);
+    }
+    if (test) {
+        test = (sharedVariable == 1) && (!failed) && (!testMutex.Locked());
+    }
+    return test;
+}
@@ -164,6 +164,43 @@ public:
      */
     bool TestRecursive();
 
+    /**
+     * @brief Tests the FastPollingMutexSem::Create function in adaptive mode.
+     * @return true if the semaphore is created in the requested state and FastPollingMutexSem::IsAdaptive returns true.
+     */
+    bool TestCreateAdaptive(bool locked);
+
+    /**
+     * @see TestFastLock with FastPollingMutexSem created in adaptive mode.
+     */
+    bool TestFastLockAdaptive(int32 nOfThreads,
+                              TimeoutType timeout);
+
+    /**
+     * @see TestFastLockErrorCode with FastPollingMutexSem created in adaptive mode.
+     */
+    bool TestFastLockErrorCodeAdaptive();
+
+    /**
+     * @brief Verifies that a thread parked in an adaptive FastPollingMutexSem::FastLock is woken by FastPollingMutexSem::FastUnLock.
+     * @return true if the waiting thread acquires the semaphore after FastPollingMutexSem::FastUnLock.
+     */
+    bool TestFastUnLockAdaptive();
+
+    /**
+     * @brief Verifies that \a nOfThreads threads contending for an adaptive FastPollingMutexSem (so that some of them park
+     * while others keep trying to acquire it) all finish, i.e. that no parked thread loses its wake-up.
+     * @return true if all the threads finish all their iterations.
+     */
+    bool TestFastLockAdaptive_Contention(int32 nOfThreads);
+
+    /**
+     * @brief Verifies that a failed FastPollingMutexSem::FastTryLock on an adaptive semaphore with a parked thread
+     * does not overwrite the contended state, i.e. that the parked thread is still woken by FastPollingMutexSem::FastUnLock.
+     * @return true if the parked thread acquires the semaphore after FastPollingMutexSem::FastUnLock.
+     */
+    bool TestFastTryLockAdaptive_Parked();
+
 private:
 
     /**
@@ -256,6 +293,15 @@ private:
      * @see TestRecursive
      */
     friend void TestRecursiveCallback(FastPollingMutexSemTest &mt);
+    /**
+     * @see TestFastUnLockAdaptive
+     */
+    friend void TestFastUnLockAdaptiveCallback(FastPollingMutexSemTest &mt);
+
+    /**
+     * @see TestFastLockAdaptive_Contention
+     */
+    friend void TestFastLockAdaptiveContentionCallback(FastPollingMutexSemTest &mt);
 };
 
 /*---------------------------------------------------------------------------*/
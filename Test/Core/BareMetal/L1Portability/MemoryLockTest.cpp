@@ -0,0 +1,107 @@
+/**
+ * @file MemoryLockTest.cpp
+ * @brief Source file for class MemoryLockTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryLockTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryLockTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MemoryLockTest::TestLock_False_NULL() {
+    bool ok = !MemoryLock::Lock(NULL_PTR(void *), 16u);
+    if (ok) {
+        ok = !MemoryLock::Unlock(NULL_PTR(void *), 16u);
+    }
+    return ok;
+}
+
+bool MemoryLockTest::TestLockUnlock() {
+    //A few bytes are within the default locked memory limit of unprivileged processes.
+    uint8 memory[64] = { 0u };
+    bool ok = MemoryLock::Lock(&memory[0], static_cast<uint32>(sizeof(memory)));
+    if (ok) {
+        ok = MemoryLock::Unlock(&memory[0], static_cast<uint32>(sizeof(memory)));
+    }
+    return ok;
+}
+
+bool MemoryLockTest::TestPreFault() {
+    uint8 memory[64];
+    uint32 i;
+    for (i = 0u; i < sizeof(memory); i++) {
+        memory[i] = 0xAAu;
+    }
+    MemoryLock::PreFault(&memory[0], static_cast<uint32>(sizeof(memory)));
+    bool ok = true;
+    for (i = 0u; (i < sizeof(memory)) && (ok); i++) {
+        ok = (memory[i] == 0u);
+    }
+    //Does not crash
+    MemoryLock::PreFault(NULL_PTR(void *), 16u);
+    return ok;
+}
+
+bool MemoryLockTest::TestTouch() {
+    const uint32 size = 3u * 4096u + 17u;
+    uint8 *memory = new uint8[size];
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        memory[i] = static_cast<uint8>(i % 251u);
+    }
+    MemoryLock::Touch(memory, size);
+    bool ok = true;
+    for (i = 0u; (i < size) && (ok); i++) {
+        ok = (memory[i] == static_cast<uint8>(i % 251u));
+    }
+    delete[] memory;
+    //Does not crash
+    MemoryLock::Touch(NULL_PTR(void *), 16u);
+    return ok;
+}
+
+bool MemoryLockTest::TestTouch_ReadOnly() {
+    //Placed in read-only memory: any write would crash.
+    static const uint8 readOnlyMemory[3u * 4096u + 17u] = { 1u, 2u, 3u };
+    MemoryLock::Touch(&readOnlyMemory[0], static_cast<uint32>(sizeof(readOnlyMemory)));
+    return (readOnlyMemory[2] == 3u);
+}
+
+bool MemoryLockTest::TestLockAllUnlockAll() {
+    bool ok = MemoryLock::LockAll();
+    if (ok) {
+        ok = MemoryLock::UnlockAll();
+    }
+    return ok;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file MemoryLockTest.h
+ * @brief Header file for class MemoryLockTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryLockTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYLOCKTEST_H_
+#define MEMORYLOCKTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryLock.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the MemoryLock functions.
+ */
+class MemoryLockTest {
+public:
+
+    /**
+     * @brief Tests that Lock and Unlock fail with a NULL address.
+     */
+    bool TestLock_False_NULL();
+
+    /**
+     * @brief Tests that a small memory area can be locked and unlocked.
+     */
+    bool TestLockUnlock();
+
+    /**
+     * @brief Tests that PreFault sets the memory to zero.
+     */
+    bool TestPreFault();
+
+    /**
+     * @brief Tests that Touch preserves the content of a memory area spanning several pages.
+     */
+    bool TestTouch();
+
+    /**
+     * @brief Tests that Touch only reads the memory area (i.e. that it can touch read-only memory).
+     */
+    bool TestTouch_ReadOnly();
+
+    /**
+     * @brief Tests that the process memory can be locked and unlocked.
+     */
+    bool TestLockAllUnlockAll();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYLOCKTEST_H_ */
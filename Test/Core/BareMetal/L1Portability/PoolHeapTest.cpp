@@ -0,0 +1,361 @@
+/**
+ * @file PoolHeapTest.cpp
+ * @brief Source file for class PoolHeapTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PoolHeapTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "HeapManager.h"
+#include "PoolHeapTest.h"
+#include "ReferenceContainer.h"
+#include "ReferenceT.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Shared by the threads of TestMallocFree_Threads.
+ */
+struct PoolHeapTestThreadParameters {
+    PoolHeap *heap;
+    volatile int32 finished;
+    volatile int32 errors;
+};
+
+static void PoolHeapTestThread(PoolHeapTestThreadParameters * const parameters) {
+    uint32 i;
+    for (i = 0u; i < 10000u; i++) {
+        uint32 size = 1u + ((i * 7u) % 60u);
+        uint8 *block = static_cast<uint8 *>(parameters->heap->Malloc(size));
+        if (block != NULL_PTR(uint8 *)) {
+            uint32 j;
+            uint8 pattern = static_cast<uint8>(i);
+            for (j = 0u; j < size; j++) {
+                block[j] = pattern;
+            }
+            Atomic::Pause();
+            for (j = 0u; j < size; j++) {
+                if (block[j] != pattern) {
+                    Atomic::Increment(&parameters->errors);
+                }
+            }
+            void *toFree = block;
+            parameters->heap->Free(toFree);
+        }
+        else {
+            Atomic::Increment(&parameters->errors);
+        }
+    }
+    Atomic::Increment(&parameters->finished);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool PoolHeapTest::TestConstructor() {
+    PoolHeap heap;
+    bool ok = (heap.GetNumberOfSizeClasses() == 0u);
+    if (ok) {
+        ok = (heap.FirstAddress() == 0u);
+    }
+    if (ok) {
+        ok = (heap.LastAddress() == 0u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "") == 0);
+    }
+    if (ok) {
+        ok = !heap.IsMemoryLocked();
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestCreate() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 100u, 4u, false);
+    if (ok) {
+        ok = (heap.GetNumberOfSizeClasses() == 4u);
+    }
+    uint32 c;
+    for (c = 0u; (c < 4u) && (ok); c++) {
+        ok = (heap.GetBlockSize(c) == (16u << c));
+        if (ok) {
+            ok = (heap.GetNumberOfFreeBlocks(c) == 4u);
+        }
+    }
+    if (ok) {
+        ok = (heap.GetBlockSize(4u) == 0u);
+    }
+    if (ok) {
+        ok = ((heap.LastAddress() - heap.FirstAddress()) == (((16u + 32u + 64u + 128u) * 4u) - 1u));
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(heap.Name(), "PoolHeapTest") == 0);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap("PoolHeapTest") == &heap);
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestCreate_False_Twice() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 100u, 4u, false);
+    if (ok) {
+        ok = !heap.Create("PoolHeapTest2", 100u, 4u, false);
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestCreate_False_Parameters() {
+    PoolHeap heap1;
+    bool ok = !heap1.Create(NULL_PTR(const char8 *), 100u, 4u, false);
+    PoolHeap heap2;
+    if (ok) {
+        ok = !heap2.Create("PoolHeapTest", 0u, 4u, false);
+    }
+    PoolHeap heap3;
+    if (ok) {
+        ok = !heap3.Create("PoolHeapTest", 100u, 0u, false);
+    }
+    PoolHeap heap4;
+    if (ok) {
+        ok = !heap4.Create("PoolHeapTest", 0xFFFFFFFFu, 1u, false);
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestDestructor() {
+    PoolHeap *heap = new PoolHeap();
+    bool ok = heap->Create("PoolHeapTest", 100u, 4u, false);
+    if (ok) {
+        ok = (HeapManager::FindHeap("PoolHeapTest") == heap);
+    }
+    delete heap;
+    if (ok) {
+        ok = (HeapManager::FindHeap("PoolHeapTest") == NULL_PTR(HeapI *));
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestMalloc() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 100u, 4u, false);
+    void *block = NULL_PTR(void *);
+    if (ok) {
+        block = heap.Malloc(20u);
+        ok = (block != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = ((heap.GetNumberOfFreeBlocks(0u) == 4u) && (heap.GetNumberOfFreeBlocks(1u) == 3u));
+    }
+    if (ok) {
+        ok = heap.Owns(block);
+    }
+    if (ok) {
+        ok = (HeapManager::FindHeap(block) == &heap);
+    }
+    if (ok) {
+        /*lint -e{9091} -e{923} check the alignment*/
+        ok = ((reinterpret_cast<uintp>(block) % PoolHeapMinimumBlockSize) == 0u);
+    }
+    if (ok) {
+        ok = (heap.Malloc(0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.Malloc(129u) == NULL_PTR(void *));
+    }
+    heap.Free(block);
+    return ok;
+}
+
+bool PoolHeapTest::TestMalloc_Exhausted() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 32u, 2u, false);
+    void *blocks[4];
+    uint32 i;
+    for (i = 0u; (i < 4u) && (ok); i++) {
+        blocks[i] = heap.Malloc(10u);
+        ok = (blocks[i] != NULL_PTR(void *));
+    }
+    if (ok) {
+        //The last two were served by the 32 bytes size class
+        ok = ((heap.GetNumberOfFreeBlocks(0u) == 0u) && (heap.GetNumberOfFreeBlocks(1u) == 0u));
+    }
+    if (ok) {
+        ok = (heap.Malloc(10u) == NULL_PTR(void *));
+    }
+    for (i = 0u; i < 4u; i++) {
+        heap.Free(blocks[i]);
+    }
+    if (ok) {
+        ok = ((heap.GetNumberOfFreeBlocks(0u) == 2u) && (heap.GetNumberOfFreeBlocks(1u) == 2u));
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestFree() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 64u, 2u, false);
+    void *block1 = NULL_PTR(void *);
+    void *block2 = NULL_PTR(void *);
+    if (ok) {
+        block1 = heap.Malloc(64u);
+        block2 = heap.Malloc(64u);
+        ok = ((block1 != NULL_PTR(void *)) && (block2 != NULL_PTR(void *)) && (block1 != block2));
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfFreeBlocks(2u) == 0u);
+    }
+    if (ok) {
+        heap.Free(block1);
+        ok = (block1 == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = HeapManager::Free(block2);
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfFreeBlocks(2u) == 2u);
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestRealloc() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 64u, 2u, false);
+    void *block = NULL_PTR(void *);
+    if (ok) {
+        block = heap.Realloc(block, 10u);
+        ok = (block != NULL_PTR(void *));
+    }
+    void *sameBlock = block;
+    if (ok) {
+        (void) StringHelper::Copy(static_cast<char8 *>(block), "Realloc");
+        ok = (heap.Realloc(block, 16u) == sameBlock);
+    }
+    if (ok) {
+        ok = (heap.Realloc(block, 40u) != sameBlock);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(block), "Realloc") == 0);
+    }
+    if (ok) {
+        ok = ((heap.GetNumberOfFreeBlocks(0u) == 2u) && (heap.GetNumberOfFreeBlocks(2u) == 1u));
+    }
+    if (ok) {
+        ok = (heap.Realloc(block, 0u) == NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfFreeBlocks(2u) == 2u);
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestDuplicate() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 64u, 2u, false);
+    void *duplicate = NULL_PTR(void *);
+    if (ok) {
+        duplicate = heap.Duplicate("Duplicate");
+        ok = (duplicate != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(duplicate), "Duplicate") == 0);
+    }
+    heap.Free(duplicate);
+    if (ok) {
+        duplicate = heap.Duplicate("Duplicate", 3u);
+        ok = (duplicate != NULL_PTR(void *));
+    }
+    if (ok) {
+        ok = (StringHelper::CompareN(static_cast<char8 *>(duplicate), "Dup", 3u) == 0);
+    }
+    heap.Free(duplicate);
+    if (ok) {
+        ok = (heap.Duplicate(NULL_PTR(void *)) == NULL_PTR(void *));
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestCreateObject() {
+    PoolHeap heap;
+    bool ok = heap.Create("PoolHeapTest", 1024u, 4u, false);
+    uint32 freeBlocks[8];
+    uint32 c;
+    for (c = 0u; (c < heap.GetNumberOfSizeClasses()) && (ok); c++) {
+        freeBlocks[c] = heap.GetNumberOfFreeBlocks(c);
+    }
+    if (ok) {
+        ReferenceT<ReferenceContainer> container("ReferenceContainer", &heap);
+        ok = container.IsValid();
+        if (ok) {
+            ok = heap.Owns(container.operator->());
+        }
+    }
+    //The object was returned to the heap when the last reference was removed
+    for (c = 0u; (c < heap.GetNumberOfSizeClasses()) && (ok); c++) {
+        ok = (freeBlocks[c] == heap.GetNumberOfFreeBlocks(c));
+    }
+    return ok;
+}
+
+bool PoolHeapTest::TestMallocFree_Threads() {
+    PoolHeap heap;
+    //Enough blocks for all the threads, but the size classes are shared.
+    bool ok = heap.Create("PoolHeapTest", 64u, 8u, false);
+    PoolHeapTestThreadParameters parameters;
+    parameters.heap = &heap;
+    parameters.finished = 0;
+    parameters.errors = 0;
+    const int32 numberOfThreads = 4;
+    int32 i;
+    for (i = 0; (i < numberOfThreads) && (ok); i++) {
+        ok = (Threads::BeginThread(reinterpret_cast<ThreadFunctionType>(&PoolHeapTestThread), &parameters) != InvalidThreadIdentifier);
+    }
+    uint32 timeout = 0u;
+    while ((parameters.finished < i) && (timeout < 10000u)) {
+        Sleep::MSec(1u);
+        timeout++;
+    }
+    if (ok) {
+        ok = (parameters.finished == numberOfThreads);
+    }
+    if (ok) {
+        ok = (parameters.errors == 0);
+    }
+    uint32 c;
+    for (c = 0u; (c < heap.GetNumberOfSizeClasses()) && (ok); c++) {
+        ok = (heap.GetNumberOfFreeBlocks(c) == 8u);
+    }
+    return ok;
+}
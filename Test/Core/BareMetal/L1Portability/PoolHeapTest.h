@@ -0,0 +1,114 @@
+/**
+ * @file PoolHeapTest.h
+ * @brief Header file for class PoolHeapTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class PoolHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef POOLHEAPTEST_H_
+#define POOLHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "PoolHeap.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the PoolHeap functions.
+ */
+class PoolHeapTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Create builds the size classes and registers the heap in the HeapManager.
+     */
+    bool TestCreate();
+
+    /**
+     * @brief Tests that Create fails if called twice.
+     */
+    bool TestCreate_False_Twice();
+
+    /**
+     * @brief Tests that Create fails with invalid parameters.
+     */
+    bool TestCreate_False_Parameters();
+
+    /**
+     * @brief Tests that the destructor removes the heap from the HeapManager.
+     */
+    bool TestDestructor();
+
+    /**
+     * @brief Tests that Malloc returns a block of the smallest size class that fits.
+     */
+    bool TestMalloc();
+
+    /**
+     * @brief Tests that Malloc uses a larger size class when a size class is exhausted and fails when all are exhausted.
+     */
+    bool TestMalloc_Exhausted();
+
+    /**
+     * @brief Tests that Free returns the block to its size class, also through the HeapManager.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests the Realloc function.
+     */
+    bool TestRealloc();
+
+    /**
+     * @brief Tests the Duplicate function.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests that objects can be built on the heap and are returned to it when destroyed.
+     */
+    bool TestCreateObject();
+
+    /**
+     * @brief Tests concurrent Malloc and Free from several threads.
+     */
+    bool TestMallocFree_Threads();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* POOLHEAPTEST_H_ */
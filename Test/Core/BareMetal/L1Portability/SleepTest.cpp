@@ -120,6 +120,22 @@ bool SleepTest::TestSemiBusy(float64 totalSleepSec,
     return testResult;
 }
 
+bool SleepTest::TestUntilCounter(float64 sec) {
+    uint64 startTicks = HighResolutionTimer::Counter();
+    uint64 deltaTicks = static_cast<uint64>(sec * static_cast<float64>(HighResolutionTimer::Frequency()));
+    Sleep::UntilCounter(startTicks + deltaTicks);
+    uint64 elapsedTicks = HighResolutionTimer::Counter() - startTicks;
+    return ((elapsedTicks >= deltaTicks) && (elapsedTicks <= (2u * deltaTicks)));
+}
+
+bool SleepTest::TestUntilCounter_Past() {
+    uint64 startTicks = HighResolutionTimer::Counter();
+    Sleep::UntilCounter(startTicks - HighResolutionTimer::Frequency());
+    uint64 elapsedTicks = HighResolutionTimer::Counter() - startTicks;
+    //Far less than the one second that it would have slept if the deadline had been treated as an unsigned delta.
+    return (elapsedTicks < (HighResolutionTimer::Frequency() / 10u));
+}
+
 bool SleepTest::TestSetSchedulerGranularity() {
     uint32 currentValue = Sleep::GetSchedulerGranularity();
     uint32 valueToSet = 123456;
@@ -90,6 +90,18 @@ public:
     bool TestSemiBusy(float64 totalSleepSec,
                       float64 nonBusySleepSec);
 
+    /**
+     * @brief Tests the Sleep::UntilCounter function.
+     * @param[in] sec is the time to sleep, relative to the current counter.
+     * @return true if it does not return before the deadline and sleeps less than the double of sec.
+     */
+    bool TestUntilCounter(float64 sec);
+
+    /**
+     * @brief Tests that the Sleep::UntilCounter function returns immediately if the deadline is in the past.
+     */
+    bool TestUntilCounter_Past();
+
     /**
      * @brief Tests the GetSchedulerGranularity function.
      */
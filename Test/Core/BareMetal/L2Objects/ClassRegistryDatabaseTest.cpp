@@ -281,3 +281,87 @@ bool ClassRegistryDatabaseTest::TestCleanUp() {
     testDB.CleanUp();
     return testDB.GetSize() == 0;
 }
+
+bool ClassRegistryDatabaseTest::TestFind_Index() {
+    const uint32 numberOfClasses = 256u;
+    char8 names[numberOfClasses][16];
+    char8 typeIdNames[numberOfClasses][16];
+    ClassProperties cps[numberOfClasses];
+    DummyClassRegistryDatabase testDB;
+    ClassRegistryItem *items[numberOfClasses];
+    for (uint32 i = 0u; i < numberOfClasses; i++) {
+        //Build unique names without depending on the streams
+        StringHelper::Copy(&names[i][0], "IndexClass");
+        StringHelper::Copy(&typeIdNames[i][0], "IndexTypeId");
+        char8 suffix[4] = { static_cast<char8>('A' + (i / 26u / 26u)), static_cast<char8>('A' + ((i / 26u) % 26u)), static_cast<char8>('A' + (i % 26u)), '\0' };
+        StringHelper::Concatenate(&names[i][0], &suffix[0]);
+        StringHelper::Concatenate(&typeIdNames[i][0], &suffix[0]);
+        cps[i] = ClassProperties(&names[i][0], &typeIdNames[i][0], "1.0");
+        items[i] = new DummyClassRegistryItem(cps[i]);
+        testDB.Add(items[i]);
+    }
+    bool ok = (testDB.GetSize() == numberOfClasses);
+    for (uint32 i = 0u; (i < numberOfClasses) && (ok); i++) {
+        ok = (testDB.Find(&names[i][0]) == items[i]);
+        if (ok) {
+            ok = (testDB.FindTypeIdName(&typeIdNames[i][0]) == items[i]);
+        }
+        if (ok) {
+            //The class name is not a typeid name
+            ok = (testDB.FindTypeIdName(&names[i][0]) == NULL);
+        }
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("IndexTypeIdZZZ") == NULL);
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFind_IndexSameName() {
+    ClassProperties cp1("IndexSameName", "IndexSameNameTypeId1", "1.0");
+    ClassProperties cp2("IndexSameName", "IndexSameNameTypeId2", "1.0");
+    DummyClassRegistryDatabase testDB;
+    ClassRegistryItem *p1 = new DummyClassRegistryItem(cp1);
+    ClassRegistryItem *p2 = new DummyClassRegistryItem(cp2);
+    testDB.Add(p1);
+    testDB.Add(p2);
+    bool ok = (testDB.Find("IndexSameName") == p1);
+    if (ok) {
+        ok = (testDB.FindTypeIdName("IndexSameNameTypeId1") == p1);
+    }
+    if (ok) {
+        ok = (testDB.FindTypeIdName("IndexSameNameTypeId2") == p2);
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestFind_IndexNullName() {
+    ClassProperties cpNull;
+    ClassProperties cp("IndexNotNullName", "IndexNotNullNameTypeId", "1.0");
+    DummyClassRegistryDatabase testDB;
+    ClassRegistryItem *pNull = new DummyClassRegistryItem(cpNull);
+    ClassRegistryItem *p = new DummyClassRegistryItem(cp);
+    testDB.Add(pNull);
+    testDB.Add(p);
+    bool ok = (testDB.Find("IndexNotNullName") == p);
+    if (ok) {
+        ok = (testDB.FindTypeIdName("IndexNotNullNameTypeId") == p);
+    }
+    return ok;
+}
+
+bool ClassRegistryDatabaseTest::TestCleanUp_Index() {
+    ClassProperties cp("IndexCleanUp", "IndexCleanUpTypeId", "1.0");
+    DummyClassRegistryDatabase testDB;
+    ClassRegistryItem *p = new DummyClassRegistryItem(cp);
+    testDB.Add(p);
+    bool ok = (testDB.FindTypeIdName("IndexCleanUpTypeId") == p);
+    if (ok) {
+        testDB.CleanUp();
+        ok = (testDB.FindTypeIdName("IndexCleanUpTypeId") == NULL);
+    }
+    if (ok) {
+        ok = (testDB.Find("IndexCleanUp") == NULL);
+    }
+    return ok;
+}
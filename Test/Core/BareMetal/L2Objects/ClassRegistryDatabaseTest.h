@@ -159,6 +159,26 @@ public:
 
     bool TestCleanUp();
 
+    /**
+     * @brief Tests that Find and FindTypeIdName find all the classes of a database with many registered classes.
+     */
+    bool TestFind_Index();
+
+    /**
+     * @brief Tests that Find returns the first registered class when more than one class is registered with the same name.
+     */
+    bool TestFind_IndexSameName();
+
+    /**
+     * @brief Tests that Find and FindTypeIdName still find the classes that were registered with a NULL name.
+     */
+    bool TestFind_IndexNullName();
+
+    /**
+     * @brief Tests that CleanUp also removes the classes from the indexes.
+     */
+    bool TestCleanUp_Index();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -29,8 +29,11 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "ClassRegistryItemT.h"
 #include "ObjectRegistryDatabaseTest.h"
+#include "Sleep.h"
+#include "Threads.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,6 +46,37 @@ bool PID::Initialise(StructuredDataI & data) {
 }
 CLASS_REGISTER(PID, "1.0")
 
+/**
+ * Number of times that the subtree A.B.D.PID is inserted and deleted by PathIndexInsertDeleteRoutine.
+ */
+static const uint32 pathIndexInsertDeleteCycles = 20000u;
+
+/**
+ * Set to 1 by PathIndexInsertDeleteRoutine when it has finished.
+ */
+static volatile int32 pathIndexInsertDeleteDone = 0;
+
+/**
+ * Repeatedly inserts and deletes A.B.D.PID. After each Delete the only References to D and to the PID are released.
+ */
+static void PathIndexInsertDeleteRoutine(const void * const params) {
+    ReferenceT<ReferenceContainer> b = ObjectRegistryDatabase::Instance()->Find("A.B");
+    for (uint32 i = 0u; (i < pathIndexInsertDeleteCycles) && (b.IsValid()); i++) {
+        ReferenceT<ReferenceContainer> d("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ReferenceT<PID> pid("PID", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        d->SetName("D");
+        pid->SetName("PID");
+        pid->Kp = i;
+        (void) d->Insert(pid);
+        (void) b->Insert(d);
+        d = Reference();
+        pid = Reference();
+        (void) b->Delete("D");
+    }
+    (void) Atomic::Exchange(&pathIndexInsertDeleteDone, 1);
+    Threads::EndThread();
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -75,6 +109,7 @@ ObjectRegistryDatabaseTest::ObjectRegistryDatabaseTest() {
 }
 
 ObjectRegistryDatabaseTest::~ObjectRegistryDatabaseTest() {
+    ObjectRegistryDatabase::Instance()->SetPathIndexEnabled(false);
     ObjectRegistryDatabase::Instance()->Purge();
 }
 
@@ -194,3 +229,274 @@ bool ObjectRegistryDatabaseTest::TestGetClassName() {
     return StringHelper::Compare(ObjectRegistryDatabase::Instance()->GetClassName(), "ObjectRegistryDatabase") == 0;
 }
 
+bool ObjectRegistryDatabaseTest::TestSetPathIndexEnabled() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    bool ok = !ord->IsPathIndexEnabled();
+    if (ok) {
+        ok = ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 0u);
+    }
+    if (ok) {
+        ord->SetPathIndexEnabled(true);
+        ok = ord->IsPathIndexEnabled();
+    }
+    if (ok) {
+        ok = ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = ord->Find("A.B").IsValid();
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 2u);
+    }
+    if (ok) {
+        ok = ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 2u);
+    }
+    //Paths that cannot be resolved are not indexed
+    if (ok) {
+        ok = !ord->Find("A.B.D").IsValid();
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 2u);
+    }
+    if (ok) {
+        ord->SetPathIndexEnabled(false);
+        ok = !ord->IsPathIndexEnabled();
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 0u);
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_PathIndex() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    const char8 *paths[] = { "A", "A.PID", "A.B", "A.B.PID", "A.B.C", "A.B.C.PID", NULL_PTR(const char8 *) };
+    Reference expected[6];
+    bool ok = true;
+    for (uint32 i = 0u; (paths[i] != NULL) && (ok); i++) {
+        expected[i] = ord->Find(paths[i]);
+        ok = expected[i].IsValid();
+    }
+    ord->SetPathIndexEnabled(true);
+    //The first iteration fills the index, the second uses it
+    for (uint32 n = 0u; (n < 2u) && (ok); n++) {
+        for (uint32 i = 0u; (paths[i] != NULL) && (ok); i++) {
+            ok = (ord->Find(paths[i]) == expected[i]);
+        }
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 6u);
+    }
+    if (ok) {
+        ReferenceT<PID> test = ord->Find("A.B.C.PID");
+        ok = test.IsValid();
+        if (ok) {
+            ok = (test->Kp == 1);
+        }
+    }
+    //Relative paths are not indexed
+    if (ok) {
+        ReferenceT<PID> test = ord->Find("::PID", ord->Find("A.B.C"));
+        ok = test.IsValid();
+        if (ok) {
+            ok = (test->Kp == 4);
+        }
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 6u);
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_PathIndexDeleteInsert() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->SetPathIndexEnabled(true);
+    ReferenceT<PID> pid = ord->Find("A.B.C.PID");
+    bool ok = pid.IsValid();
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == pid);
+    }
+    ReferenceT<ReferenceContainer> c = ord->Find("A.B.C");
+    if (ok) {
+        ok = c.IsValid();
+    }
+    if (ok) {
+        ok = c->Delete("PID");
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    ReferenceT<PID> newPid("PID", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        newPid->SetName("PID");
+        newPid->Kp = 10;
+        ok = c->Insert(newPid);
+    }
+    if (ok) {
+        ReferenceT<PID> test = ord->Find("A.B.C.PID");
+        ok = (test == newPid);
+        if (ok) {
+            ok = (test->Kp == 10);
+        }
+    }
+    //Modification of an intermediate container
+    ReferenceT<ReferenceContainer> b = ord->Find("A.B");
+    if (ok) {
+        ok = b.IsValid();
+    }
+    if (ok) {
+        ok = b->Delete("C");
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C").IsValid();
+    }
+    if (ok) {
+        ok = b->Insert(c);
+    }
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == newPid);
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_PathIndexCollision() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->SetPathIndexEnabled(false);
+    ord->SetPathIndexEnabled(true);
+    //NodeM08C and NodeQGLD have the same FNV-1a hash.
+    ReferenceT<ReferenceContainer> first("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceT<ReferenceContainer> second("ReferenceContainer", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    first->SetName("NodeM08C");
+    second->SetName("NodeQGLD");
+    Fnv1aHashFunction hashFunction;
+    bool ok = (hashFunction.Compute("NodeM08C", 0u) == hashFunction.Compute("NodeQGLD", 0u));
+    if (ok) {
+        ok = ord->Insert(first);
+    }
+    if (ok) {
+        ok = ord->Insert(second);
+    }
+    if (ok) {
+        ok = (ord->Find("NodeM08C") == first);
+    }
+    if (ok) {
+        ok = (ord->Find("NodeQGLD") == second);
+    }
+    //Both are indexed and found in the index
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 2u);
+    }
+    if (ok) {
+        ok = (ord->Find("NodeM08C") == first);
+    }
+    if (ok) {
+        ok = (ord->Find("NodeQGLD") == second);
+    }
+    //Invalidating the first of the chain keeps the second
+    if (ok) {
+        ok = ord->Delete("NodeM08C");
+    }
+    if (ok) {
+        ok = !ord->Find("NodeM08C").IsValid();
+    }
+    if (ok) {
+        ok = (ord->Find("NodeQGLD") == second);
+    }
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 1u);
+    }
+    if (ok) {
+        ok = (ord->Find("NodeQGLD") == second);
+    }
+    if (ok) {
+        ok = ord->Delete("NodeQGLD");
+    }
+    ord->SetPathIndexEnabled(false);
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestFind_PathIndexRename() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->SetPathIndexEnabled(true);
+    ReferenceT<PID> pid = ord->Find("A.B.C.PID");
+    bool ok = pid.IsValid();
+    ReferenceT<ReferenceContainer> b = ord->Find("A.B");
+    if (ok) {
+        ok = b.IsValid();
+    }
+    if (ok) {
+        ok = (ord->Find("A.B.C.PID") == pid);
+    }
+    if (ok) {
+        b->SetName("D");
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = !ord->Find("A.B").IsValid();
+    }
+    if (ok) {
+        ok = (ord->Find("A.D.C.PID") == pid);
+    }
+    if (ok) {
+        pid->SetName("PID2");
+        ok = !ord->Find("A.D.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = (ord->Find("A.D.C.PID2") == pid);
+    }
+    return ok;
+}
+
+bool ObjectRegistryDatabaseTest::TestPurge_PathIndex() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->SetPathIndexEnabled(true);
+    bool ok = ord->Find("A.B.C.PID").IsValid();
+    if (ok) {
+        ok = (ord->GetPathIndexSize() == 1u);
+    }
+    if (ok) {
+        ord->Purge();
+        ok = (ord->GetPathIndexSize() == 0u);
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.C.PID").IsValid();
+    }
+    if (ok) {
+        ok = ord->IsPathIndexEnabled();
+    }
+    return ok;
+}
+
+
+bool ObjectRegistryDatabaseTest::TestFind_PathIndexConcurrentDelete() {
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ord->SetPathIndexEnabled(true);
+    pathIndexInsertDeleteDone = 0;
+    bool ok = (Threads::BeginThread(&PathIndexInsertDeleteRoutine, NULL_PTR(void *)) != InvalidThreadIdentifier);
+    while ((ok) && (pathIndexInsertDeleteDone == 0)) {
+        //Any Reference returned must still be a valid PID, i.e. it was not destroyed while the indexed path was being validated.
+        ReferenceT<PID> pid = ord->Find("A.B.D.PID");
+        if (pid.IsValid()) {
+            ok = (StringHelper::Compare(pid->GetName(), "PID") == 0);
+            if (ok) {
+                ok = (pid->Kp < pathIndexInsertDeleteCycles);
+            }
+        }
+    }
+    while (Threads::NumberOfThreads() > 0u) {
+        Sleep::MSec(10);
+    }
+    if (ok) {
+        ok = !ord->Find("A.B.D.PID").IsValid();
+    }
+    return ok;
+}
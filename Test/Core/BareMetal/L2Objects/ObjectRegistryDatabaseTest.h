@@ -113,6 +113,41 @@ public:
      */
     bool TestGetClassName();
 
+    /**
+     * @brief Tests that the path index can be enabled and disabled and that it stores the paths resolved by Find.
+     */
+    bool TestSetPathIndexEnabled();
+
+    /**
+     * @brief Tests that Find with the path index enabled returns the same references as without the index.
+     */
+    bool TestFind_PathIndex();
+
+    /**
+     * @brief Tests that an indexed path is no longer returned after a node is deleted and that the new node is found after insertion.
+     */
+    bool TestFind_PathIndexDeleteInsert();
+
+    /**
+     * @brief Tests that two paths with the same hash are both indexed and can be invalidated independently.
+     */
+    bool TestFind_PathIndexCollision();
+
+    /**
+     * @brief Tests that an indexed path is no longer returned after a node is renamed.
+     */
+    bool TestFind_PathIndexRename();
+
+    /**
+     * @brief Tests that Purge clears the path index.
+     */
+    bool TestPurge_PathIndex();
+
+    /**
+     * @brief Tests that an indexed path can be found while one of its nodes is concurrently inserted, deleted and destroyed.
+     */
+    bool TestFind_PathIndexConcurrentDelete();
+
 
 private:
 
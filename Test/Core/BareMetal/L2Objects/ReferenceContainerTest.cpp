@@ -1045,6 +1045,192 @@ bool ReferenceContainerTest::TestIsReferenceContainer() {
     return rc.IsReferenceContainer();
 }
 
+bool ReferenceContainerTest::UseArrayStorage() {
+    bool ok = tree->SetArrayStorage(true);
+    if (ok) {
+        ok = containerC->SetArrayStorage(true);
+    }
+    if (ok) {
+        ok = containerD->SetArrayStorage(true);
+    }
+    if (ok) {
+        ok = containerE->SetArrayStorage(true);
+    }
+    if (ok) {
+        ok = containerF->SetArrayStorage(true);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestSetArrayStorage() {
+    bool ok = !tree->IsArrayStorage();
+    if (ok) {
+        ok = tree->SetArrayStorage(true);
+    }
+    if (ok) {
+        ok = tree->IsArrayStorage();
+    }
+    //Switching to the same storage has no effect
+    if (ok) {
+        ok = tree->SetArrayStorage(true);
+    }
+    if (ok) {
+        ok = (tree->Size() == 4u);
+    }
+    if (ok) {
+        ok = (tree->Get(0u) == leafB);
+        ok &= (tree->Get(1u) == containerC);
+        ok &= (tree->Get(2u) == containerD);
+        ok &= (tree->Get(3u) == leafH);
+        ok &= !tree->Get(4u).IsValid();
+    }
+    if (ok) {
+        ok = tree->SetArrayStorage(false);
+    }
+    if (ok) {
+        ok = !tree->IsArrayStorage();
+    }
+    if (ok) {
+        ok = (tree->Size() == 4u);
+    }
+    if (ok) {
+        ok = (tree->Get(0u) == leafB);
+        ok &= (tree->Get(1u) == containerC);
+        ok &= (tree->Get(2u) == containerD);
+        ok &= (tree->Get(3u) == leafH);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestInsertDelete_ArrayStorage() {
+    ReferenceT<ReferenceContainer> containerRoot("ReferenceContainer", h);
+    bool ok = containerRoot->SetArrayStorage(true);
+    if (ok) {
+        ok = containerRoot->Insert(leafB, 0);
+        ok &= containerRoot->Insert(containerD, 0);
+        ok &= containerRoot->Insert(leafH, 0);
+        ok &= containerRoot->Insert(containerC, 2);
+        ok &= containerRoot->Insert(containerF);
+        //Beyond the end
+        ok &= containerRoot->Insert(leafG, 10);
+    }
+    if (ok) {
+        ok = (containerRoot->Size() == 6u);
+    }
+    if (ok) {
+        ok = (containerRoot->Get(0u) == leafH);
+        ok &= (containerRoot->Get(1u) == containerD);
+        ok &= (containerRoot->Get(2u) == containerC);
+        ok &= (containerRoot->Get(3u) == leafB);
+        ok &= (containerRoot->Get(4u) == containerF);
+        ok &= (containerRoot->Get(5u) == leafG);
+    }
+    if (ok) {
+        ok = containerRoot->Delete(containerC);
+    }
+    if (ok) {
+        ok = containerRoot->Delete("G");
+    }
+    if (ok) {
+        ok = !containerRoot->Delete(leafNoExist);
+    }
+    if (ok) {
+        ok = (containerRoot->Size() == 4u);
+    }
+    if (ok) {
+        ok = (containerRoot->Get(0u) == leafH);
+        ok &= (containerRoot->Get(1u) == containerD);
+        ok &= (containerRoot->Get(2u) == leafB);
+        ok &= (containerRoot->Get(3u) == containerF);
+    }
+    if (ok) {
+        containerRoot->Purge();
+        ok = (containerRoot->Size() == 0u);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestInitialise_ArrayStorage() {
+    ConfigurationDatabase cdb;
+    cdb.CreateAbsolute("+intObj1");
+    cdb.Write("Class", "IntegerObject");
+    int32 value = 1;
+    cdb.Write("var", value);
+    cdb.CreateAbsolute("+container");
+    cdb.Write("Class", "ReferenceContainer");
+    cdb.Write("ArrayStorage", 1);
+    cdb.CreateRelative("+intObj2");
+    cdb.Write("Class", "IntegerObject");
+    value = 3;
+    cdb.Write("var", value);
+    cdb.MoveToRoot();
+    ReferenceContainer container;
+    bool ok = container.Initialise(cdb);
+    if (ok) {
+        ok = !container.IsArrayStorage();
+    }
+    ReferenceT<ReferenceContainer> child;
+    if (ok) {
+        child = container.Find("container");
+        ok = child.IsValid();
+    }
+    if (ok) {
+        ok = child->IsArrayStorage();
+    }
+    if (ok) {
+        ReferenceT<IntegerObject> test = container.Find("container.intObj2");
+        ok = test.IsValid();
+        if (ok) {
+            ok = (test->GetVariable() == 3);
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestGetModificationCounter() {
+    ReferenceContainer rc;
+    bool ok = (rc.GetModificationCounter() == 0u);
+    ReferenceT<Object> obj1("Object", h);
+    ReferenceT<Object> obj2("Object", h);
+    obj1->SetName("obj1");
+    obj2->SetName("obj2");
+    if (ok) {
+        ok = rc.Insert(obj1);
+    }
+    if (ok) {
+        ok = rc.Insert(obj2, 0);
+    }
+    if (ok) {
+        ok = (rc.GetModificationCounter() == 2u);
+    }
+    if (ok) {
+        ReferenceContainerFilterObjectName filter(1, ReferenceContainerFilterMode::SHALLOW, "obj1");
+        ReferenceContainer result;
+        rc.Find(result, filter);
+        ok = (result.Size() == 1u);
+    }
+    if (ok) {
+        ok = (rc.GetModificationCounter() == 2u);
+    }
+    if (ok) {
+        ok = rc.Delete("obj1");
+    }
+    if (ok) {
+        ok = (rc.GetModificationCounter() == 3u);
+    }
+    if (ok) {
+        ok = !rc.Delete("obj1");
+    }
+    if (ok) {
+        ok = (rc.GetModificationCounter() == 3u);
+    }
+    if (ok) {
+        rc.Purge();
+        ok = (rc.GetModificationCounter() == 4u);
+    }
+    return ok;
+}
+
 bool ReferenceContainerTest::TestIsBuildToken() {
     ReferenceContainer container;
     ReferenceContainer::AddBuildToken('_');
@@ -500,6 +500,32 @@ public:
      */
     bool TestIsReferenceContainer();
 
+    /**
+     * @brief Tests that the GetModificationCounter method is incremented by Insert, Delete and Purge and not by Find.
+     */
+    bool TestGetModificationCounter();
+
+    /**
+     * @brief Switches all the containers of the test tree to array storage, so that the Find tests can be repeated with this storage.
+     * @return true if all the containers were switched to array storage.
+     */
+    bool UseArrayStorage();
+
+    /**
+     * @brief Tests that SetArrayStorage moves the references between storages keeping their order.
+     */
+    bool TestSetArrayStorage();
+
+    /**
+     * @brief Tests the Insert, Get and Delete methods with array storage.
+     */
+    bool TestInsertDelete_ArrayStorage();
+
+    /**
+     * @brief Tests the Initialise method with the ArrayStorage parameter.
+     */
+    bool TestInitialise_ArrayStorage();
+
     volatile int32 spinLock;
 
 private:
@@ -0,0 +1,359 @@
+/**
+ * @file BinaryParserTest.cpp
+ * @brief Source file for class BinaryParserTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryParserTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryParserTest.h"
+#include "BinaryWriter.h"
+#include "MemoryOperationsHelper.h"
+#include "StandardParser.h"
+#include "StreamMemoryReference.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const char8 * const testConfiguration = ""
+        "A = {\n"
+        "    B = (int8) -3\n"
+        "    C = (uint16) { 1 2 3 }\n"
+        "    D = (float64) { { 1.5 2.5 } { 3.5 4.5 } }\n"
+        "    E = \"hello\"\n"
+        "    F = { \"a\" \"bb\" \"ccc\" }\n"
+        "    G = { { \"a\" \"b\" } { \"c\" \"d\" } }\n"
+        "    H = {\n"
+        "        Class = ReferenceContainer\n"
+        "    }\n"
+        "}\n"
+        "I = (uint64) 12345678901\n"
+        "J = (float32) -1.25\n"
+        "K = (int32) { -1 -2 }\n";
+
+bool BinaryParserTest::WriteTestConfiguration(StreamString &binary) {
+    StreamString text = testConfiguration;
+    ConfigurationDatabase cdb;
+    bool ok = text.Seek(0LLU);
+    if (ok) {
+        StandardParser parser(text, cdb);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        BinaryWriter writer(binary, cdb);
+        ok = writer.Write();
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::CheckTestConfiguration(ConfigurationDatabase &cdb) {
+    bool ok = cdb.MoveAbsolute("A");
+    if (ok) {
+        ok = (cdb.GetNumberOfChildren() == 7u);
+    }
+    int8 b = 0;
+    if (ok) {
+        ok = cdb.Read("B", b);
+    }
+    if (ok) {
+        ok = (b == -3) && (cdb.GetType("B").GetTypeDescriptor() == SignedInteger8Bit);
+    }
+    uint16 c[3] = { 0u, 0u, 0u };
+    if (ok) {
+        ok = cdb.Read("C", c);
+    }
+    if (ok) {
+        ok = (c[0] == 1u) && (c[1] == 2u) && (c[2] == 3u);
+        ok &= (cdb.GetType("C").GetTypeDescriptor() == UnsignedInteger16Bit);
+        ok &= (cdb.GetType("C").GetNumberOfDimensions() == 1u);
+    }
+    float64 d[2][2] = { { 0.0, 0.0 }, { 0.0, 0.0 } };
+    if (ok) {
+        ok = cdb.Read("D", d);
+    }
+    if (ok) {
+        ok = (d[0][0] == 1.5) && (d[0][1] == 2.5) && (d[1][0] == 3.5) && (d[1][1] == 4.5);
+        ok &= (cdb.GetType("D").GetTypeDescriptor() == Float64Bit);
+        ok &= (cdb.GetType("D").GetNumberOfDimensions() == 2u);
+    }
+    StreamString e;
+    if (ok) {
+        ok = cdb.Read("E", e);
+    }
+    if (ok) {
+        ok = (e == "hello");
+    }
+    StreamString f[3];
+    Vector<StreamString> fv(&f[0], 3u);
+    if (ok) {
+        ok = cdb.Read("F", fv);
+    }
+    if (ok) {
+        ok = (f[0] == "a") && (f[1] == "bb") && (f[2] == "ccc");
+    }
+    StreamString g[4];
+    Matrix<StreamString> gm(&g[0], 2u, 2u);
+    if (ok) {
+        ok = cdb.Read("G", gm);
+    }
+    if (ok) {
+        ok = (g[0] == "a") && (g[1] == "b") && (g[2] == "c") && (g[3] == "d");
+    }
+    StreamString className;
+    if (ok) {
+        ok = cdb.MoveRelative("H");
+    }
+    if (ok) {
+        ok = cdb.Read("Class", className);
+    }
+    if (ok) {
+        ok = (className == "ReferenceContainer");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    uint64 i = 0u;
+    if (ok) {
+        ok = cdb.Read("I", i);
+    }
+    if (ok) {
+        ok = (i == 12345678901ull);
+    }
+    float32 j = 0.F;
+    if (ok) {
+        ok = cdb.Read("J", j);
+    }
+    if (ok) {
+        ok = (j == -1.25F);
+    }
+    int32 k[2] = { 0, 0 };
+    if (ok) {
+        ok = cdb.Read("K", k);
+    }
+    if (ok) {
+        ok = (k[0] == -1) && (k[1] == -2);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::ParsePatchedRecord(const uint32 recordIdx,
+                                          const uint32 fieldIdx,
+                                          const uint32 value) {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    if (ok) {
+        uint32 offset = static_cast<uint32>(sizeof(BinaryConfigurationHeader) + (recordIdx * sizeof(BinaryConfigurationRecord)) + (fieldIdx * sizeof(uint32)));
+        ok = binary.Seek(offset);
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        if (ok) {
+            ok = binary.Write(reinterpret_cast<const char8 *>(&value), size);
+        }
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    if (ok) {
+        ConfigurationDatabase cdb;
+        BinaryParser parser(binary, cdb);
+        ok = parser.Parse();
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestConstructor() {
+    StreamString binary;
+    ConfigurationDatabase cdb;
+    BinaryParser parser(binary, cdb);
+    return (cdb.GetNumberOfChildren() == 0u);
+}
+
+bool BinaryParserTest::TestParse() {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        BinaryParser parser(binary, cdb);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = CheckTestConfiguration(cdb);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_StreamMemoryReference() {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    //Copy to an aligned buffer (as a memory mapped file would be)
+    uint64 *alignedMemory = NULL_PTR(uint64 *);
+    uint32 size = static_cast<uint32>(binary.Size());
+    if (ok) {
+        alignedMemory = new uint64[(size / sizeof(uint64)) + 1u];
+        ok = MemoryOperationsHelper::Copy(alignedMemory, binary.Buffer(), size);
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        StreamMemoryReference mapped(reinterpret_cast<const char8 *>(alignedMemory), size);
+        BinaryParser parser(mapped, cdb);
+        ok = parser.Parse();
+        if (ok) {
+            //The stream is consumed
+            ok = (mapped.Position() == size);
+        }
+    }
+    if (ok) {
+        ok = CheckTestConfiguration(cdb);
+    }
+    if (alignedMemory != NULL_PTR(uint64 *)) {
+        delete[] alignedMemory;
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_Empty() {
+    ConfigurationDatabase empty;
+    StreamString binary;
+    BinaryWriter writer(binary, empty);
+    bool ok = writer.Write();
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        BinaryParser parser(binary, cdb);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = (cdb.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_False_BadMagic() {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    if (ok) {
+        binary.BufferReference()[0] = 'X';
+    }
+    ConfigurationDatabase cdb;
+    StreamString errors;
+    if (ok) {
+        BinaryParser parser(binary, cdb, &errors);
+        ok = !parser.Parse();
+    }
+    if (ok) {
+        ok = (errors.Size() > 0u);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_False_BadVersion() {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    if (ok) {
+        uint32 version = BinaryConfiguration::VERSION + 1u;
+        ok = MemoryOperationsHelper::Copy(&(binary.BufferReference()[sizeof(uint32)]), &version, static_cast<uint32>(sizeof(uint32)));
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        BinaryParser parser(binary, cdb);
+        ok = !parser.Parse();
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_False_Truncated() {
+    StreamString binary;
+    bool ok = WriteTestConfiguration(binary);
+    if (ok) {
+        ok = binary.SetSize(binary.Size() - 1u);
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    ConfigurationDatabase cdb;
+    if (ok) {
+        BinaryParser parser(binary, cdb);
+        ok = !parser.Parse();
+    }
+    StreamString tooSmall = "MCDB";
+    if (ok) {
+        ok = tooSmall.Seek(0LLU);
+    }
+    if (ok) {
+        BinaryParser parser(tooSmall, cdb);
+        ok = !parser.Parse();
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_False_InvalidRecord() {
+    //nameOffset outside of the string table
+    bool ok = !ParsePatchedRecord(0u, 0u, 0xFFFFu);
+    if (ok) {
+        //nextSibling before the record
+        ok = !ParsePatchedRecord(1u, 6u, 0u);
+    }
+    if (ok) {
+        //nextSibling after the parent subtree
+        ok = !ParsePatchedRecord(1u, 6u, 100u);
+    }
+    if (ok) {
+        //unknown kind
+        ok = !ParsePatchedRecord(1u, 1u, 99u);
+    }
+    return ok;
+}
+
+bool BinaryParserTest::TestParse_False_InvalidLeaf() {
+    //B: invalid number of bits
+    bool ok = !ParsePatchedRecord(1u, 2u, 12u);
+    if (ok) {
+        //B: too many dimensions
+        ok = !ParsePatchedRecord(1u, 3u, 3u);
+    }
+    if (ok) {
+        //C: data size does not match the number of elements
+        ok = !ParsePatchedRecord(2u, 4u, 4u);
+    }
+    if (ok) {
+        //C: data outside of the data section
+        ok = !ParsePatchedRecord(2u, 7u, 0xFFFFFFu);
+    }
+    if (ok) {
+        //F: number of strings does not match the number of elements
+        ok = !ParsePatchedRecord(5u, 4u, 2u);
+    }
+    return ok;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file BinaryParserTest.h
+ * @brief Header file for class BinaryParserTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BinaryParserTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BINARYPARSERTEST_H_
+#define BINARYPARSERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryParser.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the BinaryParser functions.
+ */
+class BinaryParserTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that a configuration written with the BinaryWriter is parsed back with the same nodes, types and values.
+     */
+    bool TestParse();
+
+    /**
+     * @brief Tests that a binary configuration is parsed in-place from a StreamMemoryReference.
+     */
+    bool TestParse_StreamMemoryReference();
+
+    /**
+     * @brief Tests that an empty binary configuration is parsed.
+     */
+    bool TestParse_Empty();
+
+    /**
+     * @brief Tests that the Parse fails if the magic number is not valid.
+     */
+    bool TestParse_False_BadMagic();
+
+    /**
+     * @brief Tests that the Parse fails if the version is not supported.
+     */
+    bool TestParse_False_BadVersion();
+
+    /**
+     * @brief Tests that the Parse fails if the binary configuration is truncated.
+     */
+    bool TestParse_False_Truncated();
+
+    /**
+     * @brief Tests that the Parse fails if a record is not valid.
+     */
+    bool TestParse_False_InvalidRecord();
+
+    /**
+     * @brief Tests that the Parse fails if a leaf data is not valid.
+     */
+    bool TestParse_False_InvalidLeaf();
+
+private:
+
+    /**
+     * @brief Parses the test configuration with the StandardParser and writes it with the BinaryWriter.
+     * @param[out] binary the binary configuration.
+     * @return true if the binary configuration was written.
+     */
+    bool WriteTestConfiguration(StreamString &binary);
+
+    /**
+     * @brief Checks that \a cdb has the contents of the test configuration.
+     * @param[in] cdb the database to check.
+     * @return true if \a cdb has the contents of the test configuration.
+     */
+    bool CheckTestConfiguration(ConfigurationDatabase &cdb);
+
+    /**
+     * @brief Parses a binary configuration where the record \a recordIdx has been patched.
+     * @param[in] recordIdx the record to patch.
+     * @param[in] fieldIdx the (uint32) field of the record to patch.
+     * @param[in] value the value to be written.
+     * @return the result of the Parse.
+     */
+    bool ParsePatchedRecord(const uint32 recordIdx,
+                            const uint32 fieldIdx,
+                            const uint32 value);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BINARYPARSERTEST_H_ */
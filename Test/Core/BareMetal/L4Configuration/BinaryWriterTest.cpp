@@ -0,0 +1,193 @@
+/**
+ * @file BinaryWriterTest.cpp
+ * @brief Source file for class BinaryWriterTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryWriterTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryWriterTest.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool BinaryWriterTest::TestConstructor() {
+    StreamString stream;
+    ConfigurationDatabase cdb;
+    BinaryWriter writer(stream, cdb);
+    return (stream.Size() == 0u);
+}
+
+bool BinaryWriterTest::TestWrite_Empty() {
+    StreamString stream;
+    ConfigurationDatabase cdb;
+    BinaryWriter writer(stream, cdb);
+    bool ok = writer.Write();
+    if (ok) {
+        ok = (stream.Size() == sizeof(BinaryConfigurationHeader));
+    }
+    BinaryConfigurationHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, stream.Buffer(), static_cast<uint32>(sizeof(BinaryConfigurationHeader)));
+    }
+    if (ok) {
+        ok = (header.magic == BinaryConfiguration::MAGIC);
+        ok &= (header.version == BinaryConfiguration::VERSION);
+        ok &= (header.numberOfRecords == 0u);
+        ok &= (header.stringTableSize == 0u);
+        ok &= (header.dataSize == 0u);
+    }
+    return ok;
+}
+
+bool BinaryWriterTest::TestWrite() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A.B");
+    uint32 scalar = 7u;
+    if (ok) {
+        ok = cdb.Write("C", scalar);
+    }
+    if (ok) {
+        ok = cdb.Write("D", "string");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    float32 vector[3] = { 1.0F, 2.0F, 3.0F };
+    if (ok) {
+        ok = cdb.Write("E", vector);
+    }
+    StreamString stream;
+    if (ok) {
+        BinaryWriter writer(stream, cdb);
+        ok = writer.Write();
+    }
+    BinaryConfigurationHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, stream.Buffer(), static_cast<uint32>(sizeof(BinaryConfigurationHeader)));
+    }
+    if (ok) {
+        //A, B, C, D and E
+        ok = (header.numberOfRecords == 5u);
+    }
+    if (ok) {
+        uint64 expectedSize = sizeof(BinaryConfigurationHeader) + (header.numberOfRecords * sizeof(BinaryConfigurationRecord));
+        expectedSize += header.stringTableSize;
+        expectedSize += header.dataSize;
+        ok = (stream.Size() == expectedSize);
+    }
+    if (ok) {
+        ok = ((header.stringTableSize % BinaryConfiguration::ALIGNMENT) == 0u);
+    }
+    BinaryConfigurationRecord records[5];
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&records[0], &(stream.Buffer()[sizeof(BinaryConfigurationHeader)]), static_cast<uint32>(sizeof(records)));
+    }
+    if (ok) {
+        //Pre-order: A(0) B(1) C(2) D(3) E(4)
+        ok = (records[0].kind == BinaryConfiguration::NODE) && (records[0].nextSibling == 4u);
+        ok &= (records[1].kind == BinaryConfiguration::NODE) && (records[1].nextSibling == 4u);
+        ok &= (records[2].kind == BinaryConfiguration::UNSIGNED_INTEGER) && (records[2].numberOfBits == 32u) && (records[2].nextSibling == 3u);
+        ok &= (records[3].kind == BinaryConfiguration::STRING) && (records[3].dataSize == 7u);
+        ok &= (records[4].kind == BinaryConfiguration::FLOAT) && (records[4].numberOfDimensions == 1u) && (records[4].numberOfColumns == 3u);
+        ok &= (records[4].dataSize == sizeof(vector)) && ((records[4].dataOffset % BinaryConfiguration::ALIGNMENT) == 0u);
+    }
+    return ok;
+}
+
+bool BinaryWriterTest::TestWrite_NamesOnce() {
+    ConfigurationDatabase cdb;
+    bool ok = true;
+    const char8 * const nodes[] = { "A", "B", "C", "D" };
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = cdb.CreateAbsolute(nodes[i]);
+        if (ok) {
+            ok = cdb.Write("Class", "ReferenceContainer");
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    StreamString stream;
+    if (ok) {
+        BinaryWriter writer(stream, cdb);
+        ok = writer.Write();
+    }
+    BinaryConfigurationHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, stream.Buffer(), static_cast<uint32>(sizeof(BinaryConfigurationHeader)));
+    }
+    if (ok) {
+        ok = (header.numberOfRecords == 8u);
+    }
+    if (ok) {
+        //"A\0B\0C\0D\0Class\0" padded to the alignment
+        ok = (header.stringTableSize == 16u);
+    }
+    return ok;
+}
+
+bool BinaryWriterTest::TestWrite_CurrentNode() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A.B");
+    uint32 value = 1u;
+    if (ok) {
+        ok = cdb.Write("C", value);
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("D");
+    }
+    if (ok) {
+        ok = cdb.Write("E", value);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("A");
+    }
+    StreamString stream;
+    if (ok) {
+        BinaryWriter writer(stream, cdb);
+        ok = writer.Write();
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(cdb.GetName(), "A") == 0);
+    }
+    BinaryConfigurationHeader header;
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&header, stream.Buffer(), static_cast<uint32>(sizeof(BinaryConfigurationHeader)));
+    }
+    if (ok) {
+        //B and C
+        ok = (header.numberOfRecords == 2u);
+    }
+    return ok;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file BinaryWriterTest.h
+ * @brief Header file for class BinaryWriterTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BinaryWriterTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BINARYWRITERTEST_H_
+#define BINARYWRITERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryWriter.h"
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the BinaryWriter functions.
+ */
+class BinaryWriterTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that an empty StructuredDataI is written as a header without records.
+     */
+    bool TestWrite_Empty();
+
+    /**
+     * @brief Tests that a record is written for each node and leaf.
+     */
+    bool TestWrite();
+
+    /**
+     * @brief Tests that repeated names are written only once in the string table.
+     */
+    bool TestWrite_NamesOnce();
+
+    /**
+     * @brief Tests that only the subtree of the current node is written and that the current node is not changed.
+     */
+    bool TestWrite_CurrentNode();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BINARYWRITERTEST_H_ */
@@ -31,6 +31,7 @@
 #include "ConfigurationDatabaseNodeTest.h"
 #include "ConfigurationDatabaseNode.h"
 #include "StreamString.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -202,3 +203,131 @@ bool ConfigurationDatabaseNodeTest::TestGetParent() {
 bool ConfigurationDatabaseNodeTest::TestSetParent() {
     return TestGetParent();
 }
+
+bool ConfigurationDatabaseNodeTest::TestIsIndexed() {
+    using namespace MARTe;
+    ConfigurationDatabaseNode cdbn;
+    uint32 n;
+    bool ok = !cdbn.IsIndexed();
+    for (n = 0u; (n < CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) && (ok); n++) {
+        ok = !cdbn.IsIndexed();
+        ReferenceT<Object> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString nname;
+        nname.Printf("%d", n);
+        ref->SetName(nname.Buffer());
+        if (ok) {
+            ok = cdbn.Insert(ref);
+        }
+    }
+    if (ok) {
+        ok = cdbn.IsIndexed();
+    }
+    for (n = 0u; (n < CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) && (ok); n++) {
+        StreamString nname;
+        nname.Printf("%d", n);
+        ReferenceT<Object> ref = cdbn.FindLeaf(nname.Buffer());
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (nname == ref->GetName());
+        }
+    }
+    if (ok) {
+        ok = cdbn.Delete(cdbn.Get(0u));
+    }
+    if (ok) {
+        ok = !cdbn.IsIndexed();
+    }
+    for (n = 1u; (n < CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) && (ok); n++) {
+        StreamString nname;
+        nname.Printf("%d", n);
+        ReferenceT<Object> ref = cdbn.FindLeaf(nname.Buffer());
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (nname == ref->GetName());
+        }
+    }
+    if (ok) {
+        ok = !cdbn.FindLeaf("0").IsValid();
+    }
+    return ok;
+}
+
+bool ConfigurationDatabaseNodeTest::TestInsert_SameName() {
+    using namespace MARTe;
+    ConfigurationDatabaseNode cdbn;
+    uint32 n;
+    bool ok = true;
+    //Before and after the children are indexed
+    for (n = 0u; (n < (2u * CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD)) && (ok); n++) {
+        ReferenceT<Object> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString nname;
+        nname.Printf("%d", n);
+        ref->SetName(nname.Buffer());
+        ok = cdbn.Insert(ref);
+        if (ok) {
+            ReferenceT<Object> sameName(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            sameName->SetName(nname.Buffer());
+            ok = !cdbn.Insert(sameName);
+        }
+        if (ok) {
+            ok = (cdbn.FindLeaf(nname.Buffer()) == ref);
+        }
+    }
+    if (ok) {
+        ok = (cdbn.Size() == (2u * CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD));
+    }
+    return ok;
+}
+
+bool ConfigurationDatabaseNodeTest::TestFindLeaf_HashCollision() {
+    using namespace MARTe;
+    ConfigurationDatabaseNode cdbn;
+    //Pairs of names with the same FNV-1a hash
+    const char8 * const names[] = { "costarring", "liquid", "declinate", "macallums", "altarage", "zinke" };
+    const uint32 numberOfNames = 6u;
+    uint32 n;
+    bool ok = true;
+    for (n = 0u; (n < numberOfNames) && (ok); n++) {
+        ReferenceT<Object> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ref->SetName(names[n]);
+        ok = cdbn.Insert(ref);
+    }
+    for (n = 0u; (n < CONFIGURATION_DATABASE_NODE_INDEX_THRESHOLD) && (ok); n++) {
+        ReferenceT<Object> ref(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString nname;
+        nname.Printf("%d", n);
+        ref->SetName(nname.Buffer());
+        ok = cdbn.Insert(ref);
+    }
+    if (ok) {
+        ok = cdbn.IsIndexed();
+    }
+    for (n = 0u; (n < numberOfNames) && (ok); n++) {
+        Reference ref = cdbn.FindLeaf(names[n]);
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (StringHelper::Compare(ref->GetName(), names[n]) == 0);
+        }
+    }
+    if (ok) {
+        ok = cdbn.Delete(cdbn.FindLeaf("costarring"));
+    }
+    if (ok) {
+        ok = !cdbn.FindLeaf("costarring").IsValid();
+    }
+    if (ok) {
+        Reference ref = cdbn.FindLeaf("liquid");
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (StringHelper::Compare(ref->GetName(), "liquid") == 0);
+        }
+    }
+    if (ok) {
+        Reference ref = cdbn.Find("zinke");
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (StringHelper::Compare(ref->GetName(), "zinke") == 0);
+        }
+    }
+    return ok;
+}
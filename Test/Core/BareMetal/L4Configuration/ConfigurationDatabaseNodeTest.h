@@ -95,6 +95,21 @@ public:
      */
     bool TestSetParent();
 
+    /**
+     * @brief Tests the IsIndexed method.
+     */
+    bool TestIsIndexed();
+
+    /**
+     * @brief Tests that the Insert method fails if a child with the same name exists.
+     */
+    bool TestInsert_SameName();
+
+    /**
+     * @brief Tests the FindLeaf method with names that have the same hash.
+     */
+    bool TestFindLeaf_HashCollision();
+
 };
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
@@ -774,3 +774,66 @@ bool ConfigurationDatabaseTest::TestSetCurrentNodeAsRootNode() {
     ok &= cdb.MoveRelative("C");
     return ok;
 }
+
+bool ConfigurationDatabaseTest::TestExportImportBinary() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A.B");
+    uint32 u32 = 10u;
+    int64 i64[2] = { -5, 5 };
+    float64 f64[2][3] = { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
+    ok &= cdb.Write("u32", u32);
+    ok &= cdb.Write("i64", i64);
+    ok &= cdb.Write("f64", f64);
+    ok &= cdb.Write("str", "value");
+    ok &= cdb.MoveToRoot();
+    StreamString binary;
+    ok &= cdb.ExportBinary(binary);
+    ok &= binary.Seek(0LLU);
+    ConfigurationDatabase imported;
+    ok &= imported.ImportBinary(binary);
+    ok &= imported.MoveAbsolute("A.B");
+    uint32 u32Read = 0u;
+    int64 i64Read[2] = { 0, 0 };
+    float64 f64Read[2][3];
+    StreamString strRead;
+    ok &= imported.Read("u32", u32Read);
+    ok &= imported.Read("i64", i64Read);
+    ok &= imported.Read("f64", f64Read);
+    ok &= imported.Read("str", strRead);
+    if (ok) {
+        ok = (u32Read == u32) && (i64Read[0] == i64[0]) && (i64Read[1] == i64[1]) && (strRead == "value");
+        for (uint32 r = 0u; r < 2u; r++) {
+            for (uint32 c = 0u; c < 3u; c++) {
+                ok &= (f64Read[r][c] == f64[r][c]);
+            }
+        }
+    }
+    if (ok) {
+        //The binary configuration of the imported database shall be the same
+        StreamString binaryAgain;
+        ok = imported.MoveToRoot();
+        ok &= imported.ExportBinary(binaryAgain);
+        ok &= (binaryAgain == binary);
+    }
+    return ok;
+}
+
+bool ConfigurationDatabaseTest::TestImportBinary_CurrentNode() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("B");
+    uint32 value = 3u;
+    ok &= cdb.Write("value", value);
+    ok &= cdb.MoveToRoot();
+    StreamString binary;
+    ok &= cdb.ExportBinary(binary);
+    ok &= binary.Seek(0LLU);
+    ConfigurationDatabase imported;
+    ok &= imported.CreateAbsolute("A");
+    ok &= imported.ImportBinary(binary);
+    ok &= (StringHelper::Compare(imported.GetName(), "A") == 0);
+    uint32 valueRead = 0u;
+    ok &= imported.MoveAbsolute("A.B");
+    ok &= imported.Read("value", valueRead);
+    ok &= (valueRead == value);
+    return ok;
+}
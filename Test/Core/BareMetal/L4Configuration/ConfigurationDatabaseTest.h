@@ -237,6 +237,16 @@ public:
      * @brief Tests the SetCurrentNodeAsRootNode method
      */
     bool TestSetCurrentNodeAsRootNode();
+
+    /**
+     * @brief Tests that ExportBinary and ImportBinary round-trip the database contents.
+     */
+    bool TestExportImportBinary();
+
+    /**
+     * @brief Tests that ImportBinary adds the contents to the current node and does not change it.
+     */
+    bool TestImportBinary_CurrentNode();
 };
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
@@ -0,0 +1,157 @@
+/**
+ * @file MathExpressionOptimiserTest.cpp
+ * @brief Source file for class MathExpressionOptimiserTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiserTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionOptimiserTest.h"
+#include "MemoryOperationsHelper.h"
+#include "RuntimeEvaluator.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Checks if the input variable is one of the constants of the code.
+ */
+static bool IsConstant(VariableInformation * const variable) {
+    return (StringHelper::CompareN(variable->name.Buffer(), "Constant@", 9u) == 0);
+}
+
+/**
+ * @brief Compiles \a evaluator with all the input variables of type float64 and executes it once.
+ */
+static bool CompileAndExecute(RuntimeEvaluator &evaluator,
+                              const float64 inputValue) {
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    VariableInformation *variable;
+    uint32 index = 0u;
+    while ((ok) && (evaluator.BrowseInputVariable(index, variable) == ErrorManagement::NoError)) {
+        if (!IsConstant(variable)) {
+            ok = evaluator.SetInputVariableType(index, Float64Bit);
+        }
+        index++;
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    for (uint32 i = 0u; (i < index) && (ok); i++) {
+        ok = (evaluator.BrowseInputVariable(i, variable) == ErrorManagement::NoError);
+        if ((ok) && (!IsConstant(variable))) {
+            float64 *value = static_cast<float64 *>(evaluator.GetInputVariableMemory(i));
+            ok = (value != NULL);
+            if (ok) {
+                *value = inputValue;
+            }
+        }
+    }
+    if (ok) {
+        ok = (evaluator.Execute(RuntimeEvaluator::safeMode) == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MathExpressionOptimiserTest::TestConstructor() {
+    MathExpressionOptimiser optimiser;
+    StreamString input;
+    StreamString output;
+    bool ok = optimiser.Optimise(input, output);
+    if (ok) {
+        ok = (output.Size() == 0u);
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise(const char8 * const input,
+                                               const char8 * const expectedOutput) {
+    MathExpressionOptimiser optimiser;
+    StreamString inputCode = input;
+    StreamString output;
+    bool ok = optimiser.Optimise(inputCode, output);
+    if (ok) {
+        ok = (output == expectedOutput);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Optimised code:\n%s", output.Buffer());
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_SameResults(const char8 * const input,
+                                                           const float64 inputValue) {
+    MathExpressionOptimiser optimiser;
+    StreamString inputCode = input;
+    StreamString output;
+    bool ok = optimiser.Optimise(inputCode, output);
+    if (ok) {
+        ok = !(output == inputCode);
+    }
+    RuntimeEvaluator literal(inputCode);
+    RuntimeEvaluator optimised(output);
+    if (ok) {
+        ok = CompileAndExecute(literal, inputValue);
+    }
+    if (ok) {
+        ok = CompileAndExecute(optimised, inputValue);
+    }
+    VariableInformation *variable;
+    uint32 index = 0u;
+    while ((ok) && (literal.BrowseOutputVariable(index, variable) == ErrorManagement::NoError)) {
+        void *literalValue = literal.GetOutputVariableMemory(index);
+        void *optimisedValue = optimised.GetOutputVariableMemory(variable->name);
+        ok = ((literalValue != NULL) && (optimisedValue != NULL));
+        if (ok) {
+            ok = (MemoryOperationsHelper::Compare(literalValue, optimisedValue, static_cast<uint32>(variable->type.numberOfBits) / 8u) == 0);
+        }
+        index++;
+    }
+    return ok;
+}
+
+bool MathExpressionOptimiserTest::TestOptimise_Twice() {
+    MathExpressionOptimiser optimiser;
+    StreamString input1 = "CONST float64 1\nCONST float64 2\nADD\nWRITE A\n";
+    StreamString input2 = "READ A\nCONST float64 2\nPOW\nWRITE B\n";
+    StreamString output;
+    bool ok = optimiser.Optimise(input1, output);
+    if (ok) {
+        ok = (output == "CONST float64 3.0000000000000000\nWRITE A\n");
+    }
+    if (ok) {
+        ok = optimiser.Optimise(input2, output);
+    }
+    if (ok) {
+        ok = (output == "READ A\nREAD A\nMUL\nWRITE B\n");
+    }
+    return ok;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file MathExpressionOptimiserTest.h
+ * @brief Header file for class MathExpressionOptimiserTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionOptimiserTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONOPTIMISERTEST_H_
+#define MATHEXPRESSIONOPTIMISERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionOptimiser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the MathExpressionOptimiser public methods.
+ */
+class MathExpressionOptimiserTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Optimise() converts \a input into \a expectedOutput.
+     */
+    bool TestOptimise(const char8 * const input,
+                      const char8 * const expectedOutput);
+
+    /**
+     * @brief Tests that the optimised code computes exactly the same values of \a input
+     * (with all the input variables set to \a inputValue).
+     */
+    bool TestOptimise_SameResults(const char8 * const input,
+                                  const float64 inputValue);
+
+    /**
+     * @brief Tests that Optimise() can be called more than once.
+     */
+    bool TestOptimise_Twice();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONOPTIMISERTEST_H_ */
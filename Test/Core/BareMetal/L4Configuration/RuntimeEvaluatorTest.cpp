@@ -898,6 +898,371 @@ bool RuntimeEvaluatorTest::TestExecute(CCString rpnCode, ErrorManagement::ErrorT
     
 }
 
+bool RuntimeEvaluatorTest::TestExecute_ThreadedCode() {
+
+    CCString rpnCode=
+            "READ A\n"
+            "READ B\n"
+            "ADD\n"
+            "CONST float64 2.5\n"
+            "MUL\n"
+            "READ A\n"
+            "DIV\n"
+            "READ B\n"
+            "SUB\n"
+            "WRITE C\n"
+            "READ C\n"
+            "CONST float64 0.5\n"
+            "POW\n"
+            "WRITE D\n"
+            "READ C\n"
+            "CAST int32\n"
+            "READ N1\n"
+            "ADD\n"
+            "WRITE N2\n"
+            "READ N2\n"
+            "READ N1\n"
+            "GT\n"
+            "READ C\n"
+            "READ D\n"
+            "LTE\n"
+            "AND\n"
+            "WRITE E\n"
+    ;
+
+    float64 externalA = 3.0;
+    int32 externalN1 = -7;
+    float64 outputs[2][2];
+    int32 outputN2[2];
+    uint8 outputE[2];
+    RuntimeEvaluator::executionMode modes[2] = { RuntimeEvaluator::fastMode, RuntimeEvaluator::safeMode };
+
+    bool ok = true;
+    for (uint32 m = 0u; (m < 2u) && (ok); m++) {
+        RuntimeEvaluator context(rpnCode);
+        ok = (context.ExtractVariables() == ErrorManagement::NoError);
+        if (ok) {
+            ok = context.SetInputVariableType("A", Float64Bit);
+        }
+        if (ok) {
+            ok = context.SetInputVariableMemory("A", &externalA);
+        }
+        if (ok) {
+            ok = context.SetInputVariableType("B", Float64Bit);
+        }
+        if (ok) {
+            ok = context.SetInputVariableType("N1", SignedInteger32Bit);
+        }
+        if (ok) {
+            ok = context.SetInputVariableMemory("N1", &externalN1);
+        }
+        if (ok) {
+            ok = context.SetOutputVariableType("D", Float64Bit);
+        }
+        if (ok) {
+            ok = context.SetOutputVariableMemory("D", &outputs[m][1]);
+        }
+        if (ok) {
+            ok = context.SetOutputVariableType("N2", SignedInteger32Bit);
+        }
+        if (ok) {
+            ok = context.SetOutputVariableType("E", UnsignedInteger8Bit);
+        }
+        if (ok) {
+            ok = context.SetOutputVariableMemory("E", &outputE[m]);
+        }
+        if (ok) {
+            ok = (context.Compile() == ErrorManagement::NoError);
+        }
+        if (ok) {
+            *(static_cast<float64 *>(context.GetInputVariableMemory("B"))) = 1.5;
+            // execute twice to check that the threaded code can be re-executed
+            ok = (context.Execute(modes[m]) == ErrorManagement::NoError);
+            if (ok) {
+                ok = (context.Execute(modes[m]) == ErrorManagement::NoError);
+            }
+        }
+        if (ok) {
+            outputs[m][0] = *(static_cast<float64 *>(context.GetOutputVariableMemory("C")));
+            outputN2[m] = *(static_cast<int32 *>(context.GetOutputVariableMemory("N2")));
+        }
+    }
+
+    if (ok) {
+        // ((3 + 1.5) * 2.5 / 3) - 1.5 = 2.25
+        ok = (outputs[0][0] == 2.25);
+    }
+    if (ok) {
+        ok = (outputs[0][0] == outputs[1][0]);
+    }
+    if (ok) {
+        ok = (outputs[0][1] == outputs[1][1]);
+    }
+    if (ok) {
+        ok = (outputN2[0] == -5);
+    }
+    if (ok) {
+        ok = (outputN2[0] == outputN2[1]);
+    }
+    if (ok) {
+        ok = (outputE[0] == 0u);
+    }
+    if (ok) {
+        ok = (outputE[0] == outputE[1]);
+    }
+
+    return ok;
+}
+
+static CCString batchRpnCode=
+        "READ A\n"
+        "READ K\n"
+        "MUL\n"
+        "CONST float64 1.5\n"
+        "ADD\n"
+        "WRITE T\n"
+        "READ T\n"
+        "READ T\n"
+        "MUL\n"
+        "CONST float64 0.5\n"
+        "POW\n"
+        "WRITE Y\n"
+        "READ T\n"
+        "CAST int32\n"
+        "READ N\n"
+        "ADD\n"
+        "WRITE M\n"
+        "READ T\n"
+        "READ A\n"
+        "GT\n"
+        "READ Y\n"
+        "CONST float64 2.0\n"
+        "LT\n"
+        "OR\n"
+        "WRITE E\n"
+;
+
+static bool CompileBatchEvaluator(RuntimeEvaluator &context, float64 *A, int32 *N, float64 *Y, int32 *M, uint8 *E) {
+    bool ok = (context.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = context.SetInputVariableType("A", Float64Bit);
+    }
+    if (ok) {
+        ok = context.SetInputVariableMemory("A", A);
+    }
+    if (ok) {
+        ok = context.SetInputVariableType("K", Float64Bit);
+    }
+    if (ok) {
+        ok = context.SetInputVariableType("N", SignedInteger32Bit);
+    }
+    if (ok) {
+        ok = context.SetInputVariableMemory("N", N);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableType("Y", Float64Bit);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableMemory("Y", Y);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableType("M", SignedInteger32Bit);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableMemory("M", M);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableType("E", UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableMemory("E", E);
+    }
+    if (ok) {
+        ok = (context.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        *(static_cast<float64 *>(context.GetInputVariableMemory("K"))) = -0.25;
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch(uint32 numberOfSamples) {
+
+    uint32 arraySize = numberOfSamples + 1u;
+    float64 *A = new float64[arraySize];
+    int32 *N = new int32[arraySize];
+    float64 *Y = new float64[arraySize];
+    int32 *M = new int32[arraySize];
+    uint8 *E = new uint8[arraySize];
+    for (uint32 i = 0u; i < arraySize; i++) {
+        A[i] = static_cast<float64>(i) * 0.1;
+        N[i] = static_cast<int32>(i) - 50;
+        Y[i] = -1.0;
+        M[i] = -1;
+        E[i] = 0xFFu;
+    }
+
+    // reference: one execution for each sample
+    float64 sampleA;
+    int32 sampleN;
+    float64 sampleY;
+    int32 sampleM;
+    uint8 sampleE;
+    RuntimeEvaluator reference(batchRpnCode);
+    bool ok = CompileBatchEvaluator(reference, &sampleA, &sampleN, &sampleY, &sampleM, &sampleE);
+
+    RuntimeEvaluator context(batchRpnCode);
+    if (ok) {
+        ok = CompileBatchEvaluator(context, A, N, Y, M, E);
+    }
+    if (ok) {
+        ok = (context.ExecuteBatch(numberOfSamples) == ErrorManagement::NoError);
+    }
+    for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+        sampleA = A[i];
+        sampleN = N[i];
+        ok = (reference.Execute() == ErrorManagement::NoError);
+        if (ok) {
+            ok = (Y[i] == sampleY);
+        }
+        if (ok) {
+            ok = (M[i] == sampleM);
+        }
+        if (ok) {
+            ok = (E[i] == sampleE);
+        }
+    }
+    // the samples after numberOfSamples are not touched
+    if (ok) {
+        ok = ((Y[numberOfSamples] == -1.0) && (M[numberOfSamples] == -1) && (E[numberOfSamples] == 0xFFu));
+    }
+    // the internal output variables hold the last sample
+    if ((ok) && (numberOfSamples > 0u)) {
+        ok = (*(static_cast<float64 *>(context.GetOutputVariableMemory("T"))) == *(static_cast<float64 *>(reference.GetOutputVariableMemory("T"))));
+    }
+
+    delete[] A;
+    delete[] N;
+    delete[] Y;
+    delete[] M;
+    delete[] E;
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_OutOfRange() {
+
+    CCString rpnCode=
+            "READ A\n"
+            "CAST uint8\n"
+            "WRITE B\n"
+    ;
+
+    float32 A[100];
+    uint8 B[100];
+    for (uint32 i = 0u; i < 100u; i++) {
+        A[i] = static_cast<float32>(i);
+    }
+    A[70] = 1000.0;
+
+    RuntimeEvaluator context(rpnCode);
+    bool ok = (context.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = context.SetInputVariableType("A", Float32Bit);
+    }
+    if (ok) {
+        ok = context.SetInputVariableMemory("A", &A[0]);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableType("B", UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableMemory("B", &B[0]);
+    }
+    if (ok) {
+        ok = (context.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (context.ExecuteBatch(100u) == ErrorManagement::OutOfRange);
+    }
+    // all the other samples are converted
+    if (ok) {
+        ok = ((B[69] == 69u) && (B[71] == 71u) && (B[99] == 99u));
+    }
+    if (ok) {
+        ok = (context.ExecuteBatch(70u) == ErrorManagement::NoError);
+    }
+
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestInternalVariables() {
+
+    CCString rpnCode=
+            "READ A\n"
+            "READ A\n"
+            "ADD\n"
+            "WRITE @cse0\n"
+            "READ @cse0\n"
+            "READ @cse0\n"
+            "MUL\n"
+            "WRITE B\n"
+    ;
+
+    float64 A[3] = { 1.0, 2.0, 3.0 };
+    float64 B[3] = { 0.0, 0.0, 0.0 };
+
+    RuntimeEvaluator context(rpnCode);
+    bool ok = (context.ExtractVariables() == ErrorManagement::NoError);
+    VariableInformation *var;
+    if (ok) {
+        ok = (context.BrowseInputVariable(0u, var) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (var->name == "A");
+    }
+    if (ok) {
+        ok = (context.BrowseInputVariable(1u, var) != ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (context.BrowseOutputVariable(0u, var) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (var->name == "B");
+    }
+    if (ok) {
+        ok = (context.BrowseOutputVariable(1u, var) != ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = context.SetInputVariableType("A", Float64Bit);
+    }
+    if (ok) {
+        ok = context.SetInputVariableMemory("A", &A[0]);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableType("B", Float64Bit);
+    }
+    if (ok) {
+        ok = context.SetOutputVariableMemory("B", &B[0]);
+    }
+    if (ok) {
+        ok = (context.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (context.Execute() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (B[0] == 4.0);
+    }
+    if (ok) {
+        ok = (context.ExecuteBatch(3u) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = ((B[0] == 4.0) && (B[1] == 16.0) && (B[2] == 36.0));
+    }
+
+    return ok;
+}
+
 bool RuntimeEvaluatorTest::TestExtractVariables(CCString rpnCode, ErrorManagement::ErrorType expectedError) {
     RuntimeEvaluator evaluator(rpnCode);
     bool ok = true;
@@ -133,6 +133,35 @@ public:
      */
      bool TestExecute(CCString rpnCode, ErrorManagement::ErrorType expectedError, RuntimeEvaluator::executionMode mode = RuntimeEvaluator::fastMode);
 
+    /**
+     * @brief   Tests that the threaded code executed in fastMode
+     *          produces the same results of the safeMode execution.
+     * @details Uses functions with and without a specialised threaded
+     *          version, with variables both in the internal and in the
+     *          external memory.
+     */
+     bool TestExecute_ThreadedCode();
+
+    /**
+     * @brief   Tests the ExecuteBatch() method.
+     * @details Checks that executing the code on \a numberOfSamples samples
+     *          gives the same results of executing it once for each sample.
+     */
+     bool TestExecuteBatch(uint32 numberOfSamples);
+
+    /**
+     * @brief   Tests that ExecuteBatch() reports the out of range conversions.
+     */
+     bool TestExecuteBatch_OutOfRange();
+
+    /**
+     * @brief   Tests the internal variables.
+     * @details Checks that the variables named with runtimeEvaluatorInternalVariablePrefix
+     *          are neither input nor output variables and that the code using them
+     *          computes the right values with Execute() and ExecuteBatch().
+     */
+     bool TestInternalVariables();
+
      /**
       * @brief   Tests the ExtractVariables() method.
       * @details Checks if execution stops with the correct expectedError.
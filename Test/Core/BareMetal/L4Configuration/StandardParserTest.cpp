@@ -434,4 +434,56 @@ bool StandardParserTest::TestStandardCast() {
     return var == 1;
 }
 
+bool StandardParserTest::TestParse_StreamMemoryReference() {
+    const char8 * const config = "A = {\n B = (uint32) 2\n C = { 1 2 3 }\n}\nD = \"E\"";
+    StreamMemoryReference configStream(config, StringHelper::Length(config));
+    StreamString errors;
+    ConfigurationDatabase database;
+
+    StandardParser myParser(configStream, database, &errors);
+    bool ok = myParser.Parse();
+    if (ok) {
+        ok = database.MoveAbsolute("A");
+    }
+    uint32 b = 0u;
+    if (ok) {
+        ok = database.Read("B", b);
+    }
+    if (ok) {
+        ok = (b == 2u);
+    }
+    uint32 c[3] = { 0u, 0u, 0u };
+    if (ok) {
+        ok = database.Read("C", c);
+    }
+    if (ok) {
+        ok = (c[0] == 1u) && (c[1] == 2u) && (c[2] == 3u);
+    }
+    StreamString d;
+    if (ok) {
+        ok = database.MoveToRoot();
+    }
+    if (ok) {
+        ok = database.Read("D", d);
+    }
+    if (ok) {
+        ok = (d == "E");
+    }
+    return ok;
+}
+
+bool StandardParserTest::TestParseErrors_StreamMemoryReference() {
+    const char8 * const config = "A = {\n B = 2\n C = { 1 2 3 \n}\n";
+    StreamMemoryReference configStream(config, StringHelper::Length(config));
+    StreamString errors;
+    ConfigurationDatabase database;
+
+    StandardParser myParser(configStream, database, &errors);
+    bool ok = !myParser.Parse();
+    if (ok) {
+        ok = (errors.Size() > 0u);
+    }
+    return ok;
+}
+
 
@@ -30,6 +30,7 @@
 
 #include "StandardParser.h"
 #include "ConfigurationDatabase.h"
+#include "StreamMemoryReference.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -119,6 +120,16 @@ public:
      */
     bool TestStandardCast();
 
+    /**
+     * @brief Tests the parsing of a read-only memory reference (e.g. a memory mapped file) without copying it.
+     */
+    bool TestParse_StreamMemoryReference();
+
+    /**
+     * @brief Tests that the errors of an input read from a read-only memory reference are reported.
+     */
+    bool TestParseErrors_StreamMemoryReference();
+
     /**
      * @brief Tests the type cast parsing with scalar variables.
      */
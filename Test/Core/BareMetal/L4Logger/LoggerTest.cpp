@@ -30,14 +30,137 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "Logger.h"
 #include "LoggerTest.h"
+#include "Sleep.h"
 #include "StreamString.h"
+#include "Threads.h"
+#include "Vector.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+/**
+ * @brief Returns all the pages that might have been triggered by other tests.
+ */
+static void EmptyLogger(MARTe::Logger * const logger) {
+    using namespace MARTe;
+    LoggerPage *page = logger->GetLogEntry();
+    while (page != NULL_PTR(LoggerPage *)) {
+        logger->ReturnPage(page);
+        page = logger->GetLogEntry();
+    }
+}
+
+/**
+ * @brief The last message received by LoggerTestErrorProcessFunction.
+ */
+static MARTe::StreamString loggerTestLastMessage;
+
+/**
+ * @brief Error process function that stores the last message.
+ */
+static void LoggerTestErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo,
+                                           const MARTe::char8 * const errorDescription) {
+    loggerTestLastMessage = errorDescription;
+}
+
+/**
+ * @brief Counts the number of log entries added to the Logger.
+ */
+class LoggerNotifierTest: public MARTe::LoggerNotifierI {
+public:
+    LoggerNotifierTest() {
+        counter = 0u;
+    }
+
+    virtual ~LoggerNotifierTest() {
+    }
+
+    virtual void LogEntryAdded() {
+        counter++;
+    }
+
+    MARTe::uint32 counter;
+};
+
+/**
+ * @brief A notifier that takes a while to return from LogEntryAdded.
+ */
+class LoggerNotifierSlowTest: public MARTe::LoggerNotifierI {
+public:
+    LoggerNotifierSlowTest() {
+        entered = 0;
+        returned = 0;
+    }
+
+    virtual ~LoggerNotifierSlowTest() {
+    }
+
+    virtual void LogEntryAdded() {
+        entered = 1;
+        MARTe::Sleep::MSec(200u);
+        returned = 1;
+    }
+
+    volatile MARTe::int32 entered;
+    volatile MARTe::int32 returned;
+};
+
+/**
+ * @brief Number of LoggerRateLimitThread threads that are still reporting.
+ */
+static volatile MARTe::int32 loggerRateLimitThreads = 0;
+
+/**
+ * @brief Reports 50 messages from the same call site.
+ */
+static void LoggerRateLimitThread(const void * const params) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < 50u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestRateLimit_Concurrent %d", i);
+    }
+    Atomic::Decrement(&loggerRateLimitThreads);
+}
+
+/**
+ * @brief Adds a page to the Logger (which calls the notifier).
+ */
+static void LoggerAddPageThread(const void * const params) {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerPage *page = logger->GetPage();
+    if (page != NULL_PTR(LoggerPage *)) {
+        logger->AddLogEntry(page);
+    }
+}
+
+/**
+ * @brief Gets the message of the next entry of the \a logger.
+ */
+static bool GetNextMessage(MARTe::Logger * const logger,
+                           MARTe::StreamString &message) {
+    using namespace MARTe;
+    LoggerPage *entry = logger->GetLogEntry();
+    bool ok = (entry != NULL_PTR(LoggerPage *));
+    if (ok) {
+        ok = (entry->errorInfo.header.errorType == ErrorManagement::Information);
+    }
+    if (ok) {
+        ok = (entry->format == NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        message = entry->errorStrBuffer;
+    }
+    if (entry != NULL_PTR(LoggerPage *)) {
+        logger->ReturnPage(entry);
+    }
+    return ok;
+}
+
 bool LoggerTest::TestConstructor() {
     using namespace MARTe;
     Logger *logger = Logger::Instance();
@@ -163,7 +286,473 @@ bool LoggerTest::TestGetNumberOfLogs() {
     return ok;
 }
 
+bool LoggerTest::TestSetDeferredFormatting() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetDeferredFormatting(true);
+    bool ok = (ErrorManagement::deferredErrorProcessFunction != NULL);
+    uint32 i;
+    for (i = 0u; (i < (DEFAULT_NUMBER_OF_LOG_PAGES * 2u)) && (ok); i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestSetDeferredFormatting %d", i);
+        StreamString message;
+        ok = GetNextMessage(logger, message);
+        if (ok) {
+            StreamString toCompare;
+            toCompare.Printf("Testing TestSetDeferredFormatting %d", i);
+            ok = (toCompare == message);
+        }
+    }
+    logger->SetDeferredFormatting(false);
+    if (ok) {
+        ok = (ErrorManagement::deferredErrorProcessFunction == NULL);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestSetDeferredFormatting %d", 3);
+        StreamString message;
+        ok = GetNextMessage(logger, message);
+        if (ok) {
+            ok = (message == "Testing TestSetDeferredFormatting 3");
+        }
+    }
+    return ok;
+}
+
+bool LoggerTest::TestIsDeferredFormatting() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    bool ok = !logger->IsDeferredFormatting();
+    logger->SetDeferredFormatting(true);
+    if (ok) {
+        ok = logger->IsDeferredFormatting();
+    }
+    logger->SetDeferredFormatting(false);
+    if (ok) {
+        ok = !logger->IsDeferredFormatting();
+    }
+    return ok;
+}
+
+bool LoggerTest::TestDeferredFormatting_Values() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetDeferredFormatting(true);
+    int8 i8 = -8;
+    uint16 u16 = 16u;
+    int32 i32 = -32;
+    uint64 u64 = 0xFFFFFFFFFFFFull;
+    float32 f32 = 1.5F;
+    float64 f64 = -2.25;
+    char8 array[16] = "array";
+    StreamString stream = "stream";
+    void *pointer = &stream;
+    const char8 * const format = "%d %u %d %u %f %f %s %s %p";
+    StreamString toCompare;
+    bool ok = toCompare.Printf(format, i8, u16, i32, u64, f32, f64, array, stream.Buffer(), pointer);
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "%d %u %d %u %f %f %s %s %p", i8, u16, i32, u64, f32, f64, array, stream.Buffer(), pointer);
+    //Change all the values before the message is formatted.
+    i8 = 0;
+    u16 = 0u;
+    i32 = 0;
+    u64 = 0u;
+    f32 = 0.F;
+    f64 = 0.;
+    array[0] = 'X';
+    stream = "changed";
+    pointer = NULL_PTR(void *);
+    StreamString message;
+    if (ok) {
+        ok = GetNextMessage(logger, message);
+    }
+    if (ok) {
+        ok = (toCompare == message);
+    }
+    if (ok) {
+        //NULL strings are kept (and fail to print as when the formatting is not deferred).
+        const char8 *nullString = NULL_PTR(const char8 *);
+        toCompare = "";
+        (void) toCompare.Printf("%s %s", nullString, "literal");
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%s %s", nullString, "literal");
+        if (ok) {
+            ok = GetNextMessage(logger, message);
+        }
+        if (ok) {
+            ok = (toCompare == message);
+        }
+    }
+    logger->SetDeferredFormatting(false);
+    return ok;
+}
+
+bool LoggerTest::TestDeferredFormatting_NotDeferred() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetDeferredFormatting(true);
+    uint32 values[3] = { 1u, 2u, 3u };
+    Vector<uint32> vector(&values[0], 3u);
+    StreamString toCompare;
+    bool ok = toCompare.Printf("Vector %d", vector);
+    EmptyLogger(logger);
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Vector %d", vector);
+    values[0] = 7u;
+    StreamString message;
+    if (ok) {
+        ok = GetNextMessage(logger, message);
+    }
+    if (ok) {
+        ok = (toCompare == message);
+    }
+    //StreamString parameters are printed from their current position
+    StreamString stream = "stream";
+    if (ok) {
+        ok = stream.Seek(2u);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Stream %s", stream);
+        stream = "changed";
+        ok = GetNextMessage(logger, message);
+    }
+    if (ok) {
+        ok = (message == "Stream ream");
+    }
+    //Strings that do not fit in the parametersBuffer
+    char8 longString[MAX_ERROR_MESSAGE_SIZE + 1u];
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(&longString[0], 'a', MAX_ERROR_MESSAGE_SIZE);
+        longString[MAX_ERROR_MESSAGE_SIZE] = '\0';
+    }
+    if (ok) {
+        toCompare = "";
+        ok = toCompare.Printf("Long %d %s", 1, longString);
+    }
+    if (ok) {
+        //The message is truncated
+        ok = toCompare.SetSize(MAX_ERROR_MESSAGE_SIZE - 1u);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Long %d %s", 1, longString);
+        longString[0] = 'b';
+        ok = GetNextMessage(logger, message);
+    }
+    if (ok) {
+        ok = (toCompare == message);
+    }
+    logger->SetDeferredFormatting(false);
+    return ok;
+}
+
+bool LoggerTest::TestDeferredFormatting_OtherErrorProcessFunction() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetDeferredFormatting(true);
+    ErrorManagement::ErrorProcessFunctionType loggerFunction = ErrorManagement::errorMessageProcessFunction;
+    ErrorManagement::SetErrorProcessFunction(&LoggerTestErrorProcessFunction);
+    loggerTestLastMessage = "";
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing %s %d", "TestDeferredFormatting_OtherErrorProcessFunction", 1);
+    ErrorManagement::SetErrorProcessFunction(loggerFunction);
+    bool ok = (loggerTestLastMessage == "Testing TestDeferredFormatting_OtherErrorProcessFunction 1");
+    if (ok) {
+        ok = (logger->GetNumberOfLogs() == 0u);
+    }
+    logger->SetDeferredFormatting(false);
+    return ok;
+}
+
+bool LoggerTest::TestSetNotifier() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    LoggerNotifierTest notifier;
+    logger->SetNotifier(&notifier);
+    uint32 i;
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestSetNotifier %d", i);
+    }
+    //Pages added directly are also notified
+    LoggerPage *page = logger->GetPage();
+    bool ok = (page != NULL_PTR(LoggerPage *));
+    if (ok) {
+        logger->AddLogEntry(page);
+    }
+    logger->SetNotifier(NULL_PTR(LoggerNotifierI *));
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestSetNotifier %d", i);
+    if (ok) {
+        ok = (notifier.counter == 11u);
+    }
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestSetNotifier_WaitLogEntryAdded() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    LoggerNotifierSlowTest notifier;
+    logger->SetNotifier(&notifier);
+    ThreadIdentifier tid = Threads::BeginThread(&LoggerAddPageThread);
+    bool ok = (tid != InvalidThreadIdentifier);
+    uint32 i;
+    for (i = 0u; (i < 1000u) && (ok) && (notifier.entered == 0); i++) {
+        Sleep::MSec(1u);
+    }
+    if (ok) {
+        ok = (notifier.entered == 1);
+    }
+    logger->SetNotifier(NULL_PTR(LoggerNotifierI *));
+    //The notifier could be destroyed as soon as SetNotifier returns.
+    if (ok) {
+        ok = (notifier.returned == 1);
+    }
+    for (i = 0u; (i < 1000u) && (Threads::IsAlive(tid)); i++) {
+        Sleep::MSec(1u);
+    }
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestGetNotifier() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerNotifierTest notifier;
+    bool ok = (logger->GetNotifier() == NULL_PTR(LoggerNotifierI *));
+    logger->SetNotifier(&notifier);
+    if (ok) {
+        ok = (logger->GetNotifier() == &notifier);
+    }
+    logger->SetNotifier(NULL_PTR(LoggerNotifierI *));
+    if (ok) {
+        ok = (logger->GetNotifier() == NULL_PTR(LoggerNotifierI *));
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 
+bool LoggerTest::TestSetRateLimit() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetRateLimit(3u, 100000u);
+    uint32 i;
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestSetRateLimit %d", i);
+    }
+    bool ok = (logger->GetNumberOfLogs() == 3u);
+    for (i = 0u; (i < 3u) && (ok); i++) {
+        StreamString message;
+        ok = GetNextMessage(logger, message);
+        if (ok) {
+            StreamString expected;
+            (void) expected.Printf("TestSetRateLimit %d", i);
+            ok = (message == expected);
+        }
+    }
+    logger->SetRateLimit(0u, 0u);
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestSetRateLimit %d", i);
+    }
+    if (ok) {
+        ok = (logger->GetNumberOfLogs() == 10u);
+    }
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestGetRateLimit() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    bool ok = (logger->GetRateLimit() == 0u);
+    logger->SetRateLimit(5u, 200u);
+    if (ok) {
+        ok = (logger->GetRateLimit() == 5u);
+    }
+    logger->SetRateLimit(0u, 0u);
+    if (ok) {
+        ok = (logger->GetRateLimit() == 0u);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestGetRateLimitPeriod() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    logger->SetRateLimit(5u, 200u);
+    bool ok = (logger->GetRateLimitPeriod() == 200u);
+    logger->SetRateLimit(0u, 0u);
+    return ok;
+}
+
+bool LoggerTest::TestAcceptLogEntry_CallSites() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetRateLimit(2u, 100000u);
+    uint32 i;
+    for (i = 0u; i < 5u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestAcceptLogEntry_CallSites A");
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestAcceptLogEntry_CallSites B");
+    }
+    bool ok = (logger->GetNumberOfLogs() == 4u);
+    const char8 * const expected[] = { "TestAcceptLogEntry_CallSites A", "TestAcceptLogEntry_CallSites B" };
+    for (i = 0u; (i < 4u) && (ok); i++) {
+        StreamString message;
+        ok = GetNextMessage(logger, message);
+        if (ok) {
+            ok = (message == expected[i % 2u]);
+        }
+    }
+    //A message which is not reported by a call site that is being limited
+    ErrorManagement::ErrorInformation errorInfo;
+    errorInfo.fileName = "TestAcceptLogEntry_CallSites";
+    errorInfo.functionName = "TestAcceptLogEntry_CallSites";
+    errorInfo.header.lineNumber = 1;
+    if (ok) {
+        ok = logger->AcceptLogEntry(errorInfo);
+    }
+    logger->SetRateLimit(0u, 0u);
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestRateLimit_Summary() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    logger->SetRateLimit(2u, 50u);
+    uint32 i;
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestRateLimit_Summary");
+    }
+    LoggerPage *entry = logger->GetLogEntry();
+    bool ok = (entry != NULL_PTR(LoggerPage *));
+    int16 lineNumber = 0;
+    if (ok) {
+        lineNumber = entry->errorInfo.header.lineNumber;
+        logger->ReturnPage(entry);
+        StreamString message;
+        ok = GetNextMessage(logger, message);
+    }
+    if (ok) {
+        ok = (logger->GetLogEntry() == NULL_PTR(LoggerPage *));
+    }
+    Sleep::MSec(60u);
+    entry = logger->GetLogEntry();
+    if (ok) {
+        ok = (entry != NULL_PTR(LoggerPage *));
+    }
+    if (ok) {
+        ok = (entry->errorInfo.header.errorType == ErrorManagement::Information);
+    }
+    if (ok) {
+        ok = (entry->errorInfo.header.lineNumber == lineNumber);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(&entry->errorStrBuffer[0], "Message repeated 8 times") == 0);
+    }
+    if (entry != NULL_PTR(LoggerPage *)) {
+        logger->ReturnPage(entry);
+    }
+    //Only once
+    Sleep::MSec(60u);
+    if (ok) {
+        ok = (logger->GetLogEntry() == NULL_PTR(LoggerPage *));
+    }
+    logger->SetRateLimit(0u, 0u);
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestGetNumberOfSuppressedLogs() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    uint32 nOfSuppressedLogs = logger->GetNumberOfSuppressedLogs();
+    logger->SetRateLimit(4u, 100000u);
+    uint32 i;
+    for (i = 0u; i < 10u; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "TestGetNumberOfSuppressedLogs");
+    }
+    logger->SetRateLimit(0u, 0u);
+    bool ok = (logger->GetNumberOfSuppressedLogs() == (nOfSuppressedLogs + 6u));
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestRateLimit_Concurrent() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    uint32 nOfSuppressedLogs = logger->GetNumberOfSuppressedLogs();
+    logger->SetRateLimit(5u, 100000u);
+    const uint32 numberOfThreads = 4u;
+    loggerRateLimitThreads = static_cast<int32>(numberOfThreads);
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfThreads) && (ok); i++) {
+        ok = (Threads::BeginThread(&LoggerRateLimitThread) != InvalidThreadIdentifier);
+    }
+    for (i = 0u; (i < 5000u) && (ok) && (loggerRateLimitThreads > 0); i++) {
+        Sleep::MSec(1u);
+    }
+    if (ok) {
+        ok = (loggerRateLimitThreads == 0);
+    }
+    logger->SetRateLimit(0u, 0u);
+    if (ok) {
+        ok = (logger->GetNumberOfLogs() == 5u);
+    }
+    if (ok) {
+        ok = (logger->GetNumberOfSuppressedLogs() == (nOfSuppressedLogs + (numberOfThreads * 50u) - 5u));
+    }
+    EmptyLogger(logger);
+    return ok;
+}
+
+bool LoggerTest::TestGetNumberOfDroppedLogs() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    EmptyLogger(logger);
+    uint32 nOfDroppedLogs = logger->GetNumberOfDroppedLogs();
+    uint32 nOfPages = logger->GetNumberOfPages();
+    LoggerPage **pages = new LoggerPage*[nOfPages];
+    uint32 n = 0u;
+    pages[n] = logger->GetPage();
+    while ((pages[n] != NULL_PTR(LoggerPage *)) && (n < (nOfPages - 1u))) {
+        n++;
+        pages[n] = logger->GetPage();
+    }
+    if (pages[n] != NULL_PTR(LoggerPage *)) {
+        n++;
+    }
+    //All the pages are taken
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestGetNumberOfDroppedLogs");
+    REPORT_ERROR_STATIC(ErrorManagement::Information, "TestGetNumberOfDroppedLogs");
+    bool ok = (logger->GetNumberOfDroppedLogs() == (nOfDroppedLogs + 2u));
+    uint32 i;
+    for (i = 0u; i < n; i++) {
+        logger->ReturnPage(pages[i]);
+    }
+    delete[] pages;
+    LoggerPage *entry = logger->GetLogEntry();
+    if (ok) {
+        ok = (entry != NULL_PTR(LoggerPage *));
+    }
+    if (ok) {
+        ok = (entry->errorInfo.header.errorType == ErrorManagement::Warning);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(&entry->errorStrBuffer[0], "2 log messages were lost because no page was available") == 0);
+    }
+    if (entry != NULL_PTR(LoggerPage *)) {
+        logger->ReturnPage(entry);
+    }
+    if (ok) {
+        ok = (logger->GetLogEntry() == NULL_PTR(LoggerPage *));
+    }
+    return ok;
+}
@@ -82,6 +82,87 @@ public:
      */
     bool TestLoggerErrorProcessFunction();
 
+    /**
+     * @brief Tests the SetDeferredFormatting method
+     */
+    bool TestSetDeferredFormatting();
+
+    /**
+     * @brief Tests the IsDeferredFormatting method
+     */
+    bool TestIsDeferredFormatting();
+
+    /**
+     * @brief Tests that the deferred messages are formatted with the values of the parameters when the error was reported
+     */
+    bool TestDeferredFormatting_Values();
+
+    /**
+     * @brief Tests that the messages with parameters that cannot be deferred are formatted immediately
+     */
+    bool TestDeferredFormatting_NotDeferred();
+
+    /**
+     * @brief Tests that the deferred messages are formatted when the errors are not processed by the Logger
+     */
+    bool TestDeferredFormatting_OtherErrorProcessFunction();
+
+    /**
+     * @brief Tests the SetNotifier method
+     */
+    bool TestSetNotifier();
+
+    /**
+     * @brief Tests that the SetNotifier method waits for the LogEntryAdded calls on the previous notifier to return.
+     */
+    bool TestSetNotifier_WaitLogEntryAdded();
+
+    /**
+     * @brief Tests the GetNotifier method
+     */
+    bool TestGetNotifier();
+
+    /**
+     * @brief Tests that the SetRateLimit method limits the number of messages logged from the same call site.
+     */
+    bool TestSetRateLimit();
+
+    /**
+     * @brief Tests the GetRateLimit method.
+     */
+    bool TestGetRateLimit();
+
+    /**
+     * @brief Tests the GetRateLimitPeriod method.
+     */
+    bool TestGetRateLimitPeriod();
+
+    /**
+     * @brief Tests that the AcceptLogEntry method limits each call site independently.
+     */
+    bool TestAcceptLogEntry_CallSites();
+
+    /**
+     * @brief Tests that a "Message repeated N times" entry is added after the rate limiting period.
+     */
+    bool TestRateLimit_Summary();
+
+    /**
+     * @brief Tests the GetNumberOfSuppressedLogs method.
+     */
+    bool TestGetNumberOfSuppressedLogs();
+
+    /**
+     * @brief Tests that the messages reported concurrently from the same call site are counted exactly once.
+     */
+    bool TestRateLimit_Concurrent();
+
+    /**
+     * @brief Tests that the GetNumberOfDroppedLogs method counts the messages lost because no page was available
+     * and that an entry with the number of lost messages is added.
+     */
+    bool TestGetNumberOfDroppedLogs();
+
 };
 
 
@@ -0,0 +1,419 @@
+/**
+ * @file CyclicTimerDataSourceTest.cpp
+ * @brief Source file for class CyclicTimerDataSourceTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CyclicTimerDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "CyclicTimerDataSourceTest.h"
+#include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+class CyclicTimerDataSourceTestScheduler1: public GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+CyclicTimerDataSourceTestScheduler1    ();
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution();
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution();
+
+    virtual void CustomPrepareNextState(){
+
+    }
+
+};
+
+CyclicTimerDataSourceTestScheduler1::CyclicTimerDataSourceTestScheduler1() :
+        GAMSchedulerI() {
+
+}
+
+MARTe::ErrorManagement::ErrorType CyclicTimerDataSourceTestScheduler1::StartNextStateExecution() {
+    return MARTe::ErrorManagement::NoError;
+}
+
+MARTe::ErrorManagement::ErrorType CyclicTimerDataSourceTestScheduler1::StopCurrentStateExecution() {
+    return MARTe::ErrorManagement::NoError;
+}
+
+CLASS_REGISTER(CyclicTimerDataSourceTestScheduler1, "1.0")
+
+class CyclicTimerDataSourceTestGAM1: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+CyclicTimerDataSourceTestGAM1    ();
+
+    virtual bool Setup();
+
+    virtual bool Execute();
+};
+
+CyclicTimerDataSourceTestGAM1::CyclicTimerDataSourceTestGAM1() :
+        GAM() {
+
+}
+
+bool CyclicTimerDataSourceTestGAM1::Setup() {
+    return true;
+}
+
+bool CyclicTimerDataSourceTestGAM1::Execute() {
+    return true;
+}
+CLASS_REGISTER(CyclicTimerDataSourceTestGAM1, "1.0")
+
+/**
+ * Application template. The parameters are: the Timer parameters, the Frequency of the Counter signal,
+ * the type of the Time signal and any extra signal to be read from the Timer.
+ */
+static const char8 * const configTemplate = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = CyclicTimerDataSourceTestGAM1"
+        "            InputSignals = {"
+        "               Counter = {"
+        "                   DataSource = Timer"
+        "                   Type = uint32"
+        "                   %s"
+        "               }"
+        "               Time = {"
+        "                   DataSource = Timer"
+        "                   Type = %s"
+        "               }"
+        "               Overruns = {"
+        "                   DataSource = Timer"
+        "                   Type = uint32"
+        "               }"
+        "               %s"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Timer = {"
+        "            Class = CyclicTimerDataSource"
+        "            %s"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = CyclicTimerDataSourceTestScheduler1"
+        "    }"
+        "}";
+
+static bool InitialiseCyclicTimerDataSourceEnviroment(const char8 * const frequency,
+                                                      const char8 * const timeType,
+                                                      const char8 * const extraSignal,
+                                                      const char8 * const timerParameters) {
+    StreamString configStream;
+    bool ok = configStream.Printf(configTemplate, frequency, timeType, extraSignal, timerParameters);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        configStream.Seek(0);
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+static bool GetCyclicTimerDataSourceSignals(ReferenceT<CyclicTimerDataSource> timer,
+                                            uint32 *&counter,
+                                            uint32 *&time,
+                                            uint32 *&overruns) {
+    void *signalAddress = NULL_PTR(void *);
+    bool ok = timer->GetSignalMemoryBuffer(0u, 0u, signalAddress);
+    if (ok) {
+        counter = static_cast<uint32 *>(signalAddress);
+        ok = timer->GetSignalMemoryBuffer(1u, 0u, signalAddress);
+    }
+    if (ok) {
+        time = static_cast<uint32 *>(signalAddress);
+        ok = timer->GetSignalMemoryBuffer(2u, 0u, signalAddress);
+    }
+    if (ok) {
+        overruns = static_cast<uint32 *>(signalAddress);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool CyclicTimerDataSourceTest::TestConstructor() {
+    CyclicTimerDataSource timer;
+    bool ret = (timer.GetFrequency() == 0.F);
+    if (ret) {
+        ret = (timer.GetPeriodTicks() == 0u);
+    }
+    if (ret) {
+        ret = (timer.GetNumberOfOverruns() == 0u);
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestInitialise() {
+    ConfigurationDatabase config;
+    bool ret = config.Write("SpinTime", 100);
+    if (ret) {
+        ret = config.Write("AdaptiveSpin", 0);
+    }
+    CyclicTimerDataSource timer;
+    if (ret) {
+        ret = timer.Initialise(config);
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestInitialise_False_AdaptiveSpin() {
+    ConfigurationDatabase config;
+    bool ret = config.Write("AdaptiveSpin", 2);
+    CyclicTimerDataSource timer;
+    if (ret) {
+        ret = !timer.Initialise(config);
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestSetConfiguredDatabase() {
+    bool ret = InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "uint32", "", "");
+    ReferenceT<CyclicTimerDataSource> timer;
+    if (ret) {
+        timer = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timer");
+        ret = timer.IsValid();
+    }
+    if (ret) {
+        ret = (timer->GetFrequency() == 1000.F);
+    }
+    if (ret) {
+        ret = (timer->GetPeriodTicks() == (HighResolutionTimer::Frequency() / 1000u));
+    }
+    if (ret) {
+        ret = (timer->GetNumberOfSignals() == 3u);
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestSetConfiguredDatabase_False_NoFrequency() {
+    return !InitialiseCyclicTimerDataSourceEnviroment("", "uint32", "", "");
+}
+
+bool CyclicTimerDataSourceTest::TestSetConfiguredDatabase_False_SignalType() {
+    return !InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "float32", "", "");
+}
+
+bool CyclicTimerDataSourceTest::TestSetConfiguredDatabase_False_NumberOfSignals() {
+    return !InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "uint32", "Extra = { DataSource = Timer Type = uint32 }", "");
+}
+
+bool CyclicTimerDataSourceTest::TestSynchronise() {
+    bool ret = InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "uint32", "", "SpinTime = 100");
+    ReferenceT<CyclicTimerDataSource> timer;
+    if (ret) {
+        timer = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timer");
+        ret = timer.IsValid();
+    }
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 *time = NULL_PTR(uint32 *);
+    uint32 *overruns = NULL_PTR(uint32 *);
+    if (ret) {
+        ret = GetCyclicTimerDataSourceSignals(timer, counter, time, overruns);
+    }
+    uint64 startTicks = 0u;
+    if (ret) {
+        ret = timer->Synchronise();
+        startTicks = HighResolutionTimer::Counter();
+    }
+    if (ret) {
+        ret = ((*counter == 0u) && (*time == 0u));
+    }
+    const uint32 numberOfCycles = 50u;
+    uint32 lastCounter = 0u;
+    uint32 i;
+    for (i = 0u; (i < numberOfCycles) && (ret); i++) {
+        ret = timer->Synchronise();
+        if (ret) {
+            //Deadlines can only be skipped if there was an overrun.
+            ret = (*counter > lastCounter);
+            if (ret) {
+                ret = ((*counter - lastCounter) == 1u) || (*overruns > 0u);
+            }
+            lastCounter = *counter;
+        }
+        if (ret) {
+            //The deadlines are on the grid, independently of the jitter of each cycle.
+            uint32 expectedTime = (*counter * 1000u);
+            ret = ((*time + 1u) >= expectedTime) && (*time <= (expectedTime + 1u));
+        }
+    }
+    if (ret) {
+        //The Synchronise never returns before the deadline.
+        uint64 elapsedTicks = HighResolutionTimer::Counter() - startTicks;
+        ret = (elapsedTicks >= ((lastCounter - 1u) * timer->GetPeriodTicks()));
+    }
+    if (ret) {
+        ret = (*overruns == timer->GetNumberOfOverruns());
+    }
+    if (ret) {
+        ret = (timer->GetSpinTicks() <= timer->GetPeriodTicks());
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestSynchronise_Overrun() {
+    bool ret = InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "uint32", "", "");
+    ReferenceT<CyclicTimerDataSource> timer;
+    if (ret) {
+        timer = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timer");
+        ret = timer.IsValid();
+    }
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 *time = NULL_PTR(uint32 *);
+    uint32 *overruns = NULL_PTR(uint32 *);
+    if (ret) {
+        ret = GetCyclicTimerDataSourceSignals(timer, counter, time, overruns);
+    }
+    if (ret) {
+        ret = timer->Synchronise();
+    }
+    if (ret) {
+        //Miss several deadlines
+        Sleep::MSec(10u);
+        ret = timer->Synchronise();
+    }
+    if (ret) {
+        ret = (*overruns == 1u);
+    }
+    if (ret) {
+        ret = (timer->GetNumberOfOverruns() == 1u);
+    }
+    if (ret) {
+        ret = (*counter > 10u);
+    }
+    if (ret) {
+        //Still aligned with the grid
+        uint32 expectedTime = (*counter * 1000u);
+        ret = ((*time + 1u) >= expectedTime) && (*time <= (expectedTime + 1u));
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestSynchronise_NoAdaptiveSpin() {
+    bool ret = InitialiseCyclicTimerDataSourceEnviroment("Frequency = 1000", "uint32", "", "SpinTime = 200 AdaptiveSpin = 0");
+    ReferenceT<CyclicTimerDataSource> timer;
+    if (ret) {
+        timer = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timer");
+        ret = timer.IsValid();
+    }
+    uint64 spinTicks = 0u;
+    if (ret) {
+        spinTicks = timer->GetSpinTicks();
+        uint64 expectedTicks = static_cast<uint64>((200e-6) * static_cast<float64>(HighResolutionTimer::Frequency()));
+        ret = ((spinTicks + 1u) >= expectedTicks) && (spinTicks <= (expectedTicks + 1u));
+    }
+    uint32 i;
+    for (i = 0u; (i < 10u) && (ret); i++) {
+        ret = timer->Synchronise();
+    }
+    if (ret) {
+        ret = (timer->GetSpinTicks() == spinTicks);
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestGetBrokerName() {
+    CyclicTimerDataSource timer;
+    ConfigurationDatabase config;
+    StreamString brokerName = timer.GetBrokerName(config, InputSignals);
+    bool ret = (brokerName == "MemoryMapInputBroker");
+    if (ret) {
+        ret = config.Write("Frequency", 1000);
+    }
+    if (ret) {
+        brokerName = timer.GetBrokerName(config, InputSignals);
+        ret = (brokerName == "MemoryMapSynchronisedInputBroker");
+    }
+    if (ret) {
+        ret = (timer.GetBrokerName(config, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    return ret;
+}
+
+bool CyclicTimerDataSourceTest::TestGetOutputBrokers() {
+    CyclicTimerDataSource timer;
+    ReferenceContainer outputBrokers;
+    return !timer.GetOutputBrokers(outputBrokers, "GAMA", NULL_PTR(void *));
+}
+
+bool CyclicTimerDataSourceTest::TestPrepareNextState() {
+    CyclicTimerDataSource timer;
+    return timer.PrepareNextState("State1", "State2");
+}
@@ -0,0 +1,118 @@
+/**
+ * @file CyclicTimerDataSourceTest.h
+ * @brief Header file for class CyclicTimerDataSourceTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CyclicTimerDataSourceTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CYCLICTIMERDATASOURCETEST_H_
+#define CYCLICTIMERDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CyclicTimerDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the CyclicTimerDataSource public methods.
+ */
+class CyclicTimerDataSourceTest {
+public:
+    /**
+     * @brief Tests the Constructor method.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails if AdaptiveSpin is not 0 or 1.
+     */
+    bool TestInitialise_False_AdaptiveSpin();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method computes the period from the signal Frequency.
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if no signal has a Frequency.
+     */
+    bool TestSetConfiguredDatabase_False_NoFrequency();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if a signal is not a 32 bit integer.
+     */
+    bool TestSetConfiguredDatabase_False_SignalType();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with more than three signals.
+     */
+    bool TestSetConfiguredDatabase_False_NumberOfSignals();
+
+    /**
+     * @brief Tests that the Synchronise method paces the cycles on the period grid.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that the Synchronise method counts the overruns and skips the missed deadlines.
+     */
+    bool TestSynchronise_Overrun();
+
+    /**
+     * @brief Tests that the spin time is kept constant when AdaptiveSpin = 0.
+     */
+    bool TestSynchronise_NoAdaptiveSpin();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests that the GetOutputBrokers method returns false.
+     */
+    bool TestGetOutputBrokers();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CYCLICTIMERDATASOURCETEST_H_ */
+
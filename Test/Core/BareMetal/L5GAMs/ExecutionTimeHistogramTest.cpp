@@ -0,0 +1,202 @@
+/**
+ * @file ExecutionTimeHistogramTest.cpp
+ * @brief Source file for class ExecutionTimeHistogramTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeHistogramTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "ExecutionTimeHistogramTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ExecutionTimeHistogramTest::TestConstructor() {
+    ExecutionTimeHistogram histogram;
+    bool ok = (histogram.GetNumberOfSamples() == 0u);
+    ok &= (histogram.GetNumberOfOverruns() == 0u);
+    ok &= (histogram.GetOverrunThreshold() == 0u);
+    ok &= (histogram.GetMinimum() == 0u);
+    ok &= (histogram.GetMaximum() == 0u);
+    ok &= (histogram.GetValueAtPercentile(50.0) == 0u);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestReset() {
+    ExecutionTimeHistogram histogram;
+    histogram.SetOverrunThreshold(10u);
+    histogram.Add(5u);
+    histogram.Add(50u);
+    bool ok = (histogram.GetNumberOfSamples() == 2u);
+    ok &= (histogram.GetNumberOfOverruns() == 1u);
+    histogram.Reset();
+    ok &= (histogram.GetNumberOfSamples() == 0u);
+    ok &= (histogram.GetNumberOfOverruns() == 0u);
+    ok &= (histogram.GetMaximum() == 0u);
+    ok &= (histogram.GetValueAtPercentile(100.0) == 0u);
+    ok &= (histogram.GetOverrunThreshold() == 10u);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestAdd() {
+    ExecutionTimeHistogram histogram;
+    histogram.Add(1000u);
+    histogram.Add(10u);
+    histogram.Add(100u);
+    bool ok = (histogram.GetNumberOfSamples() == 3u);
+    ok &= (histogram.GetMinimum() == 10u);
+    ok &= (histogram.GetMaximum() == 1000u);
+    ok &= (histogram.GetMean() == 370.0);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetNumberOfOverruns() {
+    ExecutionTimeHistogram histogram;
+    uint64 i;
+    for (i = 0u; i < 100u; i++) {
+        histogram.Add(i);
+    }
+    bool ok = (histogram.GetNumberOfOverruns() == 0u);
+    histogram.SetOverrunThreshold(89u);
+    for (i = 0u; i < 100u; i++) {
+        histogram.Add(i);
+    }
+    ok &= (histogram.GetNumberOfOverruns() == 10u);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetBucketIndex() {
+    bool ok = true;
+    uint32 lastIdx = 0u;
+    uint64 value = 0u;
+    //Walk through all the magnitudes with a step smaller than the bucket width.
+    while ((value < 0x4000000000000000ull) && (ok)) {
+        uint32 idx = ExecutionTimeHistogram::GetBucketIndex(value);
+        ok = (idx >= lastIdx);
+        if (ok) {
+            ok = (idx < EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS);
+        }
+        if (ok) {
+            ok = (value <= ExecutionTimeHistogram::GetBucketUpperValue(idx));
+        }
+        if ((ok) && (idx > 0u)) {
+            ok = (value > ExecutionTimeHistogram::GetBucketUpperValue(idx - 1u));
+        }
+        lastIdx = idx;
+        value += (value / 32u) + 1u;
+    }
+    if (ok) {
+        uint32 lastBucket = ExecutionTimeHistogram::GetBucketIndex(0xFFFFFFFFFFFFFFFFull);
+        ok = (lastBucket == (EXECUTION_TIME_HISTOGRAM_NUMBER_OF_BUCKETS - 1u));
+        if (ok) {
+            ok = (ExecutionTimeHistogram::GetBucketUpperValue(lastBucket) == 0xFFFFFFFFFFFFFFFFull);
+        }
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetValueAtPercentile() {
+    ExecutionTimeHistogram histogram;
+    uint64 i;
+    for (i = 1u; i <= 10000u; i++) {
+        histogram.Add(i);
+    }
+    //The returned values are the upper limit of the bucket, i.e. at most 1/16 above the exact value
+    uint64 p50 = histogram.GetValueAtPercentile(50.0);
+    uint64 p90 = histogram.GetValueAtPercentile(90.0);
+    uint64 p99 = histogram.GetValueAtPercentile(99.0);
+    bool ok = (p50 >= 5000u) && (p50 <= (5000u + (5000u / 16u)));
+    ok &= (p90 >= 9000u) && (p90 <= (9000u + (9000u / 16u)));
+    ok &= (p99 >= 9900u) && (p99 <= 10000u);
+    ok &= (histogram.GetValueAtPercentile(100.0) == 10000u);
+    ok &= (histogram.GetValueAtPercentile(0.0) == 1u);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetValueAtPercentile_Outlier() {
+    ExecutionTimeHistogram histogram;
+    uint64 i;
+    for (i = 0u; i < 99999u; i++) {
+        histogram.Add(10u);
+    }
+    histogram.Add(1000000u);
+    bool ok = (histogram.GetValueAtPercentile(99.99) == 10u);
+    ok &= (histogram.GetValueAtPercentile(100.0) == 1000000u);
+    ok &= (histogram.GetMaximum() == 1000000u);
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestExportData() {
+    ExecutionTimeHistogram histogram;
+    histogram.SetOverrunThreshold(150u);
+    histogram.Add(100u);
+    histogram.Add(200u);
+    ConfigurationDatabase cdb;
+    //1 tick = 1 us
+    bool ok = histogram.ExportData(cdb, 1e-6);
+    uint64 samples = 0u;
+    uint64 overruns = 0u;
+    float64 minUs = 0.0;
+    float64 maxUs = 0.0;
+    float64 meanUs = 0.0;
+    float64 p9999 = 0.0;
+    if (ok) {
+        ok = cdb.Read("Samples", samples);
+    }
+    if (ok) {
+        ok = cdb.Read("Overruns", overruns);
+    }
+    if (ok) {
+        ok = cdb.Read("Min", minUs);
+    }
+    if (ok) {
+        ok = cdb.Read("Max", maxUs);
+    }
+    if (ok) {
+        ok = cdb.Read("Mean", meanUs);
+    }
+    if (ok) {
+        ok = cdb.Read("P9999", p9999);
+    }
+    if (ok) {
+        ok = (samples == 2u) && (overruns == 1u);
+    }
+    if (ok) {
+        ok = (minUs > 99.9) && (minUs < 100.1) && (maxUs > 199.9) && (maxUs < 200.1);
+    }
+    if (ok) {
+        ok = (meanUs > 149.9) && (meanUs < 150.1) && (p9999 > 199.9) && (p9999 < 200.1);
+    }
+    if (ok) {
+        ok = cdb.Read("P50", p9999) && cdb.Read("P90", p9999) && cdb.Read("P99", p9999) && cdb.Read("P999", p9999);
+    }
+    return ok;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file ExecutionTimeHistogramTest.h
+ * @brief Header file for class ExecutionTimeHistogramTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeHistogramTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONTIMEHISTOGRAMTEST_H_
+#define EXECUTIONTIMEHISTOGRAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the ExecutionTimeHistogram public methods.
+ */
+class ExecutionTimeHistogramTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset();
+
+    /**
+     * @brief Tests the Add method and the min/max/mean statistics.
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests the SetOverrunThreshold and the GetNumberOfOverruns methods.
+     */
+    bool TestGetNumberOfOverruns();
+
+    /**
+     * @brief Tests that the GetBucketIndex method is monotonic and that each value is inside its bucket range.
+     */
+    bool TestGetBucketIndex();
+
+    /**
+     * @brief Tests the GetValueAtPercentile method for a uniform distribution.
+     */
+    bool TestGetValueAtPercentile();
+
+    /**
+     * @brief Tests the GetValueAtPercentile method with a single outlier.
+     */
+    bool TestGetValueAtPercentile_Outlier();
+
+    /**
+     * @brief Tests the ExportData method.
+     */
+    bool TestExportData();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONTIMEHISTOGRAMTEST_H_ */
@@ -2057,6 +2057,35 @@ bool GAMDataSourceTest::TestAllocateMemory() {
     return ret;
 }
 
+bool GAMDataSourceTest::TestPreFaultMemory() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config1);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    uint64 expectedSize = 0u;
+    if (ret) {
+        uint32 numberOfSignals = gamDataSource->GetNumberOfSignals();
+        for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+            uint32 byteSize = 0u;
+            ret = gamDataSource->GetSignalByteSize(i, byteSize);
+            expectedSize += byteSize;
+        }
+    }
+    if (ret) {
+        ret = (expectedSize > 0u);
+    }
+    if (ret) {
+        ret = (gamDataSource->PreFaultMemory() == expectedSize);
+    }
+    if (ret) {
+        GAMDataSource notAllocated;
+        ret = (notAllocated.PreFaultMemory() == 0u);
+    }
+    return ret;
+}
+
 bool GAMDataSourceTest::TestGetBrokerName() {
     bool ret = InitialiseGAMDataSourceEnviroment(config1);
     ReferenceT<GAMDataSource> gamDataSource;
@@ -99,6 +99,11 @@ public:
      */
     bool TestAllocateMemory();
 
+    /**
+     * @brief Tests that the PreFaultMemory method returns the size of the signal memory.
+     */
+    bool TestPreFaultMemory();
+
     /**
      * @brief Tests the GetBrokerName method.
      */
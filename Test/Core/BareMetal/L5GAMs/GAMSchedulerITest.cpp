@@ -753,3 +753,498 @@ bool GAMSchedulerITest::TestExecuteSingleCycle_False() {
     }
     return ok;
 }
+
+bool GAMSchedulerITest::TestExportData_ExecutionTimeHistograms() {
+    static StreamString config = ""
+            "$TestExportData_ExecutionTimeHistograms = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add1"
+            "                    Default = 1"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add2"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings"
+            "        ExecutionTimeHistograms = 1"
+            "        ExecutionTimeOverrunSec = 1e-9"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestExportData_ExecutionTimeHistograms");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    const uint64 numberOfCycles = 10u;
+    for (uint64 n = 0u; (n < numberOfCycles) && (ok); n++) {
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    ConfigurationDatabase exported;
+    if (ok) {
+        ok = scheduler->ExportData(exported);
+    }
+    if (ok) {
+        ok = exported.MoveAbsolute("ExecutionTimes.State1.Thread1");
+    }
+    bool found = false;
+    uint32 numberOfExecutables = 0u;
+    if (ok) {
+        numberOfExecutables = exported.GetNumberOfChildren();
+        //Input brokers, GAMs and output brokers
+        ok = (numberOfExecutables == scheduler->GetNumberOfExecutables("State1", "Thread1"));
+    }
+    for (uint32 e = 0u; (e < numberOfExecutables) && (ok); e++) {
+        ok = exported.MoveToChild(e);
+        uint64 samples = 0u;
+        uint64 overruns = 0u;
+        float64 minUs = 0.0;
+        float64 p50Us = 0.0;
+        float64 maxUs = 0.0;
+        if (ok) {
+            ok = exported.Read("Samples", samples);
+        }
+        if (ok) {
+            ok = exported.Read("Overruns", overruns);
+        }
+        if (ok) {
+            ok = exported.Read("Min", minUs);
+        }
+        if (ok) {
+            ok = exported.Read("P50", p50Us);
+        }
+        if (ok) {
+            ok = exported.Read("Max", maxUs);
+        }
+        if (ok) {
+            ok = (samples == numberOfCycles) && (overruns == numberOfCycles);
+        }
+        if (ok) {
+            ok = (minUs <= p50Us) && (p50Us <= maxUs);
+        }
+        StreamString name;
+        if (exported.Read("Name", name)) {
+            if (name == "GAMA") {
+                found = true;
+            }
+        }
+        if (ok) {
+            ok = exported.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        ok = found;
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExportData_ExecutionTimeHistograms_States() {
+    static StreamString config = ""
+            "$TestExportData_ExecutionTimeHistograms_States = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add1"
+            "                    Default = 1"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "        +State2 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings"
+            "        ExecutionTimeHistograms = 1"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestExportData_ExecutionTimeHistograms_States");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    //GAMA and its brokers are executed 10 times in State1 and 3 times in State2
+    const uint64 numberOfCycles[] = { 10u, 3u };
+    const char8 * const stateNames[] = { "State1", "State2" };
+    const char8 *currentStateName = "";
+    for (uint32 s = 0u; (s < 2u) && (ok); s++) {
+        ok = scheduler->PrepareNextState(currentStateName, stateNames[s]);
+        if (ok) {
+            ok = app->StartNextStateExecution();
+        }
+        for (uint64 n = 0u; (n < numberOfCycles[s]) && (ok); n++) {
+            ok = scheduler->ExecuteThreadCycle(0);
+        }
+        currentStateName = stateNames[s];
+    }
+    ConfigurationDatabase exported;
+    if (ok) {
+        ok = scheduler->ExportData(exported);
+    }
+    if (ok) {
+        ok = exported.MoveAbsolute("ExecutionTimes");
+    }
+    //Each state is exported once
+    if (ok) {
+        ok = (exported.GetNumberOfChildren() == 2u);
+    }
+    for (uint32 s = 0u; (s < 2u) && (ok); s++) {
+        StreamString threadPath;
+        ok = threadPath.Printf("ExecutionTimes.%s.Thread1", stateNames[s]);
+        if (ok) {
+            ok = exported.MoveAbsolute(threadPath.Buffer());
+        }
+        uint32 numberOfExecutables = 0u;
+        if (ok) {
+            numberOfExecutables = exported.GetNumberOfChildren();
+            ok = (numberOfExecutables == scheduler->GetNumberOfExecutables(stateNames[s], "Thread1"));
+        }
+        for (uint32 e = 0u; (e < numberOfExecutables) && (ok); e++) {
+            ok = exported.MoveToChild(e);
+            uint64 samples = 0u;
+            if (ok) {
+                ok = exported.Read("Samples", samples);
+            }
+            if (ok) {
+                ok = (samples == numberOfCycles[s]);
+            }
+            if (ok) {
+                ok = exported.MoveToAncestor(1u);
+            }
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool GAMSchedulerITest::TestInitialise_False_ExecutionTimeOverrunSec() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("TimingDataSource", "Timings");
+    if (ok) {
+        ok = cdb.Write("ExecutionTimeOverrunSec", -1.0);
+    }
+    DummyScheduler scheduler;
+    if (ok) {
+        ok = !scheduler.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExecuteSingleCycle_TimeUnitTicks() {
+    static StreamString config = ""
+            "$TestExecuteSingleCycle_TimeUnitTicks = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add1"
+            "                    Default = 1"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add2"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                    Alias = add2"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "            TimeUnit = Ticks"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestExecuteSingleCycle_TimeUnitTicks");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->ConfigureScheduler(app);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    if (ok) {
+        ok = scheduler->ExecuteThreadCycle(0);
+    }
+    ReferenceT<TimingDataSource> timings;
+    if (ok) {
+        timings = app->Find("Data.Timings");
+        ok = timings.IsValid();
+    }
+    uint64 *execTimeTicks[2] = { NULL_PTR(uint64 *), NULL_PTR(uint64 *) };
+    const char8 * const signalNames[2] = { "GAMA_ExecTime", "GAMB_ExecTime" };
+    uint32 n;
+    for (n = 0u; (n < 2u) && (ok); n++) {
+        uint32 signalIdx;
+        ok = timings->GetSignalIndex(signalIdx, signalNames[n]);
+        if (ok) {
+            ok = timings->IsTicksSignal(signalIdx);
+        }
+        void *signalAddress = NULL_PTR(void *);
+        if (ok) {
+            ok = timings->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+        }
+        if (ok) {
+            execTimeTicks[n] = reinterpret_cast<uint64 *>(signalAddress);
+        }
+    }
+    if (ok) {
+        //Time measured w.r.t. the start of the cycle, so that GAMB always finishes after GAMA.
+        ok = (*execTimeTicks[1] > 0u) && (*execTimeTicks[1] >= *execTimeTicks[0]);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool GAMSchedulerITest::TestTicksToMicroSeconds() {
+    DummyScheduler scheduler;
+    const uint64 scale = scheduler.GetTicksToMicroSecondsScale();
+    const float64 microSecondsPerTick = HighResolutionTimer::Period() * 1e6;
+    bool ok = (scale > 0u);
+    const uint32 numberOfValues = 6u;
+    const uint64 ticks[numberOfValues] = { 0u, 1u, 1000u, 123456789u, 0x100000000u, 0x123456789ABu };
+    uint32 n;
+    for (n = 0u; (n < numberOfValues) && (ok); n++) {
+        float64 expected = static_cast<float64>(ticks[n]) * microSecondsPerTick;
+        if (expected < 4294967295.0) {
+            float64 microSeconds = static_cast<float64>(GAMSchedulerI::TicksToMicroSeconds(ticks[n], scale));
+            float64 error = expected - microSeconds;
+            if (error < 0.0) {
+                error = -error;
+            }
+            //Truncation plus the rounding of the fixed-point scale (at most 0.5 / scale relative error).
+            ok = (error <= (1.0 + (expected / static_cast<float64>(scale))));
+        }
+    }
+    //Scales larger than 2^32 (i.e. ticks longer than one micro-second).
+    const uint64 tenMicroSecondsPerTick = 10ull << 32u;
+    if (ok) {
+        ok = (GAMSchedulerI::TicksToMicroSeconds(12345u, tenMicroSecondsPerTick) == 123450u);
+    }
+    if (ok) {
+        ok = (GAMSchedulerI::TicksToMicroSeconds(0x100000001ull, (1ull << 31u)) == 0x80000000u);
+    }
+    return ok;
+}
+
@@ -92,6 +92,31 @@ public:
      */
     bool TestExecuteSingleCycle_False();
 
+    /**
+     * @brief Tests that the ExecutionTimeHistograms are accumulated by ExecuteSingleCycle and exported by ExportData.
+     */
+    bool TestExportData_ExecutionTimeHistograms();
+
+    /**
+     * @brief Tests that an ExecutableI shared by two states has a distinct ExecutionTimeHistogram in each state.
+     */
+    bool TestExportData_ExecutionTimeHistograms_States();
+
+    /**
+     * @brief Tests that the Initialise fails if the ExecutionTimeOverrunSec is negative.
+     */
+    bool TestInitialise_False_ExecutionTimeOverrunSec();
+
+    /**
+     * @brief Tests that ExecuteSingleCycle stores raw ticks in the time signals when the TimingDataSource TimeUnit is Ticks.
+     */
+    bool TestExecuteSingleCycle_TimeUnitTicks();
+
+    /**
+     * @brief Tests the TicksToMicroSeconds method against the floating-point conversion.
+     */
+    bool TestTicksToMicroSeconds();
+
 };
 
 /*---------------------------------------------------------------------------*/
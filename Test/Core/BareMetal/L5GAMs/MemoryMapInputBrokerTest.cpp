@@ -32,6 +32,7 @@
 #include "MemoryMapInputBrokerTest.h"
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
+#include "GAMDataSource.h"
 #include "GAMSchedulerI.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
@@ -486,6 +487,86 @@ static const char8 * const config1 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}";
+static const char8 * const config2 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMB = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal4 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMA = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal2 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               Signal3 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -709,3 +790,52 @@ bool MemoryMapInputBrokerTest::TestExecute_MultiStateBuffer() {
     return ret;
 }
 
+bool MemoryMapInputBrokerTest::TestExecute_CoalescedCopies() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+    ReferenceT<GAMDataSource> dataSource;
+    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    ReferenceT<MemoryMapInputBrokerTestGAM1> gamA;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gamA.IsValid();
+    }
+    if (ret) {
+        ret = broker->Init(InputSignals, *(dataSource.operator->()), "GAMA", gamA->GetInputSignalsMemory());
+    }
+    if (ret) {
+        ret = (broker->GetNumberOfCopies() == 4u);
+    }
+    //Signal0, Signal1 and Signal2 are contiguous in both memories. Signal3 is not.
+    if (ret) {
+        ret = (broker->GetNumberOfCopyRuns(0u) == 2u);
+    }
+    if (ret) {
+        ret = (broker->GetNumberOfCopyRuns(dataSource->GetNumberOfStatefulMemoryBuffers()) == 0u);
+    }
+    uint32 signalIdx;
+    uint32 *dataSourcePtr = NULL_PTR(uint32 *);
+    const char8 *signalNames[] = { "Signal0", "Signal1", "Signal2", "Signal3" };
+    uint32 n;
+    for (n = 0u; (n < 4u) && (ret); n++) {
+        ret = dataSource->GetSignalIndex(signalIdx, signalNames[n]);
+        if (ret) {
+            ret = dataSource->GetSignalMemoryBuffer(signalIdx, dataSource->GetCurrentStateBuffer(), reinterpret_cast<void *&>(dataSourcePtr));
+        }
+        if (ret) {
+            *dataSourcePtr = (n + 1u) * 10u;
+        }
+    }
+    if (ret) {
+        ret = broker->Execute();
+    }
+    for (n = 0u; (n < 4u) && (ret); n++) {
+        uint32 *gamPtr = reinterpret_cast<uint32 *>(gamA->GetInputSignalMemory(n));
+        ret = (*gamPtr == ((n + 1u) * 10u));
+    }
+
+    return ret;
+}
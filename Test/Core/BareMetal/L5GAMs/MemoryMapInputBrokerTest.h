@@ -68,6 +68,11 @@ public:
      * @brief Tests the Execute method with a multi-state buffers.
      */
     bool TestExecute_MultiStateBuffer();
+
+    /**
+     * @brief Tests the Execute method with signals that are contiguous both in the GAM and in the DataSource memory.
+     */
+    bool TestExecute_CoalescedCopies();
 };
 
 /*---------------------------------------------------------------------------*/
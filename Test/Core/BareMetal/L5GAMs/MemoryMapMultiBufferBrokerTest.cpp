@@ -221,6 +221,10 @@ MemoryMapMultiBufferBrokerTestInputBroker    () {
         return signalIdxArr;
     }
 
+    MemoryMapBrokerCopyTableEntry *GetCopyTable() {
+        return copyTable;
+    }
+
     bool CopyInputs() {
         return MemoryMapMultiBufferBroker::CopyInputs();
     }
@@ -481,6 +485,46 @@ bool MemoryMapMultiBufferBrokerTest::TestInit1() {
     return ret;
 }
 
+bool MemoryMapMultiBufferBrokerTest::TestInit_NoCopyRuns() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    MemoryMapMultiBufferBrokerTestInputBroker brokerTest;
+
+    ReferenceT<MemoryMapMultiBufferBrokerDSTest> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    MemoryMapMultiBufferBrokerDSTest *dataSourceInstance = dataSource.operator->();
+
+    ReferenceT<MemoryMapMultiBufferBrokerTestGAM1> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        void* gamPtr = gam->GetInputMemoryBuffer();
+        ret = brokerTest.Init(InputSignals, *dataSourceInstance, "GAMA", gamPtr);
+    }
+    //The copyTable is not compiled into copy runs, which would not follow the copy sizes of the multi-buffer copies.
+    if (ret) {
+        ret = (brokerTest.GetNumberOfCopyRuns(0u) == 0u);
+    }
+    MemoryMapBrokerCopyTableEntry *copyTable = brokerTest.GetCopyTable();
+    if (ret) {
+        ret = (copyTable != NULL);
+    }
+    uint32 numberOfCopies = brokerTest.GetNumberOfCopies();
+    for (uint32 n = 0u; (n < numberOfCopies) && (ret); n++) {
+        ret = (copyTable[n].copySize == brokerTest.GetCopyByteSize(n));
+    }
+    if (ret) {
+        ret = brokerTest.CopyInputs();
+    }
+
+    return ret;
+}
+
 bool MemoryMapMultiBufferBrokerTest::TestCopyInputs() {
     static const char8 * const config1 = ""
             "$Application1 = {"
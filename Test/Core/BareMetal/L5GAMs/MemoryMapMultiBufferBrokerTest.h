@@ -66,6 +66,11 @@ public:
      */
     bool TestInit1();
 
+    /**
+     * @brief Tests that the Init method does not compile the copyTable into copy runs (see MemoryMapBroker::CompileCopyTable).
+     */
+    bool TestInit_NoCopyRuns();
+
     /**
      * @brief Tests the CopyInputs method.
      */
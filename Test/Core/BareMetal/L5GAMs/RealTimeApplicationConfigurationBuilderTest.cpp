@@ -32594,4 +32594,271 @@ bool RealTimeApplicationConfigurationBuilderTest::TestStructureDefaultArrayMembe
     return ok;
 }
 
+bool RealTimeApplicationConfigurationBuilderTest::TestConfigure_ManyFunctionsAndDataSources(bool fromConfig) {
+    const uint32 numberOfGAMs = 128u;
+    const uint32 numberOfDataSources = 32u;
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer";
+    uint32 i;
+    for (i = 0u; i < numberOfGAMs; i++) {
+        const uint32 d = (i % numberOfDataSources);
+        config.Printf("        +GAM%d = {"
+                      "            Class = GAM1"
+                      "            InputSignals = {"
+                      "                In%d = {"
+                      "                    DataSource = Drv%d"
+                      "                    Type = uint32"
+                      "                }"
+                      "            }"
+                      "            OutputSignals = {"
+                      "                Out%d = {"
+                      "                    DataSource = Drv%d"
+                      "                    Type = uint32"
+                      "                }"
+                      "            }"
+                      "        }", i, i, d, i, d);
+    }
+    //The Monitor reads the timing signals of all the GAMs (so that they are already in the TimingDataSource when
+    //the timing signals are added) and completes the partial definition of the Partial signal. Deleting the partial
+    //definition shifts the index of all the other Timings signals, with the int32 Partial members last.
+    config += ""
+            "        +Monitor = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                CycleTime = {"
+            "                    Alias = \"State1.Thread1_CycleTime\""
+            "                    DataSource = Timings"
+            "                    Type = uint32"
+            "                }";
+    for (i = 0u; i < numberOfGAMs; i++) {
+        config.Printf("                GAM%d_ExecTime = {"
+                      "                    DataSource = Timings"
+                      "                    Type = uint32"
+                      "                }", i);
+    }
+    config += ""
+            "                Partial = {"
+            "                    DataSource = Timings"
+            "                    Type = TestStructB"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                Sum = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }";
+    for (i = 0u; i < numberOfDataSources; i++) {
+        config.Printf("        +Drv%d = {"
+                      "            Class = Driver1"
+                      "        }", i);
+    }
+    config += ""
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "            Signals = {"
+            "                Partial = {"
+            "                    NumberOfElements = 1"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {";
+    for (i = 0u; i < numberOfGAMs; i++) {
+        config.Printf(" GAM%d", i);
+    }
+    config += ""
+            " Monitor }"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DefaultSchedulerForTests"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StreamString err;
+    StandardParser parser(config, cdb, &err);
+    bool ok = parser.Parse();
+    if (!ok) {
+        printf("\n%s\n", err.Buffer());
+    }
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataDatabase;
+    if (ok) {
+        if (fromConfig) {
+            ok = cdb.MoveAbsolute("$Application1");
+            if (ok) {
+                RealTimeApplicationConfigurationBuilder builder(cdb, "DDB1");
+                ok = builder.ConfigureBeforeInitialisation();
+                if (ok) {
+                    ok = builder.Copy(functionsDatabase, dataDatabase);
+                }
+            }
+        }
+        else {
+            ObjectRegistryDatabase::Instance()->Purge();
+            ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+            ReferenceT<RealTimeApplication> application;
+            if (ok) {
+                application = ObjectRegistryDatabase::Instance()->Find("Application1");
+                ok = application.IsValid();
+            }
+            if (ok) {
+                RealTimeApplicationConfigurationBuilder builder(*application.operator->(), "DDB1");
+                ok = builder.ConfigureAfterInitialisation();
+                if (ok) {
+                    ok = builder.Copy(functionsDatabase, dataDatabase);
+                }
+            }
+        }
+    }
+    //Count the signals of every DataSource by qualified name.
+    ConfigurationDatabase signalsCount;
+    if (ok) {
+        ok = dataDatabase.MoveAbsolute("Data");
+    }
+    uint32 numberOfDataSourcesFound = 0u;
+    if (ok) {
+        numberOfDataSourcesFound = dataDatabase.GetNumberOfChildren();
+        ok = (numberOfDataSourcesFound == (numberOfDataSources + 2u));
+    }
+    for (i = 0u; (i < numberOfDataSourcesFound) && (ok); i++) {
+        ok = dataDatabase.MoveToChild(i);
+        StreamString dataSourceName;
+        if (ok) {
+            ok = dataDatabase.Read("QualifiedName", dataSourceName);
+        }
+        if (ok) {
+            ok = signalsCount.CreateAbsolute(dataSourceName.Buffer());
+        }
+        if (ok) {
+            ok = dataDatabase.MoveRelative("Signals");
+        }
+        uint32 numberOfSignals = 0u;
+        if (ok) {
+            numberOfSignals = dataDatabase.GetNumberOfChildren();
+        }
+        uint32 s;
+        for (s = 0u; (s < numberOfSignals) && (ok); s++) {
+            ok = dataDatabase.MoveToChild(s);
+            StreamString signalName;
+            if (ok) {
+                ok = dataDatabase.Read("QualifiedName", signalName);
+            }
+            uint32 count = 0u;
+            if (ok) {
+                if (!signalsCount.Read(signalName.Buffer(), count)) {
+                    count = 0u;
+                }
+                count++;
+                ok = signalsCount.Write(signalName.Buffer(), count);
+            }
+            if (ok) {
+                ok = dataDatabase.MoveToAncestor(1u);
+            }
+        }
+        if (ok) {
+            ok = dataDatabase.MoveToAncestor(2u);
+        }
+    }
+    for (i = 0u; (i < numberOfGAMs) && (ok); i++) {
+        StreamString dataSourceName;
+        ok = dataSourceName.Printf("Drv%d", (i % numberOfDataSources));
+        if (ok) {
+            ok = signalsCount.MoveAbsolute(dataSourceName.Buffer());
+        }
+        uint32 count = 0u;
+        StreamString signalName;
+        if (ok) {
+            ok = signalName.Printf("In%d", i);
+        }
+        if (ok) {
+            ok = signalsCount.Read(signalName.Buffer(), count);
+        }
+        if (ok) {
+            ok = (count == 1u);
+        }
+        if (ok) {
+            signalName = "";
+            ok = signalName.Printf("Out%d", i);
+        }
+        if (ok) {
+            ok = signalsCount.Read(signalName.Buffer(), count);
+        }
+        if (ok) {
+            ok = (count == 1u);
+        }
+        if (ok) {
+            ok = signalsCount.MoveAbsolute("Timings");
+        }
+        const char8 * postfix[] = { "_ReadTime", "_ExecTime", "_WriteTime", NULL_PTR(const char8*) };
+        for (uint32 k = 0u; (postfix[k] != NULL) && (ok); k++) {
+            signalName = "";
+            ok = signalName.Printf("GAM%d%s", i, postfix[k]);
+            if (ok) {
+                ok = signalsCount.Read(signalName.Buffer(), count);
+            }
+            if (ok) {
+                ok = (count == 1u);
+            }
+        }
+    }
+    if (ok) {
+        ok = signalsCount.MoveAbsolute("Timings");
+    }
+    uint32 count = 0u;
+    if (ok) {
+        ok = signalsCount.Read("State1.Thread1_CycleTime", count);
+    }
+    if (ok) {
+        ok = (count == 1u);
+    }
+    if (ok) {
+        ok = signalsCount.Read("Monitor_ExecTime", count);
+    }
+    if (ok) {
+        ok = (count == 1u);
+    }
+    if (ok) {
+        ok = signalsCount.Read("Partial.b1", count);
+    }
+    if (ok) {
+        ok = (count == 1u);
+    }
+    if (ok) {
+        //The partial definition was replaced by the members of the structure.
+        ok = !signalsCount.Read("Partial", count);
+    }
+    if (ok) {
+        //Partial.b1, Partial.b2, the cycle time and the three timing signals of each GAM (including the Monitor).
+        ok = (signalsCount.GetNumberOfChildren() == (3u + (3u * (numberOfGAMs + 1u))));
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 }
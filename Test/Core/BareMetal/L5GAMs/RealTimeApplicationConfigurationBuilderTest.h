@@ -565,6 +565,12 @@ public:
      * @brief Tests that the application successfully handles a struct Default for char8 []
      */
     bool TestStructureDefaultArrayMemberString();
+
+    /**
+     * @brief Tests that the signals are resolved in applications with many GAMs and DataSources, including timing signals
+     * read by a GAM and a partial signal definition in the TimingDataSource.
+     */
+    bool TestConfigure_ManyFunctionsAndDataSources(bool fromConfig);
 };
 
 }
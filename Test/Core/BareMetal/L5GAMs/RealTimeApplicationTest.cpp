@@ -2426,3 +2426,66 @@ bool RealTimeApplicationTest::TestGetIndex() {
     return (app->GetIndex() == 1u);
 }
 
+bool RealTimeApplicationTest::TestGetMemoryFootprint() {
+    RealTimeApplication notConfigured;
+    bool ret = (notConfigured.GetMemoryFootprint() == 0u);
+    if (ret) {
+        ret = Init();
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ret) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ret = app.IsValid();
+    }
+    if (ret) {
+        ret = app->ConfigureApplication();
+    }
+    if (ret) {
+        //Four threads with the default stack size plus the DataSource memory and the broker tables.
+        ret = (app->GetMemoryFootprint() > (4u * THREADS_DEFAULT_STACKSIZE));
+    }
+    if (ret) {
+        ret = !app->IsMemoryLocked();
+    }
+    return ret;
+}
+
+bool RealTimeApplicationTest::TestIsMemoryLocked() {
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = cdb.MoveAbsolute("$Fibonacci");
+    }
+    if (ret) {
+        ret = cdb.Write("LockMemory", 1u);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ret = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ret) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ret = app.IsValid();
+    }
+    if (ret) {
+        ret = !app->IsMemoryLocked();
+    }
+    if (ret) {
+        ret = app->ConfigureApplication();
+    }
+    if (ret) {
+        ret = app->IsMemoryLocked();
+    }
+    if (ret) {
+        ret = (app->GetMemoryFootprint() > 0u);
+    }
+    //The memory is unlocked when the application is destroyed.
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -196,6 +196,16 @@ public:
      */
     bool TestGetIndex();
 
+    /**
+     * @brief Tests the GetMemoryFootprint method.
+     */
+    bool TestGetMemoryFootprint();
+
+    /**
+     * @brief Tests that the process memory is locked by ConfigureApplication when LockMemory = 1.
+     */
+    bool TestIsMemoryLocked();
+
     StreamString config;
 };
 
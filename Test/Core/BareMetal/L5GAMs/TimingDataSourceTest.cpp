@@ -329,6 +329,69 @@ static const char8 * const config2 = ""
         "    }"
         "}";
 
+//Time signals in ticks. GAMA_ReadTime is explicitly declared as uint32 and thus kept in micro-seconds.
+//The signals not consumed by any GAM (e.g. GAMB_ExecTime) are created with the type given by the TimeUnit.
+static const char8 * const config3 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = TimingDataSourceTestGAM1"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = TimingDataSourceTestGAM1"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "               GAMA_ExecTime = {"
+        "                   DataSource = Timings"
+        "                   Type = uint64"
+        "               }"
+        "               GAMA_ReadTime = {"
+        "                   DataSource = Timings"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "            TimeUnit = Ticks"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = TimingDataSourceTestScheduler1"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -369,3 +432,57 @@ bool TimingDataSourceTest::TestSetConfiguredDatabase_False_Producers() {
     TimingDataSource timingDataSource;
     return !timingDataSource.SetConfiguredDatabase(config);
 }
+
+bool TimingDataSourceTest::TestInitialise_TimeUnit() {
+    ConfigurationDatabase config;
+    bool ret = config.Write("TimeUnit", "MicroSeconds");
+    TimingDataSource timingDataSourceMicroSeconds;
+    if (ret) {
+        ret = timingDataSourceMicroSeconds.Initialise(config);
+    }
+    if (ret) {
+        ret = !timingDataSourceMicroSeconds.IsTimeUnitTicks();
+    }
+    if (ret) {
+        ret = config.Write("TimeUnit", "Ticks");
+    }
+    TimingDataSource timingDataSourceTicks;
+    if (ret) {
+        ret = timingDataSourceTicks.Initialise(config);
+    }
+    if (ret) {
+        ret = timingDataSourceTicks.IsTimeUnitTicks();
+    }
+    return ret;
+}
+
+bool TimingDataSourceTest::TestInitialise_False_TimeUnit() {
+    ConfigurationDatabase config;
+    bool ret = config.Write("TimeUnit", "Seconds");
+    TimingDataSource timingDataSource;
+    if (ret) {
+        ret = !timingDataSource.Initialise(config);
+    }
+    return ret;
+}
+
+bool TimingDataSourceTest::TestSetConfiguredDatabase_TimeUnitTicks() {
+    bool ret = InitialiseTimingDataSourceEnviroment(config3);
+    ReferenceT<TimingDataSource> timingDataSource;
+    if (ret) {
+        timingDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timings");
+        ret = timingDataSource.IsValid();
+    }
+    const uint32 numberOfSignals = 4u;
+    const char8 * const signalNames[numberOfSignals] = { "GAMA_ExecTime", "GAMA_ReadTime", "GAMB_ExecTime", "State1.Thread1_CycleTime" };
+    const bool ticksSignals[numberOfSignals] = { true, false, true, true };
+    uint32 n;
+    for (n = 0u; (n < numberOfSignals) && (ret); n++) {
+        uint32 signalIdx;
+        ret = timingDataSource->GetSignalIndex(signalIdx, signalNames[n]);
+        if (ret) {
+            ret = (timingDataSource->IsTicksSignal(signalIdx) == ticksSignals[n]);
+        }
+    }
+    return ret;
+}
@@ -59,6 +59,21 @@ public:
      */
     bool TestSetConfiguredDatabase_False_Producers();
 
+    /**
+     * @brief Tests the Initialise method with the TimeUnit set to MicroSeconds and to Ticks.
+     */
+    bool TestInitialise_TimeUnit();
+
+    /**
+     * @brief Tests that the Initialise method fails with an unsupported TimeUnit.
+     */
+    bool TestInitialise_False_TimeUnit();
+
+    /**
+     * @brief Tests that with TimeUnit = Ticks the time signals hold ticks, unless explicitly declared as uint32.
+     */
+    bool TestSetConfiguredDatabase_TimeUnitTicks();
+
 };
 
 /*---------------------------------------------------------------------------*/
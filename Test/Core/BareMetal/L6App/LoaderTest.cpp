@@ -139,6 +139,27 @@ bool LoaderTest::TestConfigure_Xml() {
     return ok;
 }
 
+bool LoaderTest::TestConfigure_Bin() {
+    using namespace MARTe;
+    Loader l;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("+A");
+    ok &= cdb.Write("Class", "ReferenceContainer");
+    ok &= cdb.MoveToRoot();
+    StreamString config;
+    ok &= cdb.ExportBinary(config);
+    ConfigurationDatabase params;
+    params.Write("Parser", "bin");
+    if (ok) {
+        ok = l.Configure(params, config);
+    }
+    if (ok) {
+        ReferenceT<ReferenceContainer> rc = ObjectRegistryDatabase::Instance()->Find("A");
+        ok = rc.IsValid();
+    }
+    return ok;
+}
+
 bool LoaderTest::TestConfigure_False_NoParser() {
     using namespace MARTe;
     Loader l;
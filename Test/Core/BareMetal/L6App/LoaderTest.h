@@ -72,6 +72,11 @@ public:
      */
     bool TestConfigure_Xml();
 
+    /**
+     * @brief Tests the Configure method with the binary parser.
+     */
+    bool TestConfigure_Bin();
+
     /**
      * @brief Tests the Configure method without specifying a parser.
      */
@@ -30,6 +30,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "BasicUDPSocketTest.h"
+#include "StreamString.h"
+#include "StringHelper.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -810,3 +812,62 @@ bool BasicUDPSocketTest::TestWrite(const ReadWriteUDPTestTable* table) {
     }
     return true;
 }
+
+
+bool BasicUDPSocketTest::TestWriteDatagrams() {
+    const uint32 nOfDatagrams = BasicUDPSocket::MAX_DATAGRAMS_PER_CALL + 3u;
+    BasicUDPSocket serverSocket;
+    BasicUDPSocket clientSocket;
+    bool ok = serverSocket.Open();
+    if (ok) {
+        ok = serverSocket.Listen(4445u);
+    }
+    if (ok) {
+        ok = clientSocket.Open();
+    }
+    if (ok) {
+        ok = clientSocket.Connect("127.0.0.1", 4445u);
+    }
+    StreamString datagrams[nOfDatagrams];
+    const char8 *inputs[nOfDatagrams];
+    uint32 sizes[nOfDatagrams];
+    uint32 i;
+    for (i = 0u; i < nOfDatagrams; i++) {
+        (void) datagrams[i].Printf("Datagram %d", i);
+        inputs[i] = datagrams[i].Buffer();
+        sizes[i] = static_cast<uint32>(datagrams[i].Size());
+    }
+    uint32 nOfDatagramsWritten = nOfDatagrams;
+    if (ok) {
+        ok = clientSocket.WriteDatagrams(&inputs[0], &sizes[0], nOfDatagramsWritten);
+    }
+    if (ok) {
+        ok = (nOfDatagramsWritten == nOfDatagrams);
+    }
+    for (i = 0u; (i < nOfDatagrams) && (ok); i++) {
+        char8 buffer[32];
+        uint32 size = 32u;
+        ok = serverSocket.Read(&buffer[0], size, 1000u);
+        if (ok) {
+            ok = (size == sizes[i]);
+        }
+        if (ok) {
+            ok = (StringHelper::CompareN(&buffer[0], inputs[i], size) == 0);
+        }
+    }
+    (void) clientSocket.Close();
+    (void) serverSocket.Close();
+    return ok;
+}
+
+bool BasicUDPSocketTest::TestWriteDatagrams_InvalidSocket() {
+    BasicUDPSocket clientSocket;
+    const char8 *inputs[] = { "a", "b" };
+    uint32 sizes[] = { 1u, 1u };
+    uint32 nOfDatagrams = 2u;
+    bool ok = !clientSocket.WriteDatagrams(&inputs[0], &sizes[0], nOfDatagrams);
+    if (ok) {
+        ok = (nOfDatagrams == 0u);
+    }
+    return ok;
+}
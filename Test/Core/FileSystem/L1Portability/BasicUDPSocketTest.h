@@ -167,6 +167,16 @@ public:
      */
     bool TestWrite(const ReadWriteUDPTestTable* table);
 
+    /**
+     * @brief Tests that WriteDatagrams sends (with more than one system call) all the datagrams in order.
+     */
+    bool TestWriteDatagrams();
+
+    /**
+     * @brief Tests that WriteDatagrams fails if the socket is not valid.
+     */
+    bool TestWriteDatagrams_InvalidSocket();
+
 public:
 
     InternetHost server;
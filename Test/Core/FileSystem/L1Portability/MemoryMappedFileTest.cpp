@@ -0,0 +1,334 @@
+/**
+ * @file MemoryMappedFileTest.cpp
+ * @brief Source file for class MemoryMappedFileTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMappedFileTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#if ENVIRONMENT == Linux
+#include <sys/stat.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Directory.h"
+#include "MemoryMappedFileTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Name of the file used by the tests.
+ */
+static const char8 * const memoryMappedFileTestName = "MemoryMappedFileTest.bin";
+
+/**
+ * @brief Deletes the file used by the tests.
+ */
+static void MemoryMappedFileTestDelete() {
+    Directory toDelete(memoryMappedFileTestName);
+    if (toDelete.Exists()) {
+        (void) toDelete.Delete();
+    }
+}
+
+/**
+ * @brief Creates the file used by the tests with \a size bytes, each set to its index.
+ */
+static bool MemoryMappedFileTestCreate(const uint32 size) {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, size);
+    if (ok) {
+        uint8 *memory = static_cast<uint8 *>(file.GetMemory());
+        for (uint32 i = 0u; i < size; i++) {
+            memory[i] = static_cast<uint8>(i);
+        }
+        ok = file.Close();
+    }
+    return ok;
+}
+
+/**
+ * @brief Checks that the file used by the tests has \a size bytes, each set to its index.
+ */
+static bool MemoryMappedFileTestCheck(const uint32 size) {
+    MemoryMappedFile file;
+    bool ok = file.OpenReadOnly(memoryMappedFileTestName);
+    if (ok) {
+        ok = (file.GetSize() == size);
+    }
+    if (ok) {
+        const uint8 *memory = static_cast<const uint8 *>(file.GetMemory());
+        for (uint32 i = 0u; (i < size) && (ok); i++) {
+            ok = (memory[i] == static_cast<uint8>(i));
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MemoryMappedFileTest::TestConstructor() {
+    MemoryMappedFile file;
+    bool ok = (file.GetMemory() == NULL);
+    if (ok) {
+        ok = (file.GetSize() == 0u);
+    }
+    if (ok) {
+        ok = !file.IsReadOnly();
+    }
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpen() {
+    bool ok = MemoryMappedFileTestCreate(8192u);
+    if (ok) {
+        ok = MemoryMappedFileTestCheck(8192u);
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpen_Resize() {
+    bool ok = MemoryMappedFileTestCreate(8192u);
+    MemoryMappedFile file;
+    if (ok) {
+        ok = file.Open(memoryMappedFileTestName, 4096u);
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    //The first 4096 bytes are kept.
+    if (ok) {
+        ok = MemoryMappedFileTestCheck(4096u);
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpen_Allocated() {
+    MemoryMappedFileTestDelete();
+    const uint32 fileSize = 1048576u;
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, fileSize);
+#if ENVIRONMENT == Linux
+    //A sparse file would have (almost) no blocks allocated.
+    if (ok) {
+        struct stat fileStatus;
+        ok = (stat(memoryMappedFileTestName, &fileStatus) == 0);
+        if (ok) {
+            ok = ((static_cast<uint64>(fileStatus.st_blocks) * 512u) >= fileSize);
+        }
+    }
+#endif
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpen_False_Size() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    return !file.Open(memoryMappedFileTestName, 0u);
+}
+
+bool MemoryMappedFileTest::TestOpen_False_AlreadyOpen() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, 4096u);
+    if (ok) {
+        ok = !file.Open(memoryMappedFileTestName, 4096u);
+    }
+    if (ok) {
+        ok = !file.OpenReadOnly(memoryMappedFileTestName);
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpenReadOnly() {
+    bool ok = MemoryMappedFileTestCreate(4096u);
+    MemoryMappedFile file;
+    if (ok) {
+        ok = file.OpenReadOnly(memoryMappedFileTestName);
+    }
+    if (ok) {
+        ok = (file.GetSize() == 4096u);
+    }
+    if (ok) {
+        ok = (static_cast<const uint8 *>(file.GetMemory())[10] == 10u);
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestOpenReadOnly_False_NotExistent() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = !file.OpenReadOnly(memoryMappedFileTestName);
+    if (ok) {
+        ok = (file.GetMemory() == NULL);
+    }
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestClose() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, 4096u);
+    if (ok) {
+        ok = file.Close();
+    }
+    if (ok) {
+        ok = ((file.GetMemory() == NULL) && (file.GetSize() == 0u));
+    }
+    //Can be reopened after being closed.
+    if (ok) {
+        ok = file.Open(memoryMappedFileTestName, 4096u);
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestClose_False() {
+    MemoryMappedFile file;
+    return !file.Close();
+}
+
+bool MemoryMappedFileTest::TestFlush() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = !file.Flush();
+    if (ok) {
+        ok = file.Open(memoryMappedFileTestName, 4096u);
+    }
+    if (ok) {
+        static_cast<char8 *>(file.GetMemory())[0] = 'M';
+        ok = file.Flush();
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestFlush_False_ReadOnly() {
+    bool ok = MemoryMappedFileTestCreate(4096u);
+    MemoryMappedFile file;
+    if (ok) {
+        ok = file.OpenReadOnly(memoryMappedFileTestName);
+    }
+    if (ok) {
+        ok = !file.Flush();
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestGetMemory() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = (file.GetMemory() == NULL);
+    if (ok) {
+        ok = file.Open(memoryMappedFileTestName, 4096u);
+    }
+    if (ok) {
+        ok = (file.GetMemory() != NULL);
+    }
+    //The memory is shared with other mappings of the same file.
+    MemoryMappedFile other;
+    if (ok) {
+        ok = other.OpenReadOnly(memoryMappedFileTestName);
+    }
+    if (ok) {
+        static_cast<char8 *>(file.GetMemory())[100] = 'M';
+        ok = (static_cast<const char8 *>(other.GetMemory())[100] == 'M');
+    }
+    if (ok) {
+        ok = other.Close();
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestGetSize() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, 12288u);
+    if (ok) {
+        ok = (file.GetSize() == 12288u);
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
+
+bool MemoryMappedFileTest::TestIsReadOnly() {
+    MemoryMappedFileTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(memoryMappedFileTestName, 4096u);
+    if (ok) {
+        ok = !file.IsReadOnly();
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    if (ok) {
+        ok = file.OpenReadOnly(memoryMappedFileTestName);
+    }
+    if (ok) {
+        ok = file.IsReadOnly();
+    }
+    if (ok) {
+        ok = file.Close();
+    }
+    MemoryMappedFileTestDelete();
+    return ok;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file MemoryMappedFileTest.h
+ * @brief Header file for class MemoryMappedFileTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMappedFileTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef MEMORYMAPPEDFILETEST_H_
+#define MEMORYMAPPEDFILETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryMappedFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the MemoryMappedFile public methods.
+ */
+class MemoryMappedFileTest {
+public:
+
+    /**
+     * @brief Tests the default constructor post-conditions.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Open creates a file with the requested size and that the written memory is stored in the file.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that Open resizes an existing file.
+     */
+    bool TestOpen_Resize();
+
+    /**
+     * @brief Tests that Open allocates the disk space of the whole file (i.e. that the file is not sparse).
+     */
+    bool TestOpen_Allocated();
+
+    /**
+     * @brief Tests that Open fails with a zero size.
+     */
+    bool TestOpen_False_Size();
+
+    /**
+     * @brief Tests that Open fails if the file is already open.
+     */
+    bool TestOpen_False_AlreadyOpen();
+
+    /**
+     * @brief Tests that OpenReadOnly maps all the contents of an existing file.
+     */
+    bool TestOpenReadOnly();
+
+    /**
+     * @brief Tests that OpenReadOnly fails if the file does not exist.
+     */
+    bool TestOpenReadOnly_False_NotExistent();
+
+    /**
+     * @brief Tests the Close method.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests that Close fails if the file is not open.
+     */
+    bool TestClose_False();
+
+    /**
+     * @brief Tests the Flush method.
+     */
+    bool TestFlush();
+
+    /**
+     * @brief Tests that Flush fails if the file was open with OpenReadOnly.
+     */
+    bool TestFlush_False_ReadOnly();
+
+    /**
+     * @brief Tests the GetMemory method.
+     */
+    bool TestGetMemory();
+
+    /**
+     * @brief Tests the GetSize method.
+     */
+    bool TestGetSize();
+
+    /**
+     * @brief Tests the IsReadOnly method.
+     */
+    bool TestIsReadOnly();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPPEDFILETEST_H_ */
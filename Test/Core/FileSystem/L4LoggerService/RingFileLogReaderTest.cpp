@@ -0,0 +1,366 @@
+/**
+ * @file RingFileLogReaderTest.cpp
+ * @brief Source file for class RingFileLogReaderTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLogReaderTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "Directory.h"
+#include "RingFileLogger.h"
+#include "RingFileLogReader.h"
+#include "RingFileLogReaderTest.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Name of the file used by the tests.
+ */
+static const MARTe::char8 * const ringFileLogReaderTestName = "RingFileLogReaderTest.bin";
+
+/**
+ * @brief Deletes the file used by the tests.
+ */
+static void RingFileLogReaderTestDelete() {
+    using namespace MARTe;
+    Directory toDelete(ringFileLogReaderTestName);
+    if (toDelete.Exists()) {
+        (void) toDelete.Delete();
+    }
+}
+
+/**
+ * @brief Writes the messages "Message first" to "Message (first + nOfMessages - 1)" with \a writer.
+ */
+static void RingFileLogReaderTestWriteMessages(MARTe::RingFileLogger &writer,
+                                               const MARTe::uint32 first,
+                                               const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    for (uint32 i = first; i < (first + nOfMessages); i++) {
+        LoggerPage page;
+        page.errorInfo.header.errorType = ErrorManagement::Information;
+        page.errorInfo.header.lineNumber = static_cast<int16>(i);
+        page.errorInfo.header.isObject = false;
+        page.errorInfo.hrtTime = i;
+        page.errorInfo.timeSeconds = 0;
+        page.errorInfo.objectName = NULL_PTR(const char8 *);
+        page.errorInfo.className = NULL_PTR(const char8 *);
+        page.errorInfo.fileName = "RingFileLogReaderTest.cpp";
+        page.errorInfo.functionName = "RingFileLogReaderTestWrite";
+        page.errorInfo.objectPointer = NULL_PTR(const void *);
+        StreamString message;
+        (void) message.Printf("Message %u", i);
+        (void) StringHelper::CopyN(&page.errorStrBuffer[0], message.Buffer(), MAX_ERROR_MESSAGE_SIZE);
+        writer.ConsumeLogMessage(&page);
+    }
+}
+
+/**
+ * @brief Initialises a RingFileLogger that writes to a new (8192 bytes) file used by the tests.
+ */
+static bool RingFileLogReaderTestInitialise(MARTe::RingFileLogger &writer) {
+    using namespace MARTe;
+    RingFileLogReaderTestDelete();
+    ConfigurationDatabase cdb;
+    cdb.Write("FileName", ringFileLogReaderTestName);
+    cdb.Write("Size", 8192u);
+    return writer.Initialise(cdb);
+}
+
+/**
+ * @brief Writes \a nOfMessages messages ("Message 0", "Message 1", ...) to the file used by the tests.
+ */
+static bool RingFileLogReaderTestWrite(const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    RingFileLogger writer;
+    bool ok = RingFileLogReaderTestInitialise(writer);
+    if (ok) {
+        RingFileLogReaderTestWriteMessages(writer, 0u, nOfMessages);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool RingFileLogReaderTest::TestConstructor() {
+    using namespace MARTe;
+    RingFileLogReader test;
+    LoggerPage page;
+    bool ok = (test.GetSequence() == 0u);
+    if (ok) {
+        ok = (test.GetNumberOfRecords() == 0u);
+    }
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestOpen() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(1u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestOpen_False_NotExistent() {
+    using namespace MARTe;
+    RingFileLogReaderTestDelete();
+    RingFileLogReader test;
+    return !test.Open(ringFileLogReaderTestName);
+}
+
+bool RingFileLogReaderTest::TestOpen_False_Invalid() {
+    using namespace MARTe;
+    RingFileLogReaderTestDelete();
+    MemoryMappedFile file;
+    bool ok = file.Open(ringFileLogReaderTestName, 8192u);
+    if (ok) {
+        ok = file.Close();
+    }
+    RingFileLogReader test;
+    if (ok) {
+        ok = !test.Open(ringFileLogReaderTestName);
+    }
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestOpen_False_AlreadyOpen() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(1u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    if (ok) {
+        ok = !test.Open(ringFileLogReaderTestName);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestClose() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(1u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = !test.Close();
+    }
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    if (ok) {
+        ok = test.Close();
+    }
+    LoggerPage page;
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestRead() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(10u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    LoggerPage page;
+    for (uint32 i = 0u; (i < 10u) && (ok); i++) {
+        ok = test.Read(page);
+        StreamString expected;
+        (void) expected.Printf("Message %u", i);
+        if (ok) {
+            ok = (expected == &page.errorStrBuffer[0]);
+        }
+        if (ok) {
+            ok = ((page.errorInfo.header.lineNumber == static_cast<int16>(i)) && (page.errorInfo.hrtTime == i));
+        }
+        if (ok) {
+            ok = (StringHelper::Compare(page.errorInfo.functionName, "RingFileLogReaderTestWrite") == 0);
+        }
+        if (ok) {
+            ok = (page.format == NULL_PTR(const char8 *));
+        }
+    }
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestRead_Overwritten() {
+    using namespace MARTe;
+    RingFileLogger writer;
+    bool ok = RingFileLogReaderTestInitialise(writer);
+    if (ok) {
+        RingFileLogReaderTestWriteMessages(writer, 0u, 10u);
+    }
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    LoggerPage page;
+    if (ok) {
+        ok = test.Read(page);
+    }
+    if (ok) {
+        ok = (test.GetSequence() == 0u);
+    }
+    //Wrap the file, so that the oldest records (but not the last ones committed when the reader was open) are overwritten.
+    if (ok) {
+        RingFileLogReaderTestWriteMessages(writer, 10u, 60u);
+    }
+    if (ok) {
+        ok = test.Read(page);
+    }
+    uint64 expectedSequence = 0u;
+    if (ok) {
+        expectedSequence = test.GetSequence();
+        ok = ((expectedSequence > 1u) && (expectedSequence < 10u));
+    }
+    while ((ok) && (expectedSequence < 10u)) {
+        StreamString expected;
+        (void) expected.Printf("Message %u", static_cast<uint32>(expectedSequence));
+        ok = (expected == &page.errorStrBuffer[0]);
+        if (ok) {
+            ok = (StringHelper::Compare(page.errorInfo.fileName, "RingFileLogReaderTest.cpp") == 0);
+        }
+        expectedSequence++;
+        if ((ok) && (expectedSequence < 10u)) {
+            ok = test.Read(page);
+            if (ok) {
+                ok = (test.GetSequence() == expectedSequence);
+            }
+        }
+    }
+    //Only the records committed when Open was called are read.
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestRead_Empty() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(0u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    LoggerPage page;
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestRead_False_Corrupted() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(3u);
+    //Corrupt the magic of the second record.
+    if (ok) {
+        MemoryMappedFile file;
+        ok = file.Open(ringFileLogReaderTestName, 8192u);
+        if (ok) {
+            char8 *dataArea = &static_cast<char8 *>(file.GetMemory())[RING_FILE_LOGGER_HEADER_SIZE];
+            const RingFileLoggerRecord *first = reinterpret_cast<const RingFileLoggerRecord *>(dataArea);
+            RingFileLoggerRecord *second = reinterpret_cast<RingFileLoggerRecord *>(&dataArea[first->size]);
+            second->magic = 0u;
+            ok = file.Close();
+        }
+    }
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    LoggerPage page;
+    if (ok) {
+        ok = test.Read(page);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(&page.errorStrBuffer[0], "Message 0") == 0);
+    }
+    if (ok) {
+        ok = !test.Read(page);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestGetSequence() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(3u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    LoggerPage page;
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        ok = test.Read(page);
+        if (ok) {
+            ok = (test.GetSequence() == i);
+        }
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
+
+bool RingFileLogReaderTest::TestGetNumberOfRecords() {
+    using namespace MARTe;
+    bool ok = RingFileLogReaderTestWrite(7u);
+    RingFileLogReader test;
+    if (ok) {
+        ok = test.Open(ringFileLogReaderTestName);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfRecords() == 7u);
+    }
+    (void) test.Close();
+    RingFileLogReaderTestDelete();
+    return ok;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file RingFileLogReaderTest.h
+ * @brief Header file for class RingFileLogReaderTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RingFileLogReaderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef RINGFILELOGREADERTEST_H_
+#define RINGFILELOGREADERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the RingFileLogReader public methods.
+ */
+class RingFileLogReaderTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Open accepts a valid ring log file.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that Open fails if the file does not exist.
+     */
+    bool TestOpen_False_NotExistent();
+
+    /**
+     * @brief Tests that Open fails if the file is not a ring log file.
+     */
+    bool TestOpen_False_Invalid();
+
+    /**
+     * @brief Tests that Open fails if a file is already open.
+     */
+    bool TestOpen_False_AlreadyOpen();
+
+    /**
+     * @brief Tests the Close method.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests that Read returns the records from the oldest to the newest.
+     */
+    bool TestRead();
+
+    /**
+     * @brief Tests that Read returns false for a ring log file without records.
+     */
+    bool TestRead_Empty();
+
+    /**
+     * @brief Tests that the records overwritten by a writer after Open are skipped.
+     */
+    bool TestRead_Overwritten();
+
+    /**
+     * @brief Tests that Read stops at a corrupted record.
+     */
+    bool TestRead_False_Corrupted();
+
+    /**
+     * @brief Tests the GetSequence method.
+     */
+    bool TestGetSequence();
+
+    /**
+     * @brief Tests the GetNumberOfRecords method.
+     */
+    bool TestGetNumberOfRecords();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* RINGFILELOGREADERTEST_H_ */
@@ -0,0 +1,489 @@
+/**
+ * @file RingFileLoggerTest.cpp
+ * @brief Source file for class RingFileLoggerTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLoggerTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "Directory.h"
+#include "LoggerService.h"
+#include "RingFileLogger.h"
+#include "RingFileLoggerTest.h"
+#include "RingFileLogReader.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Name of the file used by the tests.
+ */
+static const MARTe::char8 * const ringFileLoggerTestName = "RingFileLoggerTest.bin";
+
+/**
+ * @brief Deletes the file used by the tests.
+ */
+static void RingFileLoggerTestDelete() {
+    using namespace MARTe;
+    Directory toDelete(ringFileLoggerTestName);
+    if (toDelete.Exists()) {
+        (void) toDelete.Delete();
+    }
+}
+
+/**
+ * @brief Initialises \a ringFileLogger to write to the file used by the tests with \a size bytes.
+ */
+static bool RingFileLoggerTestSetup(MARTe::RingFileLogger &ringFileLogger,
+                                    const MARTe::uint32 size) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("FileName", ringFileLoggerTestName);
+    cdb.Write("Size", size);
+    return ringFileLogger.Initialise(cdb);
+}
+
+/**
+ * @brief Consumes a log message with \a message in \a ringFileLogger.
+ */
+static void RingFileLoggerTestConsume(MARTe::RingFileLogger &ringFileLogger,
+                                      const MARTe::char8 * const message) {
+    using namespace MARTe;
+    LoggerPage page;
+    page.errorInfo.header.errorType = ErrorManagement::Information;
+    page.errorInfo.header.lineNumber = 0;
+    page.errorInfo.header.isObject = false;
+    page.errorInfo.hrtTime = 0u;
+    page.errorInfo.timeSeconds = 0;
+    page.errorInfo.objectName = NULL_PTR(const char8 *);
+    page.errorInfo.className = NULL_PTR(const char8 *);
+    page.errorInfo.fileName = NULL_PTR(const char8 *);
+    page.errorInfo.functionName = NULL_PTR(const char8 *);
+    page.errorInfo.objectPointer = NULL_PTR(const void *);
+    (void) StringHelper::CopyN(&page.errorStrBuffer[0], message, MAX_ERROR_MESSAGE_SIZE);
+    ringFileLogger.ConsumeLogMessage(&page);
+}
+
+/**
+ * @brief Reads the file used by the tests and checks that it contains exactly the \a nOfMessages \a messages.
+ */
+static bool RingFileLoggerTestCheck(const MARTe::char8 * const * const messages,
+                                    const MARTe::uint32 nOfMessages) {
+    using namespace MARTe;
+    RingFileLogReader reader;
+    bool ok = reader.Open(ringFileLoggerTestName);
+    LoggerPage page;
+    for (uint32 i = 0u; (i < nOfMessages) && (ok); i++) {
+        ok = reader.Read(page);
+        if (ok) {
+            ok = (StringHelper::Compare(&page.errorStrBuffer[0], messages[i]) == 0);
+        }
+    }
+    if (ok) {
+        ok = !reader.Read(page);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+bool RingFileLoggerTest::TestConstructor() {
+    using namespace MARTe;
+    RingFileLogger test;
+    //Not initialised: nothing is written.
+    RingFileLoggerTestConsume(test, "Nothing");
+    return true;
+}
+
+bool RingFileLoggerTest::TestInitialise() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+    }
+    MemoryMappedFile file;
+    if (ok) {
+        ok = file.OpenReadOnly(ringFileLoggerTestName);
+    }
+    if (ok) {
+        ok = (file.GetSize() == 8192u);
+    }
+    if (ok) {
+        const RingFileLoggerHeader *header = static_cast<const RingFileLoggerHeader *>(file.GetMemory());
+        ok = ((header->magic == RING_FILE_LOGGER_MAGIC) && (header->version == RING_FILE_LOGGER_VERSION));
+        if (ok) {
+            ok = ((header->headerSize == RING_FILE_LOGGER_HEADER_SIZE) && (header->dataSize == (8192u - RING_FILE_LOGGER_HEADER_SIZE)));
+        }
+        if (ok) {
+            ok = ((header->headOffset == 0u) && (header->tailOffset == 0u) && (header->nextSequence == 0u));
+        }
+    }
+    (void) file.Close();
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestInitialise_DefaultSize() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        RingFileLogger test;
+        ConfigurationDatabase cdb;
+        cdb.Write("FileName", ringFileLoggerTestName);
+        ok = test.Initialise(cdb);
+    }
+    MemoryMappedFile file;
+    if (ok) {
+        ok = file.OpenReadOnly(ringFileLoggerTestName);
+    }
+    if (ok) {
+        ok = (file.GetSize() == RING_FILE_LOGGER_DEFAULT_SIZE);
+    }
+    (void) file.Close();
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestInitialise_False_FileName() {
+    using namespace MARTe;
+    RingFileLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Size", 8192u);
+    return !test.Initialise(cdb);
+}
+
+bool RingFileLoggerTest::TestInitialise_False_Size() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    RingFileLogger test;
+    return !RingFileLoggerTestSetup(test, RING_FILE_LOGGER_MIN_SIZE - 1u);
+}
+
+bool RingFileLoggerTest::TestInitialise_False_Twice() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            ok = !RingFileLoggerTestSetup(test, 8192u);
+        }
+    }
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestInitialise_Append() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            RingFileLoggerTestConsume(test, "First");
+            RingFileLoggerTestConsume(test, "Second");
+        }
+    }
+    if (ok) {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            RingFileLoggerTestConsume(test, "Third");
+        }
+    }
+    if (ok) {
+        const char8 * const messages[] = { "First", "Second", "Third" };
+        ok = RingFileLoggerTestCheck(&messages[0], 3u);
+    }
+    //With a different size the file is reset.
+    if (ok) {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 16384u);
+        if (ok) {
+            RingFileLoggerTestConsume(test, "Fourth");
+        }
+    }
+    if (ok) {
+        const char8 * const messages[] = { "Fourth" };
+        ok = RingFileLoggerTestCheck(&messages[0], 1u);
+    }
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestInitialise_Invalid() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            RingFileLoggerTestConsume(test, "First");
+        }
+    }
+    //Corrupt the header offsets.
+    if (ok) {
+        MemoryMappedFile file;
+        ok = file.Open(ringFileLoggerTestName, 8192u);
+        if (ok) {
+            RingFileLoggerHeader *header = static_cast<RingFileLoggerHeader *>(file.GetMemory());
+            header->tailOffset = (header->headOffset + 8u);
+            ok = file.Close();
+        }
+    }
+    if (ok) {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            RingFileLoggerTestConsume(test, "Second");
+        }
+    }
+    if (ok) {
+        const char8 * const messages[] = { "Second" };
+        ok = RingFileLoggerTestCheck(&messages[0], 1u);
+    }
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestConsumeLogMessage() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    int32 anObject = 0;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            LoggerPage page;
+            page.errorInfo.header.errorType = ErrorManagement::Warning;
+            page.errorInfo.header.lineNumber = 1234;
+            page.errorInfo.header.isObject = true;
+            page.errorInfo.hrtTime = 0x123456789Au;
+            page.errorInfo.timeSeconds = 1000000;
+            page.errorInfo.objectName = "AnObject";
+            page.errorInfo.className = "AClass";
+            page.errorInfo.fileName = "AFile.cpp";
+            page.errorInfo.functionName = "AFunction";
+            page.errorInfo.objectPointer = &anObject;
+            (void) StringHelper::CopyN(&page.errorStrBuffer[0], "A message", MAX_ERROR_MESSAGE_SIZE);
+            test.ConsumeLogMessage(&page);
+        }
+    }
+    RingFileLogReader reader;
+    LoggerPage page;
+    if (ok) {
+        ok = reader.Open(ringFileLoggerTestName);
+    }
+    if (ok) {
+        ok = reader.Read(page);
+    }
+    if (ok) {
+        ok = (page.errorInfo.header.errorType == ErrorManagement::Warning);
+    }
+    if (ok) {
+        ok = ((page.errorInfo.header.lineNumber == 1234) && (page.errorInfo.header.isObject));
+    }
+    if (ok) {
+        ok = ((page.errorInfo.hrtTime == 0x123456789Au) && (page.errorInfo.timeSeconds == 1000000));
+    }
+    if (ok) {
+        ok = (page.errorInfo.objectPointer == &anObject);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(page.errorInfo.objectName, "AnObject") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(page.errorInfo.className, "AClass") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(page.errorInfo.fileName, "AFile.cpp") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(page.errorInfo.functionName, "AFunction") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(&page.errorStrBuffer[0], "A message") == 0);
+    }
+    if (ok) {
+        ok = !reader.Read(page);
+    }
+    (void) reader.Close();
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestConsumeLogMessage_Wrap() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    const uint32 nOfMessages = 1000u;
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, RING_FILE_LOGGER_MIN_SIZE);
+        for (uint32 i = 0u; (i < nOfMessages) && (ok); i++) {
+            StreamString message;
+            (void) message.Printf("Message %u", i);
+            RingFileLoggerTestConsume(test, message.Buffer());
+        }
+    }
+    //Only the newest messages are kept, in order.
+    RingFileLogReader reader;
+    if (ok) {
+        ok = reader.Open(ringFileLoggerTestName);
+    }
+    if (ok) {
+        ok = (reader.GetNumberOfRecords() == nOfMessages);
+    }
+    LoggerPage page;
+    uint32 nOfRead = 0u;
+    uint64 firstSequence = 0u;
+    while ((ok) && (reader.Read(page))) {
+        if (nOfRead == 0u) {
+            firstSequence = reader.GetSequence();
+        }
+        StreamString expected;
+        (void) expected.Printf("Message %u", static_cast<uint32>(firstSequence + nOfRead));
+        ok = (reader.GetSequence() == (firstSequence + nOfRead));
+        if (ok) {
+            ok = (expected == &page.errorStrBuffer[0]);
+        }
+        nOfRead++;
+    }
+    if (ok) {
+        ok = ((firstSequence > 0u) && (nOfRead > 1u));
+    }
+    if (ok) {
+        ok = ((firstSequence + nOfRead) == nOfMessages);
+    }
+    (void) reader.Close();
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestConsumeLogMessage_Truncate() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    char8 longName[2u * RING_FILE_LOGGER_MAX_NAME_SIZE];
+    for (uint32 i = 0u; i < ((2u * RING_FILE_LOGGER_MAX_NAME_SIZE) - 1u); i++) {
+        longName[i] = 'a';
+    }
+    longName[(2u * RING_FILE_LOGGER_MAX_NAME_SIZE) - 1u] = '\0';
+    bool ok;
+    {
+        RingFileLogger test;
+        ok = RingFileLoggerTestSetup(test, 8192u);
+        if (ok) {
+            LoggerPage page;
+            page.errorInfo.header.errorType = ErrorManagement::Information;
+            page.errorInfo.header.lineNumber = 0;
+            page.errorInfo.header.isObject = false;
+            page.errorInfo.hrtTime = 0u;
+            page.errorInfo.timeSeconds = 0;
+            page.errorInfo.objectName = NULL_PTR(const char8 *);
+            page.errorInfo.className = NULL_PTR(const char8 *);
+            page.errorInfo.fileName = &longName[0];
+            page.errorInfo.functionName = NULL_PTR(const char8 *);
+            page.errorInfo.objectPointer = NULL_PTR(const void *);
+            (void) StringHelper::CopyN(&page.errorStrBuffer[0], "A message", MAX_ERROR_MESSAGE_SIZE);
+            test.ConsumeLogMessage(&page);
+        }
+    }
+    RingFileLogReader reader;
+    LoggerPage page;
+    if (ok) {
+        ok = reader.Open(ringFileLoggerTestName);
+    }
+    if (ok) {
+        ok = reader.Read(page);
+    }
+    if (ok) {
+        ok = (StringHelper::Length(page.errorInfo.fileName) == RING_FILE_LOGGER_MAX_NAME_SIZE);
+    }
+    if (ok) {
+        ok = (StringHelper::Length(page.errorInfo.functionName) == 0u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(&page.errorStrBuffer[0], "A message") == 0);
+    }
+    (void) reader.Close();
+    RingFileLoggerTestDelete();
+    return ok;
+}
+
+bool RingFileLoggerTest::TestConsumeLogMessage_LoggerService() {
+    using namespace MARTe;
+    RingFileLoggerTestDelete();
+    bool ok;
+    {
+        ReferenceT<RingFileLogger> test(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ReferenceT<LoggerService> logService(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = RingFileLoggerTestSetup(*(test.operator->()), 65536u);
+        if (ok) {
+            ok = logService->Insert(test);
+        }
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", "0x1");
+        if (ok) {
+            ok = logService->Initialise(cdb);
+        }
+        if (ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Debug, "RingFileLoggerTest::TestConsumeLogMessage_LoggerService()");
+        }
+        //Wait for the LoggerService to write the message.
+        bool found = false;
+        for (uint32 n = 0u; (n < 500u) && (ok) && (!found); n++) {
+            RingFileLogReader reader;
+            ok = reader.Open(ringFileLoggerTestName);
+            LoggerPage page;
+            while ((ok) && (!found) && (reader.Read(page))) {
+                found = (StringHelper::Compare(&page.errorStrBuffer[0], "RingFileLoggerTest::TestConsumeLogMessage_LoggerService()") == 0);
+                if (found) {
+                    found = (page.errorInfo.header.errorType == ErrorManagement::Debug);
+                }
+            }
+            if (!found) {
+                Sleep::MSec(10u);
+            }
+        }
+        if (ok) {
+            ok = found;
+        }
+    }
+    RingFileLoggerTestDelete();
+    return ok;
+}
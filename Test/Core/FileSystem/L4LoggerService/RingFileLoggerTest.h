@@ -0,0 +1,109 @@
+/**
+ * @file RingFileLoggerTest.h
+ * @brief Header file for class RingFileLoggerTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RingFileLoggerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef RINGFILELOGGERTEST_H_
+#define RINGFILELOGGERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the RingFileLogger public methods.
+ */
+class RingFileLoggerTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Initialise creates a valid ring log file with the requested size.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that Initialise uses RING_FILE_LOGGER_DEFAULT_SIZE if the Size is not set.
+     */
+    bool TestInitialise_DefaultSize();
+
+    /**
+     * @brief Tests that Initialise fails if the FileName is not set.
+     */
+    bool TestInitialise_False_FileName();
+
+    /**
+     * @brief Tests that Initialise fails if the Size is smaller than RING_FILE_LOGGER_MIN_SIZE.
+     */
+    bool TestInitialise_False_Size();
+
+    /**
+     * @brief Tests that Initialise fails if called twice.
+     */
+    bool TestInitialise_False_Twice();
+
+    /**
+     * @brief Tests that the records are appended to an existing valid ring log file.
+     */
+    bool TestInitialise_Append();
+
+    /**
+     * @brief Tests that an existing ring log file with an invalid header is reset.
+     */
+    bool TestInitialise_Invalid();
+
+    /**
+     * @brief Tests that ConsumeLogMessage writes all the log information.
+     */
+    bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests that ConsumeLogMessage overwrites the oldest records when the file is full.
+     */
+    bool TestConsumeLogMessage_Wrap();
+
+    /**
+     * @brief Tests that ConsumeLogMessage truncates long names.
+     */
+    bool TestConsumeLogMessage_Truncate();
+
+    /**
+     * @brief Tests the RingFileLogger as a consumer of a LoggerService.
+     */
+    bool TestConsumeLogMessage_LoggerService();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* RINGFILELOGGERTEST_H_ */
@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
 #include "LoggerService.h"
+#include "StringHelper.h"
 #include "Threads.h"
 #include "UDPLogger.h"
 #include "UDPLoggerTest.h"
@@ -37,6 +38,70 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * @brief Consumes a log message with \a message in \a udpLogger.
+ */
+static void UDPLoggerTestConsume(MARTe::UDPLogger &udpLogger,
+                                 const MARTe::char8 * const message) {
+    using namespace MARTe;
+    LoggerPage page;
+    page.errorInfo.header.errorType = ErrorManagement::Information;
+    page.errorInfo.header.lineNumber = 0;
+    page.errorInfo.header.isObject = false;
+    (void) StringHelper::CopyN(&page.errorStrBuffer[0], message, MAX_ERROR_MESSAGE_SIZE);
+    udpLogger.ConsumeLogMessage(&page);
+}
+
+/**
+ * @brief Reads one datagram from \a server and checks that it is equal to \a expected.
+ * If \a expected is NULL checks that no datagram is received.
+ */
+static bool UDPLoggerTestReceive(MARTe::BasicUDPSocket &server,
+                                 const MARTe::char8 * const expected) {
+    using namespace MARTe;
+    char8 buffer[64];
+    uint32 size = 63u;
+    bool ok = server.Read(&buffer[0], size, 100u);
+    if (expected == NULL_PTR(const char8 *)) {
+        ok = !ok;
+    }
+    else if (ok) {
+        buffer[size] = '\0';
+        ok = (StringHelper::Compare(&buffer[0], expected) == 0);
+    }
+    else {
+        //NOOP
+    }
+    return ok;
+}
+
+/**
+ * @brief Opens \a server in the port 44449 and initialises \a udpLogger to send (only the message) to it.
+ */
+static bool UDPLoggerTestSetup(MARTe::BasicUDPSocket &server,
+                               MARTe::UDPLogger &udpLogger,
+                               const MARTe::uint32 mtu,
+                               const MARTe::uint32 batchSize,
+                               const MARTe::uint32 flushPeriod) {
+    using namespace MARTe;
+    bool ok = server.Open();
+    if (ok) {
+        ok = server.Listen(44449u);
+    }
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "m");
+    cdb.Write("PrintKeys", 0);
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 44449);
+    cdb.Write("MTU", mtu);
+    cdb.Write("BatchSize", batchSize);
+    cdb.Write("FlushPeriod", flushPeriod);
+    if (ok) {
+        ok = udpLogger.Initialise(cdb);
+    }
+    return ok;
+}
+
 static bool udpLoggerTestServerOK = true;
 static bool udpLoggerTestServerDone = false;
 static bool udpLoggerTestServerSetup = false;
@@ -108,6 +173,40 @@ bool UDPLoggerTest::TestInitialise_False_Address_Port() {
     return !test.Initialise(cdb);
 }
 
+bool UDPLoggerTest::TestInitialise_False_MTU() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 44448);
+    cdb.Write("MTU", 0);
+    UDPLogger test;
+    return !test.Initialise(cdb);
+}
+
+bool UDPLoggerTest::TestInitialise_False_BatchSize() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 44448);
+    cdb.Write("BatchSize", 0);
+    UDPLogger test;
+    return !test.Initialise(cdb);
+}
+
+bool UDPLoggerTest::TestInitialise_False_BatchSize_MTU() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 44448);
+    cdb.Write("MTU", 65536);
+    cdb.Write("BatchSize", 65536);
+    UDPLogger test;
+    return !test.Initialise(cdb);
+}
+
 bool UDPLoggerTest::TestConsumeLogMessage() {
     using namespace MARTe;
     Threads::BeginThread((ThreadFunctionType) UDPLoggerTestServerThread, NULL);
@@ -131,3 +230,82 @@ bool UDPLoggerTest::TestConsumeLogMessage() {
     }
     return udpLoggerTestServerOK;
 }
+
+bool UDPLoggerTest::TestConsumeLogMessage_Batch() {
+    using namespace MARTe;
+    BasicUDPSocket server;
+    bool ok;
+    {
+        //Only one message fits in each datagram
+        UDPLogger test;
+        ok = UDPLoggerTestSetup(server, test, 10u, 2u, 100000u);
+        if (ok) {
+            UDPLoggerTestConsume(test, "abcdef");
+            UDPLoggerTestConsume(test, "ghijkl");
+            ok = UDPLoggerTestReceive(server, NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            //Both datagrams are full
+            UDPLoggerTestConsume(test, "mnopqr");
+            ok = UDPLoggerTestReceive(server, "|abcdef");
+        }
+        if (ok) {
+            ok = UDPLoggerTestReceive(server, "|ghijkl");
+        }
+        if (ok) {
+            ok = UDPLoggerTestReceive(server, NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            //Truncated to the MTU
+            UDPLoggerTestConsume(test, "0123456789ABCDEFGHIJ");
+        }
+    }
+    //The destructor sends the buffered messages.
+    if (ok) {
+        ok = UDPLoggerTestReceive(server, "|mnopqr");
+    }
+    if (ok) {
+        ok = UDPLoggerTestReceive(server, "|012345678");
+    }
+    (void) server.Close();
+    return ok;
+}
+
+bool UDPLoggerTest::TestConsumeLogMessage_FlushPeriod() {
+    using namespace MARTe;
+    BasicUDPSocket server;
+    UDPLogger test;
+    bool ok = UDPLoggerTestSetup(server, test, 16u, 4u, 0u);
+    if (ok) {
+        UDPLoggerTestConsume(test, "abcdef");
+        ok = UDPLoggerTestReceive(server, "|abcdef");
+    }
+    if (ok) {
+        UDPLoggerTestConsume(test, "ghijkl");
+        ok = UDPLoggerTestReceive(server, "|ghijkl");
+    }
+    (void) server.Close();
+    return ok;
+}
+
+bool UDPLoggerTest::TestFlush() {
+    using namespace MARTe;
+    BasicUDPSocket server;
+    UDPLogger test;
+    bool ok = UDPLoggerTestSetup(server, test, 1472u, 16u, 100000u);
+    if (ok) {
+        UDPLoggerTestConsume(test, "abcdef");
+        UDPLoggerTestConsume(test, "ghijkl");
+        ok = UDPLoggerTestReceive(server, NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        test.Flush();
+        ok = UDPLoggerTestReceive(server, "|abcdef\n|ghijkl");
+    }
+    if (ok) {
+        test.Flush();
+        ok = UDPLoggerTestReceive(server, NULL_PTR(const char8 *));
+    }
+    (void) server.Close();
+    return ok;
+}
@@ -65,10 +65,41 @@ public:
      */
     bool TestInitialise_False_Address_Port();
 
+    /**
+     * @brief Tests the initialise method with an MTU of zero.
+     */
+    bool TestInitialise_False_MTU();
+
+    /**
+     * @brief Tests the initialise method with a BatchSize of zero.
+     */
+    bool TestInitialise_False_BatchSize();
+
+    /**
+     * @brief Tests the initialise method with a BatchSize * MTU that does not fit in a uint32.
+     */
+    bool TestInitialise_False_BatchSize_MTU();
+
     /**
      * @brief Tests the ConsumeLogMessage method .
      */
     bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests that the ConsumeLogMessage method packs the log messages in datagrams of at most MTU bytes
+     * and only sends them when BatchSize datagrams are full.
+     */
+    bool TestConsumeLogMessage_Batch();
+
+    /**
+     * @brief Tests that the ConsumeLogMessage method sends each log message immediately with a FlushPeriod of zero.
+     */
+    bool TestConsumeLogMessage_FlushPeriod();
+
+    /**
+     * @brief Tests that the Flush method sends all the buffered log messages.
+     */
+    bool TestFlush();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -61,6 +61,31 @@ public:
 };
 CLASS_REGISTER(LoggerConsumerITest, "1.0")
 
+/**
+ * A dummy logger that counts the messages received
+ */
+class LoggerConsumerICounterTest: public MARTe::Object, public MARTe::LoggerConsumerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    LoggerConsumerICounterTest() : Object() {
+        counter = 0u;
+    }
+
+    virtual ~LoggerConsumerICounterTest() {
+
+    }
+
+    virtual void ConsumeLogMessage(MARTe::LoggerPage *logPage) {
+        MARTe::StreamString err = logPage->errorStrBuffer;
+        if (err == "LoggerConsumerICounterTest test") {
+            counter++;
+        }
+    }
+
+    volatile MARTe::uint32 counter;
+};
+CLASS_REGISTER(LoggerConsumerICounterTest, "1.0")
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -204,3 +229,190 @@ bool LoggerServiceTest::TestExecute() {
     return ok;
 }
 
+bool LoggerServiceTest::TestInitialise_False_DeferredFormatting() {
+    using namespace MARTe;
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    cdb.Write("DeferredFormatting", 2);
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    test.Insert(consumer);
+    return !test.Initialise(cdb);
+}
+
+bool LoggerServiceTest::TestExecute_DeferredFormatting() {
+    using namespace MARTe;
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        cdb.Write("DeferredFormatting", 1);
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        Logger *logger = Logger::Instance();
+        ok &= logger->IsDeferredFormatting();
+        if (ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerConsumerITest %s", "test");
+        }
+        if (ok) {
+            uint32 maxWait = 2000;
+            uint32 i;
+            ok = consumer->ok;
+            for (i = 0; (i < maxWait) && (!ok); i++) {
+                ok = consumer->ok;
+                Sleep::Sec(1e-3);
+            }
+        }
+    }
+    //The LoggerService disables the deferred formatting when it is destroyed
+    ok &= !Logger::Instance()->IsDeferredFormatting();
+    return ok;
+}
+
+bool LoggerServiceTest::TestIsDeferredFormatting() {
+    using namespace MARTe;
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= !test.IsDeferredFormatting();
+    }
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        cdb.Write("DeferredFormatting", 1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok &= test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= test.IsDeferredFormatting();
+    }
+    return ok;
+}
+
+bool LoggerServiceTest::TestLogEntryAdded() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= (logger->GetNotifier() == &test);
+        if (ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerConsumerITest test");
+        }
+        if (ok) {
+            //The message must be consumed well before the LOGGER_SERVICE_WAIT_TIMEOUT
+            uint32 maxWait = LOGGER_SERVICE_WAIT_TIMEOUT / 2u;
+            uint32 i;
+            ok = consumer->ok;
+            for (i = 0; (i < maxWait) && (!ok); i++) {
+                Sleep::Sec(1e-3);
+                ok = consumer->ok;
+            }
+        }
+    }
+    ok &= (logger->GetNotifier() == NULL_PTR(LoggerNotifierI *));
+    return ok;
+}
+
+bool LoggerServiceTest::TestExecute_Burst() {
+    using namespace MARTe;
+    ReferenceT<LoggerConsumerICounterTest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    bool ok = test.Insert(consumer);
+    ok &= test.Initialise(cdb);
+    const uint32 numberOfMessages = DEFAULT_NUMBER_OF_LOG_PAGES / 2u;
+    uint32 i;
+    for (i = 0u; (i < numberOfMessages) && (ok); i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerConsumerICounterTest test");
+    }
+    if (ok) {
+        uint32 maxWait = LOGGER_SERVICE_WAIT_TIMEOUT / 2u;
+        ok = (consumer->counter == numberOfMessages);
+        for (i = 0; (i < maxWait) && (!ok); i++) {
+            Sleep::Sec(1e-3);
+            ok = (consumer->counter == numberOfMessages);
+        }
+    }
+    return ok;
+}
+
+bool LoggerServiceTest::TestExecute_Sporadic() {
+    using namespace MARTe;
+    ReferenceT<LoggerConsumerICounterTest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    bool ok = test.Insert(consumer);
+    ok &= test.Initialise(cdb);
+    const uint32 numberOfMessages = 20u;
+    //Each message is reported after the thread went back to wait, so that every message has to wake the thread.
+    for (uint32 n = 1u; (n <= numberOfMessages) && (ok); n++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerConsumerICounterTest test");
+        uint32 maxWait = LOGGER_SERVICE_WAIT_TIMEOUT / 2u;
+        ok = (consumer->counter == n);
+        for (uint32 i = 0; (i < maxWait) && (!ok); i++) {
+            Sleep::Sec(1e-3);
+            ok = (consumer->counter == n);
+        }
+        Sleep::Sec(5e-3);
+    }
+    return ok;
+}
+
+bool LoggerServiceTest::TestInitialise_False_RateLimitPeriod() {
+    using namespace MARTe;
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    cdb.Write("RateLimit", 10);
+    cdb.Write("RateLimitPeriod", 0);
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    test.Insert(consumer);
+    return !test.Initialise(cdb);
+}
+
+bool LoggerServiceTest::TestGetRateLimit() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    bool ok;
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= (test.GetRateLimit() == 0u);
+        ok &= (logger->GetRateLimit() == 0u);
+    }
+    {
+        LoggerService test;
+        ConfigurationDatabase cdb;
+        cdb.Write("CPUs", 0x1);
+        cdb.Write("RateLimit", 10);
+        cdb.Write("RateLimitPeriod", 500);
+        ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok &= test.Insert(consumer);
+        ok &= test.Initialise(cdb);
+        ok &= (test.GetRateLimit() == 10u);
+        ok &= (logger->GetRateLimit() == 10u);
+        ok &= (logger->GetRateLimitPeriod() == 500u);
+    }
+    //The LoggerService disables the rate limiting when it is destroyed
+    ok &= (logger->GetRateLimit() == 0u);
+    return ok;
+}
@@ -100,6 +100,46 @@ public:
      * @brief Tests the GetStackSize method.
      */
     bool TestGetStackSize();
+
+    /**
+     * @brief Tests the Initialise method with an invalid DeferredFormatting.
+     */
+    bool TestInitialise_False_DeferredFormatting();
+
+    /**
+     * @brief Tests the Execute method with DeferredFormatting = 1.
+     */
+    bool TestExecute_DeferredFormatting();
+
+    /**
+     * @brief Tests the IsDeferredFormatting method.
+     */
+    bool TestIsDeferredFormatting();
+
+    /**
+     * @brief Tests that the LoggerService is registered as the Logger notifier and that it is removed on destruction.
+     */
+    bool TestLogEntryAdded();
+
+    /**
+     * @brief Tests that all the pending log messages are consumed after a single wake-up.
+     */
+    bool TestExecute_Burst();
+
+    /**
+     * @brief Tests that sporadic log messages, each one added while the thread is waiting, are consumed without waiting for the timeout.
+     */
+    bool TestExecute_Sporadic();
+
+    /**
+     * @brief Tests the Initialise method with a RateLimitPeriod of zero.
+     */
+    bool TestInitialise_False_RateLimitPeriod();
+
+    /**
+     * @brief Tests the GetRateLimit method and that the rate limiting is disabled when the LoggerService is destroyed.
+     */
+    bool TestGetRateLimit();
 };
 
 /*---------------------------------------------------------------------------*/
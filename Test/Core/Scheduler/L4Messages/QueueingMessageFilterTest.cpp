@@ -50,6 +50,19 @@ static void QueueingMessageFilterTestWaitCallCallback(QueueingMessageFilterTest
     test.waitState = 2;
 }
 
+static void QueueingMessageFilterTestProducerCallback(QueueingMessageFilterTest &test) {
+    using namespace MARTe;
+    int32 producerIdx;
+    do {
+        producerIdx = test.producersStarted;
+    }
+    while (!Atomic::CompareAndSwap(&test.producersStarted, producerIdx, producerIdx + 1));
+    for (uint32 i = 0u; i < QueueingMessageFilterTest::messagesPerProducer; i++) {
+        (void) test.producersFilter.ConsumeMessage(test.producerMessages[producerIdx][i]);
+    }
+    Atomic::Increment(&test.producersDone);
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -120,3 +133,133 @@ bool QueueingMessageFilterTest::TestGetMessage_Wait_Timeout() {
     ErrorManagement::ErrorType err = filter.GetMessage(msg, 1);
     return err.timeout;
 }
+
+bool QueueingMessageFilterTest::TestGetMessage_Wait_Timeout_Total() {
+    using namespace MARTe;
+    ReferenceT<Message> msg(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    waitErr = ErrorManagement::NoError;
+    waitState = 0;
+    //The thread waits forever for a message, so that the second GetMessage also has to wait for it.
+    Threads::BeginThread((ThreadFunctionType) QueueingMessageFilterTestWaitCallCallback, this);
+    while (waitState == 0) {
+        Sleep::MSec(1);
+    }
+    MARTe::Sleep::MSec(10);
+    ReferenceT<Message> otherMsg;
+    uint64 startCounter = HighResolutionTimer::Counter();
+    ErrorManagement::ErrorType err = waitFilter.GetMessage(otherMsg, 100u);
+    float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - startCounter) * HighResolutionTimer::Period();
+    bool ok = err.timeout;
+    if (ok) {
+        ok = (elapsed < 1.0);
+    }
+    waitFilter.ConsumeMessage(msg);
+    while (waitState == 1) {
+        Sleep::MSec(1);
+    }
+    if (ok) {
+        ok = waitErr.ErrorsCleared();
+    }
+    if (ok) {
+        ok = (msg == waitMessage);
+    }
+    return ok;
+}
+
+bool QueueingMessageFilterTest::TestConsumeMessage_InvalidMessage() {
+    using namespace MARTe;
+    QueueingMessageFilter filter;
+    ReferenceT<Message> msg;
+    ErrorManagement::ErrorType err = filter.ConsumeMessage(msg);
+    bool ok = err.fatalError;
+    if (ok) {
+        err = filter.GetMessage(msg, 1);
+        ok = err.timeout;
+    }
+    return ok;
+}
+
+bool QueueingMessageFilterTest::TestGetMessage_Order() {
+    using namespace MARTe;
+    QueueingMessageFilter filter;
+    //More than one chunk of nodes, so that the pool has to grow.
+    const uint32 numberOfMessages = 3u * QueueingMessageFilterNodesPerChunk;
+    ReferenceT<Message> msgs[numberOfMessages];
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfMessages) && (ok); i++) {
+        msgs[i] = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = filter.ConsumeMessage(msgs[i]).ErrorsCleared();
+    }
+    for (i = 0u; (i < numberOfMessages) && (ok); i++) {
+        ReferenceT<Message> msg;
+        ok = filter.GetMessage(msg, 1).ErrorsCleared();
+        if (ok) {
+            ok = (msg == msgs[i]);
+        }
+    }
+    if (ok) {
+        ReferenceT<Message> msg;
+        ok = filter.GetMessage(msg, 1).timeout;
+    }
+    //The nodes are reused
+    for (uint32 n = 0u; (n < 2u) && (ok); n++) {
+        for (i = 0u; (i < numberOfMessages) && (ok); i++) {
+            ok = filter.ConsumeMessage(msgs[i]).ErrorsCleared();
+            ReferenceT<Message> msg;
+            if (ok) {
+                ok = filter.GetMessage(msg, 1).ErrorsCleared();
+            }
+            if (ok) {
+                ok = (msg == msgs[i]);
+            }
+        }
+    }
+    return ok;
+}
+
+bool QueueingMessageFilterTest::TestConsumeMessage_MultipleProducers() {
+    using namespace MARTe;
+    uint32 p;
+    uint32 i;
+    for (p = 0u; p < numberOfProducers; p++) {
+        for (i = 0u; i < messagesPerProducer; i++) {
+            producerMessages[p][i] = ReferenceT<Message>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        }
+    }
+    producersStarted = 0;
+    producersDone = 0;
+    for (p = 0u; p < numberOfProducers; p++) {
+        Threads::BeginThread((ThreadFunctionType) QueueingMessageFilterTestProducerCallback, this);
+    }
+    uint32 nextExpected[numberOfProducers];
+    for (p = 0u; p < numberOfProducers; p++) {
+        nextExpected[p] = 0u;
+    }
+    bool ok = true;
+    for (i = 0u; (i < (numberOfProducers * messagesPerProducer)) && (ok); i++) {
+        ReferenceT<Message> msg;
+        ok = producersFilter.GetMessage(msg, 5000u).ErrorsCleared();
+        if (ok) {
+            //The message must be the next one of one of the producers
+            bool found = false;
+            for (p = 0u; (p < numberOfProducers) && (!found); p++) {
+                if (nextExpected[p] < messagesPerProducer) {
+                    found = (msg == producerMessages[p][nextExpected[p]]);
+                    if (found) {
+                        nextExpected[p]++;
+                    }
+                }
+            }
+            ok = found;
+        }
+    }
+    if (ok) {
+        ReferenceT<Message> msg;
+        ok = producersFilter.GetMessage(msg, 1).timeout;
+    }
+    while (producersDone != static_cast<int32>(numberOfProducers)) {
+        Sleep::MSec(1);
+    }
+    return ok;
+}
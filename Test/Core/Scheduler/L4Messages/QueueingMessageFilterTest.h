@@ -73,6 +73,34 @@ public:
      */
     bool TestGetMessage_Wait_Timeout();
 
+    /**
+     * @brief Tests that the GetMessage timeout is the total time of the call, also when it has to wait for a concurrent call.
+     */
+    bool TestGetMessage_Wait_Timeout_Total();
+
+    /**
+     * @brief Tests that ConsumeMessage fails with an invalid message.
+     */
+    bool TestConsumeMessage_InvalidMessage();
+
+    /**
+     * @brief Tests that the messages are retrieved in order, also when the node pool has to grow.
+     */
+    bool TestGetMessage_Order();
+
+    /**
+     * @brief Tests that messages sent concurrently by several threads are all retrieved, in order for each thread.
+     */
+    bool TestConsumeMessage_MultipleProducers();
+
+    //Synchronise the multiple producers test
+    static const MARTe::uint32 numberOfProducers = 4u;
+    static const MARTe::uint32 messagesPerProducer = 500u;
+    MARTe::ReferenceT<MARTe::Message> producerMessages[numberOfProducers][messagesPerProducer];
+    volatile MARTe::int32 producersStarted;
+    volatile MARTe::int32 producersDone;
+    MARTe::QueueingMessageFilter producersFilter;
+
     //Synchronise the test
     MARTe::uint32 waitState;
     MARTe::QueueingMessageFilter waitFilter;
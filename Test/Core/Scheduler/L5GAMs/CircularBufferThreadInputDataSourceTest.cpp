@@ -459,6 +459,35 @@ bool CircularBufferThreadInputDataSourceTest::TestInitialise() {
     if (ret) {
         ret = (dataSource.GetStackSize() == THREADS_DEFAULT_STACKSIZE);
     }
+    //SleepInMutexSec is specified
+    if (ret) {
+        ret = !dataSource.GetMutex()->IsAdaptive();
+    }
+    dataSource.Stop();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool CircularBufferThreadInputDataSourceTest::TestInitialise_AdaptiveMutex() {
+    CircularBufferThreadInputDataSourceTestDS dataSource;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        ret = cdb.MoveAbsolute("$Application1.+Data.+Drv1");
+    }
+    if (ret) {
+        ret = cdb.Delete("SleepInMutexSec");
+    }
+    if (ret) {
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        ret = dataSource.GetMutex()->IsAdaptive();
+    }
     dataSource.Stop();
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
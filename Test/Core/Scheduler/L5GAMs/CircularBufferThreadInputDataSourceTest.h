@@ -61,6 +61,11 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests that the CircularBufferThreadInputDataSource::Initialise creates an adaptive mutex if SleepInMutexSec is not specified
+     */
+    bool TestInitialise_AdaptiveMutex();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::Initialise specifying a CpuMask
      */
@@ -128,6 +128,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         expectedSignal = NULL;
         counter = 0;
         memoryOK = true;
+        holdSynchronise = false;
     }
 
     virtual ~MemoryMapAsyncOutputBrokerDataSourceTestHelper() {
@@ -237,6 +238,9 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     //Check that the memory is indeed set as expected
     virtual bool Synchronise() {
         using namespace MARTe;
+        while (holdSynchronise) {
+            Sleep::MSec(1);
+        }
         if (counter < numberOfExecutes) {
             uint32 *signalMemory32 = reinterpret_cast<uint32 *>(signalMemory);
             if (memoryOK) {
@@ -263,6 +267,8 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     MARTe::uint32 counter;
     bool memoryOK;
     void *signalMemory;
+    //Allows to keep the BufferLoop from releasing the buffers.
+    volatile bool holdSynchronise;
 };
 CLASS_REGISTER(MemoryMapAsyncOutputBrokerDataSourceTestHelper, "1.0")
 
@@ -418,10 +424,8 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
         Sleep::MSec(sleepMSec);
     }
 
-    //2 seconds to finish
+    //2 seconds to finish. The BufferLoop is woken on every published buffer, so no extra cycle is needed to flush the last one.
     uint64 maxTimeInCounts = HighResolutionTimer::Counter() + 2 * HighResolutionTimer::Frequency();
-    //Force flushing of BufferLoop
-    scheduler->ExecuteThreadCycle(0);
     while (dataSource->counter != dataSource->numberOfExecutes) {
         Sleep::Sec(0.1);
         if (HighResolutionTimer::Counter() > maxTimeInCounts) {
@@ -859,6 +863,14 @@ bool MemoryMapAsyncOutputBrokerTest::TestExecute_1_Buffer() {
     return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 1, 100);
 }
 
+bool MemoryMapAsyncOutputBrokerTest::TestExecute_N_Buffers_NoWait() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3,
+            4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+
+    return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 100, 0);
+}
+
 bool MemoryMapAsyncOutputBrokerTest::TestGetCPUMask() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -1086,12 +1098,15 @@ bool MemoryMapAsyncOutputBrokerTest::TestExecute_Buffer_Overrun() {
     char8 *fakeMem = new char8[1024];
     dataSource->GetOutputBrokers(brokers, "GAM1", fakeMem);
     ReferenceT<MemoryMapAsyncOutputBroker> broker = brokers.Get(0);
+    //Do not let the BufferLoop release the only buffer before the next Execute.
+    dataSource->holdSynchronise = true;
     if (ok) {
         ok = broker->Execute();
     }
     if (ok) {
         ok = !broker->Execute();
     }
+    dataSource->holdSynchronise = false;
     delete fakeMem;
 
     godb->Purge();
@@ -80,6 +80,12 @@ public:
      */
     bool TestExecute_1_Buffer();
 
+    /**
+     * @brief Tests the Execute method with N buffers and without waiting between cycles, so that the buffers are
+     * also handed over while the consumer thread is not sleeping.
+     */
+    bool TestExecute_N_Buffers_NoWait();
+
     /**
      * @brief Tests that a buffer overrun is detected.
      */
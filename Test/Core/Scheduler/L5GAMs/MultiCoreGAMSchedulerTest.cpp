@@ -0,0 +1,550 @@
+/**
+ * @file MultiCoreGAMSchedulerTest.cpp
+ * @brief Source file for class MultiCoreGAMSchedulerTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MultiCoreGAMSchedulerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationDatabase.h"
+#include "MultiCoreGAMSchedulerTest.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief GAM which writes the number of times it was executed in all its outputs and which counts how many times
+ * any of its DDB1 inputs was not produced in the same cycle (i.e. was not equal to its own number of executions)
+ * or any of its timing inputs was not measured from the start of a cycle (i.e. the GAM was executed outside of a cycle).
+ */
+class MultiCoreGAMSchedulerTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MultiCoreGAMSchedulerTestGAM() :
+            GAM() {
+        numberOfExecutions = 0u;
+        numberOfErrors = 0u;
+        checkInput = NULL_PTR(bool *);
+        checkTiming = NULL_PTR(bool *);
+    }
+
+    virtual ~MultiCoreGAMSchedulerTestGAM() {
+        if (checkInput != NULL_PTR(bool *)) {
+            delete[] checkInput;
+        }
+        if (checkTiming != NULL_PTR(bool *)) {
+            delete[] checkTiming;
+        }
+    }
+
+    virtual bool Setup() {
+        uint32 numberOfInputs = GetNumberOfInputSignals();
+        bool ok = true;
+        if (numberOfInputs > 0u) {
+            checkInput = new bool[numberOfInputs];
+            checkTiming = new bool[numberOfInputs];
+        }
+        for (uint32 i = 0u; (i < numberOfInputs) && (ok); i++) {
+            StreamString dataSourceName;
+            ok = GetSignalDataSourceName(InputSignals, i, dataSourceName);
+            if (ok) {
+                checkInput[i] = (dataSourceName == "DDB1");
+                checkTiming[i] = (dataSourceName == "Timings");
+            }
+        }
+        return ok;
+    }
+
+    virtual bool Execute() {
+        numberOfExecutions++;
+        uint32 i;
+        for (i = 0u; i < GetNumberOfInputSignals(); i++) {
+            if (checkInput[i]) {
+                uint32 *input = static_cast<uint32 *>(GetInputSignalMemory(i));
+                if (*input != numberOfExecutions) {
+                    numberOfErrors++;
+                }
+            }
+            //Outside of a cycle the time would be measured from an unrelated start (e.g. 0).
+            if (checkTiming[i]) {
+                uint32 *input = static_cast<uint32 *>(GetInputSignalMemory(i));
+                if (*input > 1000000u) {
+                    numberOfErrors++;
+                }
+            }
+        }
+        //Give some time for the other GAMs to be executed in parallel
+        uint64 startTicks = HighResolutionTimer::Counter();
+        while ((HighResolutionTimer::Counter() - startTicks) < (HighResolutionTimer::Frequency() / 100000u)) {
+        }
+        for (i = 0u; i < GetNumberOfOutputSignals(); i++) {
+            uint32 *output = static_cast<uint32 *>(GetOutputSignalMemory(i));
+            *output = numberOfExecutions;
+        }
+        return true;
+    }
+
+    uint32 numberOfExecutions;
+    uint32 numberOfErrors;
+
+private:
+    bool *checkInput;
+    bool *checkTiming;
+};
+
+CLASS_REGISTER(MultiCoreGAMSchedulerTestGAM, "1.0")
+
+/**
+ * Application where, in Thread1, GAMB depends on GAMA, GAMD on GAMB and GAMC and GAME, which reads a timing signal, on all.
+ * The CPUs of Thread1 are written after configHead, the ones of Thread2 after configThread2, the functions of Thread2 (GAMF and
+ * optionally GAMG, which depends on GAMF) before configScheduler and the scheduler between configScheduler and configTail.
+ */
+static const char8 * const configHead = ""
+        "$Fibonacci = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            InputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Signal3 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            OutputSignals = {"
+        "                Signal2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMD = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            InputSignals = {"
+        "                Signal3 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Signal2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Signal4 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAME = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            InputSignals = {"
+        "                Signal4 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                GAMA_ReadTime = {"
+        "                    DataSource = Timings"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMF = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            OutputSignals = {"
+        "                Signal5 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMG = {"
+        "            Class = MultiCoreGAMSchedulerTestGAM"
+        "            InputSignals = {"
+        "                Signal5 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                GAMF_ReadTime = {"
+        "                    DataSource = Timings"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread";
+
+static const char8 * const configThread2 = ""
+        "                    Functions = {GAMA, GAMB, GAMC, GAMD, GAME}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread";
+
+static const char8 * const configScheduler = ""
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MultiCoreGAMScheduler"
+        "        TimingDataSource = Timings";
+
+static const char8 * const configTail = ""
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+MultiCoreGAMSchedulerTest::MultiCoreGAMSchedulerTest() {
+}
+
+MultiCoreGAMSchedulerTest::~MultiCoreGAMSchedulerTest() {
+    ObjectRegistryDatabase::Instance()->Purge();
+}
+
+bool MultiCoreGAMSchedulerTest::Init(const uint32 numberOfWorkers,
+                                     const uint32 threadCPUs,
+                                     const uint32 * const workerCPUs,
+                                     const bool parallelThread2) {
+    StreamString config = configHead;
+    config.Printf(" CPUs = %d", threadCPUs);
+    config += configThread2;
+    config.Printf(" CPUs = %d", threadCPUs);
+    if (parallelThread2) {
+        config += " Functions = {GAMF, GAMG}";
+    }
+    else {
+        config += " Functions = {GAMF}";
+    }
+    config += configScheduler;
+    config.Printf(" NumberOfWorkers = %d", numberOfWorkers);
+    if (numberOfWorkers > 0u) {
+        config += " WorkerCPUs = {";
+        for (uint32 n = 0u; n < numberOfWorkers; n++) {
+            config.Printf(" %d", workerCPUs[n]);
+        }
+        config += " }";
+    }
+    config += configTail;
+    config.Seek(0u);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    if (!parser.Parse()) {
+        return false;
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (!ObjectRegistryDatabase::Instance()->Initialise(cdb)) {
+        return false;
+    }
+    return true;
+}
+
+bool MultiCoreGAMSchedulerTest::TestConstructor() {
+    MultiCoreGAMScheduler test;
+    return (test.GetNumberOfWorkers() == 0u);
+}
+
+bool MultiCoreGAMSchedulerTest::TestInitialise() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.Write("NumberOfWorkers", 2);
+    uint32 cpus[] = { 1u, 2u };
+    config.Write("WorkerCPUs", cpus);
+    MultiCoreGAMScheduler scheduler;
+    bool ok = scheduler.Initialise(config);
+    if (ok) {
+        ok = (scheduler.GetNumberOfWorkers() == 2u);
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::TestInitialise_False_WorkerCPUs() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.Write("NumberOfWorkers", 2);
+    uint32 cpus[] = { 1u, 2u, 4u };
+    config.Write("WorkerCPUs", cpus);
+    MultiCoreGAMScheduler scheduler;
+    return !scheduler.Initialise(config);
+}
+
+bool MultiCoreGAMSchedulerTest::TestInitialise_False_NoWorkerCPUs() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.Write("NumberOfWorkers", 2);
+    MultiCoreGAMScheduler scheduler;
+    return !scheduler.Initialise(config);
+}
+
+bool MultiCoreGAMSchedulerTest::TestInitialise_False_SharedWorkerCPUs() {
+    ConfigurationDatabase config;
+    config.Write("TimingDataSource", "Timings");
+    config.Write("NumberOfWorkers", 2);
+    uint32 cpus[] = { 6u, 2u };
+    config.Write("WorkerCPUs", cpus);
+    MultiCoreGAMScheduler scheduler;
+    return !scheduler.Initialise(config);
+}
+
+bool MultiCoreGAMSchedulerTest::TestConfigureScheduler() {
+    const uint32 workerCPUs[] = { 2u, 4u };
+    bool ok = Init(2u, 1u, &workerCPUs[0]);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<MultiCoreGAMScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = (scheduler->GetNumberOfTasks("State1", "Thread1") == 5u);
+    }
+    if (ok) {
+        ok = (scheduler->GetNumberOfTasks("State1", "Thread2") == 1u);
+    }
+    //GAMA, GAMB, GAMC, GAMD, GAME
+    const bool expected[5][5] = { { false, true, false, false, true }, { false, false, false, true, true }, { false, false, false, true, true }, { false,
+            false, false, false, true }, { false, false, false, false, false } };
+    for (uint32 p = 0u; (p < 5u) && (ok); p++) {
+        for (uint32 s = 0u; (s < 5u) && (ok); s++) {
+            ok = (scheduler->IsTaskDependent("State1", "Thread1", p, s) == expected[p][s]);
+        }
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::TestConfigureScheduler_ParallelThreads() {
+    const uint32 workerCPUs[] = { 2u, 4u };
+    bool ok = Init(2u, 1u, &workerCPUs[0], true);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<MultiCoreGAMScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = (scheduler->GetNumberOfTasks("State1", "Thread1") == 5u);
+    }
+    if (ok) {
+        ok = (scheduler->GetNumberOfTasks("State1", "Thread2") == 2u);
+    }
+    if (ok) {
+        ok = scheduler->IsTaskDependent("State1", "Thread2", 0u, 1u);
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::TestConfigureScheduler_False_WorkerCPUs() {
+    const uint32 workerCPUs[] = { 2u, 4u };
+    bool ok = Init(2u, 3u, &workerCPUs[0]);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = !app->ConfigureApplication();
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::TestConfigureScheduler_False_UndefinedCPUs() {
+    const uint32 workerCPUs[] = { 2u, 4u };
+    bool ok = Init(2u, 0u, &workerCPUs[0]);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = !app->ConfigureApplication();
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::RunAndCheck(const uint32 numberOfWorkers,
+                                            const bool parallelThread2) {
+    //Thread1 and Thread2 run on the first available CPU and each worker on one of the next ones.
+    const uint32 maxNumberOfWorkers = 31u;
+    uint32 workerCPUs[maxNumberOfWorkers];
+    uint32 threadCPUs = 0u;
+    uint32 numberOfCPUWorkers = 0u;
+    uint32 availableCPUs = Threads::GetCPUs(Threads::Id());
+    for (uint32 b = 0u; (b < 32u) && (numberOfCPUWorkers < numberOfWorkers) && (numberOfCPUWorkers < maxNumberOfWorkers); b++) {
+        uint32 cpu = (1u << b);
+        if ((availableCPUs & cpu) != 0u) {
+            if (threadCPUs == 0u) {
+                threadCPUs = cpu;
+            }
+            else {
+                workerCPUs[numberOfCPUWorkers] = cpu;
+                numberOfCPUWorkers++;
+            }
+        }
+    }
+    //On a single CPU machine the workers cannot be allocated and Thread1 is executed sequentially.
+    bool ok = Init(numberOfCPUWorkers, threadCPUs, &workerCPUs[0], parallelThread2);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    const uint32 numberOfGAMs = 7u;
+    ReferenceT<MultiCoreGAMSchedulerTestGAM> gams[numberOfGAMs];
+    if (ok) {
+        gams[0] = app->Find("Functions.GAMA");
+        gams[1] = app->Find("Functions.GAMB");
+        gams[2] = app->Find("Functions.GAMC");
+        gams[3] = app->Find("Functions.GAMD");
+        gams[4] = app->Find("Functions.GAME");
+        gams[5] = app->Find("Functions.GAMF");
+        gams[6] = app->Find("Functions.GAMG");
+        for (uint32 i = 0u; (i < numberOfGAMs) && (ok); i++) {
+            ok = gams[i].IsValid();
+        }
+    }
+    //No GAM shall be executed before the first cycle
+    for (uint32 i = 0u; (i < numberOfGAMs) && (ok); i++) {
+        ok = (gams[i]->numberOfExecutions == 0u);
+    }
+    if (ok) {
+        ErrorManagement::ErrorType err = app->StartNextStateExecution();
+        ok = err.ErrorsCleared();
+    }
+    if (ok) {
+        const uint32 minimumNumberOfExecutions = 1000u;
+        uint32 counter = 0u;
+        bool done = false;
+        while ((!done) && (counter < 500u)) {
+            done = true;
+            //GAMF and GAMG are executed by Thread2, which is not expected to run at the same rate on machines with few cores.
+            for (uint32 i = 0u; (i < 5u) && (done); i++) {
+                done = (gams[i]->numberOfExecutions > minimumNumberOfExecutions);
+            }
+            if (!done) {
+                Sleep::MSec(10);
+            }
+            counter++;
+        }
+        ErrorManagement::ErrorType err = app->StopCurrentStateExecution();
+        ok = (done && err.ErrorsCleared());
+    }
+    for (uint32 i = 0u; (i < numberOfGAMs) && (ok); i++) {
+        ok = (gams[i]->numberOfErrors == 0u);
+    }
+    //All the GAMs of a thread shall have been executed the same number of times (join point at the end of every cycle)
+    for (uint32 i = 1u; (i < 5u) && (ok); i++) {
+        ok = (gams[i]->numberOfExecutions == gams[0]->numberOfExecutions);
+    }
+    if ((ok) && (parallelThread2)) {
+        ok = (gams[6]->numberOfExecutions == gams[5]->numberOfExecutions);
+    }
+    while (Threads::NumberOfThreads() > 0) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+bool MultiCoreGAMSchedulerTest::TestStartNextStateExecution() {
+    return RunAndCheck(2u);
+}
+
+bool MultiCoreGAMSchedulerTest::TestStartNextStateExecution_NoWorkers() {
+    return RunAndCheck(0u);
+}
+
+bool MultiCoreGAMSchedulerTest::TestStartNextStateExecution_OncePerCycle() {
+    //The workers race with the real-time threads at the start of every state: repeat it with freshly built graphs.
+    bool ok = true;
+    for (uint32 n = 0u; (n < 5u) && (ok); n++) {
+        ok = RunAndCheck(2u, true);
+    }
+    return ok;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file MultiCoreGAMSchedulerTest.h
+ * @brief Header file for class MultiCoreGAMSchedulerTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MultiCoreGAMSchedulerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MULTICOREGAMSCHEDULERTEST_H_
+#define MULTICOREGAMSCHEDULERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MultiCoreGAMScheduler.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests all the MultiCoreGAMScheduler functions
+ */
+class MultiCoreGAMSchedulerTest {
+
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MultiCoreGAMSchedulerTest();
+
+    /**
+     * @brief Destroys the ObjectRegistryDatabase
+     */
+    ~MultiCoreGAMSchedulerTest();
+
+    /**
+     * @brief Initialises the ObjectRegistryDatabase with an application where the scheduler has \a numberOfWorkers workers,
+     * running on \a workerCPUs, and where both Thread1 and Thread2 run on \a threadCPUs. If \a parallelThread2 is true
+     * Thread2 has two GAMs, i.e. it is also executed by the workers.
+     */
+    bool Init(const uint32 numberOfWorkers, const uint32 threadCPUs, const uint32 * const workerCPUs, const bool parallelThread2 = false);
+
+    /**
+     * @brief Tests the scheduler constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails if the number of WorkerCPUs is not NumberOfWorkers
+     */
+    bool TestInitialise_False_WorkerCPUs();
+
+    /**
+     * @brief Tests that the Initialise method fails if NumberOfWorkers > 0 and the WorkerCPUs are not defined
+     */
+    bool TestInitialise_False_NoWorkerCPUs();
+
+    /**
+     * @brief Tests that the Initialise method fails if two workers share a CPU
+     */
+    bool TestInitialise_False_SharedWorkerCPUs();
+
+    /**
+     * @brief Tests that the ConfigureScheduler method derives the GAM dependencies from the signals
+     */
+    bool TestConfigureScheduler();
+
+    /**
+     * @brief Tests that the ConfigureScheduler method allows the workers to execute more than one real-time thread of a state
+     */
+    bool TestConfigureScheduler_ParallelThreads();
+
+    /**
+     * @brief Tests that the ConfigureScheduler method fails if a real-time thread shares a CPU with the workers
+     */
+    bool TestConfigureScheduler_False_WorkerCPUs();
+
+    /**
+     * @brief Tests that the ConfigureScheduler method fails if a real-time thread does not define its CPUs (i.e. may run on the WorkerCPUs)
+     */
+    bool TestConfigureScheduler_False_UndefinedCPUs();
+
+    /**
+     * @brief Tests that the GAMs are executed in parallel respecting the dependencies
+     */
+    bool TestStartNextStateExecution();
+
+    /**
+     * @brief Tests that the GAMs are executed sequentially when there are no workers
+     */
+    bool TestStartNextStateExecution_NoWorkers();
+
+    /**
+     * @brief Tests that no GAM is executed before the first cycle and that all the GAMs are executed exactly once per cycle,
+     * also when the workers are shared by two real-time threads
+     */
+    bool TestStartNextStateExecution_OncePerCycle();
+
+private:
+
+    /**
+     * @brief Executes State1 for some cycles and checks that no GAM has seen an out-of-order input.
+     */
+    bool RunAndCheck(const uint32 numberOfWorkers, const bool parallelThread2 = false);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MULTICOREGAMSCHEDULERTEST_H_ */
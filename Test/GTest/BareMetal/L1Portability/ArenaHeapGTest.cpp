@@ -0,0 +1,82 @@
+/**
+ * @file ArenaHeapGTest.cpp
+ * @brief Source file for class ArenaHeapGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeapGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestConstructor) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestCreate) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestCreate());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestCreate_False) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestCreate_False());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestMalloc) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestMalloc());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestFree) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRealloc) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRealloc());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestDuplicate) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestReset) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestReset());
+}
@@ -62,6 +62,18 @@ TEST(BareMetal_L1Portability_AtomicGTest,Int32TestTestAndSet) {
     ASSERT_TRUE(int32Test.TestTestAndSet());
 }
 
+TEST(BareMetal_L1Portability_AtomicGTest,Int32TestCompareAndSwap) {
+    int32 testValue = 32;
+    AtomicTest<int32> int32Test(testValue);
+    ASSERT_TRUE(int32Test.TestCompareAndSwap());
+}
+
+TEST(BareMetal_L1Portability_AtomicGTest,Int64TestCompareAndSwap) {
+    int64 testValue = 0x123456789LL;
+    AtomicTest<int64> int64Test(testValue);
+    ASSERT_TRUE(int64Test.TestCompareAndSwap());
+}
+
 TEST(BareMetal_L1Portability_AtomicGTest,Int32TestBoundaryIncrement) {
     int32 testValue = 32;
     AtomicTest<int32> int32Test(testValue);
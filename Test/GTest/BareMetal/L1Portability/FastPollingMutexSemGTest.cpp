@@ -152,6 +152,46 @@ TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestLocked) {
     ASSERT_TRUE(mutextest.TestLocked());
 }
 
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestCreateNoLockAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestCreateAdaptive(false));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestCreateLockAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestCreateAdaptive(true));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptive(32, TTInfiniteWait));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockWithFiniteTimeoutAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptive(32, 10000000));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockErrorCodeAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockErrorCodeAdaptive());
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastUnLockAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastUnLockAdaptive());
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptive_Contention) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptive_Contention(8));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastTryLockAdaptive_Parked) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastTryLockAdaptive_Parked());
+}
+
 TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestRecursive) {
     FastPollingMutexSemTest mutextest;
     ASSERT_TRUE(mutextest.TestRecursive());
@@ -0,0 +1,72 @@
+/**
+ * @file MemoryLockGTest.cpp
+ * @brief Source file for class MemoryLockGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryLockGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryLockTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestLock_False_NULL) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestLock_False_NULL());
+}
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestLockUnlock) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestLockUnlock());
+}
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestPreFault) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestPreFault());
+}
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestTouch) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestTouch());
+}
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestTouch_ReadOnly) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestTouch_ReadOnly());
+}
+
+TEST(BareMetal_L1Portability_MemoryLockGTest,TestLockAllUnlockAll) {
+    MemoryLockTest test;
+    ASSERT_TRUE(test.TestLockAllUnlockAll());
+}
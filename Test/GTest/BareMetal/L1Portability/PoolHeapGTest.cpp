@@ -0,0 +1,102 @@
+/**
+ * @file PoolHeapGTest.cpp
+ * @brief Source file for class PoolHeapGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class PoolHeapGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "PoolHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestConstructor) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestCreate) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestCreate());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestCreate_False_Twice) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestCreate_False_Twice());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestCreate_False_Parameters) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestCreate_False_Parameters());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestDestructor) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestDestructor());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestMalloc) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestMalloc());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestMalloc_Exhausted) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Exhausted());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestFree) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestRealloc) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestRealloc());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestDuplicate) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestCreateObject) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestCreateObject());
+}
+
+TEST(BareMetal_L1Portability_PoolHeapGTest,TestMallocFree_Threads) {
+    PoolHeapTest test;
+    ASSERT_TRUE(test.TestMallocFree_Threads());
+}
@@ -70,6 +70,16 @@ TEST(BareMetal_L1Portability_SleepGTest,TestSleepSemiBusy) {
     ASSERT_TRUE(sleepTest.TestSemiBusy(0.5, 0.2));
 }
 
+TEST(BareMetal_L1Portability_SleepGTest,TestUntilCounter) {
+    SleepTest sleepTest;
+    ASSERT_TRUE(sleepTest.TestUntilCounter(0.1));
+}
+
+TEST(BareMetal_L1Portability_SleepGTest,TestUntilCounter_Past) {
+    SleepTest sleepTest;
+    ASSERT_TRUE(sleepTest.TestUntilCounter_Past());
+}
+
 TEST(BareMetal_L1Portability_SleepGTest,TestGetDateSeconds) {
     SleepTest sleepTest;
     ASSERT_TRUE(sleepTest.TestGetDateSeconds());
@@ -100,3 +100,23 @@ TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCleanUp) {
     ClassRegistryDatabaseTest classRegistryDatabaseTest;
     ASSERT_TRUE(classRegistryDatabaseTest.TestCleanUp());
 }
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_Index) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_Index());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_IndexSameName) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_IndexSameName());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestFind_IndexNullName) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestFind_IndexNullName());
+}
+
+TEST(BareMetal_L2Objects_ClassRegistryDatabaseGTest,TestCleanUp_Index) {
+    ClassRegistryDatabaseTest classRegistryDatabaseTest;
+    ASSERT_TRUE(classRegistryDatabaseTest.TestCleanUp_Index());
+}
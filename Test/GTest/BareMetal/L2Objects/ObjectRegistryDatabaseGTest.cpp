@@ -68,3 +68,38 @@ TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestGetClassName) {
     ObjectRegistryDatabaseTest objRegTest;
     ASSERT_TRUE(objRegTest.TestGetClassName());
 }
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestSetPathIndexEnabled) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestSetPathIndexEnabled());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_PathIndex) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_PathIndex());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_PathIndexDeleteInsert) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_PathIndexDeleteInsert());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_PathIndexCollision) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_PathIndexCollision());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_PathIndexRename) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_PathIndexRename());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestPurge_PathIndex) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestPurge_PathIndex());
+}
+
+TEST(BareMetal_L2Objects_ObjectRegistryDatabaseGTest,TestFind_PathIndexConcurrentDelete) {
+    ObjectRegistryDatabaseTest objRegTest;
+    ASSERT_TRUE(objRegTest.TestFind_PathIndexConcurrentDelete());
+}
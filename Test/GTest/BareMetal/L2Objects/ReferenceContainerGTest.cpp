@@ -531,6 +531,54 @@ TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestIsReferenceContainer) {
     ASSERT_TRUE(referenceContainerTest.TestIsReferenceContainer());
 }
 
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestGetModificationCounter) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestGetModificationCounter());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestSetArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestSetArrayStorage());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestInsertDelete_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestInsertDelete_ArrayStorage());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestInitialise_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ASSERT_TRUE(referenceContainerTest.TestInitialise_ArrayStorage());
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindFirstOccurrenceBranchAlwaysObjectNameFilter_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ReferenceContainerFilterObjectName filter(1, 0u, "H");
+    ASSERT_TRUE(referenceContainerTest.UseArrayStorage());
+    ASSERT_TRUE(referenceContainerTest.TestFindFirstOccurrenceBranchAlways(filter));
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindFirstOccurrenceObjectNameFilter_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ReferenceContainerFilterObjectName filter(1, 0u, "E");
+    ASSERT_TRUE(referenceContainerTest.UseArrayStorage());
+    ASSERT_TRUE(referenceContainerTest.TestFindFirstOccurrence(filter));
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindSecondOccurrenceObjectNameFilter_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ReferenceContainerFilterObjectName filter(2, 0u, "H");
+    ASSERT_TRUE(referenceContainerTest.UseArrayStorage());
+    ASSERT_TRUE(referenceContainerTest.TestFindSecondOccurrence(filter));
+}
+
+TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestFindRemoveFirstOccurrenceObjectNameFilter_ArrayStorage) {
+    ReferenceContainerTest referenceContainerTest;
+    ReferenceContainerFilterObjectName filter(1, ReferenceContainerFilterMode::RECURSIVE, "C");
+    ASSERT_TRUE(referenceContainerTest.UseArrayStorage());
+    ASSERT_TRUE(referenceContainerTest.TestFindRemoveFirstOccurrence(filter));
+}
+
 TEST(BareMetal_L2Objects_ReferenceContainerGTest,TestAddBuildToken) {
     ReferenceContainerTest referenceContainerTest;
     ASSERT_TRUE(referenceContainerTest.TestAddBuildToken());
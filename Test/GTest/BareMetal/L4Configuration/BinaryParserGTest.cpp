@@ -0,0 +1,87 @@
+/**
+ * @file BinaryParserGTest.cpp
+ * @brief Source file for class BinaryParserGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryParserGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryParserTest.h"
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestConstructor) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_StreamMemoryReference) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_StreamMemoryReference());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_Empty) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_Empty());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_False_BadMagic) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_False_BadMagic());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_False_BadVersion) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_False_BadVersion());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_False_Truncated) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_False_Truncated());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_False_InvalidRecord) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_False_InvalidRecord());
+}
+
+TEST(BareMetal_L4Configuration_BinaryParserGTest,TestParse_False_InvalidLeaf) {
+    BinaryParserTest test;
+    ASSERT_TRUE(test.TestParse_False_InvalidLeaf());
+}
+
@@ -0,0 +1,67 @@
+/**
+ * @file BinaryWriterGTest.cpp
+ * @brief Source file for class BinaryWriterGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryWriterGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BinaryWriterTest.h"
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L4Configuration_BinaryWriterGTest,TestConstructor) {
+    BinaryWriterTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L4Configuration_BinaryWriterGTest,TestWrite_Empty) {
+    BinaryWriterTest test;
+    ASSERT_TRUE(test.TestWrite_Empty());
+}
+
+TEST(BareMetal_L4Configuration_BinaryWriterGTest,TestWrite) {
+    BinaryWriterTest test;
+    ASSERT_TRUE(test.TestWrite());
+}
+
+TEST(BareMetal_L4Configuration_BinaryWriterGTest,TestWrite_NamesOnce) {
+    BinaryWriterTest test;
+    ASSERT_TRUE(test.TestWrite_NamesOnce());
+}
+
+TEST(BareMetal_L4Configuration_BinaryWriterGTest,TestWrite_CurrentNode) {
+    BinaryWriterTest test;
+    ASSERT_TRUE(test.TestWrite_CurrentNode());
+}
+
@@ -367,3 +367,13 @@ TEST(BareMetal_L4Configuration_ConfigurationDatabaseGTest,TestSetCurrentNodeAsRo
     ConfigurationDatabaseTest cdbTest;
     ASSERT_TRUE(cdbTest.TestSetCurrentNodeAsRootNode());
 }
+
+TEST(BareMetal_L4Configuration_ConfigurationDatabaseGTest,TestExportImportBinary) {
+    ConfigurationDatabaseTest cdbTest;
+    ASSERT_TRUE(cdbTest.TestExportImportBinary());
+}
+
+TEST(BareMetal_L4Configuration_ConfigurationDatabaseGTest,TestImportBinary_CurrentNode) {
+    ConfigurationDatabaseTest cdbTest;
+    ASSERT_TRUE(cdbTest.TestImportBinary_CurrentNode());
+}
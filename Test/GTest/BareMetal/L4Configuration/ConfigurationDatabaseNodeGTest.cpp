@@ -93,3 +93,18 @@ TEST(BareMetal_L4Configuration_ConfigurationDatabaseNodeGTest,TestSetParent) {
     ConfigurationDatabaseNodeTest cdbTest;
     ASSERT_TRUE(cdbTest.TestSetParent());
 }
+
+TEST(BareMetal_L4Configuration_ConfigurationDatabaseNodeGTest,TestIsIndexed) {
+    ConfigurationDatabaseNodeTest cdbTest;
+    ASSERT_TRUE(cdbTest.TestIsIndexed());
+}
+
+TEST(BareMetal_L4Configuration_ConfigurationDatabaseNodeGTest,TestInsert_SameName) {
+    ConfigurationDatabaseNodeTest cdbTest;
+    ASSERT_TRUE(cdbTest.TestInsert_SameName());
+}
+
+TEST(BareMetal_L4Configuration_ConfigurationDatabaseNodeGTest,TestFindLeaf_HashCollision) {
+    ConfigurationDatabaseNodeTest cdbTest;
+    ASSERT_TRUE(cdbTest.TestFindLeaf_HashCollision());
+}
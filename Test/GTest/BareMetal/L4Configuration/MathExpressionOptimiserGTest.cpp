@@ -0,0 +1,383 @@
+/**
+ * @file MathExpressionOptimiserGTest.cpp
+ * @brief Source file for class MathExpressionOptimiserGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionOptimiserGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MathExpressionOptimiserTest.h"
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestConstructor) {
+    MathExpressionOptimiserTest optimiserTest;
+    ASSERT_TRUE(optimiserTest.TestConstructor());
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_Twice) {
+    MathExpressionOptimiserTest optimiserTest;
+    ASSERT_TRUE(optimiserTest.TestOptimise_Twice());
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_NoOptimisation) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_ConstantFolding) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 2\n"
+                         "CONST float64 3\n"
+                         "MUL\n"
+                         "MUL\n"
+                         "WRITE ret\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "CONST float64 6.0000000000000000\n"
+                                  "MUL\n"
+                                  "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_ConstantFolding_Nested) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "CONST float64 1\n"
+                         "NEG\n"
+                         "CONST float64 0.5\n"
+                         "ADD\n"
+                         "CONST float64 4\n"
+                         "DIV\n"
+                         "SIN\n"
+                         "WRITE ret\n";
+    const char8 *expectedOutput = "CONST float64 -1.2467473338522769E-1\n"
+                                  "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_ConstantFolding_NotFolded) {
+    MathExpressionOptimiserTest optimiserTest;
+    //Typed constants, results that are not finite or zero and operators other than the arithmetic ones are not folded.
+    const char8 *input = "CONST float32 1\n"
+                         "CONST float32 2\n"
+                         "ADD\n"
+                         "WRITE A\n"
+                         "CONST float64 1\n"
+                         "CONST float64 0\n"
+                         "DIV\n"
+                         "WRITE B\n"
+                         "CONST float64 -1\n"
+                         "LOG\n"
+                         "WRITE C\n"
+                         "CONST float64 1\n"
+                         "CONST float64 1\n"
+                         "SUB\n"
+                         "WRITE D\n"
+                         "CONST float64 1\n"
+                         "CONST float64 2\n"
+                         "GT\n"
+                         "WRITE E\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_ConstantFolding_NoReassociation) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 2\n"
+                         "ADD\n"
+                         "CONST float64 3\n"
+                         "ADD\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_StrengthReduction_Square) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 2\n"
+                         "POW\n"
+                         "WRITE ret\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "READ A\n"
+                                  "MUL\n"
+                                  "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_StrengthReduction_Cube) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 3\n"
+                         "POW\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_StrengthReduction_NotReduced) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 0.5\n"
+                         "POW\n"
+                         "WRITE B\n"
+                         "READ A\n"
+                         "CONST int32 2\n"
+                         "POW\n"
+                         "WRITE C\n"
+                         "READ A\n"
+                         "READ B\n"
+                         "POW\n"
+                         "WRITE D\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_StrengthReduction_Subexpression) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "SIN\n"
+                         "CONST float64 2\n"
+                         "POW\n"
+                         "WRITE ret\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "SIN\n"
+                                  "WRITE @cse0\n"
+                                  "READ @cse0\n"
+                                  "READ @cse0\n"
+                                  "MUL\n"
+                                  "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_CommonSubexpression) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "READ C\n"
+                         "MUL\n"
+                         "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "READ C\n"
+                         "MUL\n"
+                         "DIV\n"
+                         "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "READ C\n"
+                         "MUL\n"
+                         "SUB\n"
+                         "WRITE ret\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "READ B\n"
+                                  "ADD\n"
+                                  "READ C\n"
+                                  "MUL\n"
+                                  "WRITE @cse0\n"
+                                  "READ @cse0\n"
+                                  "READ @cse0\n"
+                                  "DIV\n"
+                                  "READ @cse0\n"
+                                  "SUB\n"
+                                  "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_CommonSubexpression_NotWorth) {
+    MathExpressionOptimiserTest optimiserTest;
+    //Storing A + B would need a WRITE and two READ instead of two READ and one ADD.
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "MUL\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_CommonSubexpression_Statements) {
+    MathExpressionOptimiserTest optimiserTest;
+    //Subexpressions are not shared between statements (the second statement writes A).
+    const char8 *input = "READ A\n"
+                         "SIN\n"
+                         "READ A\n"
+                         "SIN\n"
+                         "ADD\n"
+                         "WRITE A\n"
+                         "READ A\n"
+                         "SIN\n"
+                         "READ A\n"
+                         "SIN\n"
+                         "SUB\n"
+                         "WRITE B\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "SIN\n"
+                                  "WRITE @cse0\n"
+                                  "READ @cse0\n"
+                                  "READ @cse0\n"
+                                  "ADD\n"
+                                  "WRITE A\n"
+                                  "READ A\n"
+                                  "SIN\n"
+                                  "WRITE @cse1\n"
+                                  "READ @cse1\n"
+                                  "READ @cse1\n"
+                                  "SUB\n"
+                                  "WRITE B\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_CommonSubexpression_VariableName) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ @cse0\n"
+                         "EXP\n"
+                         "READ @cse0\n"
+                         "EXP\n"
+                         "MUL\n"
+                         "WRITE @cse1\n";
+    const char8 *expectedOutput = "READ @cse0\n"
+                                  "EXP\n"
+                                  "WRITE @cse2\n"
+                                  "READ @cse2\n"
+                                  "READ @cse2\n"
+                                  "MUL\n"
+                                  "WRITE @cse1\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_UnknownInstruction) {
+    MathExpressionOptimiserTest optimiserTest;
+    //Only the statements with unknown instructions and the code after the last WRITE are copied unchanged.
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "MEAN\n"
+                         "CONST float64 1\n"
+                         "CONST float64 1\n"
+                         "ADD\n"
+                         "ADD\n"
+                         "WRITE C\n"
+                         "CONST float64 1\n"
+                         "CONST float64 1\n"
+                         "ADD\n"
+                         "WRITE D\n"
+                         "READ A\n"
+                         "CONST float64 1\n"
+                         "CONST float64 1\n"
+                         "ADD\n";
+    const char8 *expectedOutput = "READ A\n"
+                                  "READ B\n"
+                                  "MEAN\n"
+                                  "CONST float64 1\n"
+                                  "CONST float64 1\n"
+                                  "ADD\n"
+                                  "ADD\n"
+                                  "WRITE C\n"
+                                  "CONST float64 2.0000000000000000\n"
+                                  "WRITE D\n"
+                                  "READ A\n"
+                                  "CONST float64 1\n"
+                                  "CONST float64 1\n"
+                                  "ADD\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_InvalidStatement) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "WRITE C\n"
+                         "WRITE D\n"
+                         "ADD\n"
+                         "WRITE E\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise(input, input));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_SameResults_Folding) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 0.1\n"
+                         "CONST float64 0.2\n"
+                         "ADD\n"
+                         "CONST float64 3\n"
+                         "LOG\n"
+                         "CONST float64 7\n"
+                         "DIV\n"
+                         "EXP\n"
+                         "MUL\n"
+                         "ADD\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise_SameResults(input, 1.7));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_SameResults_StrengthReduction) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "CONST float64 2\n"
+                         "POW\n"
+                         "READ A\n"
+                         "CONST float64 3\n"
+                         "POW\n"
+                         "SUB\n"
+                         "WRITE ret\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise_SameResults(input, 1.1));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionOptimiserGTest,TestOptimise_SameResults_CommonSubexpression) {
+    MathExpressionOptimiserTest optimiserTest;
+    const char8 *input = "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "SIN\n"
+                         "READ C\n"
+                         "MUL\n"
+                         "READ A\n"
+                         "READ B\n"
+                         "ADD\n"
+                         "SIN\n"
+                         "READ D\n"
+                         "MUL\n"
+                         "ADD\n"
+                         "WRITE ret\n"
+                         "READ ret\n"
+                         "COS\n"
+                         "READ ret\n"
+                         "COS\n"
+                         "GT\n"
+                         "WRITE flag\n";
+    ASSERT_TRUE(optimiserTest.TestOptimise_SameResults(input, 0.3));
+}
@@ -704,6 +704,49 @@ TEST(BareMetal_L4Configuration_MathExpressionParserGTest,TestExpression_Multiple
     ASSERT_TRUE(parserTest.TestExpression(expression, expectedOutput));
 }
 
+TEST(BareMetal_L4Configuration_MathExpressionParserGTest,TestExpression_Optimised)
+{
+    MathExpressionParserTest parserTest;
+    
+    const char8* expression     = "ret = A * (2 * 3) + pow(sin(B), 2);";
+    const char8* expectedOutput = "READ A\n"
+                                  "CONST float64 6.0000000000000000\n"
+                                  "MUL\n"
+                                  "READ B\n"
+                                  "SIN\n"
+                                  "WRITE @cse0\n"
+                                  "READ @cse0\n"
+                                  "READ @cse0\n"
+                                  "MUL\n"
+                                  "ADD\n"
+                                  "WRITE ret\n";
+            
+    ASSERT_TRUE(parserTest.TestExpression(expression, expectedOutput));
+}
+
+TEST(BareMetal_L4Configuration_MathExpressionParserGTest,TestExpression_Optimised_Statements)
+{
+    MathExpressionParserTest parserTest;
+    
+    const char8* expression     = "ret1 = sin(A) * sin(A); ret2 = cos(A) * cos(A);";
+    const char8* expectedOutput = "READ A\n"
+                                  "SIN\n"
+                                  "WRITE @cse0\n"
+                                  "READ @cse0\n"
+                                  "READ @cse0\n"
+                                  "MUL\n"
+                                  "WRITE ret1\n"
+                                  "READ A\n"
+                                  "COS\n"
+                                  "WRITE @cse1\n"
+                                  "READ @cse1\n"
+                                  "READ @cse1\n"
+                                  "MUL\n"
+                                  "WRITE ret2\n";
+            
+    ASSERT_TRUE(parserTest.TestExpression(expression, expectedOutput));
+}
+
 TEST(BareMetal_L4Configuration_MathExpressionParserGTest,TestExpressionError_Assignment_NoStatement)
 {
     MathExpressionParserTest parserTest;
@@ -369,6 +369,59 @@ TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_SafeMode_Faile
     ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::InternalSetupError, RuntimeEvaluator::safeMode));
 }
 
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedCode) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedCode());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch(1000u));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_OneBlock) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch(runtimeEvaluatorBatchSize));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_OneSample) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch(1u));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_NoSamples) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch(0u));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_OutOfRange) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_OutOfRange());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestInternalVariables) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestInternalVariables());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_FastMode_FailedCastOutOfRange) {
+    
+    RuntimeEvaluatorTest evaluatorTest;
+    CCString rpnCode = "READ A\n"
+                       "CAST uint8\n"
+                       "WRITE ret1\n"
+    ;
+    
+    float32 A = 1000;
+    uint8 ret1;
+    
+    evaluatorTest.SetTestInputVariable("A", Float32Bit, &A, 0);
+    
+    evaluatorTest.SetTestOutputVariable("ret1", UnsignedInteger8Bit, &ret1, 0);
+    
+    ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::OutOfRange));
+}
+
 TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_SafeMode_FailedGeneralExecutionError) {
     
     TypeDescriptor types[] = {Float32Bit, Float32Bit};
@@ -728,3 +728,13 @@ TEST(BareMetal_L4Configuration_StandardParserGTest,TestStandardCast) {
     StandardParserTest parserTest;
     ASSERT_TRUE(parserTest.TestStandardCast());
 }
+
+TEST(BareMetal_L4Configuration_StandardParserGTest,TestParse_StreamMemoryReference) {
+    StandardParserTest parserTest;
+    ASSERT_TRUE(parserTest.TestParse_StreamMemoryReference());
+}
+
+TEST(BareMetal_L4Configuration_StandardParserGTest,TestParseErrors_StreamMemoryReference) {
+    StandardParserTest parserTest;
+    ASSERT_TRUE(parserTest.TestParseErrors_StreamMemoryReference());
+}
@@ -80,3 +80,83 @@ TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerErrorProcessFunction) {
     LoggerTest target;
     ASSERT_TRUE(target.TestLoggerErrorProcessFunction());
 }
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetDeferredFormatting) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetDeferredFormatting());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestIsDeferredFormatting) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestIsDeferredFormatting());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestDeferredFormatting_Values) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestDeferredFormatting_Values());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestDeferredFormatting_NotDeferred) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestDeferredFormatting_NotDeferred());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestDeferredFormatting_OtherErrorProcessFunction) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestDeferredFormatting_OtherErrorProcessFunction());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetNotifier) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetNotifier());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetNotifier_WaitLogEntryAdded) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetNotifier_WaitLogEntryAdded());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetNotifier) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetNotifier());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestSetRateLimit) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestSetRateLimit());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetRateLimit) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetRateLimit());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetRateLimitPeriod) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetRateLimitPeriod());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestAcceptLogEntry_CallSites) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestAcceptLogEntry_CallSites());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestRateLimit_Summary) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestRateLimit_Summary());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetNumberOfSuppressedLogs) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetNumberOfSuppressedLogs());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestRateLimit_Concurrent) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestRateLimit_Concurrent());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetNumberOfDroppedLogs) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetNumberOfDroppedLogs());
+}
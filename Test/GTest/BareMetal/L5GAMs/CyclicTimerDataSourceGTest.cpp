@@ -0,0 +1,106 @@
+/**
+ * @file CyclicTimerDataSourceGTest.cpp
+ * @brief Source file for class CyclicTimerDataSourceGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CyclicTimerDataSourceGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CyclicTimerDataSourceTest.h"
+
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestConstructor) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestInitialise) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestInitialise_False_AdaptiveSpin) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_AdaptiveSpin());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSetConfiguredDatabase) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSetConfiguredDatabase_False_NoFrequency) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NoFrequency());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSetConfiguredDatabase_False_SignalType) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_SignalType());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSetConfiguredDatabase_False_NumberOfSignals) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfSignals());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSynchronise) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSynchronise_Overrun) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_Overrun());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestSynchronise_NoAdaptiveSpin) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_NoAdaptiveSpin());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestGetBrokerName) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestGetOutputBrokers) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestGetOutputBrokers());
+}
+
+TEST(BareMetal_L5GAMs_CyclicTimerDataSourceGTest,TestPrepareNextState) {
+    CyclicTimerDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
@@ -95,6 +95,11 @@ TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestAllocateMemory) {
     ASSERT_TRUE(test.TestAllocateMemory());
 }
 
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestPreFaultMemory) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestPreFaultMemory());
+}
+
 TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetBrokerName) {
     GAMDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -76,3 +76,28 @@ TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_False) {
     GAMSchedulerITest test;
     ASSERT_TRUE(test.TestExecuteSingleCycle_False());
 }
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExportData_ExecutionTimeHistograms) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExportData_ExecutionTimeHistograms());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExportData_ExecutionTimeHistograms_States) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExportData_ExecutionTimeHistograms_States());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestInitialise_False_ExecutionTimeOverrunSec) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestInitialise_False_ExecutionTimeOverrunSec());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_TimeUnitTicks) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExecuteSingleCycle_TimeUnitTicks());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestTicksToMicroSeconds) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestTicksToMicroSeconds());
+}
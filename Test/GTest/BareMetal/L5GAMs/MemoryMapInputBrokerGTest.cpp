@@ -65,3 +65,8 @@ TEST(BareMetal_L5GAMs_MemoryMapInputBrokerGTest,TestExecute_MultiStateBuffer) {
     MemoryMapInputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_MultiStateBuffer());
 }
+
+TEST(BareMetal_L5GAMs_MemoryMapInputBrokerGTest,TestExecute_CoalescedCopies) {
+    MemoryMapInputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_CoalescedCopies());
+}
@@ -57,6 +57,11 @@ TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestInit1) {
     ASSERT_TRUE(test.TestInit1());
 }
 
+TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestInit_NoCopyRuns) {
+    MemoryMapMultiBufferBrokerTest test;
+    ASSERT_TRUE(test.TestInit_NoCopyRuns());
+}
+
 TEST(BareMetal_L5GAMs_MemoryMapMultiBufferBrokerGTest,TestCopyInputs) {
     MemoryMapMultiBufferBrokerTest test;
     ASSERT_TRUE(test.TestCopyInputs());
@@ -635,3 +635,13 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestStructure
     RealTimeApplicationConfigurationBuilderTest test;
     ASSERT_TRUE(test.TestStructureDefaultArrayMemberString());
 }
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestConfigure_ManyFunctionsAndDataSources) {
+    RealTimeApplicationConfigurationBuilderTest test;
+    ASSERT_TRUE(test.TestConfigure_ManyFunctionsAndDataSources(false));
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationConfigurationBuilderGTest,TestConfigure_ManyFunctionsAndDataSources_FromConfig) {
+    RealTimeApplicationConfigurationBuilderTest test;
+    ASSERT_TRUE(test.TestConfigure_ManyFunctionsAndDataSources(true));
+}
@@ -164,3 +164,13 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestStopCurrentStateExecution_Mes
     RealTimeApplicationTest test;
     ASSERT_TRUE(test.TestStopCurrentStateExecution_Message());
 }
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestGetMemoryFootprint) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestGetMemoryFootprint());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestIsMemoryLocked) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestIsMemoryLocked());
+}
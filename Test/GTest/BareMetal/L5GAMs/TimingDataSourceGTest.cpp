@@ -54,3 +54,18 @@ TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestSetConfiguredDatabase_False_Prod
     TimingDataSourceTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_False_Producers());
 }
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestInitialise_TimeUnit) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_TimeUnit());
+}
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestInitialise_False_TimeUnit) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_TimeUnit());
+}
+
+TEST(BareMetal_L5GAMs_TimingDataSourceGTest,TestSetConfiguredDatabase_TimeUnitTicks) {
+    TimingDataSourceTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_TimeUnitTicks());
+}
@@ -64,6 +64,11 @@ TEST(BareMetal_L6App_LoaderGTest,TestConfigure_Xml) {
     ASSERT_TRUE(test.TestConfigure_Xml());
 }
 
+TEST(BareMetal_L6App_LoaderGTest,TestConfigure_Bin) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_Bin());
+}
+
 TEST(BareMetal_L6App_LoaderGTest,TestConfigure_False_BadParser) {
     LoaderTest test;
     ASSERT_TRUE(test.TestConfigure_False_BadParser());
@@ -193,3 +193,13 @@ TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWrite) {
 
     ASSERT_TRUE(basicUDPSocketTest.TestWrite(table));
 }
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteDatagrams) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteDatagrams());
+}
+
+TEST(FileSystem_L1Portability_BasicUDPSocketGTest,TestWriteDatagrams_InvalidSocket) {
+    BasicUDPSocketTest basicUDPSocketTest;
+    ASSERT_TRUE(basicUDPSocketTest.TestWriteDatagrams_InvalidSocket());
+}
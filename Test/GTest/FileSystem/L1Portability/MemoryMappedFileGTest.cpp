@@ -0,0 +1,119 @@
+/**
+ * @file MemoryMappedFileGTest.cpp
+ * @brief Source file for class MemoryMappedFileGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMappedFileGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+#include "MemoryMappedFileTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestConstructor) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpen) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpen_Resize) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpen_Resize());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpen_Allocated) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpen_Allocated());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpen_False_Size) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpen_False_Size());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpen_False_AlreadyOpen) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpen_False_AlreadyOpen());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpenReadOnly) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpenReadOnly());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestOpenReadOnly_False_NotExistent) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestOpenReadOnly_False_NotExistent());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestClose) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestClose());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestClose_False) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestClose_False());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestFlush) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestFlush());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestFlush_False_ReadOnly) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestFlush_False_ReadOnly());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestGetMemory) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestGetMemory());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestGetSize) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestGetSize());
+}
+
+TEST(FileSystem_L1Portability_MemoryMappedFileGTest,TestIsReadOnly) {
+    MemoryMappedFileTest test;
+    ASSERT_TRUE(test.TestIsReadOnly());
+}
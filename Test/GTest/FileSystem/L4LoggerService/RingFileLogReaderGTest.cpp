@@ -0,0 +1,104 @@
+/**
+ * @file RingFileLogReaderGTest.cpp
+ * @brief Source file for class RingFileLogReaderGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLogReaderGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+#include "RingFileLogReaderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestConstructor) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestOpen) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestOpen_False_NotExistent) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_NotExistent());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestOpen_False_Invalid) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_Invalid());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestOpen_False_AlreadyOpen) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_AlreadyOpen());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestClose) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestClose());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestRead) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestRead());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestRead_Empty) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestRead_Empty());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestRead_Overwritten) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestRead_Overwritten());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestRead_False_Corrupted) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestRead_False_Corrupted());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestGetSequence) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestGetSequence());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLogReaderGTest,TestGetNumberOfRecords) {
+    RingFileLogReaderTest test;
+    ASSERT_TRUE(test.TestGetNumberOfRecords());
+}
@@ -0,0 +1,104 @@
+/**
+ * @file RingFileLoggerGTest.cpp
+ * @brief Source file for class RingFileLoggerGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RingFileLoggerGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <limits.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+#include "RingFileLoggerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestConstructor) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_DefaultSize) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_DefaultSize());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_False_FileName) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_FileName());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_False_Size) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Size());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_False_Twice) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Twice());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_Append) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_Append());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestInitialise_Invalid) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_Invalid());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestConsumeLogMessage) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestConsumeLogMessage_Wrap) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Wrap());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestConsumeLogMessage_Truncate) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Truncate());
+}
+
+TEST(FileSystem_L4LoggerService_RingFileLoggerGTest,TestConsumeLogMessage_LoggerService) {
+    RingFileLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_LoggerService());
+}
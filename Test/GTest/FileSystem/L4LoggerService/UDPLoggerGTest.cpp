@@ -69,3 +69,33 @@ TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestConsumeLogMessage) {
     ASSERT_TRUE(test.TestConsumeLogMessage());
 }
 	
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestInitialise_False_MTU) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MTU());
+}
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestInitialise_False_BatchSize) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BatchSize());
+}
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestInitialise_False_BatchSize_MTU) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BatchSize_MTU());
+}
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestConsumeLogMessage_Batch) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Batch());
+}
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestConsumeLogMessage_FlushPeriod) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_FlushPeriod());
+}
+
+TEST(FileSystem_L4LoggerService_UDPLoggerGTest, TestFlush) {
+    UDPLoggerTest test;
+    ASSERT_TRUE(test.TestFlush());
+}
@@ -99,3 +99,43 @@ TEST(Scheduler_L3Services_LoggerServiceGTest,TestExecute) {
     LoggerServiceTest target;
     ASSERT_TRUE(target.TestExecute());
 }
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestInitialise_False_DeferredFormatting) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestInitialise_False_DeferredFormatting());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestExecute_DeferredFormatting) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestExecute_DeferredFormatting());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestIsDeferredFormatting) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestIsDeferredFormatting());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestLogEntryAdded) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestLogEntryAdded());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestExecute_Burst) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestExecute_Burst());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestExecute_Sporadic) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestExecute_Sporadic());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestInitialise_False_RateLimitPeriod) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestInitialise_False_RateLimitPeriod());
+}
+
+TEST(Scheduler_L3Services_LoggerServiceGTest,TestGetRateLimit) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestGetRateLimit());
+}
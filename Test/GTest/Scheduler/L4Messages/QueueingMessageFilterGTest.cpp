@@ -70,3 +70,23 @@ TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestIsPermanentFilter) {
     QueueingMessageFilterTest target;
     ASSERT_TRUE(target.TestIsPermanentFilter());
 }
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestGetMessage_Wait_Timeout_Total) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestGetMessage_Wait_Timeout_Total());
+}
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestConsumeMessage_InvalidMessage) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestConsumeMessage_InvalidMessage());
+}
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestGetMessage_Order) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestGetMessage_Order());
+}
+
+TEST(Scheduler_L4Messages_QueueingMessageFilterGTest,TestConsumeMessage_MultipleProducers) {
+    QueueingMessageFilterTest target;
+    ASSERT_TRUE(target.TestConsumeMessage_MultipleProducers());
+}
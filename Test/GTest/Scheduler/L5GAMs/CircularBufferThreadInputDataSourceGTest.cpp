@@ -54,6 +54,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise_AdaptiveMutex) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_AdaptiveMutex());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestInitialise_CpuMask) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestInitialise_CpuMask());
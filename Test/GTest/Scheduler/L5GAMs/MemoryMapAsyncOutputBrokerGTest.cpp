@@ -74,6 +74,11 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_1_Buffer) {
     ASSERT_TRUE(test.TestExecute_1_Buffer());
 }
 
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_N_Buffers_NoWait) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_N_Buffers_NoWait());
+}
+
 TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_N_Buffers) {
     MemoryMapAsyncOutputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_N_Buffers());
@@ -0,0 +1,99 @@
+/**
+ * @file MultiCoreGAMSchedulerGTest.cpp
+ * @brief Source file for class MultiCoreGAMSchedulerGTest
+ * @date 17/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MultiCoreGAMSchedulerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "gtest/gtest.h"
+#include "MultiCoreGAMSchedulerTest.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestConstructor) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestInitialise) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestInitialise_False_WorkerCPUs) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WorkerCPUs());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestInitialise_False_NoWorkerCPUs) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoWorkerCPUs());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestInitialise_False_SharedWorkerCPUs) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SharedWorkerCPUs());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestConfigureScheduler) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConfigureScheduler());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestConfigureScheduler_ParallelThreads) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConfigureScheduler_ParallelThreads());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestConfigureScheduler_False_WorkerCPUs) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConfigureScheduler_False_WorkerCPUs());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestConfigureScheduler_False_UndefinedCPUs) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestConfigureScheduler_False_UndefinedCPUs());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestStartNextStateExecution) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestStartNextStateExecution_NoWorkers) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_NoWorkers());
+}
+
+TEST(Scheduler_L5GAMs_MultiCoreGAMSchedulerGTest,TestStartNextStateExecution_OncePerCycle) {
+    MultiCoreGAMSchedulerTest test;
+    ASSERT_TRUE(test.TestStartNextStateExecution_OncePerCycle());
+}